@@ -0,0 +1,178 @@
+// Do not edit
+// Generated from attr.in (see genattrs.py)
+
+GUMBO_ATTRIBUTE_ABBR,
+GUMBO_ATTRIBUTE_ACCEPT,
+GUMBO_ATTRIBUTE_ACCEPT_CHARSET,
+GUMBO_ATTRIBUTE_ACCESSKEY,
+GUMBO_ATTRIBUTE_ACTION,
+GUMBO_ATTRIBUTE_ALIGN,
+GUMBO_ATTRIBUTE_ALINK,
+GUMBO_ATTRIBUTE_ALLOW,
+GUMBO_ATTRIBUTE_ALLOWFULLSCREEN,
+GUMBO_ATTRIBUTE_ALT,
+GUMBO_ATTRIBUTE_ARCHIVE,
+GUMBO_ATTRIBUTE_ASYNC,
+GUMBO_ATTRIBUTE_AUTOCAPITALIZE,
+GUMBO_ATTRIBUTE_AUTOCOMPLETE,
+GUMBO_ATTRIBUTE_AUTOFOCUS,
+GUMBO_ATTRIBUTE_AUTOPLAY,
+GUMBO_ATTRIBUTE_AXIS,
+GUMBO_ATTRIBUTE_BACKGROUND,
+GUMBO_ATTRIBUTE_BGCOLOR,
+GUMBO_ATTRIBUTE_BORDER,
+GUMBO_ATTRIBUTE_CELLPADDING,
+GUMBO_ATTRIBUTE_CELLSPACING,
+GUMBO_ATTRIBUTE_CHAR,
+GUMBO_ATTRIBUTE_CHAROFF,
+GUMBO_ATTRIBUTE_CHARSET,
+GUMBO_ATTRIBUTE_CHECKED,
+GUMBO_ATTRIBUTE_CITE,
+GUMBO_ATTRIBUTE_CLASS,
+GUMBO_ATTRIBUTE_CLASSID,
+GUMBO_ATTRIBUTE_CLEAR,
+GUMBO_ATTRIBUTE_CODE,
+GUMBO_ATTRIBUTE_CODEBASE,
+GUMBO_ATTRIBUTE_CODETYPE,
+GUMBO_ATTRIBUTE_COLOR,
+GUMBO_ATTRIBUTE_COLS,
+GUMBO_ATTRIBUTE_COLSPAN,
+GUMBO_ATTRIBUTE_COMPACT,
+GUMBO_ATTRIBUTE_CONTENT,
+GUMBO_ATTRIBUTE_CONTENTEDITABLE,
+GUMBO_ATTRIBUTE_CONTROLS,
+GUMBO_ATTRIBUTE_COORDS,
+GUMBO_ATTRIBUTE_CROSSORIGIN,
+GUMBO_ATTRIBUTE_DATA,
+GUMBO_ATTRIBUTE_DATETIME,
+GUMBO_ATTRIBUTE_DECLARE,
+GUMBO_ATTRIBUTE_DECODING,
+GUMBO_ATTRIBUTE_DEFAULT,
+GUMBO_ATTRIBUTE_DEFER,
+GUMBO_ATTRIBUTE_DEFINITIONURL,
+GUMBO_ATTRIBUTE_DIR,
+GUMBO_ATTRIBUTE_DIRNAME,
+GUMBO_ATTRIBUTE_DISABLED,
+GUMBO_ATTRIBUTE_DOWNLOAD,
+GUMBO_ATTRIBUTE_DRAGGABLE,
+GUMBO_ATTRIBUTE_ENCODING,
+GUMBO_ATTRIBUTE_ENCTYPE,
+GUMBO_ATTRIBUTE_ENTERKEYHINT,
+GUMBO_ATTRIBUTE_FACE,
+GUMBO_ATTRIBUTE_FOR,
+GUMBO_ATTRIBUTE_FORM,
+GUMBO_ATTRIBUTE_FORMACTION,
+GUMBO_ATTRIBUTE_FORMENCTYPE,
+GUMBO_ATTRIBUTE_FORMMETHOD,
+GUMBO_ATTRIBUTE_FORMNOVALIDATE,
+GUMBO_ATTRIBUTE_FORMTARGET,
+GUMBO_ATTRIBUTE_FRAME,
+GUMBO_ATTRIBUTE_FRAMEBORDER,
+GUMBO_ATTRIBUTE_HEADERS,
+GUMBO_ATTRIBUTE_HEIGHT,
+GUMBO_ATTRIBUTE_HIDDEN,
+GUMBO_ATTRIBUTE_HIGH,
+GUMBO_ATTRIBUTE_HREF,
+GUMBO_ATTRIBUTE_HREFLANG,
+GUMBO_ATTRIBUTE_HSPACE,
+GUMBO_ATTRIBUTE_HTTP_EQUIV,
+GUMBO_ATTRIBUTE_ID,
+GUMBO_ATTRIBUTE_INERT,
+GUMBO_ATTRIBUTE_INPUTMODE,
+GUMBO_ATTRIBUTE_INTEGRITY,
+GUMBO_ATTRIBUTE_IS,
+GUMBO_ATTRIBUTE_ISMAP,
+GUMBO_ATTRIBUTE_ITEMID,
+GUMBO_ATTRIBUTE_ITEMPROP,
+GUMBO_ATTRIBUTE_ITEMREF,
+GUMBO_ATTRIBUTE_ITEMSCOPE,
+GUMBO_ATTRIBUTE_ITEMTYPE,
+GUMBO_ATTRIBUTE_KIND,
+GUMBO_ATTRIBUTE_LABEL,
+GUMBO_ATTRIBUTE_LANG,
+GUMBO_ATTRIBUTE_LANGUAGE,
+GUMBO_ATTRIBUTE_LINK,
+GUMBO_ATTRIBUTE_LIST,
+GUMBO_ATTRIBUTE_LOADING,
+GUMBO_ATTRIBUTE_LONGDESC,
+GUMBO_ATTRIBUTE_LOOP,
+GUMBO_ATTRIBUTE_LOW,
+GUMBO_ATTRIBUTE_MANIFEST,
+GUMBO_ATTRIBUTE_MARGINHEIGHT,
+GUMBO_ATTRIBUTE_MARGINWIDTH,
+GUMBO_ATTRIBUTE_MAX,
+GUMBO_ATTRIBUTE_MAXLENGTH,
+GUMBO_ATTRIBUTE_MEDIA,
+GUMBO_ATTRIBUTE_METHOD,
+GUMBO_ATTRIBUTE_MIN,
+GUMBO_ATTRIBUTE_MINLENGTH,
+GUMBO_ATTRIBUTE_MULTIPLE,
+GUMBO_ATTRIBUTE_MUTED,
+GUMBO_ATTRIBUTE_NAME,
+GUMBO_ATTRIBUTE_NOHREF,
+GUMBO_ATTRIBUTE_NOMODULE,
+GUMBO_ATTRIBUTE_NONCE,
+GUMBO_ATTRIBUTE_NORESIZE,
+GUMBO_ATTRIBUTE_NOSHADE,
+GUMBO_ATTRIBUTE_NOVALIDATE,
+GUMBO_ATTRIBUTE_NOWRAP,
+GUMBO_ATTRIBUTE_ONCLICK,
+GUMBO_ATTRIBUTE_ONERROR,
+GUMBO_ATTRIBUTE_ONLOAD,
+GUMBO_ATTRIBUTE_OPEN,
+GUMBO_ATTRIBUTE_OPTIMUM,
+GUMBO_ATTRIBUTE_PATTERN,
+GUMBO_ATTRIBUTE_PING,
+GUMBO_ATTRIBUTE_PLACEHOLDER,
+GUMBO_ATTRIBUTE_PLAYSINLINE,
+GUMBO_ATTRIBUTE_POSTER,
+GUMBO_ATTRIBUTE_PRELOAD,
+GUMBO_ATTRIBUTE_PROFILE,
+GUMBO_ATTRIBUTE_PROMPT,
+GUMBO_ATTRIBUTE_READONLY,
+GUMBO_ATTRIBUTE_REFERRERPOLICY,
+GUMBO_ATTRIBUTE_REL,
+GUMBO_ATTRIBUTE_REQUIRED,
+GUMBO_ATTRIBUTE_REV,
+GUMBO_ATTRIBUTE_REVERSED,
+GUMBO_ATTRIBUTE_ROWS,
+GUMBO_ATTRIBUTE_ROWSPAN,
+GUMBO_ATTRIBUTE_RULES,
+GUMBO_ATTRIBUTE_SANDBOX,
+GUMBO_ATTRIBUTE_SCHEME,
+GUMBO_ATTRIBUTE_SCOPE,
+GUMBO_ATTRIBUTE_SCROLLING,
+GUMBO_ATTRIBUTE_SELECTED,
+GUMBO_ATTRIBUTE_SHAPE,
+GUMBO_ATTRIBUTE_SIZE,
+GUMBO_ATTRIBUTE_SIZES,
+GUMBO_ATTRIBUTE_SLOT,
+GUMBO_ATTRIBUTE_SPAN,
+GUMBO_ATTRIBUTE_SPELLCHECK,
+GUMBO_ATTRIBUTE_SRC,
+GUMBO_ATTRIBUTE_SRCDOC,
+GUMBO_ATTRIBUTE_SRCLANG,
+GUMBO_ATTRIBUTE_SRCSET,
+GUMBO_ATTRIBUTE_STANDBY,
+GUMBO_ATTRIBUTE_START,
+GUMBO_ATTRIBUTE_STEP,
+GUMBO_ATTRIBUTE_STYLE,
+GUMBO_ATTRIBUTE_SUMMARY,
+GUMBO_ATTRIBUTE_TABINDEX,
+GUMBO_ATTRIBUTE_TARGET,
+GUMBO_ATTRIBUTE_TEXT,
+GUMBO_ATTRIBUTE_TITLE,
+GUMBO_ATTRIBUTE_TRANSLATE,
+GUMBO_ATTRIBUTE_TYPE,
+GUMBO_ATTRIBUTE_USEMAP,
+GUMBO_ATTRIBUTE_VALIGN,
+GUMBO_ATTRIBUTE_VALUE,
+GUMBO_ATTRIBUTE_VALUETYPE,
+GUMBO_ATTRIBUTE_VERSION,
+GUMBO_ATTRIBUTE_VIEWBOX,
+GUMBO_ATTRIBUTE_VLINK,
+GUMBO_ATTRIBUTE_VSPACE,
+GUMBO_ATTRIBUTE_WIDTH,
+GUMBO_ATTRIBUTE_WRAP,
+GUMBO_ATTRIBUTE_XMLNS,
+GUMBO_ATTRIBUTE_XMLNS_XLINK,
@@ -0,0 +1,4 @@
+// Do not edit
+// Generated from attr.in (see genattrs.py)
+
+4, 6, 14, 9, 6, 5, 5, 5, 15, 3, 7, 5, 14, 12, 9, 8, 4, 10, 7, 6, 11, 11, 4, 7, 7, 7, 4, 5, 7, 5, 4, 8, 8, 5, 4, 7, 7, 7, 15, 8, 6, 11, 4, 8, 7, 8, 7, 5, 13, 3, 7, 8, 8, 9, 8, 7, 12, 4, 3, 4, 10, 11, 10, 14, 10, 5, 11, 7, 6, 6, 4, 4, 8, 6, 10, 2, 5, 9, 9, 2, 5, 6, 8, 7, 9, 8, 4, 5, 4, 8, 4, 4, 7, 8, 4, 3, 8, 12, 11, 3, 9, 5, 6, 3, 9, 8, 5, 4, 6, 8, 5, 8, 7, 10, 6, 7, 7, 6, 4, 7, 7, 4, 11, 11, 6, 7, 7, 6, 8, 14, 3, 8, 3, 8, 4, 7, 5, 7, 6, 5, 9, 8, 5, 4, 5, 4, 4, 10, 3, 6, 7, 6, 7, 5, 4, 5, 7, 8, 6, 4, 5, 9, 4, 6, 6, 5, 9, 7, 7, 5, 6, 5, 4, 5, 11, 
@@ -0,0 +1,178 @@
+// Do not edit
+// Generated from attr.in (see genattrs.py)
+
+"abbr",
+"accept",
+"accept-charset",
+"accesskey",
+"action",
+"align",
+"alink",
+"allow",
+"allowfullscreen",
+"alt",
+"archive",
+"async",
+"autocapitalize",
+"autocomplete",
+"autofocus",
+"autoplay",
+"axis",
+"background",
+"bgcolor",
+"border",
+"cellpadding",
+"cellspacing",
+"char",
+"charoff",
+"charset",
+"checked",
+"cite",
+"class",
+"classid",
+"clear",
+"code",
+"codebase",
+"codetype",
+"color",
+"cols",
+"colspan",
+"compact",
+"content",
+"contenteditable",
+"controls",
+"coords",
+"crossorigin",
+"data",
+"datetime",
+"declare",
+"decoding",
+"default",
+"defer",
+"definitionurl",
+"dir",
+"dirname",
+"disabled",
+"download",
+"draggable",
+"encoding",
+"enctype",
+"enterkeyhint",
+"face",
+"for",
+"form",
+"formaction",
+"formenctype",
+"formmethod",
+"formnovalidate",
+"formtarget",
+"frame",
+"frameborder",
+"headers",
+"height",
+"hidden",
+"high",
+"href",
+"hreflang",
+"hspace",
+"http-equiv",
+"id",
+"inert",
+"inputmode",
+"integrity",
+"is",
+"ismap",
+"itemid",
+"itemprop",
+"itemref",
+"itemscope",
+"itemtype",
+"kind",
+"label",
+"lang",
+"language",
+"link",
+"list",
+"loading",
+"longdesc",
+"loop",
+"low",
+"manifest",
+"marginheight",
+"marginwidth",
+"max",
+"maxlength",
+"media",
+"method",
+"min",
+"minlength",
+"multiple",
+"muted",
+"name",
+"nohref",
+"nomodule",
+"nonce",
+"noresize",
+"noshade",
+"novalidate",
+"nowrap",
+"onclick",
+"onerror",
+"onload",
+"open",
+"optimum",
+"pattern",
+"ping",
+"placeholder",
+"playsinline",
+"poster",
+"preload",
+"profile",
+"prompt",
+"readonly",
+"referrerpolicy",
+"rel",
+"required",
+"rev",
+"reversed",
+"rows",
+"rowspan",
+"rules",
+"sandbox",
+"scheme",
+"scope",
+"scrolling",
+"selected",
+"shape",
+"size",
+"sizes",
+"slot",
+"span",
+"spellcheck",
+"src",
+"srcdoc",
+"srclang",
+"srcset",
+"standby",
+"start",
+"step",
+"style",
+"summary",
+"tabindex",
+"target",
+"text",
+"title",
+"translate",
+"type",
+"usemap",
+"valign",
+"value",
+"valuetype",
+"version",
+"viewbox",
+"vlink",
+"vspace",
+"width",
+"wrap",
+"xmlns",
+"xmlns:xlink",
@@ -17,37 +17,141 @@
 #include "attribute.h"
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "pool.h"
 #include "util.h"
 #include "vector.h"
 
 struct GumboInternalParser;
 
+static const char* const kGumboAttributeNames[] = {
+#include "attr_strings.h"
+    "",  // ATTRIBUTE_UNKNOWN
+    "",  // ATTRIBUTE_LAST
+};
+
+static const uint8_t kGumboAttributeSizes[] = {
+#include "attr_sizes.h"
+    0,  // ATTRIBUTE_UNKNOWN
+    0,  // ATTRIBUTE_LAST
+};
+
+#include "attr_perf.h"
+
+// FNV-1a over the lowercased name, then a per-bucket displacement mixed in to
+// pick the slot.  genattrs.py has to compute exactly the same thing.
+static inline uint32_t attr_hash(const char *name, unsigned int length) {
+  uint32_t hash = 2166136261u;
+  for (unsigned int i = 0; i < length; ++i) {
+    hash = (hash ^ (unsigned char) gumbo_tolower(name[i])) * 16777619u;
+  }
+  return hash;
+}
+
+static inline uint32_t attr_slot(uint32_t hash, uint32_t displacement) {
+  return ((hash ^ (displacement * 0x9e3779b9u)) * 0x85ebca6bu) >>
+         (32 - ATTR_TABLE_BITS);
+}
+
+const char *gumbo_normalized_attribute_name(GumboAttributeName name) {
+  assert(name <= GUMBO_ATTRIBUTE_LAST);
+  return kGumboAttributeNames[name];
+}
+
+GumboAttributeName gumbo_attributen_enum(const char *name, unsigned int length) {
+  if (length == 0) {
+    return GUMBO_ATTRIBUTE_UNKNOWN;
+  }
+
+  uint32_t hash = attr_hash(name, length);
+  uint32_t bucket = hash & ((1u << ATTR_BUCKET_BITS) - 1);
+  GumboAttributeName atom = kGumboAttributeMap[attr_slot(
+      hash, kGumboAttributeDisplacements[bucket])];
+  if (atom != GUMBO_ATTRIBUTE_LAST && length == kGumboAttributeSizes[atom] &&
+      !strncasecmp(name, kGumboAttributeNames[atom], length)) {
+    return atom;
+  }
+  return GUMBO_ATTRIBUTE_UNKNOWN;
+}
+
+GumboAttributeName gumbo_attribute_enum(const char *name) {
+  return gumbo_attributen_enum(name, strlen(name));
+}
+
+GumboAttribute *gumbo_get_attribute_by_atom(
+    const GumboVector *attributes, GumboAttributeName atom) {
+  assert(atom < GUMBO_ATTRIBUTE_UNKNOWN);
+  for (unsigned int i = 0; i < attributes->length; ++i) {
+    GumboAttribute *attr = attributes->data[i];
+    if (attr->name_atom == atom) {
+      return attr;
+    }
+  }
+  return NULL;
+}
+
 GumboAttribute *gumbo_get_attribute(
     const GumboVector *attributes, const char *name) {
+  GumboAttributeName atom = gumbo_attribute_enum(name);
+  if (atom != GUMBO_ATTRIBUTE_UNKNOWN) {
+    return gumbo_get_attribute_by_atom(attributes, atom);
+  }
+
+  // An unknown name can only match another unknown name.
   for (unsigned int i = 0; i < attributes->length; ++i) {
     GumboAttribute *attr = attributes->data[i];
-    if (!strcasecmp(attr->name, name)) {
+    if (attr->name_atom == GUMBO_ATTRIBUTE_UNKNOWN &&
+        !strcasecmp(attr->name, name)) {
       return attr;
     }
   }
   return NULL;
 }
 
+const char kGumboEmptyAttributeValue[] = "";
+
+// The tokenizer points the names of known attributes at the atom table and
+// valueless attributes at kGumboEmptyAttributeValue, and a pooled attribute's
+// strings go with its pool; only individually allocated copies are freed.
+static void free_attribute_name(const GumboAttribute *attr) {
+  if (!attr->pool && attr->name != kGumboAttributeNames[attr->name_atom]) {
+    gumbo_free((void *) attr->name);
+  }
+}
+
+static void free_attribute_value(const GumboAttribute *attr) {
+  if (!attr->pool && attr->value != kGumboEmptyAttributeValue) {
+    gumbo_free((void *) attr->value);
+  }
+}
+
+void gumbo_attribute_set_name(GumboAttribute *attr, const char *name) {
+  free_attribute_name(attr);
+  attr->name = gumbo_pool_strdup(attr->pool, name);
+  attr->name_atom = gumbo_attribute_enum(name);
+}
+
 void gumbo_attribute_set_value(GumboAttribute *attr, const char *value) {
-  gumbo_free((void *) attr->value);
-  attr->value = gumbo_strdup(value);
+  free_attribute_value(attr);
+  attr->value = gumbo_pool_strdup(attr->pool, value);
   attr->original_value = kGumboEmptyString;
   attr->value_start = kGumboEmptySourcePosition;
   attr->value_end = kGumboEmptySourcePosition;
 }
 
 void gumbo_destroy_attribute(GumboAttribute *attribute) {
-  gumbo_free((void *) attribute->name);
-  gumbo_free((void *) attribute->value);
-  gumbo_free((void *) attribute);
+  free_attribute_name(attribute);
+  free_attribute_value(attribute);
+  gumbo_pool_free_attribute(attribute);
+}
+
+// Elements only ever live inside a node, whose pool their attributes share.
+static GumboPool *element_pool(const GumboElement *element) {
+  return ((const GumboNode *) ((const char *) element -
+                               offsetof(GumboNode, v)))->pool;
 }
 
 void gumbo_element_set_attribute(
@@ -56,16 +160,18 @@ void gumbo_element_set_attribute(
   GumboAttribute *attr = gumbo_get_attribute(attributes, name);
 
   if (!attr) {
-    attr = gumbo_malloc(sizeof(GumboAttribute));
+    GumboPool *pool = element_pool(element);
+    attr = gumbo_pool_alloc_attribute(pool);
     attr->value = NULL;
     attr->attr_namespace = GUMBO_ATTR_NAMESPACE_NONE;
 
-    attr->name = gumbo_strdup(name);
+    attr->name = gumbo_pool_strdup(pool, name);
+    attr->name_atom = gumbo_attribute_enum(name);
     attr->original_name = kGumboEmptyString;
     attr->name_start = kGumboEmptySourcePosition;
     attr->name_end = kGumboEmptySourcePosition;
 
-    gumbo_vector_add(attr, attributes);
+    gumbo_pool_vector_add(pool, attr, attributes);
   }
 
   gumbo_attribute_set_value(attr, value);
@@ -25,6 +25,12 @@ extern "C" {
 
 struct GumboInternalParser;
 
+// The value of attributes written without one.  It is shared rather than
+// allocated per attribute, and like the static names of known attributes (see
+// gumbo_normalized_attribute_name), never freed.
+extern const char kGumboEmptyAttributeValue[];
+
+void gumbo_attribute_set_name(GumboAttribute *attr, const char *name);
 void gumbo_attribute_set_value(GumboAttribute *attr, const char *value);
 void gumbo_destroy_attribute(GumboAttribute* attribute);
 
@@ -0,0 +1,4019 @@
+// Do not edit
+// Generated from char_ref.in (see gencharrefs.py)
+
+#define CHAR_REF_ROOT 1
+
+static const uint8_t kCharRefAlphabet[256] = {
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  1,  2,  3,  4,  5,  6,  7,  8,  0,  0,  9,  0,  0,  0,  0,
+   0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,  0,  0,  0,  0,  0,
+   0, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+  51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+// { base, check, value }
+static const CharRefTrieNode kCharRefTrie[] = {
+  { 0, 0, 0 }, { 0, 0, 0 }, { 1, 1120, 0 }, { 5171, 2, 0 },
+  { 2, 1120, 0 }, { 5172, 2, 0 }, { 5173, 4, 0 }, { 6470, 3972, 0 },
+  { 6471, 3972, 0 }, { 0, 162, 146 }, { 48, 1, 0 }, { 27, 1, 0 },
+  { 70, 1, 0 }, { 99, 1, 0 }, { 109, 1, 0 }, { 28, 1, 0 },
+  { 133, 1, 0 }, { 156, 1, 0 }, { 166, 1, 0 }, { 185, 1, 0 },
+  { 192, 1, 0 }, { 215, 1, 0 }, { 235, 1, 0 }, { 242, 1, 0 },
+  { 263, 1, 0 }, { 285, 1, 0 }, { 75, 1, 0 }, { 311, 1, 0 },
+  { 333, 1, 0 }, { 363, 1, 0 }, { 373, 1, 0 }, { 395, 1, 0 },
+  { 141, 1, 0 }, { 92, 1, 0 }, { 420, 1, 0 }, { 401, 1, 0 },
+  { 431, 1, 0 }, { 454, 1, 0 }, { 473, 1, 0 }, { 505, 1, 0 },
+  { 534, 1, 0 }, { 556, 1, 0 }, { 577, 1, 0 }, { 601, 1, 0 },
+  { 608, 1, 0 }, { 286, 1, 0 }, { 629, 1, 0 }, { 667, 1, 0 },
+  { 689, 1, 0 }, { 710, 1, 0 }, { 734, 1, 0 }, { 756, 1, 0 },
+  { 312, 1, 0 }, { 791, 1, 0 }, { 815, 1, 0 }, { 841, 1, 0 },
+  { 873, 1, 0 }, { 894, 1, 0 }, { 635, 1, 0 }, { 913, 1, 0 },
+  { 936, 1, 0 }, { 955, 1, 0 }, { 17, 10, 0 }, { 120, 11, 0 },
+  { 1852, 62, 0 }, { 70, 11, 0 }, { 270, 15, 0 }, { 146, 11, 0 },
+  { 88, 11, 0 }, { 280, 15, 0 }, { 46, 10, 0 }, { 1888, 70, 2 },
+  { 296, 15, 0 }, { 1842, 84, 0 }, { 1860, 85, 0 }, { 1848, 86, 0 },
+  { 1895, 89, 0 }, { 93, 11, 0 }, { 342, 15, 0 }, { 1869, 90, 0 },
+  { 114, 11, 0 }, { 117, 11, 0 }, { 306, 15, 0 }, { 119, 11, 0 },
+  { 35, 10, 0 }, { 21, 10, 0 }, { 31, 10, 0 }, { 138, 12, 0 },
+  { 1863, 95, 0 }, { 23, 10, 0 }, { 26, 10, 0 }, { 1894, 86, 0 },
+  { 1869, 96, 0 }, { 1900, 97, 0 }, { 152, 12, 0 }, { 37, 10, 0 },
+  { 56, 10, 0 }, { 54, 10, 0 }, { 77, 10, 0 }, { 49, 10, 0 },
+  { 1865, 99, 0 }, { 63, 10, 0 }, { 77, 10, 0 }, { 77, 10, 0 },
+  { 74, 10, 0 }, { 771, 26, 0 }, { 180, 12, 0 }, { 1864, 101, 0 },
+  { 214, 12, 0 }, { 128, 12, 0 }, { 154, 12, 0 }, { 136, 12, 0 },
+  { 216, 13, 0 }, { 152, 12, 0 }, { 145, 12, 0 }, { 1861, 102, 0 },
+  { 745, 26, 0 }, { 163, 12, 0 }, { 189, 13, 0 }, { 1860, 98, 0 },
+  { 196, 12, 0 }, { 1869, 103, 0 }, { 1870, 104, 0 }, { 167, 12, 0 },
+  { 181, 12, 0 }, { 754, 26, 0 }, { 173, 12, 0 }, { 191, 13, 0 },
+  { 1870, 98, 0 }, { 775, 26, 0 }, { 1912, 65, 0 }, { 1871, 102, 0 },
+  { 243, 14, 0 }, { 981, 33, 0 }, { 194, 13, 0 }, { 195, 13, 0 },
+  { 1026, 33, 0 }, { 200, 13, 0 }, { 251, 14, 0 }, { 191, 13, 0 },
+  { 204, 13, 0 }, { 1916, 68, 0 }, { 985, 33, 0 }, { 231, 13, 0 },
+  { 1885, 77, 0 }, { 236, 14, 0 }, { 999, 33, 0 }, { 334, 14, 0 },
+  { 231, 14, 0 }, { 252, 13, 0 }, { 231, 14, 0 }, { 233, 14, 0 },
+  { 307, 16, 0 }, { 257, 13, 0 }, { 1870, 80, 0 }, { 1875, 81, 0 },
+  { 247, 14, 0 }, { 258, 14, 0 }, { 1872, 63, 0 }, { 264, 14, 0 },
+  { 234, 14, 0 }, { 234, 14, 0 }, { 0, 16, 146 }, { 293, 14, 0 },
+  { 257, 14, 0 }, { 252, 14, 0 }, { 365, 17, 0 }, { 1878, 83, 0 },
+  { 297, 14, 0 }, { 298, 16, 0 }, { 305, 16, 0 }, { 342, 16, 0 },
+  { 309, 16, 0 }, { 1862, 63, 0 }, { 307, 16, 0 }, { 363, 16, 0 },
+  { 1870, 87, 0 }, { 1897, 94, 0 }, { 1884, 109, 0 }, { 982, 32, 0 },
+  { 381, 18, 0 }, { 988, 32, 0 }, { 975, 32, 0 }, { 322, 16, 0 },
+  { 1886, 67, 0 }, { 378, 18, 0 }, { 335, 16, 0 }, { 341, 16, 0 },
+  { 375, 16, 0 }, { 1933, 111, 0 }, { 405, 18, 0 }, { 979, 32, 0 },
+  { 365, 17, 0 }, { 1896, 110, 0 }, { 352, 17, 0 }, { 993, 32, 0 },
+  { 1934, 113, 0 }, { 344, 17, 0 }, { 1906, 114, 0 }, { 1874, 67, 0 },
+  { 353, 17, 0 }, { 1888, 67, 0 }, { 409, 18, 0 }, { 1886, 110, 0 },
+  { 415, 18, 0 }, { 403, 18, 0 }, { 393, 17, 0 }, { 401, 18, 0 },
+  { 404, 18, 0 }, { 458, 20, 0 }, { 393, 17, 0 }, { 464, 20, 0 },
+  { 357, 17, 0 }, { 1907, 117, 0 }, { 488, 18, 0 }, { 405, 18, 0 },
+  { 479, 18, 0 }, { 1897, 123, 0 }, { 1876, 106, 0 }, { 1899, 124, 0 },
+  { 425, 18, 0 }, { 420, 18, 0 }, { 489, 18, 0 }, { 439, 19, 0 },
+  { 1944, 126, 0 }, { 0, 112, 35 }, { 412, 19, 0 }, { 1895, 118, 0 },
+  { 455, 20, 0 }, { 1897, 127, 0 }, { 511, 20, 0 }, { 1924, 106, 0 },
+  { 1898, 134, 0 }, { 465, 20, 0 }, { 494, 21, 0 }, { 415, 19, 0 },
+  { 1912, 137, 0 }, { 1917, 135, 0 }, { 1958, 139, 0 }, { 498, 19, 0 },
+  { 1887, 106, 0 }, { 442, 19, 0 }, { 468, 20, 0 }, { 1896, 120, 0 },
+  { 531, 21, 215 }, { 1905, 120, 0 }, { 487, 20, 0 }, { 1909, 120, 0 },
+  { 1910, 135, 0 }, { 1921, 135, 0 }, { 1882, 108, 0 }, { 516, 21, 0 },
+  { 1899, 120, 0 }, { 517, 21, 0 }, { 1897, 108, 0 }, { 554, 21, 0 },
+  { 503, 21, 0 }, { 1960, 140, 0 }, { 1884, 108, 0 }, { 1972, 132, 0 },
+  { 1957, 137, 0 }, { 595, 23, 0 }, { 559, 21, 0 }, { 518, 21, 0 },
+  { 1889, 108, 0 }, { 641, 21, 0 }, { 1899, 112, 0 }, { 1932, 143, 0 },
+  { 1973, 138, 114 }, { 585, 21, 0 }, { 569, 21, 0 }, { 528, 22, 0 },
+  { 1930, 143, 0 }, { 520, 22, 0 }, { 1927, 145, 0 }, { 565, 22, 0 },
+  { 545, 22, 0 }, { 619, 24, 0 }, { 597, 23, 0 }, { 553, 22, 0 },
+  { 651, 23, 0 }, { 1932, 148, 0 }, { 640, 23, 0 }, { 583, 23, 0 },
+  { 1979, 150, 0 }, { 569, 22, 0 }, { 1953, 151, 0 }, { 1942, 156, 0 },
+  { 1951, 160, 0 }, { 587, 22, 0 }, { 1960, 161, 0 }, { 620, 22, 0 },
+  { 768, 23, 0 }, { 1990, 164, 0 }, { 1953, 157, 0 }, { 1923, 153, 0 },
+  { 605, 23, 0 }, { 601, 23, 0 }, { 645, 23, 0 }, { 630, 24, 0 },
+  { 1953, 165, 0 }, { 636, 24, 0 }, { 632, 24, 0 }, { 1931, 149, 0 },
+  { 640, 24, 0 }, { 642, 24, 0 }, { 1943, 159, 0 }, { 1964, 149, 0 },
+  { 1937, 149, 0 }, { 1937, 157, 0 }, { 1926, 149, 0 }, { 771, 24, 0 },
+  { 1926, 153, 0 }, { 646, 24, 0 }, { 660, 24, 0 }, { 1953, 159, 0 },
+  { 692, 24, 0 }, { 697, 24, 0 }, { 669, 24, 0 }, { 671, 24, 0 },
+  { 694, 24, 0 }, { 689, 25, 0 }, { 784, 27, 0 }, { 696, 25, 0 },
+  { 1302, 45, 0 }, { 805, 27, 0 }, { 706, 25, 0 }, { 1296, 45, 0 },
+  { 725, 25, 0 }, { 762, 25, 0 }, { 1994, 66, 0 }, { 1944, 163, 0 },
+  { 724, 25, 0 }, { 1996, 69, 0 }, { 1319, 45, 0 }, { 742, 25, 0 },
+  { 1305, 45, 0 }, { 1950, 163, 0 }, { 774, 25, 0 }, { 778, 25, 0 },
+  { 1320, 45, 0 }, { 1947, 168, 0 }, { 1317, 45, 0 }, { 1959, 72, 0 },
+  { 1957, 82, 0 }, { 1951, 152, 0 }, { 1964, 169, 0 }, { 811, 27, 0 },
+  { 1952, 168, 0 }, { 797, 27, 0 }, { 860, 28, 0 }, { 817, 27, 0 },
+  { 772, 27, 0 }, { 1573, 52, 0 }, { 786, 27, 0 }, { 801, 27, 0 },
+  { 1580, 52, 0 }, { 860, 28, 0 }, { 1974, 170, 0 }, { 1963, 172, 0 },
+  { 2010, 174, 0 }, { 837, 27, 0 }, { 1581, 52, 0 }, { 1580, 52, 0 },
+  { 804, 27, 0 }, { 858, 27, 0 }, { 1598, 52, 0 }, { 814, 27, 0 },
+  { 1601, 52, 0 }, { 848, 28, 0 }, { 1931, 147, 0 }, { 964, 28, 0 },
+  { 0, 175, 155 }, { 1979, 183, 0 }, { 834, 28, 0 }, { 1985, 186, 0 },
+  { 839, 28, 0 }, { 855, 28, 0 }, { 1932, 147, 0 }, { 1969, 187, 0 },
+  { 893, 29, 0 }, { 864, 28, 0 }, { 1976, 171, 0 }, { 851, 28, 0 },
+  { 0, 188, 165 }, { 850, 28, 0 }, { 1963, 171, 0 }, { 870, 28, 0 },
+  { 877, 28, 0 }, { 902, 28, 0 }, { 908, 29, 0 }, { 908, 29, 0 },
+  { 2010, 166, 0 }, { 1966, 78, 0 }, { 1977, 147, 0 }, { 1998, 78, 0 },
+  { 1973, 194, 0 }, { 2018, 197, 0 }, { 1956, 78, 0 }, { 882, 29, 0 },
+  { 1991, 200, 0 }, { 928, 29, 0 }, { 2008, 171, 0 }, { 1984, 192, 0 },
+  { 869, 29, 0 }, { 1982, 212, 0 }, { 935, 29, 0 }, { 889, 29, 0 },
+  { 979, 31, 0 }, { 949, 30, 0 }, { 896, 30, 0 }, { 937, 30, 0 },
+  { 921, 30, 0 }, { 886, 29, 0 }, { 906, 30, 0 }, { 925, 30, 0 },
+  { 898, 29, 0 }, { 927, 29, 0 }, { 1011, 35, 0 }, { 1974, 180, 0 },
+  { 2016, 192, 0 }, { 947, 30, 0 }, { 945, 30, 0 }, { 959, 30, 0 },
+  { 993, 30, 0 }, { 1991, 185, 0 }, { 941, 30, 0 }, { 973, 30, 0 },
+  { 968, 30, 0 }, { 966, 30, 0 }, { 1000, 34, 0 }, { 1978, 210, 0 },
+  { 980, 31, 0 }, { 957, 31, 0 }, { 982, 31, 0 }, { 980, 31, 0 },
+  { 966, 31, 0 }, { 1012, 35, 0 }, { 1001, 34, 0 }, { 1015, 35, 0 },
+  { 1002, 35, 0 }, { 1000, 35, 0 }, { 1001, 35, 0 }, { 1976, 190, 0 },
+  { 1988, 206, 0 }, { 970, 31, 0 }, { 1986, 206, 0 }, { 1981, 202, 0 },
+  { 1979, 210, 0 }, { 985, 31, 0 }, { 1002, 34, 0 }, { 1005, 35, 0 },
+  { 986, 31, 0 }, { 1985, 205, 0 }, { 2032, 207, 0 }, { 1019, 35, 0 },
+  { 1003, 34, 0 }, { 2006, 208, 0 }, { 998, 34, 0 }, { 1985, 204, 0 },
+  { 2036, 215, 0 }, { 990, 34, 0 }, { 2002, 215, 0 }, { 1998, 220, 0 },
+  { 2005, 221, 0 }, { 2048, 226, 0 }, { 2017, 235, 0 }, { 1021, 36, 0 },
+  { 1007, 36, 0 }, { 1052, 36, 0 }, { 994, 34, 0 }, { 1015, 36, 0 },
+  { 1054, 36, 0 }, { 1011, 36, 0 }, { 1008, 34, 0 }, { 2030, 204, 0 },
+  { 1000, 34, 0 }, { 1031, 37, 0 }, { 1025, 36, 0 }, { 1031, 36, 0 },
+  { 1029, 36, 0 }, { 1027, 36, 0 }, { 1065, 36, 0 }, { 2002, 223, 0 },
+  { 1026, 36, 0 }, { 1034, 36, 0 }, { 1029, 36, 0 }, { 1029, 36, 0 },
+  { 2023, 241, 0 }, { 1042, 36, 0 }, { 1045, 37, 0 }, { 1031, 37, 0 },
+  { 1035, 37, 0 }, { 1035, 37, 0 }, { 1066, 37, 0 }, { 1035, 37, 0 },
+  { 2002, 209, 0 }, { 0, 214, 183 }, { 1048, 37, 0 }, { 2047, 223, 0 },
+  { 1056, 37, 0 }, { 1074, 37, 0 }, { 2003, 211, 0 }, { 1053, 37, 0 },
+  { 1067, 37, 0 }, { 1044, 37, 0 }, { 2013, 228, 0 }, { 1066, 37, 0 },
+  { 1089, 37, 0 }, { 1090, 38, 0 }, { 1052, 37, 0 }, { 1094, 38, 0 },
+  { 1052, 38, 0 }, { 1096, 38, 0 }, { 1058, 38, 0 }, { 1104, 39, 0 },
+  { 1102, 38, 0 }, { 1060, 38, 0 }, { 2058, 233, 0 }, { 2027, 242, 0 },
+  { 1075, 38, 0 }, { 1998, 216, 0 }, { 1122, 39, 0 }, { 1100, 38, 0 },
+  { 2005, 214, 0 }, { 2016, 246, 0 }, { 1116, 38, 0 }, { 1098, 38, 0 },
+  { 1093, 38, 0 }, { 1116, 38, 0 }, { 2008, 216, 0 }, { 1115, 38, 0 },
+  { 2010, 234, 0 }, { 1090, 38, 0 }, { 2014, 216, 0 }, { 2015, 222, 0 },
+  { 2006, 239, 0 }, { 2007, 222, 0 }, { 2007, 239, 0 }, { 1997, 214, 0 },
+  { 0, 244, 215 }, { 1118, 39, 0 }, { 1115, 39, 0 }, { 1128, 39, 0 },
+  { 1159, 39, 0 }, { 1128, 39, 0 }, { 1133, 39, 0 }, { 1174, 40, 0 },
+  { 1142, 39, 0 }, { 1143, 39, 0 }, { 1142, 39, 0 }, { 2026, 230, 0 },
+  { 1143, 39, 0 }, { 2024, 253, 0 }, { 2015, 251, 0 }, { 1143, 39, 0 },
+  { 2073, 256, 0 }, { 2039, 253, 0 }, { 1154, 39, 0 }, { 1155, 39, 0 },
+  { 1143, 39, 0 }, { 1168, 39, 0 }, { 2045, 263, 0 }, { 1148, 39, 0 },
+  { 2035, 251, 0 }, { 2031, 251, 0 }, { 1164, 39, 0 }, { 2027, 251, 0 },
+  { 0, 262, 255 }, { 2022, 251, 0 }, { 1165, 40, 0 }, { 2057, 230, 0 },
+  { 1170, 40, 0 }, { 1139, 40, 0 }, { 1198, 40, 0 }, { 1199, 40, 0 },
+  { 1204, 40, 0 }, { 2070, 253, 0 }, { 0, 270, 266 }, { 2082, 271, 0 },
+  { 2083, 273, 0 }, { 1206, 40, 0 }, { 1180, 40, 0 }, { 1175, 40, 0 },
+  { 1176, 40, 0 }, { 1185, 40, 0 }, { 1184, 40, 0 }, { 1210, 40, 0 },
+  { 1198, 40, 0 }, { 1190, 40, 0 }, { 1195, 40, 0 }, { 1258, 42, 0 },
+  { 1178, 41, 0 }, { 1211, 40, 0 }, { 1168, 41, 0 }, { 2025, 255, 0 },
+  { 1187, 41, 0 }, { 1212, 41, 0 }, { 2086, 276, 0 }, { 2042, 262, 0 },
+  { 1197, 41, 0 }, { 1198, 41, 0 }, { 2040, 279, 0 }, { 1225, 41, 0 },
+  { 2049, 275, 0 }, { 1197, 41, 0 }, { 1213, 41, 0 }, { 1215, 41, 0 },
+  { 2027, 255, 0 }, { 1218, 41, 0 }, { 1225, 41, 0 }, { 1237, 43, 0 },
+  { 2047, 275, 0 }, { 1231, 42, 0 }, { 1217, 42, 0 }, { 1227, 42, 0 },
+  { 1223, 42, 0 }, { 1265, 42, 0 }, { 1222, 42, 0 }, { 1267, 42, 0 },
+  { 2056, 285, 0 }, { 1229, 42, 0 }, { 1240, 42, 0 }, { 2035, 269, 0 },
+  { 1275, 42, 0 }, { 2045, 289, 0 }, { 1267, 42, 0 }, { 1232, 42, 0 },
+  { 2080, 269, 0 }, { 0, 291, 274 }, { 1249, 42, 0 }, { 1248, 42, 0 },
+  { 1284, 42, 146 }, { 2039, 261, 0 }, { 1248, 42, 0 }, { 2044, 278, 0 },
+  { 2098, 283, 0 }, { 1247, 43, 0 }, { 1260, 43, 0 }, { 1254, 43, 0 },
+  { 2037, 269, 0 }, { 1263, 43, 0 }, { 1248, 43, 0 }, { 2059, 296, 0 },
+  { 1268, 44, 0 }, { 2066, 297, 0 }, { 1299, 44, 0 }, { 1248, 43, 0 },
+  { 1276, 44, 0 }, { 1285, 44, 0 }, { 1276, 44, 0 }, { 1277, 43, 0 },
+  { 1324, 44, 0 }, { 1287, 44, 0 }, { 0, 298, 340 }, { 1277, 43, 0 },
+  { 1303, 44, 0 }, { 1331, 44, 0 }, { 1306, 44, 0 }, { 1288, 44, 0 },
+  { 1286, 44, 0 }, { 1267, 43, 0 }, { 1307, 44, 0 }, { 1338, 44, 0 },
+  { 1304, 44, 0 }, { 1313, 46, 0 }, { 2073, 277, 0 }, { 1325, 46, 0 },
+  { 2064, 299, 0 }, { 2077, 302, 0 }, { 1313, 46, 0 }, { 1314, 46, 0 },
+  { 1332, 46, 0 }, { 1798, 58, 0 }, { 1333, 46, 0 }, { 1804, 58, 0 },
+  { 1791, 58, 0 }, { 1341, 47, 0 }, { 1342, 47, 0 }, { 1324, 46, 0 },
+  { 2068, 301, 0 }, { 1370, 47, 0 }, { 2068, 282, 0 }, { 1338, 46, 0 },
+  { 1344, 47, 0 }, { 1795, 58, 0 }, { 1838, 58, 0 }, { 2048, 280, 0 },
+  { 1840, 58, 0 }, { 1812, 58, 0 }, { 2043, 265, 0 }, { 2063, 280, 0 },
+  { 2045, 265, 0 }, { 2117, 304, 0 }, { 2050, 282, 0 }, { 2092, 305, 0 },
+  { 2113, 301, 0 }, { 2095, 313, 0 }, { 2085, 282, 0 }, { 2047, 265, 0 },
+  { 2088, 314, 0 }, { 0, 316, 354 }, { 1415, 48, 0 }, { 1349, 47, 0 },
+  { 1356, 47, 0 }, { 1359, 47, 0 }, { 1368, 47, 0 }, { 1375, 47, 0 },
+  { 1361, 47, 0 }, { 1374, 47, 0 }, { 1374, 47, 0 }, { 2094, 280, 0 },
+  { 1352, 47, 0 }, { 2093, 318, 0 }, { 1394, 47, 0 }, { 1363, 47, 0 },
+  { 1404, 47, 0 }, { 1402, 47, 0 }, { 1387, 47, 0 }, { 2095, 319, 0 },
+  { 1388, 47, 0 }, { 1412, 47, 0 }, { 1432, 47, 215 }, { 1372, 47, 0 },
+  { 1393, 47, 0 }, { 1421, 48, 0 }, { 1440, 49, 0 }, { 1385, 48, 0 },
+  { 1398, 48, 0 }, { 1410, 48, 0 }, { 1394, 48, 0 }, { 1446, 49, 0 },
+  { 1404, 48, 0 }, { 1439, 48, 0 }, { 2090, 320, 0 }, { 2085, 317, 0 },
+  { 1423, 48, 0 }, { 1439, 49, 0 }, { 1414, 48, 0 }, { 1430, 48, 0 },
+  { 1457, 48, 0 }, { 1474, 49, 0 }, { 2089, 321, 0 }, { 1435, 48, 0 },
+  { 2103, 317, 0 }, { 1471, 48, 0 }, { 1454, 49, 0 }, { 1440, 49, 0 },
+  { 1464, 49, 0 }, { 1453, 49, 0 }, { 1489, 49, 0 }, { 1444, 49, 0 },
+  { 1492, 49, 0 }, { 1498, 49, 0 }, { 1498, 49, 0 }, { 1464, 49, 0 },
+  { 2136, 323, 0 }, { 1517, 49, 0 }, { 1466, 49, 0 }, { 2137, 326, 0 },
+  { 1460, 49, 0 }, { 1476, 49, 0 }, { 1508, 50, 0 }, { 1506, 49, 0 },
+  { 1522, 49, 0 }, { 1491, 49, 0 }, { 1514, 49, 0 }, { 1541, 49, 0 },
+  { 1527, 49, 0 }, { 2138, 328, 0 }, { 1513, 50, 0 }, { 0, 329, 368 },
+  { 1515, 50, 0 }, { 1553, 50, 0 }, { 1474, 50, 0 }, { 1492, 50, 0 },
+  { 1529, 50, 0 }, { 1544, 50, 0 }, { 1473, 50, 0 }, { 2055, 292, 0 },
+  { 2094, 332, 0 }, { 1555, 50, 0 }, { 1560, 50, 0 }, { 0, 338, 371 },
+  { 1485, 50, 0 }, { 1562, 50, 0 }, { 2100, 335, 0 }, { 1577, 50, 0 },
+  { 1567, 50, 0 }, { 1495, 50, 0 }, { 1492, 50, 0 }, { 1527, 50, 0 },
+  { 1515, 51, 0 }, { 2109, 335, 0 }, { 1509, 51, 0 }, { 2127, 105, 0 },
+  { 1534, 51, 0 }, { 1548, 51, 0 }, { 2148, 116, 0 }, { 1574, 51, 0 },
+  { 1597, 51, 0 }, { 1604, 53, 0 }, { 1602, 53, 0 }, { 1572, 51, 0 },
+  { 1602, 51, 0 }, { 2117, 125, 0 }, { 1579, 51, 0 }, { 2094, 311, 0 },
+  { 1603, 53, 0 }, { 1606, 51, 0 }, { 1581, 51, 0 }, { 2092, 311, 0 },
+  { 1563, 51, 0 }, { 2106, 129, 0 }, { 2113, 338, 0 }, { 2097, 311, 0 },
+  { 2101, 339, 0 }, { 2098, 292, 0 }, { 2104, 338, 0 }, { 2069, 292, 0 },
+  { 2107, 322, 0 }, { 2152, 325, 386 }, { 2146, 339, 0 }, { 2102, 292, 0 },
+  { 2114, 338, 0 }, { 2161, 352, 0 }, { 0, 351, 394 }, { 1625, 53, 0 },
+  { 1630, 53, 0 }, { 1613, 53, 0 }, { 1632, 53, 0 }, { 1649, 53, 0 },
+  { 1628, 53, 0 }, { 2113, 349, 0 }, { 1611, 53, 0 }, { 1640, 53, 0 },
+  { 2162, 354, 0 }, { 2128, 349, 0 }, { 1652, 53, 0 }, { 1593, 53, 0 },
+  { 1597, 53, 0 }, { 1656, 53, 0 }, { 1654, 53, 0 }, { 2129, 355, 0 },
+  { 1612, 53, 0 }, { 1660, 53, 0 }, { 1665, 53, 0 }, { 1611, 53, 0 },
+  { 2133, 364, 0 }, { 2106, 347, 0 }, { 1659, 53, 0 }, { 1633, 54, 0 },
+  { 1624, 54, 0 }, { 1688, 54, 0 }, { 1649, 54, 0 }, { 1705, 54, 0 },
+  { 1648, 54, 0 }, { 2159, 349, 0 }, { 1684, 54, 0 }, { 1662, 54, 0 },
+  { 2121, 347, 0 }, { 2138, 367, 0 }, { 1670, 54, 0 }, { 1681, 54, 0 },
+  { 2111, 347, 0 }, { 1672, 54, 0 }, { 1678, 54, 0 }, { 1691, 54, 0 },
+  { 1680, 54, 0 }, { 1714, 54, 0 }, { 1697, 54, 0 }, { 1719, 54, 0 },
+  { 2162, 350, 0 }, { 1725, 54, 0 }, { 2129, 351, 0 }, { 2152, 357, 0 },
+  { 1680, 54, 0 }, { 1693, 55, 0 }, { 1677, 55, 0 }, { 1715, 55, 0 },
+  { 1681, 55, 0 }, { 1691, 55, 0 }, { 1687, 55, 0 }, { 1710, 56, 0 },
+  { 1732, 55, 0 }, { 1732, 55, 0 }, { 2126, 369, 0 }, { 2178, 374, 0 },
+  { 2132, 361, 0 }, { 2135, 376, 0 }, { 1729, 56, 0 }, { 1733, 55, 0 },
+  { 1705, 55, 0 }, { 2125, 361, 0 }, { 1741, 55, 0 }, { 1728, 55, 0 },
+  { 2123, 365, 0 }, { 2141, 377, 0 }, { 2120, 350, 0 }, { 1744, 55, 0 },
+  { 2143, 381, 0 }, { 2168, 365, 0 }, { 2150, 383, 0 }, { 2137, 385, 0 },
+  { 1757, 57, 0 }, { 1784, 57, 0 }, { 2157, 385, 0 }, { 1787, 57, 0 },
+  { 2141, 387, 0 }, { 1748, 56, 0 }, { 1736, 56, 0 }, { 1746, 56, 0 },
+  { 1759, 56, 0 }, { 2142, 388, 0 }, { 1747, 56, 0 }, { 1740, 56, 0 },
+  { 1761, 56, 0 }, { 2173, 380, 0 }, { 2188, 390, 0 }, { 2196, 399, 0 },
+  { 1761, 56, 0 }, { 1767, 56, 0 }, { 2201, 404, 0 }, { 1762, 56, 0 },
+  { 1772, 56, 0 }, { 2165, 391, 0 }, { 1774, 56, 0 }, { 1767, 56, 0 },
+  { 1778, 56, 0 }, { 1773, 56, 0 }, { 1781, 57, 0 }, { 1771, 56, 0 },
+  { 1764, 57, 0 }, { 1789, 57, 0 }, { 1792, 57, 0 }, { 1774, 57, 0 },
+  { 2175, 407, 0 }, { 2174, 413, 0 }, { 2197, 399, 0 }, { 2187, 389, 0 },
+  { 2159, 389, 0 }, { 1778, 57, 0 }, { 2165, 416, 0 }, { 1781, 57, 0 },
+  { 1785, 57, 0 }, { 1784, 57, 0 }, { 2144, 391, 0 }, { 1783, 57, 0 },
+  { 1802, 57, 0 }, { 2184, 410, 0 }, { 2189, 389, 0 }, { 1815, 59, 0 },
+  { 1797, 59, 0 }, { 2190, 389, 0 }, { 1800, 59, 0 }, { 1797, 57, 0 },
+  { 1845, 59, 0 }, { 1845, 59, 0 }, { 2179, 412, 0 }, { 2218, 414, 0 },
+  { 1846, 59, 0 }, { 1821, 59, 0 }, { 1816, 59, 0 }, { 1822, 59, 0 },
+  { 2154, 401, 0 }, { 2164, 417, 0 }, { 1852, 59, 0 }, { 1826, 59, 0 },
+  { 2169, 401, 0 }, { 1812, 59, 0 }, { 1825, 59, 0 }, { 1826, 59, 0 },
+  { 1830, 60, 0 }, { 0, 371, 431 }, { 1825, 60, 0 }, { 2158, 406, 0 },
+  { 1821, 60, 0 }, { 1819, 60, 0 }, { 2192, 415, 0 }, { 2174, 406, 0 },
+  { 1836, 60, 0 }, { 2168, 411, 0 }, { 2165, 417, 0 }, { 2191, 421, 0 },
+  { 2191, 422, 0 }, { 2196, 426, 0 }, { 1824, 60, 0 }, { 2163, 409, 0 },
+  { 2200, 401, 0 }, { 2182, 422, 0 }, { 1838, 60, 0 }, { 1845, 61, 0 },
+  { 1841, 60, 0 }, { 1848, 61, 0 }, { 1836, 61, 0 }, { 1847, 61, 0 },
+  { 1837, 61, 0 }, { 2216, 411, 0 }, { 1853, 61, 0 }, { 1850, 61, 0 },
+  { 2130, 371, 0 }, { 2183, 423, 0 }, { 2167, 409, 0 }, { 2182, 424, 0 },
+  { 2145, 371, 0 }, { 1842, 61, 0 }, { 2186, 424, 0 }, { 2185, 424, 0 },
+  { 2132, 371, 0 }, { 1856, 61, 0 }, { 2193, 423, 0 }, { 2193, 427, 0 },
+  { 2200, 428, 0 }, { 1850, 61, 0 }, { 2201, 429, 0 }, { 2195, 408, 0 },
+  { 2197, 432, 0 }, { 2242, 433, 0 }, { 2198, 434, 0 }, { 2246, 436, 0 },
+  { 2244, 435, 0 }, { 2215, 445, 0 }, { 2198, 424, 0 }, { 2204, 449, 0 },
+  { 2177, 371, 0 }, { 2222, 452, 0 }, { 2206, 179, 0 }, { 2218, 181, 0 },
+  { 2252, 182, 0 }, { 2186, 424, 0 }, { 2221, 191, 0 }, { 2210, 195, 0 },
+  { 2190, 424, 0 }, { 2217, 435, 0 }, { 2255, 133, 0 }, { 0, 136, 538 },
+  { 2224, 142, 0 }, { 2213, 146, 0 }, { 2207, 430, 0 }, { 2208, 438, 0 },
+  { 2209, 450, 0 }, { 2214, 456, 0 }, { 2218, 458, 0 }, { 2265, 461, 0 },
+  { 2202, 424, 0 }, { 2234, 470, 0 }, { 2223, 474, 0 }, { 2199, 424, 0 },
+  { 2231, 476, 0 }, { 2219, 418, 0 }, { 2224, 437, 0 }, { 2228, 439, 0 },
+  { 2228, 440, 0 }, { 2234, 441, 0 }, { 2277, 442, 0 }, { 2249, 441, 0 },
+  { 2246, 451, 0 }, { 2235, 455, 0 }, { 2264, 458, 0 }, { 2233, 467, 0 },
+  { 2250, 468, 0 }, { 0, 469, 562 }, { 2252, 471, 0 }, { 0, 472, 14 },
+  { 2262, 473, 0 }, { 2258, 478, 0 }, { 2282, 469, 0 }, { 2263, 479, 0 },
+  { 2294, 480, 0 }, { 2254, 481, 0 }, { 2266, 484, 0 }, { 2296, 480, 0 },
+  { 2263, 485, 0 }, { 2272, 486, 0 }, { 0, 482, 478 }, { 2273, 439, 0 },
+  { 2257, 478, 0 }, { 2273, 487, 0 }, { 2265, 481, 0 }, { 2298, 482, 0 },
+  { 2271, 489, 0 }, { 2268, 477, 0 }, { 2293, 479, 2 }, { 2278, 490, 0 },
+  { 2281, 491, 0 }, { 2279, 492, 0 }, { 2273, 489, 0 }, { 2275, 493, 0 },
+  { 2330, 495, 0 }, { 2308, 485, 0 }, { 2308, 498, 0 }, { 2283, 469, 0 },
+  { 2287, 500, 0 }, { 2338, 503, 0 }, { 2270, 485, 0 }, { 2320, 492, 0 },
+  { 2240, 469, 0 }, { 2315, 505, 0 }, { 2268, 490, 0 }, { 2327, 510, 0 },
+  { 2324, 510, 0 }, { 2270, 482, 0 }, { 2328, 512, 0 }, { 2298, 503, 0 },
+  { 2296, 494, 0 }, { 2302, 482, 0 }, { 2304, 507, 0 }, { 2288, 472, 0 },
+  { 2239, 469, 0 }, { 2273, 482, 0 }, { 2303, 501, 0 }, { 2385, 514, 0 },
+  { 2286, 469, 0 }, { 2394, 517, 0 }, { 2283, 494, 0 }, { 2259, 482, 0 },
+  { 2261, 482, 0 }, { 2281, 494, 0 }, { 2313, 504, 0 }, { 2288, 494, 0 },
+  { 1, 501, 0 }, { 2302, 494, 0 }, { 2346, 504, 0 }, { 2331, 507, 0 },
+  { 2304, 501, 0 }, { 2301, 504, 0 }, { 2354, 504, 0 }, { 2316, 508, 0 },
+  { 2320, 509, 0 }, { 2322, 508, 0 }, { 2327, 511, 0 }, { 2362, 520, 0 },
+  { 2373, 528, 0 }, { 2324, 508, 0 }, { 2340, 511, 0 }, { 2344, 513, 0 },
+  { 2368, 527, 0 }, { 2402, 533, 0 }, { 2328, 511, 0 }, { 2326, 508, 0 },
+  { 2335, 516, 0 }, { 2377, 509, 0 }, { 2358, 516, 0 }, { 2337, 509, 0 },
+  { 2338, 513, 0 }, { 2337, 513, 0 }, { 2389, 516, 0 }, { 2350, 523, 0 },
+  { 2356, 523, 0 }, { 2375, 523, 0 }, { 2331, 511, 0 }, { 2365, 523, 0 },
+  { 2359, 526, 0 }, { 2388, 531, 0 }, { 2385, 527, 0 }, { 2388, 529, 0 },
+  { 2375, 529, 0 }, { 2390, 515, 0 }, { 2391, 522, 0 }, { 2390, 531, 0 },
+  { 2403, 541, 0 }, { 2416, 542, 0 }, { 2417, 542, 0 }, { 2391, 529, 0 },
+  { 2401, 543, 0 }, { 2406, 541, 0 }, { 2366, 526, 0 }, { 2419, 529, 0 },
+  { 0, 544, 82 }, { 2394, 529, 0 }, { 2452, 545, 780 }, { 2396, 541, 0 },
+  { 2407, 541, 0 }, { 2393, 529, 0 }, { 2397, 529, 0 }, { 2407, 545, 0 },
+  { 2412, 545, 0 }, { 2410, 546, 0 }, { 2413, 548, 0 }, { 2419, 549, 0 },
+  { 2415, 550, 0 }, { 2426, 552, 0 }, { 2439, 560, 0 }, { 2459, 549, 0 },
+  { 2445, 563, 0 }, { 2435, 549, 0 }, { 2456, 546, 0 }, { 2447, 547, 0 },
+  { 2446, 543, 0 }, { 2450, 573, 0 }, { 2430, 555, 0 }, { 2437, 558, 0 },
+  { 2434, 558, 0 }, { 2432, 559, 0 }, { 2437, 555, 0 }, { 2417, 544, 0 },
+  { 2446, 560, 0 }, { 2428, 549, 0 }, { 2471, 555, 0 }, { 2444, 555, 0 },
+  { 2465, 549, 0 }, { 2433, 555, 0 }, { 2435, 566, 0 }, { 2443, 570, 0 },
+  { 2438, 561, 0 }, { 2439, 559, 0 }, { 2448, 572, 0 }, { 0, 574, 137 },
+  { 2454, 566, 0 }, { 2405, 544, 0 }, { 2435, 559, 0 }, { 2457, 561, 0 },
+  { 2456, 575, 0 }, { 0, 576, 820 }, { 2449, 572, 0 }, { 0, 581, 824 },
+  { 2478, 582, 0 }, { 2511, 583, 0 }, { 2473, 584, 0 }, { 2445, 570, 0 },
+  { 2456, 572, 0 }, { 2473, 585, 0 }, { 2485, 586, 0 }, { 2482, 587, 0 },
+  { 2443, 547, 0 }, { 2504, 592, 0 }, { 2534, 589, 0 }, { 2483, 584, 0 },
+  { 2543, 594, 0 }, { 2470, 583, 0 }, { 2495, 572, 0 }, { 2462, 582, 0 },
+  { 2471, 585, 0 }, { 2536, 589, 851 }, { 2467, 582, 0 }, { 2517, 596, 0 },
+  { 2484, 588, 0 }, { 2489, 588, 0 }, { 2486, 586, 0 }, { 2484, 585, 0 },
+  { 2498, 586, 0 }, { 2480, 586, 0 }, { 2493, 588, 0 }, { 2499, 590, 0 },
+  { 2513, 600, 0 }, { 2515, 601, 0 }, { 2483, 587, 0 }, { 2523, 605, 0 },
+  { 2497, 590, 0 }, { 2501, 593, 0 }, { 2463, 581, 0 }, { 2514, 607, 0 },
+  { 2498, 575, 0 }, { 2504, 581, 0 }, { 2530, 609, 0 }, { 2495, 593, 0 },
+  { 2507, 597, 0 }, { 2472, 576, 0 }, { 2501, 576, 0 }, { 2511, 597, 0 },
+  { 2505, 581, 0 }, { 2506, 603, 0 }, { 2510, 593, 0 }, { 2517, 610, 0 },
+  { 2524, 606, 0 }, { 2547, 597, 0 }, { 2530, 606, 0 }, { 0, 591, 159 },
+  { 2511, 609, 0 }, { 2516, 613, 0 }, { 2535, 614, 0 }, { 2524, 615, 0 },
+  { 2518, 603, 0 }, { 2524, 616, 0 }, { 0, 617, 157 }, { 2574, 618, 0 },
+  { 0, 619, 165 }, { 2546, 621, 0 }, { 2527, 622, 0 }, { 2525, 613, 0 },
+  { 2514, 603, 0 }, { 2582, 626, 0 }, { 2565, 613, 0 }, { 2554, 627, 0 },
+  { 0, 624, 161 }, { 2539, 630, 0 }, { 2544, 631, 0 }, { 2569, 615, 0 },
+  { 2551, 634, 0 }, { 2579, 624, 0 }, { 2556, 611, 0 }, { 2557, 637, 0 },
+  { 2550, 631, 0 }, { 0, 632, 146 }, { 2572, 637, 0 }, { 2571, 637, 0 },
+  { 2564, 638, 0 }, { 2594, 634, 0 }, { 2565, 639, 0 }, { 2566, 641, 0 },
+  { 2577, 637, 0 }, { 2616, 642, 0 }, { 2587, 647, 0 }, { 2541, 626, 0 },
+  { 2582, 661, 0 }, { 2562, 591, 0 }, { 2584, 644, 0 }, { 2584, 626, 0 },
+  { 0, 646, 190 }, { 2576, 619, 0 }, { 2575, 641, 0 }, { 2580, 624, 0 },
+  { 2571, 617, 0 }, { 2575, 651, 0 }, { 2583, 648, 0 }, { 2581, 655, 0 },
+  { 2585, 641, 0 }, { 2572, 617, 0 }, { 2596, 661, 0 }, { 2573, 617, 0 },
+  { 2581, 624, 0 }, { 2550, 626, 0 }, { 2561, 632, 0 }, { 2550, 632, 0 },
+  { 2599, 655, 0 }, { 2574, 651, 0 }, { 2637, 649, 0 }, { 2585, 651, 0 },
+  { 2591, 651, 0 }, { 2612, 650, 0 }, { 2596, 651, 0 }, { 2576, 632, 0 },
+  { 2584, 655, 0 }, { 0, 652, 186 }, { 2608, 653, 0 }, { 2606, 648, 0 },
+  { 2546, 632, 0 }, { 2567, 632, 0 }, { 2638, 649, 0 }, { 2615, 656, 0 },
+  { 0, 657, 122 }, { 2616, 659, 0 }, { 2627, 660, 0 }, { 2588, 646, 0 },
+  { 2602, 658, 0 }, { 2615, 662, 0 }, { 2621, 324, 0 }, { 0, 663, 191 },
+  { 2613, 658, 0 }, { 2667, 327, 0 }, { 2634, 664, 0 }, { 2620, 662, 0 },
+  { 2626, 664, 0 }, { 2614, 656, 0 }, { 2616, 656, 0 }, { 2622, 334, 0 },
+  { 2637, 336, 0 }, { 2623, 658, 0 }, { 2626, 340, 0 }, { 2633, 646, 0 },
+  { 2627, 340, 0 }, { 2629, 658, 0 }, { 2666, 324, 0 }, { 2643, 342, 0 },
+  { 2631, 665, 0 }, { 2644, 667, 0 }, { 2676, 670, 0 }, { 2646, 671, 0 },
+  { 2605, 652, 0 }, { 2622, 657, 0 }, { 2627, 672, 0 }, { 2628, 674, 0 },
+  { 2615, 657, 0 }, { 2609, 652, 0 }, { 2596, 652, 0 }, { 2648, 679, 0 },
+  { 2638, 683, 0 }, { 2640, 677, 0 }, { 2643, 678, 0 }, { 0, 681, 249 },
+  { 2645, 684, 0 }, { 2621, 657, 0 }, { 2624, 663, 0 }, { 0, 709, 250 },
+  { 0, 707, 1031 }, { 2675, 667, 0 }, { 2652, 657, 0 }, { 2644, 703, 0 },
+  { 2721, 709, 0 }, { 2653, 703, 0 }, { 2673, 712, 0 }, { 2649, 703, 0 },
+  { 2657, 704, 0 }, { 2658, 704, 0 }, { 2641, 677, 0 }, { 2660, 705, 0 },
+  { 2659, 677, 0 }, { 2667, 703, 0 }, { 2663, 703, 0 }, { 2675, 705, 0 },
+  { 2697, 703, 0 }, { 2651, 703, 0 }, { 2655, 703, 0 }, { 0, 714, 266 },
+  { 2700, 703, 0 }, { 2673, 708, 0 }, { 2681, 706, 0 }, { 2702, 715, 0 },
+  { 2678, 708, 0 }, { 2676, 704, 0 }, { 2678, 710, 0 }, { 2685, 710, 0 },
+  { 2688, 681, 0 }, { 2686, 715, 0 }, { 2720, 708, 0 }, { 2678, 705, 0 },
+  { 2668, 707, 0 }, { 2715, 707, 0 }, { 2734, 716, 0 }, { 2707, 705, 0 },
+  { 2662, 706, 0 }, { 2681, 706, 0 }, { 2678, 706, 0 }, { 2705, 718, 0 },
+  { 2709, 720, 0 }, { 2748, 723, 0 }, { 2714, 720, 0 }, { 2716, 707, 0 },
+  { 2741, 702, 0 }, { 2717, 707, 0 }, { 2681, 714, 0 }, { 2729, 720, 0 },
+  { 2685, 714, 0 }, { 2736, 724, 0 }, { 2745, 728, 0 }, { 2749, 727, 0 },
+  { 2757, 720, 0 }, { 2702, 714, 0 }, { 2698, 717, 0 }, { 2695, 717, 0 },
+  { 2693, 716, 0 }, { 0, 722, 215 }, { 2776, 724, 0 }, { 2714, 720, 0 },
+  { 2736, 716, 0 }, { 2789, 727, 0 }, { 2746, 729, 0 }, { 2792, 730, 0 },
+  { 2717, 721, 0 }, { 2686, 714, 0 }, { 2719, 721, 0 }, { 2707, 717, 0 },
+  { 2699, 717, 0 }, { 2716, 717, 0 }, { 2793, 732, 0 }, { 2764, 721, 0 },
+  { 2726, 721, 0 }, { 2709, 717, 0 }, { 2702, 716, 0 }, { 2739, 725, 0 },
+  { 2724, 717, 0 }, { 2758, 736, 0 }, { 2757, 736, 0 }, { 2745, 717, 0 },
+  { 2738, 721, 0 }, { 2764, 738, 0 }, { 0, 740, 272 }, { 2723, 721, 0 },
+  { 2753, 725, 0 }, { 2772, 739, 0 }, { 2739, 722, 0 }, { 2728, 722, 0 },
+  { 2786, 725, 0 }, { 2761, 743, 0 }, { 2750, 725, 0 }, { 2726, 722, 0 },
+  { 2732, 722, 0 }, { 2752, 733, 0 }, { 2797, 733, 0 }, { 2745, 722, 0 },
+  { 0, 745, 1104 }, { 2772, 739, 0 }, { 2809, 726, 0 }, { 2781, 737, 0 },
+  { 2726, 722, 0 }, { 2759, 722, 0 }, { 2779, 731, 0 }, { 2788, 741, 0 },
+  { 2751, 733, 0 }, { 2790, 749, 0 }, { 2764, 743, 0 }, { 2779, 746, 0 },
+  { 2771, 746, 0 }, { 2812, 731, 0 }, { 2779, 747, 0 }, { 2810, 726, 0 },
+  { 2783, 747, 0 }, { 2842, 751, 0 }, { 0, 750, 291 }, { 2792, 750, 0 },
+  { 2790, 748, 0 }, { 2813, 731, 0 }, { 2802, 755, 0 }, { 2786, 746, 0 },
+  { 2793, 748, 0 }, { 2825, 746, 0 }, { 2843, 752, 0 }, { 0, 754, 395 },
+  { 2804, 753, 0 }, { 2773, 746, 0 }, { 2833, 758, 0 }, { 2833, 760, 0 },
+  { 2824, 761, 0 }, { 2789, 741, 0 }, { 2788, 748, 0 }, { 2869, 760, 1142 },
+  { 2828, 763, 0 }, { 0, 762, 728 }, { 2761, 745, 0 }, { 2781, 745, 0 },
+  { 2787, 748, 0 }, { 2893, 774, 0 }, { 2892, 778, 0 }, { 0, 766, 1161 },
+  { 2833, 748, 0 }, { 2793, 750, 0 }, { 2832, 761, 0 }, { 2810, 757, 0 },
+  { 2797, 750, 0 }, { 2871, 761, 0 }, { 2894, 775, 0 }, { 2855, 757, 0 },
+  { 2845, 752, 0 }, { 2847, 765, 0 }, { 2805, 753, 0 }, { 2848, 765, 0 },
+  { 2915, 784, 0 }, { 2868, 768, 0 }, { 2854, 765, 0 }, { 2926, 789, 0 },
+  { 2928, 790, 0 }, { 2792, 750, 0 }, { 2829, 763, 0 }, { 2809, 750, 0 },
+  { 2854, 765, 0 }, { 2930, 775, 0 }, { 2811, 752, 0 }, { 2847, 752, 0 },
+  { 2806, 750, 0 }, { 2823, 753, 0 }, { 2841, 763, 0 }, { 2870, 770, 0 },
+  { 2851, 754, 0 }, { 2812, 757, 0 }, { 2866, 767, 0 }, { 2852, 754, 0 },
+  { 2813, 757, 0 }, { 2862, 757, 0 }, { 2868, 767, 0 }, { 2875, 772, 0 },
+  { 2882, 764, 0 }, { 2831, 763, 0 }, { 2892, 766, 0 }, { 2871, 768, 0 },
+  { 2940, 791, 0 }, { 2835, 764, 0 }, { 2838, 764, 0 }, { 2872, 770, 0 },
+  { 2968, 792, 0 }, { 2969, 794, 0 }, { 2843, 764, 0 }, { 2824, 757, 0 },
+  { 2864, 757, 0 }, { 2852, 764, 0 }, { 2835, 764, 0 }, { 2920, 772, 0 },
+  { 2885, 768, 0 }, { 2854, 767, 0 }, { 2855, 764, 0 }, { 2891, 776, 0 },
+  { 2871, 767, 0 }, { 2908, 777, 0 }, { 2905, 776, 0 }, { 2868, 767, 0 },
+  { 2934, 776, 0 }, { 2861, 767, 0 }, { 0, 787, 1205 }, { 2942, 796, 0 },
+  { 2902, 767, 0 }, { 2876, 773, 0 }, { 2884, 773, 0 }, { 2895, 781, 0 },
+  { 2936, 777, 0 }, { 2905, 781, 0 }, { 2905, 767, 0 }, { 2875, 767, 0 },
+  { 2914, 782, 0 }, { 2876, 773, 0 }, { 2906, 785, 0 }, { 2901, 781, 0 },
+  { 2911, 782, 0 }, { 2970, 797, 0 }, { 2908, 785, 0 }, { 2879, 773, 0 },
+  { 2916, 782, 0 }, { 2917, 788, 0 }, { 0, 800, 1232 }, { 2886, 773, 0 },
+  { 2938, 803, 0 }, { 2906, 785, 0 }, { 2942, 781, 0 }, { 0, 804, 369 },
+  { 2973, 812, 0 }, { 2910, 787, 0 }, { 2935, 788, 0 }, { 0, 809, 372 },
+  { 2955, 787, 0 }, { 2925, 788, 0 }, { 2972, 799, 0 }, { 2956, 810, 0 },
+  { 2985, 809, 0 }, { 2924, 787, 0 }, { 2934, 799, 0 }, { 2940, 806, 0 },
+  { 2934, 799, 0 }, { 3001, 810, 0 }, { 3003, 353, 0 }, { 2914, 787, 0 },
+  { 2934, 803, 0 }, { 2958, 356, 0 }, { 2950, 806, 0 }, { 2921, 787, 0 },
+  { 2973, 362, 0 }, { 2971, 363, 0 }, { 2960, 787, 0 }, { 2943, 806, 0 },
+  { 2963, 366, 0 }, { 2963, 368, 0 }, { 2974, 802, 0 }, { 2975, 808, 0 },
+  { 2968, 801, 0 }, { 2965, 368, 0 }, { 2947, 809, 0 }, { 3012, 839, 0 },
+  { 2943, 809, 0 }, { 3025, 840, 0 }, { 2992, 809, 0 }, { 3007, 834, 0 },
+  { 3025, 844, 0 }, { 2988, 829, 0 }, { 2952, 809, 0 }, { 2965, 368, 0 },
+  { 2946, 800, 0 }, { 3004, 829, 0 }, { 2976, 800, 0 }, { 2988, 809, 0 },
+  { 2966, 809, 0 }, { 2972, 801, 0 }, { 3031, 847, 0 }, { 2990, 801, 0 },
+  { 2962, 809, 0 }, { 3052, 834, 0 }, { 2955, 809, 0 }, { 2991, 827, 0 },
+  { 2988, 827, 0 }, { 2985, 827, 0 }, { 2985, 828, 0 }, { 2986, 828, 0 },
+  { 0, 850, 1321 }, { 3007, 829, 0 }, { 3013, 830, 0 }, { 3032, 851, 0 },
+  { 3003, 832, 0 }, { 3037, 829, 0 }, { 2992, 827, 0 }, { 3008, 832, 0 },
+  { 3033, 852, 0 }, { 2979, 827, 0 }, { 2983, 827, 0 }, { 3012, 830, 0 },
+  { 3001, 827, 0 }, { 3050, 832, 0 }, { 3019, 835, 0 }, { 3004, 828, 0 },
+  { 2996, 830, 0 }, { 3007, 831, 0 }, { 3010, 830, 0 }, { 3000, 831, 0 },
+  { 3012, 838, 0 }, { 3021, 835, 0 }, { 3022, 842, 0 }, { 3047, 831, 386 },
+  { 3021, 841, 0 }, { 3018, 841, 0 }, { 3020, 835, 0 }, { 3030, 838, 0 },
+  { 3027, 845, 0 }, { 0, 853, 453 }, { 3027, 845, 0 }, { 3045, 854, 0 },
+  { 3058, 838, 0 }, { 3101, 856, 0 }, { 3081, 853, 0 }, { 3072, 845, 0 },
+  { 3067, 859, 0 }, { 3026, 842, 0 }, { 3064, 862, 0 }, { 3036, 841, 0 },
+  { 3031, 846, 0 }, { 3037, 846, 0 }, { 3107, 859, 0 }, { 3029, 841, 0 },
+  { 3045, 845, 0 }, { 3068, 865, 0 }, { 3089, 866, 0 }, { 3049, 855, 0 },
+  { 3080, 868, 0 }, { 3072, 863, 0 }, { 3042, 846, 0 }, { 3116, 865, 0 },
+  { 3058, 858, 0 }, { 3069, 863, 0 }, { 3069, 858, 0 }, { 3086, 865, 0 },
+  { 3040, 853, 0 }, { 3083, 863, 0 }, { 3036, 853, 0 }, { 3121, 876, 0 },
+  { 3085, 853, 0 }, { 3099, 867, 0 }, { 3125, 878, 0 }, { 3123, 880, 0 },
+  { 3042, 853, 0 }, { 3087, 870, 0 }, { 3060, 858, 0 }, { 3108, 873, 0 },
+  { 3112, 863, 0 }, { 3082, 853, 0 }, { 3126, 881, 0 }, { 3047, 853, 0 },
+  { 3172, 882, 0 }, { 3050, 855, 0 }, { 3054, 853, 0 }, { 3049, 855, 0 },
+  { 3105, 858, 1344 }, { 3075, 867, 0 }, { 3124, 877, 0 }, { 3123, 867, 0 },
+  { 3090, 853, 0 }, { 3161, 877, 0 }, { 3108, 870, 0 }, { 3119, 879, 0 },
+  { 3081, 869, 0 }, { 3061, 855, 0 }, { 3082, 869, 0 }, { 3137, 879, 0 },
+  { 3134, 871, 0 }, { 3103, 871, 0 }, { 3154, 892, 0 }, { 3048, 855, 0 },
+  { 3059, 855, 0 }, { 3109, 873, 0 }, { 3094, 869, 0 }, { 3159, 883, 0 },
+  { 3053, 855, 0 }, { 3163, 890, 0 }, { 3150, 895, 0 }, { 3136, 871, 0 },
+  { 3108, 871, 0 }, { 3103, 869, 0 }, { 3166, 871, 0 }, { 3164, 895, 0 },
+  { 3131, 884, 0 }, { 3159, 891, 0 }, { 3105, 873, 0 }, { 3168, 879, 0 },
+  { 3151, 884, 0 }, { 3160, 894, 0 }, { 3154, 884, 0 }, { 3153, 885, 0 },
+  { 3153, 885, 0 }, { 3139, 885, 0 }, { 3138, 884, 0 }, { 3151, 895, 0 },
+  { 3187, 891, 0 }, { 3182, 894, 0 }, { 3163, 909, 0 }, { 3161, 891, 0 },
+  { 3148, 899, 0 }, { 3189, 910, 0 }, { 3173, 911, 0 }, { 3184, 914, 0 },
+  { 3161, 894, 0 }, { 3204, 915, 0 }, { 3168, 899, 0 }, { 3179, 912, 0 },
+  { 3187, 912, 0 }, { 3188, 916, 0 }, { 3195, 916, 0 }, { 3193, 920, 0 },
+  { 3230, 914, 0 }, { 3170, 909, 0 }, { 3199, 912, 0 }, { 3207, 921, 0 },
+  { 3198, 923, 0 }, { 3207, 927, 0 }, { 3222, 911, 0 }, { 3217, 931, 0 },
+  { 3197, 924, 0 }, { 3211, 929, 0 }, { 3214, 904, 0 }, { 3201, 924, 0 },
+  { 3206, 926, 0 }, { 3208, 923, 0 }, { 3238, 921, 84 }, { 3216, 924, 0 },
+  { 3191, 920, 0 }, { 3211, 928, 0 }, { 3208, 926, 0 }, { 3197, 924, 0 },
+  { 3215, 905, 0 }, { 3218, 929, 0 }, { 3215, 928, 0 }, { 3215, 907, 0 },
+  { 3263, 932, 0 }, { 3219, 933, 0 }, { 3210, 924, 0 }, { 3269, 935, 0 },
+  { 3204, 924, 0 }, { 3205, 926, 0 }, { 3228, 930, 0 }, { 3219, 928, 0 },
+  { 3265, 934, 0 }, { 3226, 941, 0 }, { 3231, 930, 0 }, { 3225, 943, 0 },
+  { 3242, 944, 0 }, { 3237, 945, 0 }, { 3235, 947, 0 }, { 3228, 934, 0 },
+  { 3236, 948, 0 }, { 3249, 955, 0 }, { 3239, 673, 0 }, { 3256, 675, 0 },
+  { 3287, 676, 0 }, { 3239, 934, 0 }, { 3256, 685, 0 }, { 0, 686, 1480 },
+  { 3255, 675, 0 }, { 0, 688, 526 }, { 3247, 689, 0 }, { 3250, 951, 0 },
+  { 3254, 952, 0 }, { 3299, 954, 0 }, { 0, 957, 1485 }, { 3256, 956, 0 },
+  { 3258, 960, 0 }, { 3262, 961, 0 }, { 3253, 948, 0 }, { 3250, 951, 0 },
+  { 3260, 962, 0 }, { 3265, 963, 0 }, { 3265, 966, 0 }, { 3276, 969, 0 },
+  { 3267, 967, 0 }, { 3285, 970, 0 }, { 3287, 971, 0 }, { 3271, 969, 0 },
+  { 3271, 972, 0 }, { 3275, 974, 0 }, { 3321, 976, 1493 }, { 3255, 951, 0 },
+  { 3323, 977, 0 }, { 3275, 963, 0 }, { 3273, 980, 0 }, { 3293, 986, 0 },
+  { 3282, 990, 0 }, { 3273, 963, 0 }, { 3283, 967, 0 }, { 3276, 992, 0 },
+  { 3263, 688, 0 }, { 3257, 956, 0 }, { 3259, 960, 0 }, { 3282, 991, 0 },
+  { 3286, 993, 0 }, { 3320, 974, 0 }, { 3286, 994, 0 }, { 3287, 995, 0 },
+  { 3266, 966, 0 }, { 3290, 992, 0 }, { 3335, 996, 0 }, { 3285, 998, 0 },
+  { 3293, 999, 0 }, { 3306, 1005, 0 }, { 3295, 1009, 0 }, { 3340, 1013, 0 },
+  { 3309, 64, 0 }, { 0, 71, 2 }, { 3297, 73, 0 }, { 3305, 1013, 0 },
+  { 3296, 74, 0 }, { 3316, 75, 0 }, { 3307, 995, 0 }, { 0, 91, 6 },
+  { 0, 76, 7 }, { 3298, 79, 0 }, { 3320, 88, 0 }, { 3304, 92, 0 },
+  { 3331, 993, 0 }, { 0, 93, 11 }, { 3309, 119, 0 }, { 3350, 128, 0 },
+  { 3300, 100, 0 }, { 3319, 107, 0 }, { 3353, 115, 0 }, { 3321, 131, 0 },
+  { 3325, 121, 0 }, { 3356, 122, 19 }, { 3312, 158, 0 }, { 3358, 173, 0 },
+  { 3328, 173, 0 }, { 0, 130, 23 }, { 3313, 184, 0 }, { 3320, 199, 0 },
+  { 3362, 201, 0 }, { 0, 141, 27 }, { 3363, 144, 0 }, { 3333, 154, 0 },
+  { 3365, 155, 0 }, { 3335, 167, 0 }, { 3367, 176, 0 }, { 3368, 177, 32 },
+  { 3323, 218, 0 }, { 0, 231, 34 }, { 3340, 240, 0 }, { 3331, 250, 0 },
+  { 3338, 254, 0 }, { 3345, 258, 0 }, { 3340, 264, 0 }, { 3376, 178, 0 },
+  { 3339, 193, 0 }, { 3347, 203, 0 }, { 0, 189, 36 }, { 0, 196, 44 },
+  { 3341, 198, 0 }, { 3343, 213, 0 }, { 3342, 243, 0 }, { 3339, 245, 0 },
+  { 3342, 252, 0 }, { 3344, 245, 0 }, { 3386, 247, 0 }, { 3344, 217, 0 },
+  { 3390, 219, 0 }, { 0, 224, 62 }, { 3348, 266, 0 }, { 3393, 227, 0 },
+  { 3364, 224, 0 }, { 3394, 229, 0 }, { 3395, 232, 0 }, { 3365, 237, 0 },
+  { 3344, 245, 0 }, { 3350, 213, 0 }, { 3346, 247, 0 }, { 3397, 248, 0 },
+  { 3350, 249, 0 }, { 3358, 236, 0 }, { 0, 260, 72 }, { 0, 238, 73 },
+  { 3324, 231, 0 }, { 0, 257, 75 }, { 3357, 267, 0 }, { 3372, 272, 0 },
+  { 3404, 303, 0 }, { 0, 307, 84 }, { 3369, 308, 0 }, { 3407, 310, 0 },
+  { 3410, 295, 0 }, { 3364, 307, 0 }, { 3363, 307, 0 }, { 3370, 312, 0 },
+  { 3361, 267, 0 }, { 0, 259, 113 }, { 0, 268, 114 }, { 3366, 274, 0 },
+  { 3372, 370, 0 }, { 3385, 378, 0 }, { 0, 394, 118 }, { 3415, 281, 0 },
+  { 0, 284, 120 }, { 3368, 286, 0 }, { 3386, 287, 0 }, { 3374, 294, 0 },
+  { 3369, 309, 0 }, { 3381, 306, 0 }, { 3422, 315, 0 }, { 3385, 288, 0 },
+  { 3386, 290, 0 }, { 3428, 331, 0 }, { 3429, 337, 0 }, { 0, 293, 134 },
+  { 3430, 300, 135 }, { 3385, 341, 0 }, { 3392, 348, 0 }, { 0, 330, 138 },
+  { 3388, 290, 0 }, { 0, 333, 139 }, { 3402, 343, 0 }, { 3435, 393, 0 },
+  { 3398, 395, 0 }, { 3402, 398, 0 }, { 3438, 344, 0 }, { 3439, 345, 0 },
+  { 3413, 346, 0 }, { 3373, 238, 0 }, { 3393, 358, 0 }, { 3407, 382, 0 },
+  { 3414, 386, 0 }, { 0, 402, 152 }, { 3444, 359, 0 }, { 0, 360, 154 },
+  { 3445, 373, 0 }, { 3400, 375, 0 }, { 3447, 379, 0 }, { 3419, 392, 0 },
+  { 3412, 403, 0 }, { 0, 420, 168 }, { 3421, 396, 0 }, { 0, 397, 170 },
+  { 3420, 400, 0 }, { 3452, 444, 0 }, { 3401, 446, 0 }, { 3454, 431, 0 },
+  { 3414, 448, 0 }, { 3452, 405, 0 }, { 3458, 419, 0 }, { 3426, 425, 0 },
+  { 3460, 443, 0 }, { 3415, 447, 0 }, { 3433, 459, 0 }, { 0, 475, 181 },
+  { 3463, 453, 0 }, { 0, 454, 183 }, { 3416, 457, 0 }, { 3421, 524, 0 },
+  { 3432, 539, 0 }, { 0, 460, 187 }, { 3424, 462, 0 }, { 3431, 524, 0 },
+  { 3430, 521, 0 }, { 3471, 530, 0 }, { 3472, 534, 0 }, { 3473, 463, 0 },
+  { 3444, 464, 0 }, { 3424, 535, 0 }, { 3476, 537, 198 }, { 3448, 483, 0 },
+  { 0, 499, 200 }, { 0, 465, 201 }, { 3478, 466, 0 }, { 3480, 536, 0 },
+  { 3452, 538, 0 }, { 3431, 488, 0 }, { 3483, 496, 0 }, { 3484, 502, 0 },
+  { 3458, 506, 0 }, { 3451, 551, 0 }, { 0, 571, 210 }, { 0, 518, 211 },
+  { 3487, 519, 0 }, { 3488, 525, 0 }, { 3489, 532, 0 }, { 3444, 554, 0 },
+  { 3461, 564, 0 }, { 3492, 565, 0 }, { 3466, 567, 0 }, { 3494, 569, 0 },
+  { 3435, 460, 0 }, { 3454, 553, 0 }, { 3461, 557, 0 }, { 0, 577, 223 },
+  { 3496, 595, 0 }, { 3500, 608, 0 }, { 0, 556, 254 }, { 3452, 599, 0 },
+  { 3460, 562, 0 }, { 3491, 690, 0 }, { 3504, 692, 0 }, { 3464, 699, 0 },
+  { 3510, 623, 0 }, { 0, 628, 264 }, { 3470, 640, 0 }, { 0, 579, 267 },
+  { 0, 580, 268 }, { 3466, 604, 0 }, { 3480, 612, 0 }, { 0, 598, 271 },
+  { 3476, 602, 0 }, { 3522, 620, 0 }, { 3524, 625, 0 }, { 3525, 633, 0 },
+  { 3480, 635, 0 }, { 3486, 687, 0 }, { 3493, 691, 0 }, { 0, 711, 279 },
+  { 3484, 682, 0 }, { 3500, 694, 0 }, { 3497, 698, 0 }, { 0, 636, 282 },
+  { 3502, 779, 0 }, { 3490, 817, 0 }, { 3536, 819, 0 }, { 0, 823, 286 },
+  { 3555, 643, 0 }, { 3526, 645, 0 }, { 3496, 823, 0 }, { 3497, 823, 0 },
+  { 3501, 823, 0 }, { 3524, 666, 0 }, { 3497, 823, 0 }, { 3495, 823, 0 },
+  { 3512, 668, 0 }, { 3530, 680, 0 }, { 0, 696, 344 }, { 3514, 823, 0 },
+  { 3533, 669, 0 }, { 3515, 823, 0 }, { 0, 693, 346 }, { 3503, 823, 0 },
+  { 3513, 695, 0 }, { 3517, 823, 0 }, { 3506, 823, 0 }, { 3515, 823, 0 },
+  { 3518, 807, 0 }, { 3523, 823, 0 }, { 3536, 811, 0 }, { 3520, 815, 0 },
+  { 3565, 697, 0 }, { 3563, 700, 0 }, { 3567, 735, 0 }, { 3523, 744, 0 },
+  { 3539, 713, 0 }, { 3539, 713, 0 }, { 3571, 719, 359 }, { 3570, 734, 0 },
+  { 3538, 742, 0 }, { 0, 756, 365 }, { 0, 759, 366 }, { 0, 769, 367 },
+  { 3561, 780, 0 }, { 3546, 786, 0 }, { 3576, 793, 0 }, { 3546, 814, 0 },
+  { 3547, 818, 0 }, { 3532, 824, 0 }, { 3581, 816, 0 }, { 0, 822, 380 },
+  { 3582, 795, 381 }, { 0, 798, 382 }, { 3583, 805, 0 }, { 3584, 813, 0 },
+  { 3541, 820, 0 }, { 0, 821, 386 }, { 3541, 849, 0 }, { 3588, 860, 0 },
+  { 3589, 864, 0 }, { 3539, 824, 0 }, { 3549, 833, 0 }, { 3556, 837, 0 },
+  { 0, 857, 393 }, { 3548, 874, 0 }, { 0, 825, 394 }, { 0, 836, 398 },
+  { 3547, 843, 0 }, { 3594, 888, 0 }, { 3565, 893, 0 }, { 3562, 848, 0 },
+  { 3597, 896, 0 }, { 0, 901, 425 }, { 3594, 861, 0 }, { 3570, 872, 0 },
+  { 3600, 898, 0 }, { 3572, 875, 0 }, { 3556, 886, 0 }, { 3562, 1000, 0 },
+  { 3569, 1004, 0 }, { 3576, 1008, 0 }, { 0, 1024, 435 }, { 0, 887, 436 },
+  { 3560, 889, 0 }, { 3580, 897, 0 }, { 3570, 900, 0 }, { 3609, 902, 0 },
+  { 3610, 903, 0 }, { 3567, 906, 0 }, { 3612, 908, 0 }, { 3613, 913, 0 },
+  { 0, 939, 451 }, { 3584, 940, 0 }, { 0, 950, 457 }, { 0, 953, 458 },
+  { 3605, 917, 0 }, { 3615, 918, 0 }, { 3596, 940, 0 }, { 3570, 925, 0 },
+  { 3622, 946, 0 }, { 0, 919, 465 }, { 0, 938, 466 }, { 3582, 964, 0 },
+  { 3589, 968, 0 }, { 0, 988, 469 }, { 0, 922, 470 }, { 3594, 975, 0 },
+  { 3590, 979, 0 }, { 3599, 975, 0 }, { 3598, 936, 0 }, { 3630, 937, 0 },
+  { 3593, 942, 0 }, { 3632, 965, 0 }, { 3592, 982, 0 }, { 3588, 987, 0 },
+  { 3636, 1002, 0 }, { 3610, 981, 0 }, { 3586, 949, 0 }, { 3609, 979, 0 },
+  { 3590, 949, 0 }, { 0, 997, 489 }, { 3613, 958, 0 }, { 0, 959, 491 },
+  { 3593, 978, 0 }, { 3598, 983, 0 }, { 3573, 953, 0 }, { 3599, 984, 0 },
+  { 3604, 989, 0 }, { 3605, 1001, 0 }, { 3646, 1010, 0 }, { 3603, 1003, 0 },
+  { 3599, 1006, 0 }, { 3602, 1007, 0 }, { 3619, 1022, 0 }, { 3607, 1029, 0 },
+  { 3603, 1032, 0 }, { 3583, 939, 0 }, { 3609, 1044, 0 }, { 3654, 1047, 0 },
+  { 3587, 953, 0 }, { 3622, 985, 0 }, { 3656, 1011, 0 }, { 3627, 1012, 0 },
+  { 3658, 1014, 515 }, { 3625, 1015, 0 }, { 3660, 1016, 0 }, { 0, 1017, 518 },
+  { 3627, 1018, 0 }, { 0, 1020, 521 }, { 3635, 1033, 0 }, { 0, 1019, 528 },
+  { 3665, 1021, 0 }, { 3666, 1023, 0 }, { 3622, 1025, 0 }, { 3639, 1026, 0 },
+  { 3638, 1027, 0 }, { 0, 1028, 534 }, { 3670, 1030, 0 }, { 3671, 1031, 0 },
+  { 0, 1034, 537 }, { 3672, 1036, 0 }, { 3673, 1037, 0 }, { 3674, 1038, 0 },
+  { 3675, 1039, 0 }, { 3676, 1040, 0 }, { 3632, 1041, 0 }, { 3650, 1042, 0 },
+  { 3663, 1033, 0 }, { 0, 1058, 546 }, { 0, 1043, 547 }, { 3680, 1045, 0 },
+  { 3681, 1046, 0 }, { 3644, 1033, 0 }, { 3682, 1048, 0 }, { 3683, 1049, 0 },
+  { 3638, 1050, 0 }, { 3644, 1051, 0 }, { 0, 1075, 554 }, { 3686, 1052, 0 },
+  { 3664, 1053, 0 }, { 3688, 1055, 0 }, { 0, 1054, 557 }, { 3689, 1056, 0 },
+  { 3690, 1057, 0 }, { 3645, 1059, 0 }, { 3645, 1060, 0 }, { 0, 1066, 563 },
+  { 0, 1091, 564 }, { 3665, 1096, 0 }, { 3664, 1108, 0 }, { 0, 1112, 566 },
+  { 3663, 1062, 0 }, { 0, 1107, 568 }, { 3649, 1064, 0 }, { 3654, 1065, 0 },
+  { 3674, 1076, 0 }, { 3658, 1067, 0 }, { 0, 1082, 2 }, { 0, 1068, 574 },
+  { 3674, 1069, 0 }, { 0, 1071, 579 }, { 3715, 1078, 0 }, { 0, 1079, 597 },
+  { 3682, 1101, 0 }, { 3666, 1065, 0 }, { 3670, 1067, 0 }, { 0, 1105, 599 },
+  { 3718, 1109, 0 }, { 3719, 1115, 0 }, { 3679, 1116, 0 }, { 3688, 1070, 0 },
+  { 3722, 1072, 0 }, { 0, 1089, 604 }, { 3681, 1094, 0 }, { 3694, 1073, 0 },
+  { 3725, 1077, 606 }, { 3686, 1080, 0 }, { 3681, 1086, 0 }, { 3728, 1081, 0 },
+  { 3700, 1083, 0 }, { 3699, 1098, 0 }, { 3701, 1098, 0 }, { 3733, 1084, 0 },
+  { 3701, 1085, 0 }, { 0, 1095, 617 }, { 3664, 1068, 0 }, { 3694, 1087, 0 },
+  { 3689, 1104, 0 }, { 3705, 1068, 0 }, { 3691, 1114, 0 }, { 3703, 1117, 0 },
+  { 3708, 1071, 0 }, { 3698, 1119, 0 }, { 3740, 1121, 0 }, { 0, 1088, 623 },
+  { 3713, 1092, 0 }, { 3718, 1110, 0 }, { 3720, 1124, 0 }, { 3678, 1071, 0 },
+  { 3665, 1071, 0 }, { 3741, 1121, 0 }, { 3717, 1090, 0 }, { 0, 1093, 644 },
+  { 3668, 1068, 0 }, { 3665, 1071, 0 }, { 3670, 1071, 0 }, { 3707, 1068, 0 },
+  { 3719, 1110, 0 }, { 3760, 1103, 0 }, { 3761, 1118, 0 }, { 0, 1122, 506 },
+  { 3730, 1125, 0 }, { 3686, 1071, 0 }, { 3716, 1090, 0 }, { 3746, 1097, 0 },
+  { 3712, 1121, 0 }, { 3755, 1106, 0 }, { 3704, 1090, 0 }, { 3704, 1090, 0 },
+  { 3707, 1090, 0 }, { 3720, 1090, 0 }, { 3722, 1090, 0 }, { 3754, 1126, 0 },
+  { 3763, 1123, 0 }, { 3791, 1127, 0 }, { 3758, 1129, 0 }, { 3767, 1126, 0 },
+  { 3795, 1133, 0 }, { 3796, 1139, 0 }, { 3805, 1099, 0 }, { 3806, 1100, 0 },
+  { 3753, 1128, 0 }, { 3777, 1143, 0 }, { 3783, 1130, 0 }, { 3796, 1134, 0 },
+  { 3788, 1130, 0 }, { 3803, 1138, 0 }, { 3788, 1150, 0 }, { 3834, 1102, 0 },
+  { 3756, 1126, 0 }, { 3769, 1126, 0 }, { 0, 1141, 701 }, { 3785, 1143, 0 },
+  { 3797, 1135, 0 }, { 3794, 1144, 0 }, { 3712, 1093, 0 }, { 3729, 1126, 0 },
+  { 3841, 1145, 717 }, { 3764, 1126, 0 }, { 0, 1111, 718 }, { 3843, 1140, 0 },
+  { 3807, 1142, 0 }, { 3780, 1126, 0 }, { 0, 1146, 721 }, { 3807, 1131, 0 },
+  { 3813, 1147, 0 }, { 3722, 1122, 0 }, { 3738, 1126, 0 }, { 0, 1113, 722 },
+  { 3827, 1148, 0 }, { 3737, 1126, 0 }, { 3858, 1151, 0 }, { 3855, 1148, 0 },
+  { 3845, 1113, 0 }, { 3743, 1126, 0 }, { 3771, 1126, 0 }, { 3804, 1126, 0 },
+  { 3817, 1152, 0 }, { 3777, 1141, 0 }, { 3774, 1141, 0 }, { 3792, 1141, 0 },
+  { 3779, 1141, 0 }, { 3856, 1149, 0 }, { 3818, 1151, 0 }, { 3817, 1149, 0 },
+  { 3817, 1166, 0 }, { 3863, 1136, 0 }, { 3864, 1154, 0 }, { 3820, 1132, 0 },
+  { 3823, 1155, 0 }, { 3860, 1151, 32 }, { 3824, 1156, 0 }, { 3826, 1163, 0 },
+  { 0, 1167, 757 }, { 3840, 1156, 0 }, { 3834, 1169, 0 }, { 3821, 1141, 0 },
+  { 3846, 1113, 0 }, { 3851, 1173, 0 }, { 3847, 1113, 0 }, { 3809, 1113, 0 },
+  { 3865, 1154, 0 }, { 3853, 1174, 0 }, { 3845, 1153, 0 }, { 3842, 1159, 0 },
+  { 3843, 1137, 0 }, { 3828, 1169, 0 }, { 3815, 1113, 0 }, { 3890, 1157, 0 },
+  { 3891, 1158, 0 }, { 3861, 1160, 0 }, { 3851, 1165, 0 }, { 3849, 1169, 0 },
+  { 3822, 1113, 0 }, { 3898, 1171, 0 }, { 3899, 1172, 0 }, { 3850, 1169, 0 },
+  { 3856, 1161, 0 }, { 3872, 1162, 0 }, { 3861, 1164, 0 }, { 0, 1188, 777 },
+  { 3827, 1167, 0 }, { 3847, 1167, 0 }, { 3832, 1167, 0 }, { 3870, 1195, 0 },
+  { 3861, 1209, 0 }, { 0, 1170, 780 }, { 3880, 1175, 0 }, { 3862, 1176, 0 },
+  { 3875, 1177, 0 }, { 0, 1186, 784 }, { 3872, 1178, 0 }, { 3911, 1179, 0 },
+  { 0, 1183, 84 }, { 3831, 1167, 0 }, { 3860, 1195, 0 }, { 3873, 1185, 0 },
+  { 3873, 1197, 0 }, { 3876, 1167, 0 }, { 0, 1200, 788 }, { 3917, 1180, 0 },
+  { 3874, 1181, 0 }, { 3893, 1190, 0 }, { 3921, 1194, 0 }, { 3878, 1181, 0 },
+  { 0, 1198, 77 }, { 3888, 1199, 0 }, { 3900, 1201, 0 }, { 3901, 1191, 0 },
+  { 3885, 1192, 0 }, { 3932, 1193, 0 }, { 3935, 1205, 0 }, { 3890, 1192, 0 },
+  { 3895, 1210, 0 }, { 3891, 1182, 0 }, { 3938, 1196, 0 }, { 3895, 1204, 0 },
+  { 3933, 1193, 0 }, { 3896, 1211, 0 }, { 3908, 1184, 0 }, { 3942, 1202, 0 },
+  { 3899, 1208, 0 }, { 3898, 1187, 0 }, { 3945, 1224, 0 }, { 3900, 1203, 0 },
+  { 3917, 1219, 0 }, { 3908, 1206, 0 }, { 3950, 1214, 0 }, { 3910, 1220, 0 },
+  { 0, 1230, 816 }, { 3953, 1189, 0 }, { 3908, 1212, 0 }, { 0, 1252, 819 },
+  { 3907, 1257, 0 }, { 3884, 1200, 0 }, { 0, 1258, 822 }, { 3879, 1198, 0 },
+  { 3912, 1250, 0 }, { 0, 1253, 826 }, { 0, 1260, 827 }, { 3875, 1200, 0 },
+  { 3916, 1216, 0 }, { 3910, 1231, 0 }, { 3971, 1234, 0 }, { 3888, 1198, 0 },
+  { 0, 1217, 834 }, { 3962, 1229, 0 }, { 3886, 1198, 0 }, { 3924, 1218, 0 },
+  { 3965, 1227, 0 }, { 3882, 1198, 0 }, { 3966, 1221, 0 }, { 3922, 1232, 0 },
+  { 3968, 1239, 0 }, { 3925, 1222, 0 }, { 3934, 1238, 0 }, { 3951, 1241, 0 },
+  { 3934, 1223, 0 }, { 3947, 1238, 0 }, { 3937, 1240, 0 }, { 3934, 1222, 0 },
+  { 3937, 1246, 0 }, { 3982, 1236, 0 }, { 3931, 1240, 0 }, { 3937, 1237, 0 },
+  { 3916, 1258, 0 }, { 3984, 1242, 0 }, { 3929, 1240, 0 }, { 0, 1226, 850 },
+  { 3918, 1260, 0 }, { 0, 1233, 851 }, { 3985, 1243, 852 }, { 3986, 1248, 0 },
+  { 3987, 1249, 0 }, { 3942, 1255, 0 }, { 3960, 1262, 0 }, { 3956, 1225, 0 },
+  { 0, 1228, 855 }, { 3954, 1235, 0 }, { 3958, 1256, 0 }, { 3961, 1259, 0 },
+  { 0, 1265, 860 }, { 3963, 1244, 0 }, { 3960, 1259, 0 }, { 3964, 1245, 0 },
+  { 3950, 1262, 0 }, { 3998, 1261, 0 }, { 3966, 1272, 0 }, { 3955, 1280, 0 },
+  { 4001, 1247, 0 }, { 4002, 1264, 0 }, { 3965, 1266, 0 }, { 3959, 1251, 0 },
+  { 4025, 1254, 0 }, { 3968, 1268, 0 }, { 4009, 1263, 0 }, { 0, 1305, 889 },
+  { 3964, 1269, 0 }, { 3985, 1279, 0 }, { 0, 1282, 892 }, { 3965, 1270, 0 },
+  { 4004, 1266, 0 }, { 3985, 1271, 0 }, { 0, 1287, 895 }, { 4015, 1273, 0 },
+  { 0, 1312, 158 }, { 0, 1317, 157 }, { 0, 1319, 162 }, { 0, 1275, 903 },
+  { 3969, 1254, 0 }, { 0, 1309, 155 }, { 3990, 1277, 0 }, { 4029, 1278, 0 },
+  { 0, 1289, 906 }, { 0, 1311, 907 }, { 0, 1320, 908 }, { 0, 1281, 909 },
+  { 4030, 1303, 0 }, { 0, 1307, 911 }, { 3993, 1321, 0 }, { 4033, 1283, 0 },
+  { 4003, 1285, 0 }, { 4035, 1286, 0 }, { 4037, 1292, 0 }, { 4036, 1322, 0 },
+  { 3993, 1323, 0 }, { 4013, 1331, 0 }, { 4010, 1336, 0 }, { 4000, 1337, 0 },
+  { 4002, 1288, 0 }, { 3994, 1322, 0 }, { 4002, 1337, 0 }, { 4002, 1337, 0 },
+  { 4049, 1297, 0 }, { 4050, 1290, 0 }, { 4006, 1291, 0 }, { 3996, 1319, 0 },
+  { 3985, 1319, 0 }, { 4053, 1294, 0 }, { 4015, 1337, 0 }, { 4016, 1295, 0 },
+  { 4026, 1300, 0 }, { 4057, 1296, 0 }, { 4030, 1298, 0 }, { 4014, 1299, 0 },
+  { 4027, 1319, 0 }, { 4012, 1337, 0 }, { 4026, 1310, 0 }, { 4021, 1316, 0 },
+  { 4022, 1317, 0 }, { 0, 1301, 932 }, { 3986, 1317, 0 }, { 4036, 1302, 0 },
+  { 4021, 1313, 0 }, { 4032, 1325, 0 }, { 4056, 1300, 0 }, { 4029, 1327, 0 },
+  { 4069, 1328, 0 }, { 4043, 1330, 0 }, { 4071, 1315, 0 }, { 4031, 1324, 0 },
+  { 4031, 1307, 0 }, { 4036, 1332, 0 }, { 4040, 1304, 0 }, { 4048, 1318, 0 },
+  { 4034, 1306, 0 }, { 4052, 1343, 0 }, { 0, 1359, 946 }, { 4082, 1314, 0 },
+  { 4045, 1335, 0 }, { 4037, 1302, 0 }, { 0, 1326, 89 }, { 0, 1338, 949 },
+  { 4036, 1329, 0 }, { 4046, 1368, 0 }, { 4053, 1373, 0 }, { 4062, 1374, 0 },
+  { 4057, 1334, 0 }, { 4047, 1339, 0 }, { 4041, 1368, 0 }, { 4094, 1353, 0 },
+  { 4065, 1354, 0 }, { 4061, 1339, 0 }, { 4052, 1369, 0 }, { 4057, 1372, 0 },
+  { 4057, 1381, 0 }, { 0, 1386, 188 }, { 4106, 1344, 0 }, { 4067, 1348, 0 },
+  { 4108, 1357, 0 }, { 4109, 1361, 0 }, { 4080, 1341, 0 }, { 4066, 1342, 0 },
+  { 4113, 1345, 0 }, { 4114, 1351, 0 }, { 4059, 1339, 0 }, { 4085, 1382, 0 },
+  { 4065, 1350, 0 }, { 4117, 1352, 978 }, { 4089, 1346, 0 }, { 0, 1362, 980 },
+  { 0, 1349, 981 }, { 4086, 1355, 0 }, { 4121, 1356, 0 }, { 4122, 1358, 0 },
+  { 4094, 1360, 0 }, { 4073, 1363, 0 }, { 4098, 1364, 0 }, { 4091, 1365, 0 },
+  { 0, 1385, 990 }, { 0, 1366, 991 }, { 4096, 1367, 0 }, { 4128, 1370, 0 },
+  { 4129, 1371, 0 }, { 4130, 1375, 0 }, { 4073, 1386, 0 }, { 4131, 1376, 0 },
+  { 4068, 1386, 0 }, { 4088, 1377, 0 }, { 4133, 1394, 0 }, { 4099, 1396, 0 },
+  { 4091, 1378, 0 }, { 0, 1412, 999 }, { 4136, 1380, 0 }, { 4075, 1386, 0 },
+  { 4091, 1387, 0 }, { 4096, 1389, 0 }, { 4112, 1391, 0 }, { 4060, 1386, 0 },
+  { 4110, 1397, 0 }, { 4141, 1398, 0 }, { 0, 1400, 1005 }, { 4101, 1401, 0 },
+  { 4146, 1402, 0 }, { 0, 1404, 1013 }, { 4103, 1392, 0 }, { 4111, 1393, 0 },
+  { 4120, 1409, 0 }, { 4110, 1395, 0 }, { 4117, 1399, 0 }, { 4154, 1415, 0 },
+  { 0, 1419, 1026 }, { 4155, 1406, 0 }, { 4115, 1420, 0 }, { 4115, 1399, 0 },
+  { 4123, 1421, 0 }, { 4160, 1422, 0 }, { 4119, 1409, 0 }, { 4139, 1416, 0 },
+  { 0, 1417, 248 }, { 0, 1427, 1031 }, { 0, 1429, 252 }, { 4135, 1405, 0 },
+  { 4129, 1408, 0 }, { 0, 1414, 1042 }, { 0, 1388, 1043 }, { 4142, 1410, 0 },
+  { 4138, 1411, 0 }, { 4176, 1390, 0 }, { 4137, 1430, 0 }, { 4138, 1432, 0 },
+  { 4108, 1404, 0 }, { 4113, 1421, 0 }, { 4142, 1437, 0 }, { 4152, 1449, 0 },
+  { 4145, 1404, 0 }, { 4152, 1407, 0 }, { 4150, 1413, 0 }, { 0, 1418, 1051 },
+  { 4196, 1440, 0 }, { 0, 1444, 1053 }, { 4163, 1458, 0 }, { 4170, 1438, 0 },
+  { 4168, 1439, 0 }, { 4169, 1451, 0 }, { 4179, 1452, 0 }, { 4160, 1438, 0 },
+  { 4165, 1453, 0 }, { 4175, 1457, 0 }, { 0, 1463, 1064 }, { 4136, 1429, 0 },
+  { 4126, 1429, 0 }, { 4210, 1453, 0 }, { 4219, 1423, 0 }, { 4168, 1429, 0 },
+  { 4170, 1460, 0 }, { 4189, 1460, 0 }, { 4176, 1424, 0 }, { 4164, 1453, 0 },
+  { 4177, 1426, 0 }, { 4178, 1431, 0 }, { 0, 1436, 1068 }, { 4188, 1443, 0 },
+  { 4161, 1427, 0 }, { 4177, 1448, 0 }, { 4125, 1427, 0 }, { 4167, 1429, 0 },
+  { 4225, 1450, 0 }, { 0, 1455, 264 }, { 4227, 1456, 0 }, { 4226, 1464, 0 },
+  { 4188, 1467, 0 }, { 4230, 1470, 0 }, { 4186, 1471, 0 }, { 4202, 1475, 0 },
+  { 4203, 1476, 0 }, { 4191, 1479, 0 }, { 4205, 1484, 0 }, { 4187, 1470, 0 },
+  { 4210, 1485, 0 }, { 4177, 1463, 0 }, { 4218, 1463, 0 }, { 4195, 1425, 0 },
+  { 4201, 1444, 0 }, { 4196, 1433, 0 }, { 4243, 1442, 0 }, { 4199, 1428, 0 },
+  { 4246, 1459, 1087 }, { 4247, 1468, 0 }, { 4187, 1464, 0 }, { 0, 1472, 410 },
+  { 4219, 1474, 0 }, { 4212, 1435, 0 }, { 0, 1445, 1092 }, { 4218, 1434, 0 },
+  { 4206, 1446, 0 }, { 0, 1447, 1094 }, { 0, 1454, 1095 }, { 4239, 1485, 0 },
+  { 4207, 1425, 0 }, { 4213, 1477, 0 }, { 0, 1478, 523 }, { 4216, 1488, 0 },
+  { 4248, 1468, 0 }, { 4262, 1461, 0 }, { 4263, 1462, 0 }, { 4217, 1465, 0 },
+  { 4227, 1469, 0 }, { 4266, 1481, 0 }, { 4267, 1473, 0 }, { 4227, 1490, 0 },
+  { 4234, 1518, 0 }, { 4230, 1519, 0 }, { 0, 1482, 1106 }, { 0, 1495, 1107 },
+  { 4228, 1486, 0 }, { 0, 1493, 1110 }, { 0, 1501, 1111 }, { 4242, 1483, 0 },
+  { 4232, 1487, 0 }, { 4233, 1513, 0 }, { 4253, 1491, 0 }, { 4235, 1492, 0 },
+  { 4282, 1503, 0 }, { 4243, 1509, 0 }, { 4288, 1494, 284 }, { 4247, 1496, 0 },
+  { 4257, 1504, 0 }, { 4210, 1478, 0 }, { 0, 1505, 336 }, { 4221, 1478, 0 },
+  { 4218, 1478, 0 }, { 4260, 1514, 0 }, { 4294, 1520, 0 }, { 4283, 1505, 0 },
+  { 4203, 1472, 0 }, { 4290, 1500, 0 }, { 0, 1524, 1126 }, { 4250, 1500, 0 },
+  { 4261, 1489, 0 }, { 4252, 1499, 0 }, { 4263, 1525, 0 }, { 4252, 1528, 0 },
+  { 4264, 1541, 0 }, { 4273, 1543, 0 }, { 4257, 1548, 0 }, { 0, 1497, 1132 },
+  { 0, 1506, 296 }, { 4262, 1543, 0 }, { 0, 1532, 295 }, { 4266, 1546, 0 },
+  { 0, 1547, 294 }, { 4264, 1508, 0 }, { 4265, 1534, 0 }, { 4266, 1549, 0 },
+  { 0, 1552, 1135 }, { 0, 1555, 395 }, { 4312, 1502, 0 }, { 4269, 1527, 0 },
+  { 0, 1531, 1138 }, { 4270, 1553, 0 }, { 4315, 1556, 0 }, { 4273, 1495, 0 },
+  { 4280, 1571, 0 }, { 4254, 1505, 0 }, { 4275, 1501, 0 }, { 0, 1557, 307 },
+  { 4321, 1510, 0 }, { 0, 1572, 306 }, { 4322, 1511, 0 }, { 4240, 1505, 0 },
+  { 4242, 1505, 0 }, { 4325, 1512, 0 }, { 0, 1515, 1142 }, { 4291, 1526, 0 },
+  { 0, 1529, 314 }, { 4285, 1516, 0 }, { 4286, 1542, 0 }, { 4297, 1550, 0 },
+  { 4297, 1561, 0 }, { 4292, 1565, 0 }, { 4337, 1566, 0 }, { 4308, 1570, 0 },
+  { 4295, 1573, 0 }, { 4293, 1574, 0 }, { 4311, 1552, 0 }, { 0, 1560, 327 },
+  { 4342, 1578, 0 }, { 4312, 1578, 0 }, { 4343, 1533, 0 }, { 4315, 1535, 0 },
+  { 4350, 1538, 0 }, { 4303, 1532, 0 }, { 4324, 1544, 0 }, { 4304, 1532, 0 },
+  { 4306, 1547, 0 }, { 0, 1562, 1162 }, { 4310, 1554, 0 }, { 4270, 1557, 0 },
+  { 4312, 1558, 0 }, { 4358, 1577, 0 }, { 4344, 1578, 0 }, { 4314, 1580, 0 },
+  { 4361, 1583, 0 }, { 4280, 1529, 0 }, { 4333, 1585, 0 }, { 4328, 1529, 0 },
+  { 4322, 1588, 0 }, { 4283, 1515, 0 }, { 4317, 1557, 0 }, { 4328, 1594, 0 },
+  { 4318, 1557, 0 }, { 4285, 1572, 0 }, { 4289, 1515, 0 }, { 4337, 1595, 0 },
+  { 4286, 1560, 0 }, { 4333, 1537, 0 }, { 4334, 1560, 0 }, { 4364, 1583, 0 },
+  { 4344, 1563, 0 }, { 4352, 1576, 0 }, { 4334, 1551, 0 }, { 4381, 1567, 0 },
+  { 4382, 1559, 0 }, { 0, 1575, 1184 }, { 4349, 1589, 0 }, { 4357, 1590, 0 },
+  { 4309, 1562, 0 }, { 4385, 1597, 0 }, { 4386, 1603, 0 }, { 4335, 1560, 0 },
+  { 4352, 1607, 0 }, { 4358, 1521, 0 }, { 4348, 1530, 0 }, { 0, 1545, 1190 },
+  { 4393, 1579, 0 }, { 4346, 1582, 0 }, { 4367, 1588, 0 }, { 0, 1584, 1193 },
+  { 4351, 1581, 0 }, { 0, 1592, 349 }, { 4312, 1562, 0 }, { 4396, 1522, 0 },
+  { 4353, 1591, 0 }, { 4354, 1593, 0 }, { 4369, 1599, 0 }, { 0, 1610, 1197 },
+  { 4357, 1596, 0 }, { 4375, 1600, 0 }, { 4359, 1604, 0 }, { 4404, 1604, 0 },
+  { 4406, 1536, 0 }, { 4369, 1588, 0 }, { 4358, 1593, 0 }, { 4407, 1598, 0 },
+  { 4330, 1594, 0 }, { 4366, 1602, 0 }, { 4364, 1609, 0 }, { 4366, 1613, 0 },
+  { 0, 1616, 1206 }, { 4358, 1604, 0 }, { 4375, 1621, 0 }, { 4417, 1627, 0 },
+  { 4377, 1631, 0 }, { 0, 1634, 1213 }, { 4419, 1605, 0 }, { 4375, 1614, 0 },
+  { 4421, 1617, 0 }, { 4392, 1539, 0 }, { 4392, 1539, 0 }, { 4424, 1540, 1218 },
+  { 4381, 1564, 0 }, { 0, 1568, 97 }, { 0, 1569, 1223 }, { 0, 1601, 1228 },
+  { 4389, 1587, 0 }, { 0, 1618, 1229 }, { 4409, 1622, 0 }, { 4406, 1624, 0 },
+  { 4404, 1652, 0 }, { 0, 1654, 1233 }, { 4390, 1587, 0 }, { 4410, 1608, 0 },
+  { 4440, 1628, 0 }, { 4395, 1623, 0 }, { 4397, 1587, 0 }, { 4442, 1630, 0 },
+  { 4413, 1635, 0 }, { 4433, 1587, 0 }, { 0, 1620, 1245 }, { 4368, 1616, 0 },
+  { 4414, 1616, 1208 }, { 4403, 1587, 0 }, { 4444, 1642, 0 }, { 4414, 1644, 0 },
+  { 4415, 1650, 0 }, { 0, 1646, 373 }, { 4448, 1655, 0 }, { 4415, 1616, 1209 },
+  { 4426, 1568, 1220 }, { 4452, 1656, 0 }, { 4416, 1660, 0 }, { 4427, 1656, 0 },
+  { 4425, 1662, 0 }, { 4457, 1619, 0 }, { 0, 1625, 1256 }, { 4413, 1612, 0 },
+  { 0, 1626, 1258 }, { 4459, 1629, 0 }, { 4460, 1632, 0 }, { 4422, 1633, 0 },
+  { 4462, 1636, 0 }, { 4453, 1656, 0 }, { 4442, 1637, 0 }, { 4417, 1641, 0 },
+  { 4466, 1651, 381 }, { 4430, 1640, 0 }, { 4392, 1568, 0 }, { 4428, 1568, 0 },
+  { 4408, 1655, 0 }, { 4475, 1657, 0 }, { 4446, 1659, 0 }, { 4438, 1638, 0 },
+  { 4483, 1639, 0 }, { 4435, 1618, 0 }, { 4449, 1646, 0 }, { 4484, 1663, 0 },
+  { 4459, 1664, 0 }, { 4448, 1665, 0 }, { 4491, 1674, 0 }, { 4451, 1677, 0 },
+  { 4496, 1678, 0 }, { 4458, 1680, 0 }, { 4453, 1666, 0 }, { 4461, 1667, 0 },
+  { 4471, 1683, 0 }, { 4461, 1649, 0 }, { 4416, 1655, 0 }, { 4468, 1653, 0 },
+  { 4505, 1669, 0 }, { 4454, 1680, 0 }, { 0, 1673, 1290 }, { 4441, 1663, 0 },
+  { 4466, 1653, 0 }, { 4506, 1670, 0 }, { 4470, 1683, 0 }, { 4473, 1679, 0 },
+  { 4467, 1684, 0 }, { 4509, 1686, 0 }, { 4511, 1685, 0 }, { 4510, 1687, 0 },
+  { 0, 1691, 386 }, { 4478, 1672, 0 }, { 4472, 1675, 0 }, { 0, 1681, 1296 },
+  { 4484, 1647, 0 }, { 0, 1661, 1298 }, { 4471, 1682, 0 }, { 4518, 1689, 0 },
+  { 4479, 1694, 0 }, { 4476, 1688, 0 }, { 4482, 1695, 0 }, { 0, 1700, 1303 },
+  { 4482, 1643, 0 }, { 4502, 1645, 0 }, { 4500, 1692, 0 }, { 4499, 1693, 0 },
+  { 4493, 1707, 0 }, { 4504, 1711, 0 }, { 4491, 1692, 0 }, { 4544, 1690, 0 },
+  { 4509, 1705, 0 }, { 4539, 1707, 0 }, { 4504, 1648, 0 }, { 4502, 1696, 0 },
+  { 4550, 1698, 0 }, { 0, 1703, 425 }, { 4551, 1712, 0 }, { 4493, 1707, 0 },
+  { 4523, 1708, 0 }, { 4524, 1709, 0 }, { 4557, 1718, 0 }, { 4524, 1658, 0 },
+  { 4513, 1671, 0 }, { 4519, 1676, 0 }, { 0, 1702, 1323 }, { 4561, 1724, 0 },
+  { 4532, 1726, 0 }, { 4521, 1724, 0 }, { 0, 1728, 454 }, { 4536, 1732, 0 },
+  { 4566, 1737, 0 }, { 4531, 1739, 0 }, { 4531, 1742, 0 }, { 0, 1748, 1332 },
+  { 4571, 1699, 0 }, { 4511, 1712, 0 }, { 4528, 1715, 0 }, { 4539, 1741, 0 },
+  { 4574, 1743, 1336 }, { 4575, 1753, 0 }, { 4549, 1759, 0 }, { 4544, 1760, 0 },
+  { 4578, 1764, 0 }, { 4516, 1661, 0 }, { 0, 1701, 1340 }, { 4539, 1720, 0 },
+  { 4553, 1722, 0 }, { 4540, 1734, 0 }, { 0, 1744, 1344 }, { 4560, 1704, 0 },
+  { 0, 1710, 475 }, { 4557, 1706, 0 }, { 4525, 1737, 0 }, { 4565, 1717, 0 },
+  { 4578, 1721, 0 }, { 0, 1736, 1358 }, { 4606, 1725, 0 }, { 4580, 1713, 0 },
+  { 4529, 1728, 0 }, { 0, 1719, 1362 }, { 4570, 1717, 0 }, { 4611, 1723, 0 },
+  { 4581, 1714, 0 }, { 4585, 1722, 0 }, { 4576, 1725, 0 }, { 4588, 1745, 0 },
+  { 0, 1747, 442 }, { 4575, 1716, 0 }, { 4620, 1752, 0 }, { 4572, 1729, 0 },
+  { 4533, 1737, 0 }, { 4582, 1754, 0 }, { 4584, 1762, 0 }, { 4579, 1769, 0 },
+  { 4624, 1733, 0 }, { 4638, 1757, 0 }, { 4613, 1714, 0 }, { 0, 1756, 1371 },
+  { 4590, 1750, 0 }, { 0, 1767, 457 }, { 4549, 1710, 0 }, { 4591, 1710, 0 },
+  { 4627, 1756, 0 }, { 4592, 1710, 0 }, { 4639, 1768, 0 }, { 4531, 1701, 0 },
+  { 4608, 1736, 0 }, { 4610, 1719, 0 }, { 4593, 1710, 0 }, { 4573, 1729, 0 },
+  { 4563, 1710, 0 }, { 4581, 1750, 0 }, { 4558, 1710, 0 }, { 4573, 1747, 0 },
+  { 4573, 1710, 0 }, { 4611, 1735, 0 }, { 4626, 1761, 0 }, { 4635, 1774, 0 },
+  { 4618, 1747, 0 }, { 4630, 1727, 0 }, { 4633, 1746, 0 }, { 4641, 1770, 1384 },
+  { 4642, 1770, 1385 }, { 4643, 1770, 1386 }, { 0, 1749, 1405 }, { 4666, 1730, 0 },
+  { 4627, 1751, 0 }, { 4587, 1756, 0 }, { 4629, 1756, 0 }, { 0, 1770, 459 },
+  { 4636, 1755, 0 }, { 0, 1775, 1408 }, { 4672, 1731, 0 }, { 4643, 1738, 0 },
+  { 4644, 1770, 0 }, { 0, 1740, 1410 }, { 4584, 1756, 0 }, { 4627, 1756, 0 },
+  { 4644, 1772, 0 }, { 4595, 1756, 0 }, { 4652, 1772, 0 }, { 4608, 1756, 0 },
+  { 4605, 1756, 0 }, { 4643, 1776, 0 }, { 4640, 1778, 0 }, { 4645, 1782, 0 },
+  { 4655, 1779, 0 }, { 4642, 1780, 0 }, { 4688, 1781, 0 }, { 4689, 1773, 0 },
+  { 0, 1784, 109 }, { 4693, 1787, 0 }, { 4655, 1758, 0 }, { 4664, 1777, 0 },
+  { 4636, 1776, 0 }, { 4651, 1792, 0 }, { 4655, 1771, 0 }, { 4704, 1766, 0 },
+  { 4666, 1783, 0 }, { 4604, 1770, 0 }, { 4646, 1770, 0 }, { 4662, 1788, 0 },
+  { 4649, 1778, 0 }, { 4602, 1770, 0 }, { 4705, 1766, 0 }, { 4678, 1794, 0 },
+  { 4710, 1763, 0 }, { 4621, 1770, 0 }, { 4603, 1770, 0 }, { 4646, 1770, 0 },
+  { 4711, 1765, 0 }, { 4616, 1770, 0 }, { 4656, 1785, 0 }, { 4666, 1786, 0 },
+  { 4626, 1770, 0 }, { 4656, 1785, 0 }, { 4698, 1785, 0 }, { 4713, 1801, 0 },
+  { 4649, 1784, 0 }, { 4656, 1784, 0 }, { 4687, 1790, 0 }, { 4663, 1789, 0 },
+  { 4692, 1784, 0 }, { 4667, 1789, 0 }, { 4664, 1785, 0 }, { 0, 1806, 1439 },
+  { 4673, 1795, 0 }, { 4662, 1785, 0 }, { 4691, 1796, 0 }, { 4675, 1802, 0 },
+  { 4673, 1785, 0 }, { 4667, 1785, 0 }, { 4686, 1791, 0 }, { 0, 1800, 1442 },
+  { 4673, 1793, 0 }, { 4684, 1797, 0 }, { 4686, 1798, 0 }, { 4680, 1799, 0 },
+  { 4691, 1816, 0 }, { 4683, 1803, 0 }, { 4684, 1799, 0 }, { 0, 1814, 84 },
+  { 4689, 1804, 0 }, { 4730, 1813, 0 }, { 4687, 1808, 0 }, { 4683, 1811, 0 },
+  { 4690, 1815, 0 }, { 4690, 1819, 0 }, { 4736, 1826, 0 }, { 4710, 1828, 0 },
+  { 4694, 1812, 0 }, { 4707, 1818, 0 }, { 4706, 1829, 0 }, { 4698, 1812, 0 },
+  { 4742, 1805, 0 }, { 4697, 1817, 0 }, { 4714, 1822, 0 }, { 4745, 1831, 0 },
+  { 4702, 1809, 0 }, { 4747, 1821, 1460 }, { 4715, 1807, 0 }, { 4749, 1810, 0 },
+  { 4750, 1820, 0 }, { 4717, 1823, 0 }, { 4708, 1830, 0 }, { 4711, 1834, 0 },
+  { 0, 1824, 1469 }, { 4726, 1825, 0 }, { 0, 1832, 1205 }, { 4729, 1839, 0 },
+  { 4738, 1845, 0 }, { 4727, 1834, 0 }, { 0, 1827, 1473 }, { 4733, 1833, 0 },
+  { 4714, 1834, 0 }, { 4741, 1835, 0 }, { 4722, 1834, 0 }, { 4773, 1836, 0 },
+  { 4758, 1834, 0 }, { 4724, 1834, 0 }, { 4728, 1834, 0 }, { 4733, 1837, 0 },
+  { 4741, 1838, 0 }, { 4778, 1840, 0 }, { 4739, 1858, 0 }, { 4729, 1841, 0 },
+  { 4753, 1842, 0 }, { 4757, 1843, 0 }, { 4767, 1845, 0 }, { 4742, 1848, 0 },
+  { 0, 1844, 1481 }, { 4787, 1846, 0 }, { 4754, 1843, 0 }, { 4742, 1880, 0 },
+  { 4789, 1850, 0 }, { 4790, 1851, 0 }, { 4734, 1832, 0 }, { 4762, 1859, 0 },
+  { 4740, 1858, 0 }, { 4720, 1832, 0 }, { 4793, 1871, 0 }, { 4759, 1852, 0 },
+  { 0, 1853, 1484 }, { 4751, 1855, 0 }, { 4752, 1881, 0 }, { 4753, 1856, 0 },
+  { 4755, 1882, 0 }, { 4800, 1857, 0 }, { 4801, 1860, 0 }, { 4756, 1861, 0 },
+  { 4803, 1873, 0 }, { 4766, 1877, 0 }, { 4762, 1862, 0 }, { 4763, 1888, 0 },
+  { 4808, 1864, 0 }, { 4762, 1878, 0 }, { 4757, 1873, 0 }, { 4763, 1863, 0 },
+  { 4776, 1867, 0 }, { 4812, 1865, 0 }, { 4780, 1866, 0 }, { 4768, 1868, 0 },
+  { 4787, 1869, 0 }, { 0, 1885, 1492 }, { 0, 1870, 1493 }, { 4815, 1868, 0 },
+  { 0, 1872, 1494 }, { 4817, 1874, 0 }, { 4818, 1875, 0 }, { 4819, 1876, 0 },
+  { 4820, 1879, 0 }, { 4821, 1889, 1499 }, { 4776, 1883, 0 }, { 4782, 1884, 0 },
+  { 0, 1908, 1502 }, { 4824, 1886, 0 }, { 4781, 1887, 0 }, { 4826, 1902, 0 },
+  { 0, 1890, 1505 }, { 4827, 1891, 0 }, { 4801, 1892, 0 }, { 4829, 1893, 0 },
+  { 4830, 1894, 0 }, { 0, 1895, 1510 }, { 4831, 1899, 0 }, { 4832, 1896, 1 },
+  { 4802, 1898, 0 }, { 4803, 1900, 0 }, { 4835, 1901, 5 }, { 4805, 1905, 0 },
+  { 4837, 1906, 0 }, { 4838, 1907, 0 }, { 4839, 1910, 0 }, { 0, 1911, 13 },
+  { 4834, 1912, 0 }, { 4841, 1913, 15 }, { 0, 1914, 16 }, { 4802, 1915, 0 },
+  { 4812, 1916, 0 }, { 0, 1917, 19 }, { 4806, 1918, 0 }, { 0, 1919, 21 },
+  { 4815, 1920, 0 }, { 4801, 1922, 0 }, { 4800, 1923, 0 }, { 0, 1924, 26 },
+  { 0, 1926, 28 }, { 4848, 1927, 0 }, { 0, 1928, 25 }, { 4806, 1929, 0 },
+  { 0, 1930, 31 }, { 0, 1931, 32 }, { 4819, 1932, 0 }, { 4824, 1968, 0 },
+  { 4801, 1934, 0 }, { 4813, 1935, 0 }, { 4816, 1936, 0 }, { 4855, 1937, 0 },
+  { 4816, 1938, 0 }, { 0, 1939, 41 }, { 4819, 1940, 0 }, { 4814, 1941, 0 },
+  { 4828, 1944, 0 }, { 4811, 1945, 0 }, { 4858, 1961, 0 }, { 4862, 1946, 0 },
+  { 4816, 1947, 0 }, { 4818, 1949, 0 }, { 4818, 1960, 0 }, { 0, 1950, 57 },
+  { 4836, 1962, 0 }, { 4836, 1948, 0 }, { 4868, 1951, 0 }, { 0, 1952, 61 },
+  { 4827, 1956, 0 }, { 4843, 1954, 0 }, { 0, 1955, 65 }, { 0, 1957, 66 },
+  { 0, 1958, 67 }, { 4827, 1959, 0 }, { 0, 1963, 69 }, { 4872, 1964, 0 },
+  { 4833, 1965, 0 }, { 4874, 2013, 0 }, { 4840, 1970, 0 }, { 4836, 1980, 0 },
+  { 4833, 1971, 0 }, { 0, 1972, 83 }, { 4832, 1977, 0 }, { 4832, 1978, 0 },
+  { 4849, 1974, 0 }, { 4837, 1975, 0 }, { 4838, 1975, 0 }, { 0, 1976, 111 },
+  { 4850, 1979, 0 }, { 4857, 1983, 0 }, { 4849, 1984, 0 }, { 4890, 1985, 117 },
+  { 0, 1987, 119 }, { 4860, 1989, 0 }, { 4852, 1990, 0 }, { 4894, 1991, 0 },
+  { 4852, 1975, 0 }, { 4876, 1992, 0 }, { 4896, 1993, 0 }, { 0, 1994, 127 },
+  { 4856, 1995, 0 }, { 4899, 1996, 0 }, { 4849, 1975, 0 }, { 4865, 2004, 0 },
+  { 4854, 1975, 0 }, { 0, 1997, 132 }, { 0, 1998, 133 }, { 0, 2000, 135 },
+  { 4856, 2001, 0 }, { 4871, 2002, 0 }, { 4873, 2006, 0 }, { 4842, 1975, 0 },
+  { 0, 2007, 142 }, { 4866, 2008, 0 }, { 4874, 2009, 0 }, { 0, 2010, 144 },
+  { 0, 2011, 145 }, { 4906, 2012, 0 }, { 4876, 2014, 0 }, { 4870, 2015, 0 },
+  { 4909, 2016, 0 }, { 0, 2018, 153 }, { 0, 2020, 156 }, { 4879, 2021, 0 },
+  { 0, 2022, 164 }, { 4860, 2023, 0 }, { 4912, 2024, 0 }, { 4913, 2026, 0 },
+  { 4870, 2028, 0 }, { 0, 2029, 172 }, { 4874, 2030, 0 }, { 0, 2031, 171 },
+  { 4879, 2032, 0 }, { 4876, 2033, 0 }, { 4875, 2033, 0 }, { 0, 2034, 176 },
+  { 4920, 2035, 0 }, { 0, 2036, 178 }, { 4890, 2037, 0 }, { 4922, 2038, 180 },
+  { 0, 2040, 182 }, { 4892, 2042, 0 }, { 4924, 2043, 0 }, { 4885, 2047, 0 },
+  { 4895, 2044, 0 }, { 4883, 2076, 0 }, { 4894, 2046, 0 }, { 4930, 2048, 0 },
+  { 0, 2049, 193 }, { 0, 2050, 194 }, { 0, 2051, 195 }, { 4900, 2052, 0 },
+  { 4932, 2053, 0 }, { 0, 2054, 198 }, { 4933, 2055, 0 }, { 0, 2058, 202 },
+  { 4883, 2076, 0 }, { 0, 2059, 203 }, { 4883, 2060, 0 }, { 4935, 2061, 0 },
+  { 0, 2062, 206 }, { 0, 2063, 207 }, { 4937, 2064, 0 }, { 4900, 2065, 0 },
+  { 0, 2068, 212 }, { 0, 2069, 213 }, { 0, 2070, 214 }, { 4908, 2071, 0 },
+  { 4913, 2072, 0 }, { 0, 2073, 218 }, { 4912, 2074, 0 }, { 0, 2075, 220 },
+  { 4902, 2077, 0 }, { 4905, 2078, 0 }, { 4904, 2080, 0 }, { 4934, 2083, 0 },
+  { 4914, 2080, 0 }, { 4905, 2080, 0 }, { 4916, 2084, 0 }, { 4909, 2080, 0 },
+  { 4933, 2085, 0 }, { 0, 2086, 261 }, { 4912, 2081, 0 }, { 4909, 2081, 0 },
+  { 4913, 2081, 0 }, { 4956, 2087, 0 }, { 4930, 2085, 0 }, { 0, 2088, 219 },
+  { 4932, 2090, 0 }, { 4927, 2081, 0 }, { 4931, 2093, 0 }, { 4914, 2080, 0 },
+  { 4931, 2094, 0 }, { 4919, 2080, 0 }, { 4909, 2080, 0 }, { 4921, 2080, 0 },
+  { 4921, 2081, 0 }, { 4925, 2081, 0 }, { 4956, 2096, 0 }, { 0, 2097, 273 },
+  { 4909, 2080, 0 }, { 0, 2098, 270 }, { 0, 2099, 275 }, { 4942, 2100, 0 },
+  { 4935, 2101, 0 }, { 4938, 2102, 0 }, { 4935, 2085, 0 }, { 4942, 2104, 0 },
+  { 4948, 2105, 0 }, { 4939, 2106, 0 }, { 4953, 2108, 0 }, { 4950, 2109, 0 },
+  { 4932, 2085, 0 }, { 0, 2110, 285 }, { 4942, 2114, 0 }, { 4937, 2115, 0 },
+  { 4954, 2116, 0 }, { 4919, 2080, 0 }, { 4957, 2118, 0 }, { 4950, 2119, 0 },
+  { 4941, 2114, 0 }, { 4939, 2116, 0 }, { 4958, 2123, 0 }, { 4946, 2125, 0 },
+  { 4961, 2127, 0 }, { 4945, 2129, 0 }, { 4948, 2130, 0 }, { 4960, 2131, 0 },
+  { 4952, 2116, 0 }, { 4961, 2129, 0 }, { 4968, 2130, 0 }, { 4955, 2133, 0 },
+  { 0, 2112, 338 }, { 4969, 2113, 0 }, { 5001, 2117, 0 }, { 4971, 2120, 0 },
+  { 5004, 2121, 343 }, { 4976, 2124, 0 }, { 4975, 2128, 0 }, { 5007, 2132, 0 },
+  { 5008, 2134, 0 }, { 4968, 2135, 0 }, { 0, 2136, 351 }, { 4964, 2137, 0 },
+  { 0, 2138, 355 }, { 4978, 2139, 0 }, { 4982, 2140, 0 }, { 4969, 2141, 0 },
+  { 0, 2142, 359 }, { 4988, 2143, 0 }, { 4990, 2144, 0 }, { 4983, 2148, 0 },
+  { 4992, 2149, 0 }, { 0, 2150, 370 }, { 4990, 2151, 0 }, { 5021, 2152, 0 },
+  { 4993, 2153, 0 }, { 4979, 2165, 0 }, { 0, 2154, 379 }, { 0, 2156, 381 },
+  { 0, 2158, 383 }, { 0, 2159, 384 }, { 5024, 2160, 0 }, { 4989, 2143, 0 },
+  { 4994, 2162, 0 }, { 0, 2163, 388 }, { 0, 2164, 389 }, { 4987, 2166, 0 },
+  { 4990, 2167, 0 }, { 4984, 2169, 0 }, { 5030, 2172, 0 }, { 0, 2173, 421 },
+  { 5021, 2174, 0 }, { 4989, 2175, 0 }, { 0, 2176, 424 }, { 5006, 2178, 0 },
+  { 4987, 2179, 0 }, { 0, 2180, 428 }, { 4988, 2181, 0 }, { 5009, 2182, 0 },
+  { 5001, 2183, 0 }, { 5004, 2184, 0 }, { 5043, 2185, 0 }, { 5041, 2188, 0 },
+  { 5044, 2189, 0 }, { 5043, 2190, 0 }, { 0, 2191, 440 }, { 0, 2192, 441 },
+  { 5016, 2193, 0 }, { 0, 2194, 449 }, { 0, 2195, 450 }, { 5002, 2241, 0 },
+  { 5018, 2197, 0 }, { 5020, 2202, 0 }, { 5010, 2230, 0 }, { 5010, 2244, 0 },
+  { 5058, 2200, 461 }, { 5060, 2201, 0 }, { 5061, 2203, 0 }, { 0, 2204, 464 },
+  { 5023, 2207, 0 }, { 5026, 2208, 0 }, { 5033, 2211, 0 }, { 5066, 2213, 0 },
+  { 5048, 2212, 0 }, { 5026, 2223, 0 }, { 5069, 2214, 0 }, { 0, 2215, 479 },
+  { 5039, 2216, 0 }, { 0, 2217, 481 }, { 5034, 2218, 0 }, { 5041, 2219, 0 },
+  { 4988, 2164, 0 }, { 0, 2220, 484 }, { 5076, 2222, 0 }, { 5046, 2224, 0 },
+  { 5078, 2221, 488 }, { 5050, 2226, 0 }, { 5049, 2228, 0 }, { 5081, 2229, 0 },
+  { 5080, 2231, 0 }, { 5083, 2232, 0 }, { 5084, 2233, 0 }, { 0, 2234, 501 },
+  { 5044, 2235, 0 }, { 5046, 2236, 0 }, { 5052, 2237, 0 }, { 5090, 2238, 0 },
+  { 5047, 2239, 0 }, { 5052, 2240, 0 }, { 5082, 2242, 0 }, { 0, 2243, 510 },
+  { 5095, 2245, 0 }, { 0, 2246, 513 }, { 5066, 2247, 0 }, { 0, 2248, 515 },
+  { 5098, 2249, 0 }, { 0, 2250, 517 }, { 5101, 2252, 0 }, { 5058, 2254, 0 },
+  { 0, 2272, 522 }, { 5070, 2277, 0 }, { 0, 2256, 529 }, { 0, 2257, 530 },
+  { 5071, 2258, 0 }, { 5106, 2259, 0 }, { 5107, 2260, 0 }, { 0, 2262, 535 },
+  { 0, 2263, 536 }, { 0, 2265, 539 }, { 0, 2266, 540 }, { 0, 2267, 541 },
+  { 0, 2268, 542 }, { 0, 2269, 543 }, { 5044, 2220, 0 }, { 5077, 2270, 0 },
+  { 5109, 2271, 0 }, { 0, 2275, 548 }, { 0, 2276, 549 }, { 0, 2278, 550 },
+  { 0, 2279, 551 }, { 5079, 2280, 0 }, { 5071, 2281, 0 }, { 0, 2283, 555 },
+  { 5077, 2284, 0 }, { 0, 2285, 556 }, { 0, 2287, 558 }, { 0, 2288, 559 },
+  { 5082, 2289, 0 }, { 5052, 2243, 0 }, { 5083, 2290, 0 }, { 5115, 2293, 565 },
+  { 5116, 2294, 76 }, { 5117, 2296, 567 }, { 5087, 2298, 0 }, { 5074, 2272, 0 },
+  { 5068, 2299, 0 }, { 5120, 2309, 0 }, { 5121, 2300, 0 }, { 5122, 2301, 0 },
+  { 5123, 2310, 0 }, { 5094, 2330, 0 }, { 0, 2333, 576 }, { 5084, 2348, 0 },
+  { 0, 2351, 578 }, { 0, 2336, 580 }, { 5126, 2343, 0 }, { 5097, 2344, 0 },
+  { 5128, 2349, 0 }, { 5095, 2350, 0 }, { 5087, 2357, 0 }, { 5132, 2304, 0 },
+  { 0, 2306, 596 }, { 5130, 2350, 0 }, { 5089, 2308, 0 }, { 0, 2312, 600 },
+  { 0, 2313, 601 }, { 5084, 2314, 0 }, { 5135, 2315, 602 }, { 0, 2316, 603 },
+  { 5136, 2318, 0 }, { 5106, 2319, 0 }, { 0, 2320, 606 }, { 5103, 2321, 0 },
+  { 5140, 2322, 0 }, { 0, 2323, 608 }, { 5100, 2324, 0 }, { 5114, 2325, 0 },
+  { 5100, 2324, 0 }, { 5116, 2326, 0 }, { 0, 2327, 496 }, { 5148, 2328, 0 },
+  { 5149, 2331, 0 }, { 5105, 2332, 0 }, { 5100, 2334, 0 }, { 5152, 2335, 0 },
+  { 5106, 2337, 0 }, { 0, 2338, 620 }, { 0, 2345, 621 }, { 5099, 2324, 0 },
+  { 5123, 2360, 0 }, { 5113, 2346, 0 }, { 5109, 2324, 0 }, { 5117, 2358, 0 },
+  { 5132, 2362, 0 }, { 5128, 2363, 0 }, { 5126, 2364, 0 }, { 5135, 2362, 0 },
+  { 5134, 2365, 0 }, { 5112, 2346, 0 }, { 5136, 2366, 0 }, { 5119, 2340, 0 },
+  { 5132, 2341, 0 }, { 5169, 2352, 0 }, { 5174, 2342, 0 }, { 5121, 2358, 0 },
+  { 5140, 2390, 0 }, { 0, 2353, 646 }, { 0, 2354, 647 }, { 5125, 2358, 0 },
+  { 5140, 2401, 0 }, { 5115, 2346, 0 }, { 5149, 2356, 0 }, { 5181, 2367, 0 },
+  { 0, 2371, 653 }, { 5189, 2384, 0 }, { 0, 2385, 662 }, { 5149, 2391, 0 },
+  { 5185, 2371, 0 }, { 5182, 2367, 0 }, { 5168, 2402, 0 }, { 5190, 2384, 0 },
+  { 5162, 2405, 0 }, { 5200, 2393, 0 }, { 5193, 2385, 0 }, { 5171, 2409, 0 },
+  { 5119, 2327, 0 }, { 0, 2397, 173 }, { 5194, 2385, 0 }, { 5201, 2393, 0 },
+  { 5211, 2410, 0 }, { 5204, 2397, 0 }, { 5190, 2359, 0 }, { 5222, 2361, 0 },
+  { 5195, 2385, 0 }, { 5186, 2371, 0 }, { 5212, 2410, 0 }, { 5179, 2368, 0 },
+  { 0, 2369, 693 }, { 5183, 2367, 0 }, { 5224, 2370, 0 }, { 5191, 2384, 0 },
+  { 0, 2372, 612 }, { 0, 2373, 695 }, { 5187, 2371, 0 }, { 5184, 2367, 0 },
+  { 5200, 2376, 0 }, { 5192, 2384, 0 }, { 5205, 2397, 0 }, { 5202, 2393, 0 },
+  { 5196, 2385, 0 }, { 0, 2411, 685 }, { 0, 2374, 698 }, { 0, 2375, 30 },
+  { 5197, 2385, 0 }, { 5203, 2393, 0 }, { 5213, 2410, 0 }, { 5206, 2397, 0 },
+  { 5229, 2375, 0 }, { 5215, 2411, 0 }, { 5198, 2385, 0 }, { 5188, 2371, 0 },
+  { 5214, 2410, 0 }, { 5216, 2411, 0 }, { 5202, 2413, 0 }, { 5204, 2414, 0 },
+  { 5192, 2415, 0 }, { 5190, 2416, 0 }, { 0, 2431, 707 }, { 5217, 2411, 0 },
+  { 5237, 2377, 0 }, { 5226, 2373, 0 }, { 5238, 2387, 0 }, { 5225, 2372, 0 },
+  { 5207, 2397, 0 }, { 5239, 2378, 0 }, { 5200, 2380, 0 }, { 5182, 2373, 0 },
+  { 5203, 2379, 0 }, { 5242, 2381, 0 }, { 5243, 2382, 0 }, { 0, 2383, 715 },
+  { 5244, 2388, 42 }, { 5182, 2374, 0 }, { 5230, 2375, 0 }, { 5218, 2411, 0 },
+  { 5193, 2415, 0 }, { 5194, 2389, 0 }, { 0, 2392, 717 }, { 5219, 2411, 0 },
+  { 0, 2395, 719 }, { 5247, 2396, 0 }, { 0, 2408, 723 }, { 0, 2432, 724 },
+  { 0, 2434, 725 }, { 5220, 2411, 0 }, { 5215, 2435, 0 }, { 5221, 2442, 0 },
+  { 5217, 2448, 0 }, { 5253, 2399, 0 }, { 5254, 2400, 0 }, { 5255, 2404, 0 },
+  { 0, 2407, 739 }, { 0, 2417, 477 }, { 5213, 2419, 0 }, { 0, 2406, 741 },
+  { 5230, 2418, 0 }, { 0, 2425, 32 }, { 5262, 2412, 0 }, { 5263, 2420, 0 },
+  { 0, 2421, 745 }, { 0, 2422, 746 }, { 0, 2436, 748 }, { 5266, 2423, 0 },
+  { 5223, 2424, 0 }, { 5268, 2426, 0 }, { 5269, 2429, 0 }, { 5226, 2427, 0 },
+  { 5242, 2456, 0 }, { 5202, 2392, 0 }, { 5229, 2458, 0 }, { 5230, 2457, 0 },
+  { 5276, 2469, 0 }, { 0, 2473, 763 }, { 5205, 2432, 0 }, { 5233, 2430, 0 },
+  { 5247, 2441, 0 }, { 5239, 2447, 0 }, { 5253, 2451, 0 }, { 5281, 2433, 0 },
+  { 5282, 2437, 0 }, { 5218, 2432, 0 }, { 5248, 2438, 0 }, { 5217, 2417, 0 },
+  { 5216, 2407, 0 }, { 5284, 2439, 0 }, { 5236, 2440, 0 }, { 0, 2443, 87 },
+  { 0, 2444, 771 }, { 5245, 2445, 0 }, { 5226, 2407, 0 }, { 5232, 2457, 0 },
+  { 5264, 2422, 0 }, { 5265, 2436, 0 }, { 5256, 2446, 0 }, { 0, 2449, 98 },
+  { 0, 2450, 774 }, { 5251, 2452, 0 }, { 5293, 2453, 0 }, { 5254, 2454, 0 },
+  { 5266, 2459, 0 }, { 5298, 2470, 0 }, { 5217, 2425, 0 }, { 5268, 2460, 0 },
+  { 5302, 2462, 0 }, { 5252, 2463, 0 }, { 5258, 2464, 0 }, { 5305, 2466, 0 },
+  { 0, 2467, 81 }, { 5270, 2471, 0 }, { 5310, 2472, 0 }, { 5280, 2509, 0 },
+  { 5262, 2515, 0 }, { 5306, 2466, 0 }, { 0, 2475, 790 }, { 5273, 2476, 0 },
+  { 5272, 2479, 0 }, { 5271, 2477, 0 }, { 0, 2478, 794 }, { 5316, 2511, 0 },
+  { 5277, 2519, 0 }, { 5271, 2522, 0 }, { 5272, 2525, 0 }, { 5289, 2481, 0 },
+  { 5277, 2482, 0 }, { 5280, 2483, 0 }, { 5285, 2484, 0 }, { 5281, 2482, 0 },
+  { 5284, 2487, 0 }, { 0, 2485, 801 }, { 0, 2492, 802 }, { 5296, 2482, 0 },
+  { 0, 2486, 803 }, { 5290, 2488, 0 }, { 5328, 2489, 0 }, { 0, 2490, 806 },
+  { 5330, 2491, 0 }, { 5331, 2493, 0 }, { 5294, 2494, 0 }, { 0, 2495, 808 },
+  { 5306, 2496, 0 }, { 5334, 2497, 0 }, { 0, 2498, 795 }, { 5304, 2499, 0 },
+  { 5291, 2450, 0 }, { 5292, 2500, 0 }, { 5297, 2501, 0 }, { 0, 2502, 813 },
+  { 5299, 2503, 0 }, { 5267, 2467, 0 }, { 0, 2505, 817 }, { 5340, 2506, 0 },
+  { 5310, 2508, 0 }, { 5308, 2467, 0 }, { 5296, 2540, 0 }, { 5312, 2512, 0 },
+  { 5298, 2544, 0 }, { 5345, 2516, 0 }, { 5347, 2517, 0 }, { 0, 2521, 835 },
+  { 4, 2518, 0 }, { 5348, 2523, 0 }, { 0, 2524, 837 }, { 0, 2526, 838 },
+  { 5350, 2527, 0 }, { 0, 2528, 841 }, { 5324, 2529, 0 }, { 5329, 2490, 0 },
+  { 0, 2518, 833 }, { 5313, 2535, 0 }, { 5355, 2530, 0 }, { 5316, 2533, 0 },
+  { 5312, 2534, 0 }, { 5312, 2538, 0 }, { 5359, 2542, 0 }, { 5316, 2531, 0 },
+  { 5338, 2502, 814 }, { 5361, 2532, 0 }, { 5362, 2536, 0 }, { 0, 2537, 849 },
+  { 5364, 2539, 0 }, { 0, 2541, 130 }, { 0, 2546, 852 }, { 0, 2547, 853 },
+  { 0, 2548, 854 }, { 5365, 2549, 0 }, { 5320, 2550, 0 }, { 5336, 2560, 0 },
+  { 5328, 2551, 0 }, { 5338, 2553, 0 }, { 5337, 2554, 0 }, { 5371, 2555, 0 },
+  { 5339, 2558, 0 }, { 5373, 2557, 0 }, { 5374, 2559, 0 }, { 0, 2561, 863 },
+  { 5375, 2562, 0 }, { 5376, 2563, 0 }, { 0, 2564, 866 }, { 0, 2565, 867 },
+  { 5339, 2566, 0 }, { 0, 2576, 868 }, { 5344, 2567, 0 }, { 5310, 2528, 0 },
+  { 5397, 2584, 0 }, { 5398, 2569, 0 }, { 0, 2570, 888 }, { 5368, 2572, 0 },
+  { 5311, 2526, 0 }, { 5400, 2573, 0 }, { 5370, 2575, 0 }, { 5402, 2577, 0 },
+  { 0, 2579, 896 }, { 5352, 2528, 0 }, { 5387, 2568, 0 }, { 5391, 2568, 0 },
+  { 5394, 2568, 0 }, { 5392, 2568, 0 }, { 5397, 2568, 0 }, { 0, 2624, 159 },
+  { 5392, 2568, 0 }, { 5376, 2626, 0 }, { 5404, 2611, 0 }, { 5359, 2612, 0 },
+  { 0, 2620, 901 }, { 5407, 2586, 0 }, { 0, 2587, 905 }, { 0, 2592, 910 },
+  { 0, 2636, 911 }, { 5410, 2594, 0 }, { 0, 2595, 913 }, { 5411, 2596, 0 },
+  { 0, 2597, 914 }, { 0, 2599, 917 }, { 0, 2598, 163 }, { 5414, 2605, 0 },
+  { 5415, 2600, 0 }, { 5372, 2601, 0 }, { 5372, 2602, 0 }, { 5376, 2603, 0 },
+  { 5374, 2606, 0 }, { 5375, 2603, 0 }, { 5383, 2607, 0 }, { 5377, 2614, 0 },
+  { 5384, 2621, 0 }, { 5384, 2604, 0 }, { 0, 2608, 923 }, { 0, 2609, 89 },
+  { 5383, 2610, 0 }, { 5378, 2576, 0 }, { 0, 2613, 871 }, { 5381, 2615, 0 },
+  { 5377, 2616, 0 }, { 0, 2630, 234 }, { 0, 2617, 927 }, { 5361, 2620, 0 },
+  { 5432, 2618, 0 }, { 5388, 2619, 0 }, { 5392, 2622, 0 }, { 5395, 2623, 0 },
+  { 5392, 2627, 0 }, { 5393, 2645, 0 }, { 5438, 2628, 0 }, { 5393, 2629, 0 },
+  { 5409, 2631, 0 }, { 5412, 2598, 0 }, { 0, 2632, 939 }, { 5398, 2633, 0 },
+  { 0, 2634, 941 }, { 5364, 2592, 0 }, { 5406, 2631, 0 }, { 5409, 2636, 0 },
+  { 5413, 2598, 0 }, { 5409, 2635, 0 }, { 5407, 2637, 0 }, { 5407, 2638, 0 },
+  { 5406, 2639, 0 }, { 5416, 2640, 0 }, { 5448, 2641, 945 }, { 0, 2643, 947 },
+  { 5449, 2644, 948 }, { 5419, 2648, 0 }, { 5394, 2630, 0 }, { 5405, 2649, 0 },
+  { 5452, 2654, 0 }, { 5413, 2650, 0 }, { 5454, 2651, 0 }, { 5455, 2652, 0 },
+  { 5456, 2653, 0 }, { 5457, 2657, 0 }, { 5460, 2670, 0 }, { 0, 2655, 958 },
+  { 5461, 2656, 0 }, { 5431, 2658, 0 }, { 5463, 2659, 0 }, { 5418, 2660, 0 },
+  { 5423, 2657, 0 }, { 5427, 2690, 0 }, { 5435, 2692, 0 }, { 5424, 2699, 0 },
+  { 5432, 2657, 0 }, { 5428, 2703, 0 }, { 5431, 2630, 0 }, { 0, 2662, 966 },
+  { 5470, 2663, 0 }, { 0, 2664, 968 }, { 0, 2665, 969 }, { 5471, 2666, 0 },
+  { 5426, 2667, 0 }, { 5438, 2692, 0 }, { 0, 2668, 971 }, { 0, 2669, 122 },
+  { 5446, 2671, 0 }, { 5478, 2672, 0 }, { 0, 2673, 978 }, { 5479, 2674, 0 },
+  { 5473, 2669, 0 }, { 5480, 2677, 0 }, { 0, 2678, 983 }, { 0, 2679, 984 },
+  { 5430, 2680, 0 }, { 5482, 2681, 0 }, { 5483, 2682, 0 }, { 5446, 2683, 0 },
+  { 5445, 2686, 0 }, { 0, 2687, 993 }, { 0, 2688, 994 }, { 0, 2689, 995 },
+  { 0, 2691, 996 }, { 5486, 2693, 0 }, { 0, 2694, 88 }, { 5449, 2695, 0 },
+  { 5488, 2696, 0 }, { 0, 2698, 1000 }, { 5458, 2700, 0 }, { 5444, 2701, 0 },
+  { 5451, 2702, 0 }, { 5465, 2704, 0 }, { 0, 2705, 224 }, { 5495, 2707, 1006 },
+  { 5465, 2736, 0 }, { 5433, 2669, 0 }, { 0, 2740, 1015 }, { 0, 2708, 225 },
+  { 5505, 2710, 0 }, { 5506, 2711, 0 }, { 5476, 2712, 0 }, { 5508, 2722, 0 },
+  { 5471, 2713, 0 }, { 5474, 2714, 0 }, { 5514, 2719, 0 }, { 0, 2715, 1019 },
+  { 0, 2717, 1027 }, { 5515, 2718, 0 }, { 5489, 2720, 0 }, { 5483, 2737, 0 },
+  { 5475, 2669, 0 }, { 0, 2721, 1030 }, { 0, 2768, 249 }, { 5476, 2669, 0 },
+  { 5497, 2770, 0 }, { 5472, 2722, 0 }, { 5525, 2755, 0 }, { 5474, 2723, 0 },
+  { 5480, 2756, 0 }, { 0, 2759, 1038 }, { 5489, 2727, 0 }, { 5492, 2728, 0 },
+  { 5493, 2705, 0 }, { 5537, 2731, 0 }, { 5492, 2723, 0 }, { 5496, 2708, 0 },
+  { 5539, 2732, 0 }, { 0, 2733, 1046 }, { 5489, 2723, 0 }, { 5452, 2708, 0 },
+  { 5463, 2705, 0 }, { 5461, 2708, 0 }, { 5540, 2734, 0 }, { 5501, 2735, 0 },
+  { 5486, 2723, 0 }, { 5457, 2708, 0 }, { 5488, 2723, 0 }, { 5512, 2738, 0 },
+  { 5543, 2739, 0 }, { 5462, 2708, 0 }, { 5538, 2731, 0 }, { 5504, 2740, 0 },
+  { 5466, 2708, 0 }, { 5464, 2708, 0 }, { 5498, 2741, 0 }, { 5487, 2771, 0 },
+  { 5499, 2742, 0 }, { 0, 2744, 1052 }, { 5489, 2771, 0 }, { 5489, 2771, 0 },
+  { 5482, 2759, 0 }, { 5487, 2771, 0 }, { 0, 2788, 1053 }, { 5548, 2746, 0 },
+  { 5549, 2747, 0 }, { 5550, 2751, 0 }, { 5551, 2748, 0 }, { 5511, 2750, 0 },
+  { 5521, 2749, 0 }, { 5526, 2749, 0 }, { 5556, 2752, 0 }, { 0, 2757, 1060 },
+  { 5512, 2763, 0 }, { 5499, 2771, 0 }, { 5519, 2749, 0 }, { 5527, 2753, 0 },
+  { 5514, 2760, 0 }, { 5517, 2761, 0 }, { 5529, 2785, 0 }, { 0, 2786, 634 },
+  { 0, 2758, 1065 }, { 5564, 2762, 0 }, { 5525, 2764, 0 }, { 5566, 2765, 0 },
+  { 5567, 2767, 0 }, { 5527, 2769, 0 }, { 0, 2772, 1071 }, { 0, 2775, 1020 },
+  { 0, 2774, 253 }, { 5571, 2794, 0 }, { 5535, 2776, 0 }, { 0, 2777, 1076 },
+  { 5573, 2783, 0 }, { 5574, 2778, 0 }, { 5544, 2779, 0 }, { 5532, 2780, 0 },
+  { 5534, 2781, 0 }, { 5534, 2782, 0 }, { 5536, 2784, 0 }, { 5502, 2744, 0 },
+  { 0, 2803, 1082 }, { 5549, 2787, 0 }, { 5557, 2804, 0 }, { 5545, 2789, 0 },
+  { 0, 2790, 1085 }, { 5547, 2788, 0 }, { 5586, 2791, 0 }, { 0, 2792, 1087 },
+  { 0, 2793, 1088 }, { 0, 2808, 1089 }, { 5547, 2840, 0 }, { 5545, 2796, 0 },
+  { 5563, 2797, 0 }, { 5591, 2799, 0 }, { 5548, 2800, 0 }, { 5593, 2805, 1096 },
+  { 5548, 2833, 0 }, { 5551, 2835, 0 }, { 5517, 2758, 0 }, { 5569, 2774, 0 },
+  { 5551, 2836, 0 }, { 5570, 2774, 0 }, { 5598, 2807, 0 }, { 0, 2809, 1100 },
+  { 0, 2810, 930 }, { 5554, 2811, 0 }, { 5555, 2812, 0 }, { 0, 2813, 1102 },
+  { 0, 2814, 1103 }, { 5556, 2815, 0 }, { 5563, 2816, 0 }, { 5581, 2803, 0 },
+  { 5582, 2803, 0 }, { 5603, 2817, 0 }, { 0, 2867, 297 }, { 5577, 2820, 0 },
+  { 0, 2870, 309 }, { 5559, 2823, 0 }, { 5572, 2824, 0 }, { 5573, 2825, 0 },
+  { 5542, 2808, 0 }, { 5608, 2826, 0 }, { 5578, 2827, 0 }, { 0, 2828, 1116 },
+  { 0, 2839, 1117 }, { 5610, 2869, 0 }, { 5611, 2875, 0 }, { 5571, 2876, 0 },
+  { 5613, 2829, 0 }, { 0, 2830, 284 }, { 5614, 2831, 0 }, { 0, 2841, 1121 },
+  { 5576, 2843, 0 }, { 5579, 2832, 0 }, { 5618, 2837, 0 }, { 0, 2838, 1125 },
+  { 5619, 2844, 0 }, { 5620, 2845, 0 }, { 5585, 2846, 0 }, { 5624, 2847, 0 },
+  { 5577, 2848, 0 }, { 5583, 2849, 0 }, { 5629, 2853, 0 }, { 5584, 2850, 0 },
+  { 0, 2897, 295 }, { 0, 2899, 299 }, { 5633, 2855, 0 }, { 0, 2900, 294 },
+  { 5623, 2846, 0 }, { 5634, 2857, 0 }, { 5635, 2858, 0 }, { 5636, 2859, 0 },
+  { 0, 2890, 1136 }, { 0, 2862, 1137 }, { 5637, 2863, 0 }, { 5638, 2865, 0 },
+  { 0, 2866, 1140 }, { 5612, 2903, 0 }, { 0, 2914, 307 }, { 0, 2916, 310 },
+  { 5644, 2868, 0 }, { 5646, 2917, 0 }, { 0, 2872, 337 }, { 0, 2874, 1141 },
+  { 5649, 2913, 0 }, { 5647, 2918, 0 }, { 0, 2877, 289 }, { 5613, 2879, 0 },
+  { 5624, 2909, 0 }, { 0, 2911, 315 }, { 5658, 2881, 0 }, { 5660, 2882, 0 },
+  { 5613, 2883, 0 }, { 5661, 2884, 0 }, { 5631, 2920, 0 }, { 0, 2922, 328 },
+  { 0, 2935, 1155 }, { 5617, 2885, 0 }, { 0, 2886, 333 }, { 5666, 2887, 0 },
+  { 5667, 2888, 0 }, { 5640, 2889, 0 }, { 5672, 2893, 0 }, { 0, 2892, 1156 },
+  { 0, 2894, 298 }, { 0, 2906, 1158 }, { 5645, 2895, 0 }, { 5631, 2897, 0 },
+  { 5669, 2892, 0 }, { 5594, 2897, 0 }, { 5673, 2906, 0 }, { 0, 2896, 308 },
+  { 5638, 2898, 0 }, { 5612, 2877, 0 }, { 5639, 2932, 0 }, { 5681, 2946, 0 },
+  { 5649, 2902, 0 }, { 5640, 2904, 0 }, { 5657, 2911, 0 }, { 0, 2905, 1167 },
+  { 5651, 2907, 0 }, { 5641, 2914, 0 }, { 0, 2908, 1169 }, { 5604, 2914, 0 },
+  { 5643, 2916, 0 }, { 0, 2923, 1170 }, { 5651, 2910, 0 }, { 5643, 2912, 0 },
+  { 0, 2942, 1173 }, { 5665, 2886, 0 }, { 0, 2957, 1174 }, { 5613, 2877, 0 },
+  { 5652, 2877, 0 }, { 5647, 2915, 0 }, { 5670, 2892, 0 }, { 5658, 2960, 0 },
+  { 5674, 2906, 0 }, { 5694, 2919, 0 }, { 5696, 2921, 0 }, { 5661, 2924, 0 },
+  { 5656, 2925, 0 }, { 5670, 2926, 0 }, { 0, 2927, 729 }, { 0, 2928, 730 },
+  { 5704, 2930, 0 }, { 5676, 2931, 0 }, { 0, 2933, 1186 }, { 0, 2934, 45 },
+  { 5640, 2892, 0 }, { 5699, 2924, 0 }, { 5644, 2906, 0 }, { 5676, 2936, 0 },
+  { 5707, 2937, 0 }, { 5710, 2938, 0 }, { 0, 2940, 1191 }, { 5680, 2941, 0 },
+  { 5712, 2944, 0 }, { 0, 2947, 56 }, { 5713, 2948, 0 }, { 5714, 2949, 0 },
+  { 5670, 2958, 0 }, { 5716, 2950, 0 }, { 5717, 2952, 0 }, { 5718, 2953, 0 },
+  { 5678, 2954, 0 }, { 0, 2955, 1201 }, { 5675, 2965, 0 }, { 0, 2956, 1202 },
+  { 0, 2959, 1203 }, { 5721, 2961, 0 }, { 5722, 2962, 0 }, { 5723, 2963, 0 },
+  { 5702, 2928, 1183 }, { 5724, 2995, 0 }, { 5655, 2957, 0 }, { 0, 2996, 1208 },
+  { 0, 3003, 1209 }, { 5693, 2966, 0 }, { 0, 2967, 1211 }, { 5684, 2968, 0 },
+  { 0, 2970, 1207 }, { 5693, 2971, 0 }, { 0, 2972, 1215 }, { 5697, 2973, 0 },
+  { 5684, 2974, 0 }, { 0, 2975, 1218 }, { 5730, 2976, 0 }, { 0, 3004, 1220 },
+  { 5693, 3022, 0 }, { 0, 3023, 364 }, { 5688, 2980, 0 }, { 5733, 3022, 0 },
+  { 5705, 2986, 0 }, { 5698, 2990, 0 }, { 0, 2993, 506 }, { 5697, 2997, 0 },
+  { 0, 3029, 1230 }, { 5692, 2982, 0 }, { 5739, 2983, 0 }, { 5709, 2984, 0 },
+  { 5705, 2987, 0 }, { 0, 2988, 1235 }, { 5717, 2989, 0 }, { 0, 2991, 1243 },
+  { 5754, 2992, 1244 }, { 0, 2998, 1246 }, { 5755, 2999, 0 }, { 5761, 3000, 0 },
+  { 5695, 2987, 0 }, { 0, 3002, 1248 }, { 0, 3030, 372 }, { 5762, 3024, 0 },
+  { 5725, 3042, 0 }, { 0, 3005, 377 }, { 0, 3017, 378 }, { 5728, 3007, 0 },
+  { 5770, 3006, 0 }, { 5733, 3008, 0 }, { 0, 3009, 1255 }, { 5730, 3011, 0 },
+  { 0, 3013, 951 }, { 0, 3014, 1259 }, { 5742, 3015, 0 }, { 0, 3016, 1261 },
+  { 5776, 3019, 0 }, { 5693, 3004, 0 }, { 5732, 3007, 0 }, { 0, 3020, 381 },
+  { 5715, 2988, 0 }, { 5745, 2988, 0 }, { 5711, 2988, 0 }, { 5706, 2988, 0 },
+  { 5748, 2988, 0 }, { 5721, 3007, 0 }, { 5730, 3018, 0 }, { 5778, 3021, 0 },
+  { 0, 3025, 93 }, { 5714, 3030, 0 }, { 5735, 3018, 0 }, { 5710, 3030, 0 },
+  { 5709, 2988, 0 }, { 5715, 3030, 0 }, { 5741, 3026, 0 }, { 5780, 3027, 0 },
+  { 0, 3028, 1265 }, { 0, 3031, 1266 }, { 5715, 2988, 0 }, { 5702, 2988, 0 },
+  { 5750, 3047, 0 }, { 5782, 3032, 0 }, { 5732, 3030, 0 }, { 5737, 3033, 0 },
+  { 0, 3034, 399 }, { 5787, 3035, 1271 }, { 5760, 3037, 0 }, { 5725, 3030, 0 },
+  { 5799, 3045, 0 }, { 0, 3036, 400 }, { 5800, 3038, 0 }, { 5801, 3039, 0 },
+  { 5728, 3017, 0 }, { 5771, 3040, 0 }, { 5803, 3050, 0 }, { 5765, 3041, 0 },
+  { 5771, 3043, 0 }, { 5810, 3048, 0 }, { 0, 3044, 1283 }, { 0, 3049, 1291 },
+  { 5784, 3051, 0 }, { 5812, 3052, 0 }, { 0, 3053, 1293 }, { 0, 3055, 1294 },
+  { 0, 3054, 394 }, { 5770, 3057, 0 }, { 5773, 3058, 0 }, { 5818, 3060, 0 },
+  { 5766, 3050, 0 }, { 0, 3109, 1299 }, { 5796, 3062, 0 }, { 0, 3063, 1302 },
+  { 5787, 3064, 0 }, { 5822, 3065, 0 }, { 5784, 3034, 0 }, { 5785, 3034, 0 },
+  { 5746, 3036, 0 }, { 5789, 3036, 0 }, { 5790, 3036, 0 }, { 5824, 3066, 0 },
+  { 5779, 3068, 0 }, { 5746, 3036, 0 }, { 5755, 3034, 0 }, { 5755, 3036, 0 },
+  { 5819, 3060, 0 }, { 5826, 3069, 0 }, { 5827, 3070, 0 }, { 5751, 3036, 0 },
+  { 5828, 3074, 0 }, { 5829, 3071, 0 }, { 5831, 3072, 0 }, { 5756, 3036, 0 },
+  { 0, 3077, 1309 }, { 5787, 3083, 0 }, { 5760, 3036, 0 }, { 5758, 3036, 0 },
+  { 5802, 3073, 0 }, { 0, 3075, 1312 }, { 5797, 3036, 0 }, { 5773, 3054, 0 },
+  { 5801, 3076, 0 }, { 5837, 3078, 0 }, { 5797, 3079, 0 }, { 0, 3080, 1316 },
+  { 0, 3082, 1284 }, { 5843, 3101, 0 }, { 5787, 3054, 0 }, { 5813, 3084, 0 },
+  { 5800, 3085, 0 }, { 5815, 3054, 0 }, { 0, 3086, 1318 }, { 5822, 3087, 0 },
+  { 5819, 3088, 0 }, { 5851, 3089, 0 }, { 0, 3091, 1324 }, { 5812, 3093, 0 },
+  { 5853, 3092, 0 }, { 5816, 3124, 0 }, { 5855, 3095, 0 }, { 0, 3096, 1328 },
+  { 5858, 3118, 0 }, { 5820, 3136, 0 }, { 5825, 3097, 0 }, { 5861, 3098, 0 },
+  { 0, 3100, 1333 }, { 5864, 3102, 0 }, { 5828, 3103, 0 }, { 0, 3104, 1336 },
+  { 0, 3105, 1337 }, { 5823, 3106, 0 }, { 5789, 3075, 0 }, { 0, 3108, 1339 },
+  { 5828, 3107, 0 }, { 5830, 3151, 0 }, { 5871, 3111, 0 }, { 5821, 3112, 0 },
+  { 5866, 3103, 0 }, { 5869, 3107, 0 }, { 0, 3129, 1343 }, { 5834, 3113, 0 },
+  { 5874, 3115, 0 }, { 5846, 3086, 0 }, { 5847, 3086, 0 }, { 5829, 3146, 0 },
+  { 0, 3147, 476 }, { 0, 3149, 1348 }, { 0, 3154, 1350 }, { 5880, 3156, 0 },
+  { 5802, 3086, 0 }, { 5834, 3158, 0 }, { 5878, 3149, 0 }, { 5879, 3154, 0 },
+  { 5862, 3100, 0 }, { 5838, 3160, 0 }, { 5883, 3117, 0 }, { 5863, 3100, 0 },
+  { 5839, 3119, 0 }, { 5843, 3126, 0 }, { 5842, 3120, 0 }, { 0, 3122, 523 },
+  { 5888, 3130, 0 }, { 0, 3152, 1359 }, { 5839, 3123, 0 }, { 0, 3153, 1363 },
+  { 0, 3127, 1365 }, { 5847, 3128, 0 }, { 0, 3142, 97 }, { 5893, 3135, 0 },
+  { 5894, 3155, 0 }, { 5895, 3131, 0 }, { 5866, 3159, 0 }, { 0, 3164, 141 },
+  { 5899, 3133, 0 }, { 0, 3134, 1369 }, { 5860, 3137, 0 }, { 5870, 3138, 0 },
+  { 5870, 3139, 0 }, { 0, 3140, 1370 }, { 5871, 3144, 0 }, { 5905, 3157, 0 },
+  { 0, 3148, 1372 }, { 5862, 3173, 0 }, { 0, 3174, 452 }, { 5896, 3131, 0 },
+  { 5872, 3182, 0 }, { 5911, 3183, 0 }, { 5866, 3185, 0 }, { 5877, 3147, 0 },
+  { 5870, 3187, 0 }, { 5869, 3188, 0 }, { 5847, 3153, 0 }, { 0, 3141, 453 },
+  { 0, 3150, 1383 }, { 5877, 3188, 0 }, { 0, 3167, 1384 }, { 0, 3168, 1385 },
+  { 0, 3169, 1386 }, { 0, 3180, 1387 }, { 5877, 3205, 0 }, { 0, 3206, 460 },
+  { 5889, 3209, 0 }, { 5888, 3213, 0 }, { 5878, 3205, 0 }, { 5895, 3214, 0 },
+  { 5934, 3215, 0 }, { 5889, 3188, 0 }, { 5889, 3152, 0 }, { 5890, 3217, 0 },
+  { 5946, 3161, 0 }, { 5903, 3140, 0 }, { 5897, 3220, 0 }, { 5912, 3183, 0 },
+  { 5868, 3174, 0 }, { 5910, 3162, 0 }, { 5905, 3220, 0 }, { 5905, 3163, 0 },
+  { 5950, 3165, 1403 }, { 5905, 3166, 0 }, { 5876, 3141, 0 }, { 0, 3171, 362 },
+  { 5872, 3141, 0 }, { 5912, 3172, 0 }, { 5877, 3141, 0 }, { 5948, 3162, 0 },
+  { 5915, 3176, 0 }, { 0, 3178, 480 }, { 5917, 3220, 0 }, { 5925, 3179, 0 },
+  { 5960, 3184, 0 }, { 5888, 3206, 0 }, { 5935, 3215, 0 }, { 5897, 3141, 0 },
+  { 5956, 3186, 0 }, { 5930, 3189, 0 }, { 5916, 3200, 0 }, { 5960, 3190, 0 },
+  { 5886, 3141, 0 }, { 5922, 3208, 0 }, { 5962, 3191, 1413 }, { 5963, 3192, 0 },
+  { 5965, 3193, 1414 }, { 0, 3194, 952 }, { 0, 3195, 1131 }, { 5918, 3224, 0 },
+  { 5922, 3225, 0 }, { 0, 3228, 1419 }, { 0, 3197, 1338 }, { 5937, 3198, 0 },
+  { 5969, 3199, 0 }, { 5937, 3218, 0 }, { 5925, 3221, 0 }, { 0, 3222, 1423 },
+  { 5932, 3230, 0 }, { 5926, 3233, 0 }, { 5974, 3236, 0 }, { 5937, 3237, 0 },
+  { 5942, 3201, 0 }, { 0, 3203, 1430 }, { 0, 3210, 1431 }, { 5978, 3202, 0 },
+  { 5942, 3204, 0 }, { 5980, 3207, 0 }, { 5954, 3211, 0 }, { 0, 3212, 95 },
+  { 0, 3216, 1434 }, { 5951, 3219, 0 }, { 0, 3223, 437 }, { 5983, 3227, 0 },
+  { 5953, 3229, 0 }, { 5985, 3226, 1438 }, { 5986, 3232, 0 }, { 5958, 3234, 0 },
+  { 5988, 3235, 0 }, { 5944, 3238, 0 }, { 5960, 3240, 0 }, { 5994, 3241, 0 },
+  { 5997, 3242, 0 }, { 5958, 3243, 0 }, { 5957, 3246, 0 }, { 6000, 3244, 0 },
+  { 6002, 3245, 0 }, { 5996, 3241, 0 }, { 6003, 3248, 0 }, { 0, 3249, 1450 },
+  { 5964, 3250, 0 }, { 5966, 3251, 0 }, { 5923, 3228, 0 }, { 5965, 3252, 0 },
+  { 6008, 3253, 0 }, { 0, 3254, 1451 }, { 5967, 3255, 0 }, { 5972, 3256, 0 },
+  { 5971, 3259, 0 }, { 6014, 3257, 0 }, { 6015, 3258, 0 }, { 0, 3260, 1457 },
+  { 6016, 3261, 0 }, { 5986, 3262, 0 }, { 0, 3263, 1422 }, { 6019, 3264, 0 },
+  { 0, 3265, 1460 }, { 5982, 3266, 0 }, { 0, 3267, 96 }, { 0, 3268, 1462 },
+  { 6022, 3269, 0 }, { 5977, 3270, 0 }, { 5979, 3271, 0 }, { 5983, 3277, 0 },
+  { 5980, 3280, 0 }, { 5992, 3282, 0 }, { 6028, 3282, 0 }, { 0, 3284, 504 },
+  { 5998, 3285, 0 }, { 6035, 3273, 0 }, { 5992, 3302, 0 }, { 6002, 3286, 0 },
+  { 6037, 3305, 0 }, { 5996, 3275, 0 }, { 5995, 3276, 0 }, { 5988, 3282, 0 },
+  { 0, 3294, 524 }, { 6040, 3279, 0 }, { 6041, 3281, 0 }, { 6009, 3254, 0 },
+  { 6004, 3285, 0 }, { 5999, 3286, 0 }, { 0, 3283, 1474 }, { 5969, 3254, 0 },
+  { 6043, 3287, 0 }, { 6044, 3288, 0 }, { 6018, 3263, 0 }, { 0, 3289, 1475 },
+  { 6040, 3290, 0 }, { 6042, 3304, 0 }, { 6021, 3291, 0 }, { 6049, 3292, 0 },
+  { 6042, 3281, 0 }, { 6006, 3293, 0 }, { 6051, 3298, 0 }, { 6010, 3295, 0 },
+  { 0, 3297, 1482 }, { 6019, 3299, 0 }, { 0, 3300, 1483 }, { 0, 3301, 189 },
+  { 6054, 3303, 0 }, { 5989, 3284, 0 }, { 0, 3306, 498 }, { 6055, 3307, 0 },
+  { 6056, 3309, 0 }, { 6057, 3310, 0 }, { 6058, 3311, 0 }, { 6021, 3268, 0 },
+  { 6059, 3312, 0 }, { 0, 3313, 1057 }, { 0, 3314, 1486 }, { 6060, 3315, 0 },
+  { 0, 3316, 1487 }, { 6016, 3322, 0 }, { 6031, 3317, 0 }, { 6063, 3318, 0 },
+  { 6064, 3319, 0 }, { 0, 3320, 1488 }, { 6023, 3321, 0 }, { 6021, 3323, 0 },
+  { 6067, 3324, 0 }, { 0, 3325, 521 }, { 6037, 3326, 0 }, { 6038, 3327, 0 },
+  { 0, 3331, 1490 }, { 6070, 3328, 0 }, { 0, 3333, 1495 }, { 0, 3334, 1496 },
+  { 0, 3335, 1497 }, { 0, 3336, 1498 }, { 0, 3337, 1499 }, { 6041, 3338, 0 },
+  { 6034, 3339, 0 }, { 0, 3341, 1503 }, { 6043, 3342, 0 }, { 0, 3343, 1504 },
+  { 0, 3345, 1506 }, { 6032, 3346, 0 }, { 0, 3347, 1508 }, { 0, 3348, 1509 },
+  { 0, 3350, 1511 }, { 0, 3351, 1 }, { 6077, 3352, 3 }, { 6078, 3353, 0 },
+  { 0, 3354, 5 }, { 6079, 3355, 8 }, { 0, 3356, 9 }, { 0, 3357, 10 },
+  { 0, 3358, 12 }, { 6033, 3360, 0 }, { 0, 3361, 15 }, { 6081, 3363, 0 },
+  { 6082, 3364, 18 }, { 6056, 3366, 0 }, { 6084, 3368, 0 }, { 6054, 3369, 0 },
+  { 6048, 3370, 0 }, { 0, 3373, 29 }, { 6087, 3375, 0 }, { 6088, 3378, 0 },
+  { 6051, 3379, 0 }, { 6045, 3380, 0 }, { 6091, 3381, 0 }, { 6092, 3382, 38 },
+  { 0, 3383, 39 }, { 6047, 3384, 0 }, { 6068, 3386, 0 }, { 6092, 3387, 0 },
+  { 6093, 3388, 0 }, { 6063, 3389, 0 }, { 6052, 3390, 0 }, { 0, 3391, 52 },
+  { 6070, 3392, 0 }, { 6102, 3393, 0 }, { 6059, 3394, 0 }, { 6057, 3396, 0 },
+  { 6061, 3397, 0 }, { 0, 3398, 60 }, { 6107, 3400, 0 }, { 6074, 3401, 0 },
+  { 6110, 3405, 0 }, { 0, 3407, 70 }, { 6111, 3408, 0 }, { 0, 3409, 74 },
+  { 6066, 3410, 0 }, { 6084, 3411, 0 }, { 6084, 3412, 0 }, { 6116, 3414, 0 },
+  { 6090, 3415, 0 }, { 6115, 3416, 0 }, { 6076, 3417, 0 }, { 6090, 3418, 0 },
+  { 6090, 3428, 0 }, { 6090, 3434, 0 }, { 6093, 3436, 0 }, { 6081, 3443, 0 },
+  { 6126, 3420, 0 }, { 6128, 3421, 115 }, { 6129, 3422, 0 }, { 0, 3423, 117 },
+  { 6130, 3425, 121 }, { 6085, 3426, 0 }, { 6100, 3391, 0 }, { 0, 3427, 123 },
+  { 6093, 3429, 0 }, { 0, 3430, 126 }, { 6095, 3432, 0 }, { 6103, 3429, 0 },
+  { 0, 3433, 129 }, { 6111, 3435, 0 }, { 6140, 3440, 0 }, { 6101, 3441, 0 },
+  { 6123, 3442, 0 }, { 6143, 3445, 0 }, { 6100, 3446, 0 }, { 0, 3449, 147 },
+  { 6147, 3450, 0 }, { 6148, 3451, 0 }, { 0, 3452, 151 }, { 6105, 3455, 0 },
+  { 6150, 3457, 0 }, { 0, 3458, 167 }, { 0, 3459, 169 }, { 6105, 3460, 0 },
+  { 6112, 3462, 0 }, { 6153, 3464, 0 }, { 6105, 3465, 0 }, { 6108, 3466, 0 },
+  { 6103, 3433, 0 }, { 0, 3468, 177 }, { 6156, 3470, 179 }, { 0, 3471, 180 },
+  { 6157, 3473, 184 }, { 0, 3474, 185 }, { 6131, 3475, 0 }, { 6114, 3476, 0 },
+  { 6133, 3477, 0 }, { 6130, 3488, 0 }, { 6134, 3478, 0 }, { 0, 3479, 192 },
+  { 6163, 3483, 0 }, { 0, 3484, 197 }, { 0, 3486, 199 }, { 6164, 3490, 0 },
+  { 0, 3491, 205 }, { 6146, 3449, 0 }, { 0, 3494, 208 }, { 6165, 3495, 0 },
+  { 6166, 3499, 0 }, { 6167, 3500, 0 }, { 6137, 3502, 0 }, { 6169, 3504, 0 },
+  { 6170, 3505, 0 }, { 6138, 3506, 0 }, { 6138, 3508, 0 }, { 6127, 3509, 0 },
+  { 6134, 3511, 0 }, { 6128, 3506, 0 }, { 6144, 3523, 0 }, { 6147, 3525, 0 },
+  { 6176, 3526, 0 }, { 6152, 3527, 0 }, { 6138, 3532, 0 }, { 6150, 3549, 0 },
+  { 6137, 3514, 0 }, { 6147, 3515, 0 }, { 6155, 3516, 0 }, { 6142, 3521, 0 },
+  { 6161, 3528, 0 }, { 6151, 3529, 0 }, { 6146, 3507, 0 }, { 6191, 3510, 0 },
+  { 6144, 3525, 0 }, { 6160, 3512, 0 }, { 6160, 3518, 0 }, { 6162, 3538, 0 },
+  { 6162, 3544, 0 }, { 6166, 3517, 0 }, { 6200, 3520, 0 }, { 6182, 3522, 0 },
+  { 6156, 3524, 0 }, { 6165, 3530, 0 }, { 6204, 3535, 0 }, { 6164, 3517, 0 },
+  { 6205, 3536, 0 }, { 6206, 3537, 0 }, { 6159, 3539, 0 }, { 6201, 3540, 0 },
+  { 6178, 3541, 0 }, { 6173, 3542, 0 }, { 6184, 3543, 0 }, { 6179, 3546, 0 },
+  { 6211, 3552, 0 }, { 6187, 3547, 0 }, { 6177, 3548, 0 }, { 6190, 3553, 0 },
+  { 6173, 3560, 0 }, { 6192, 3550, 0 }, { 6178, 3551, 0 }, { 6175, 3554, 0 },
+  { 6177, 3555, 0 }, { 6195, 3556, 0 }, { 6194, 3557, 0 }, { 6192, 3561, 0 },
+  { 6200, 3558, 0 }, { 6183, 3562, 0 }, { 6200, 3562, 0 }, { 6201, 3559, 0 },
+  { 6186, 3563, 0 }, { 6233, 3565, 339 }, { 0, 3566, 341 }, { 6234, 3567, 342 },
+  { 6177, 3554, 0 }, { 0, 3568, 343 }, { 6235, 3569, 0 }, { 6236, 3570, 347 },
+  { 0, 3571, 348 }, { 0, 3572, 349 }, { 6197, 3573, 0 }, { 6199, 3562, 0 },
+  { 6194, 3575, 0 }, { 6239, 3577, 356 }, { 6240, 3578, 357 }, { 6241, 3579, 0 },
+  { 6198, 3581, 0 }, { 6200, 3595, 0 }, { 6207, 3582, 0 }, { 6206, 3583, 0 },
+  { 6203, 3584, 0 }, { 6217, 3586, 0 }, { 0, 3587, 376 }, { 6203, 3588, 0 },
+  { 6204, 3589, 0 }, { 0, 3594, 385 }, { 6251, 3596, 0 }, { 6252, 3644, 0 },
+  { 6253, 3599, 0 }, { 6254, 3600, 0 }, { 6224, 3601, 0 }, { 6226, 3604, 0 },
+  { 6216, 3602, 0 }, { 6216, 3581, 0 }, { 6226, 3602, 0 }, { 6217, 3602, 0 },
+  { 6239, 3605, 0 }, { 6221, 3602, 0 }, { 6229, 3607, 0 }, { 6268, 3608, 0 },
+  { 6269, 3610, 0 }, { 6270, 3611, 0 }, { 6271, 3612, 0 }, { 6272, 3613, 0 },
+  { 0, 3614, 434 }, { 0, 3616, 438 }, { 6232, 3615, 0 }, { 6243, 3617, 0 },
+  { 6279, 3620, 0 }, { 6280, 3623, 0 }, { 6251, 3624, 0 }, { 6230, 3602, 0 },
+  { 6220, 3602, 0 }, { 6232, 3602, 0 }, { 6244, 3615, 0 }, { 6255, 3625, 0 },
+  { 6252, 3626, 0 }, { 6284, 3627, 0 }, { 6220, 3602, 0 }, { 0, 3628, 461 },
+  { 6241, 3615, 0 }, { 0, 3629, 462 }, { 0, 3630, 463 }, { 6235, 3615, 0 },
+  { 6286, 3632, 0 }, { 6287, 3633, 0 }, { 6248, 3634, 0 }, { 0, 3635, 472 },
+  { 6248, 3636, 0 }, { 6264, 3637, 0 }, { 0, 3638, 475 }, { 6291, 3640, 0 },
+  { 6296, 3642, 0 }, { 6297, 3643, 483 }, { 6264, 3686, 0 }, { 6249, 3638, 0 },
+  { 6246, 3638, 0 }, { 0, 3646, 486 }, { 6301, 3647, 0 }, { 0, 3648, 488 },
+  { 6302, 3649, 0 }, { 6303, 3650, 492 }, { 0, 3651, 493 }, { 6277, 3652, 0 },
+  { 0, 3653, 498 }, { 0, 3654, 500 }, { 6258, 3656, 0 }, { 6307, 3657, 0 },
+  { 6271, 3658, 0 }, { 6262, 3660, 0 }, { 6259, 3638, 0 }, { 0, 3659, 506 },
+  { 6266, 3659, 0 }, { 6285, 3661, 0 }, { 6275, 3701, 0 }, { 6282, 3662, 0 },
+  { 0, 3664, 512 }, { 6278, 3652, 0 }, { 6316, 3666, 0 }, { 0, 3668, 516 },
+  { 6268, 3653, 0 }, { 6279, 3662, 0 }, { 0, 3670, 519 }, { 6318, 3671, 0 },
+  { 6292, 3707, 0 }, { 6285, 3673, 0 }, { 6322, 3676, 0 }, { 0, 3677, 532 },
+  { 0, 3678, 533 }, { 6323, 3687, 544 }, { 0, 3688, 545 }, { 6324, 3693, 0 },
+  { 6325, 3694, 0 }, { 6296, 3696, 0 }, { 6327, 3700, 560 }, { 6328, 3702, 0 },
+  { 0, 3703, 565 }, { 0, 3704, 76 }, { 0, 3705, 567 }, { 6329, 3706, 569 },
+  { 6291, 3708, 0 }, { 0, 3709, 570 }, { 0, 3710, 571 }, { 0, 3711, 572 },
+  { 0, 3712, 573 }, { 6331, 3713, 0 }, { 6290, 3715, 0 }, { 0, 3718, 579 },
+  { 6333, 3719, 0 }, { 0, 3720, 590 }, { 6335, 3721, 0 }, { 0, 3725, 15 },
+  { 6292, 3722, 0 }, { 0, 3723, 595 }, { 6337, 3726, 0 }, { 6338, 3729, 0 },
+  { 0, 3730, 602 }, { 0, 3732, 478 }, { 6340, 3733, 605 }, { 6301, 3735, 0 },
+  { 6317, 3670, 0 }, { 0, 3736, 607 }, { 6302, 3738, 0 }, { 6298, 3740, 0 },
+  { 6309, 3751, 0 }, { 6306, 3754, 0 }, { 6346, 3739, 0 }, { 6347, 3741, 0 },
+  { 6304, 3788, 0 }, { 0, 3743, 609 }, { 0, 3744, 618 }, { 6350, 3745, 0 },
+  { 6301, 3746, 0 }, { 0, 3747, 610 }, { 6351, 3748, 0 }, { 6312, 3752, 0 },
+  { 6353, 3753, 0 }, { 6325, 3761, 0 }, { 6355, 3773, 0 }, { 6310, 3755, 0 },
+  { 6310, 3767, 0 }, { 6319, 3771, 0 }, { 6312, 3756, 0 }, { 6317, 3759, 0 },
+  { 6335, 3757, 0 }, { 6316, 3758, 0 }, { 6364, 3760, 0 }, { 6332, 3762, 0 },
+  { 6296, 3732, 0 }, { 6366, 3763, 0 }, { 0, 3765, 639 }, { 6326, 3764, 0 },
+  { 0, 3, 640 }, { 0, 5, 641 }, { 0, 6, 642 }, { 0, 3766, 643 },
+  { 6323, 3768, 0 }, { 6306, 3720, 0 }, { 6325, 3764, 0 }, { 6326, 3764, 0 },
+  { 6372, 3772, 0 }, { 6373, 3774, 0 }, { 0, 3775, 649 }, { 0, 3781, 650 },
+  { 0, 3801, 651 }, { 0, 3807, 652 }, { 0, 3780, 654 }, { 0, 3797, 655 },
+  { 0, 3806, 656 }, { 0, 3823, 657 }, { 0, 3777, 658 }, { 0, 3783, 659 },
+  { 0, 3803, 660 }, { 0, 3809, 661 }, { 0, 3786, 663 }, { 0, 3790, 664 },
+  { 0, 3796, 665 }, { 0, 3812, 666 }, { 0, 3816, 667 }, { 0, 3822, 668 },
+  { 6374, 3779, 0 }, { 0, 3785, 670 }, { 0, 3791, 671 }, { 0, 3811, 672 },
+  { 0, 3817, 673 }, { 0, 3793, 674 }, { 0, 3810, 675 }, { 0, 3819, 676 },
+  { 0, 3836, 677 }, { 6328, 3782, 0 }, { 6331, 3784, 0 }, { 6346, 3787, 0 },
+  { 0, 3792, 681 }, { 0, 3798, 682 }, { 0, 3818, 683 }, { 0, 3824, 684 },
+  { 0, 3821, 686 }, { 0, 3825, 687 }, { 0, 3831, 688 }, { 0, 3847, 689 },
+  { 0, 3851, 690 }, { 0, 3857, 691 }, { 6378, 3794, 0 }, { 0, 3795, 29 },
+  { 6379, 3799, 692 }, { 0, 3802, 694 }, { 0, 3835, 613 }, { 0, 3833, 696 },
+  { 6335, 3839, 0 }, { 6383, 3845, 0 }, { 0, 3820, 699 }, { 0, 3846, 175 },
+  { 6385, 3808, 0 }, { 6386, 3826, 0 }, { 6340, 3827, 0 }, { 6388, 3828, 0 },
+  { 6389, 3848, 0 }, { 6390, 3829, 0 }, { 0, 3832, 708 }, { 0, 3834, 167 },
+  { 0, 3837, 709 }, { 6391, 3838, 0 }, { 6392, 3840, 711 }, { 0, 3841, 712 },
+  { 0, 3842, 713 }, { 0, 3844, 42 }, { 6346, 3849, 0 }, { 6365, 3881, 0 },
+  { 0, 3853, 720 }, { 6397, 3886, 0 }, { 6371, 3893, 0 }, { 6359, 3858, 0 },
+  { 6400, 3859, 0 }, { 6358, 3860, 0 }, { 0, 3861, 735 }, { 0, 3862, 736 },
+  { 0, 3863, 737 }, { 6406, 3896, 0 }, { 6368, 3902, 0 }, { 6362, 3895, 0 },
+  { 6409, 3866, 0 }, { 6410, 3868, 0 }, { 6411, 3914, 0 }, { 0, 3870, 743 },
+  { 0, 3871, 744 }, { 0, 3904, 747 }, { 0, 3905, 749 }, { 0, 3875, 750 },
+  { 6375, 3876, 0 }, { 0, 3877, 753 }, { 0, 3878, 754 }, { 6412, 3879, 0 },
+  { 6387, 3880, 0 }, { 6415, 3883, 0 }, { 6384, 3846, 0 }, { 6416, 3903, 0 },
+  { 6417, 3882, 0 }, { 0, 3884, 762 }, { 6420, 3887, 0 }, { 6378, 3888, 0 },
+  { 6424, 3889, 768 }, { 6381, 3890, 0 }, { 0, 3891, 766 }, { 0, 3892, 767 },
+  { 6386, 3894, 0 }, { 0, 3897, 769 }, { 6404, 3862, 0 }, { 6369, 3853, 0 },
+  { 6427, 3898, 0 }, { 6354, 3842, 0 }, { 6428, 3901, 0 }, { 6429, 3906, 0 },
+  { 0, 3956, 236 }, { 6381, 3909, 0 }, { 0, 3910, 78 }, { 6431, 3911, 0 },
+  { 6391, 3888, 0 }, { 6392, 3888, 0 }, { 6388, 3912, 0 }, { 0, 3913, 778 },
+  { 6390, 3915, 0 }, { 6368, 3861, 0 }, { 6405, 3863, 0 }, { 0, 3916, 781 },
+  { 6386, 3917, 0 }, { 6435, 3918, 0 }, { 0, 3919, 231 }, { 0, 3925, 406 },
+  { 6406, 3961, 0 }, { 0, 3965, 785 }, { 6410, 3921, 0 }, { 0, 3922, 787 },
+  { 6438, 3923, 788 }, { 6439, 3924, 0 }, { 6440, 3927, 0 }, { 6441, 3928, 0 },
+  { 6442, 3929, 0 }, { 0, 3931, 86 }, { 6397, 3932, 0 }, { 6400, 3933, 0 },
+  { 6419, 3934, 0 }, { 6420, 3935, 0 }, { 6405, 3936, 0 }, { 6401, 3939, 0 },
+  { 6407, 3943, 0 }, { 6411, 3937, 0 }, { 6453, 3938, 0 }, { 6455, 3940, 0 },
+  { 6456, 3945, 0 }, { 0, 3946, 805 }, { 0, 3979, 636 }, { 0, 3948, 100 },
+  { 0, 3949, 397 }, { 6426, 3950, 0 }, { 6414, 3952, 0 }, { 0, 3953, 779 },
+  { 6460, 3955, 810 }, { 6461, 3957, 0 }, { 6462, 3958, 0 }, { 0, 3988, 814 },
+  { 6463, 3960, 0 }, { 0, 3963, 818 }, { 6464, 3964, 821 }, { 6465, 3966, 0 },
+  { 6422, 3967, 0 }, { 6467, 3968, 0 }, { 0, 3969, 829 }, { 6402, 3931, 0 },
+  { 0, 3970, 830 }, { 0, 3973, 836 }, { 6472, 4020, 0 }, { 0, 3976, 840 },
+  { 6433, 4015, 0 }, { 0, 4025, 842 }, { 6474, 3978, 0 }, { 6435, 3981, 0 },
+  { 0, 3982, 130 }, { 6430, 3983, 0 }, { 6477, 3984, 0 }, { 6478, 3985, 0 },
+  { 0, 3986, 54 }, { 6436, 3987, 0 }, { 0, 3989, 847 }, { 0, 3990, 848 },
+  { 6476, 3986, 0 }, { 0, 3992, 86 }, { 0, 3997, 136 }, { 6455, 3998, 0 },
+  { 6443, 3999, 0 }, { 6451, 4000, 0 }, { 6485, 4001, 0 }, { 6486, 4002, 0 },
+  { 0, 4003, 858 }, { 6487, 4004, 0 }, { 0, 4005, 861 }, { 0, 4006, 862 },
+  { 0, 4008, 864 }, { 0, 4009, 865 }, { 6488, 4012, 0 }, { 0, 4061, 869 },
+  { 6449, 4014, 0 }, { 6490, 4026, 871 }, { 6491, 4026, 0 }, { 6492, 4026, 873 },
+  { 6493, 4026, 0 }, { 6494, 4026, 0 }, { 6496, 4027, 0 }, { 6495, 4026, 0 },
+  { 6497, 4027, 0 }, { 6501, 4029, 0 }, { 6498, 4028, 879 }, { 6499, 4028, 0 },
+  { 6504, 4032, 0 }, { 6437, 3970, 0 }, { 6500, 4028, 0 }, { 6502, 4030, 0 },
+  { 6469, 3970, 0 }, { 6503, 4030, 0 }, { 0, 4016, 886 }, { 0, 4017, 887 },
+  { 6505, 4019, 0 }, { 0, 4021, 891 }, { 6507, 4022, 0 }, { 0, 4023, 894 },
+  { 6468, 4033, 0 }, { 0, 4034, 897 }, { 6509, 4035, 0 }, { 6510, 4067, 0 },
+  { 0, 4037, 904 }, { 6470, 4081, 0 }, { 0, 4083, 909 }, { 0, 4041, 912 },
+  { 0, 4043, 79 }, { 0, 4077, 915 }, { 0, 4084, 916 }, { 0, 4047, 918 },
+  { 0, 4048, 919 }, { 6512, 4049, 0 }, { 6467, 4050, 0 }, { 6470, 4051, 0 },
+  { 6515, 4053, 0 }, { 6516, 4052, 0 }, { 6486, 4054, 0 }, { 6474, 4055, 0 },
+  { 6520, 4056, 0 }, { 6490, 4057, 0 }, { 6522, 4060, 0 }, { 6480, 4054, 0 },
+  { 6523, 4063, 0 }, { 6524, 4064, 0 }, { 6481, 4094, 0 }, { 6506, 4021, 0 },
+  { 0, 4114, 926 }, { 0, 4068, 928 }, { 6526, 4069, 0 }, { 6527, 4070, 0 },
+  { 6528, 4071, 0 }, { 6488, 4072, 0 }, { 6489, 4073, 0 }, { 0, 4074, 935 },
+  { 6531, 4075, 0 }, { 6500, 4076, 0 }, { 6500, 4082, 0 }, { 6534, 4079, 0 },
+  { 6535, 4085, 0 }, { 6536, 4086, 0 }, { 6537, 4087, 0 }, { 6538, 4088, 0 },
+  { 6539, 4089, 944 }, { 0, 4090, 945 }, { 0, 4092, 948 }, { 6540, 4093, 950 },
+  { 6541, 4095, 0 }, { 0, 4096, 952 }, { 6542, 4097, 0 }, { 0, 4098, 954 },
+  { 0, 4099, 955 }, { 0, 4100, 956 }, { 0, 4101, 183 }, { 6503, 4108, 0 },
+  { 6500, 4112, 0 }, { 0, 4102, 957 }, { 0, 4104, 959 }, { 6545, 4105, 0 },
+  { 0, 4106, 961 }, { 6547, 4107, 0 }, { 6548, 4109, 0 }, { 6505, 4110, 0 },
+  { 6524, 4121, 0 }, { 6518, 4111, 0 }, { 6523, 4113, 0 }, { 0, 4116, 967 },
+  { 0, 4119, 965 }, { 6554, 4120, 970 }, { 0, 4128, 972 }, { 6509, 4153, 0 },
+  { 0, 4168, 974 }, { 0, 4171, 122 }, { 6557, 4124, 0 }, { 0, 4125, 977 },
+  { 0, 4127, 979 }, { 0, 4129, 982 }, { 6558, 4132, 0 }, { 0, 4133, 986 },
+  { 0, 4134, 987 }, { 6560, 4135, 0 }, { 6561, 4136, 0 }, { 0, 4141, 256 },
+  { 6562, 4143, 0 }, { 0, 4144, 998 }, { 6563, 4146, 0 }, { 6513, 4147, 0 },
+  { 6565, 4148, 0 }, { 6566, 4149, 0 }, { 0, 4180, 1004 }, { 6567, 4188, 0 },
+  { 0, 4151, 1006 }, { 0, 4183, 226 }, { 6569, 4187, 0 }, { 6570, 4189, 0 },
+  { 6571, 4193, 0 }, { 6572, 4197, 0 }, { 6535, 4200, 0 }, { 6575, 4201, 0 },
+  { 6576, 4152, 0 }, { 0, 4199, 1016 }, { 0, 4156, 1017 }, { 0, 4157, 1018 },
+  { 6577, 4158, 0 }, { 0, 4159, 1021 }, { 6511, 4106, 0 }, { 6549, 4173, 0 },
+  { 6580, 4160, 0 }, { 6581, 4161, 0 }, { 6578, 4158, 0 }, { 0, 4162, 228 },
+  { 0, 4165, 352 }, { 6539, 4166, 0 }, { 6557, 4167, 0 }, { 6541, 4175, 0 },
+  { 6542, 4182, 0 }, { 6555, 4186, 0 }, { 6555, 4192, 0 }, { 6545, 4194, 0 },
+  { 6556, 4168, 0 }, { 6550, 4172, 0 }, { 0, 4174, 1034 }, { 6591, 4176, 0 },
+  { 6592, 4208, 0 }, { 6523, 4183, 0 }, { 6551, 4203, 0 }, { 6548, 4206, 0 },
+  { 6559, 4134, 0 }, { 6562, 4207, 0 }, { 6553, 4209, 0 }, { 6559, 4221, 0 },
+  { 6599, 4178, 0 }, { 6600, 4179, 0 }, { 0, 4181, 104 }, { 0, 4198, 246 },
+  { 0, 4184, 1045 }, { 0, 4190, 1032 }, { 6571, 4191, 0 }, { 6603, 4195, 0 },
+  { 0, 4196, 1048 }, { 6604, 4202, 0 }, { 6606, 4204, 0 }, { 6566, 4247, 0 },
+  { 0, 4253, 1051 }, { 0, 4211, 1054 }, { 0, 4212, 1055 }, { 0, 4213, 1056 },
+  { 0, 4214, 229 }, { 6576, 4216, 0 }, { 6567, 4217, 0 }, { 6577, 4222, 0 },
+  { 6567, 4215, 0 }, { 0, 4218, 1059 }, { 6612, 4220, 0 }, { 6568, 4223, 0 },
+  { 6582, 4165, 0 }, { 6614, 4224, 0 }, { 6615, 4225, 0 }, { 6585, 4226, 0 },
+  { 6617, 4266, 0 }, { 0, 4229, 227 }, { 6587, 4230, 0 }, { 0, 4231, 396 },
+  { 0, 4232, 1069 }, { 6620, 4233, 0 }, { 0, 4267, 1072 }, { 0, 4269, 1073 },
+  { 0, 4237, 353 }, { 6622, 4238, 0 }, { 0, 4240, 1077 }, { 0, 4241, 1040 },
+  { 6623, 4242, 0 }, { 6601, 4198, 0 }, { 6624, 4243, 0 }, { 6625, 4244, 0 },
+  { 6580, 4245, 0 }, { 6627, 4246, 0 }, { 0, 4279, 241 }, { 0, 4280, 637 },
+  { 6601, 4249, 0 }, { 6585, 4250, 0 }, { 6599, 4251, 0 }, { 0, 4254, 1086 },
+  { 6600, 4288, 0 }, { 6634, 4258, 0 }, { 6635, 4259, 0 }, { 6636, 4260, 0 },
+  { 0, 4261, 1093 }, { 6606, 4262, 0 }, { 0, 4263, 1096 }, { 6638, 4264, 0 },
+  { 6639, 4265, 0 }, { 6619, 4231, 0 }, { 6640, 4268, 43 }, { 0, 4270, 1098 },
+  { 6643, 4273, 0 }, { 6644, 4274, 0 }, { 6645, 4277, 0 }, { 6619, 4278, 0 },
+  { 0, 4281, 1105 }, { 6603, 4283, 0 }, { 6622, 4285, 0 }, { 6650, 4286, 0 },
+  { 6651, 4287, 0 }, { 0, 4289, 73 }, { 6652, 4290, 0 }, { 0, 4293, 1118 },
+  { 0, 4294, 1119 }, { 6603, 4295, 0 }, { 0, 4296, 1120 }, { 0, 4298, 301 },
+  { 6621, 4237, 0 }, { 6656, 4300, 0 }, { 6657, 4301, 0 }, { 0, 4302, 335 },
+  { 0, 4304, 1127 }, { 0, 4305, 1128 }, { 6613, 4283, 0 }, { 6659, 4306, 0 },
+  { 0, 4316, 509 }, { 0, 4307, 1130 }, { 6661, 4308, 0 }, { 6641, 4270, 0 },
+  { 6662, 4309, 0 }, { 6642, 4270, 0 }, { 0, 4310, 292 }, { 6663, 4311, 0 },
+  { 0, 4355, 296 }, { 6638, 4357, 0 }, { 0, 4314, 300 }, { 0, 4317, 1109 },
+  { 0, 4318, 1133 }, { 0, 4319, 1134 }, { 0, 4322, 1108 }, { 0, 4323, 1139 },
+  { 6622, 4325, 0 }, { 6616, 4296, 0 }, { 0, 4369, 1138 }, { 6641, 4371, 0 },
+  { 0, 4372, 306 }, { 0, 4328, 311 }, { 6655, 4298, 0 }, { 0, 4329, 303 },
+  { 0, 4333, 317 }, { 6617, 4302, 0 }, { 0, 4332, 290 }, { 6641, 4361, 0 },
+  { 6680, 4379, 0 }, { 0, 4380, 1150 }, { 6636, 4335, 0 }, { 6670, 4332, 0 },
+  { 6683, 4336, 0 }, { 6632, 4325, 0 }, { 0, 4366, 314 }, { 0, 4338, 1112 },
+  { 6660, 4340, 0 }, { 0, 4339, 1152 }, { 0, 4341, 318 }, { 6690, 4342, 0 },
+  { 6652, 4345, 0 }, { 6611, 4316, 0 }, { 0, 4377, 334 }, { 0, 4347, 337 },
+  { 0, 4348, 289 }, { 6662, 4349, 0 }, { 0, 4356, 1157 }, { 0, 4382, 326 },
+  { 6650, 4396, 0 }, { 0, 4350, 327 }, { 0, 4358, 1159 }, { 0, 4384, 332 },
+  { 6652, 4398, 0 }, { 6699, 4354, 1160 }, { 6669, 4329, 0 }, { 6667, 4360, 0 },
+  { 6630, 4332, 0 }, { 6701, 4362, 0 }, { 0, 4363, 1164 }, { 6664, 4349, 0 },
+  { 6702, 4364, 0 }, { 6703, 4365, 0 }, { 6704, 4368, 0 }, { 6665, 4374, 0 },
+  { 6706, 4375, 0 }, { 6641, 4366, 0 }, { 6685, 4339, 0 }, { 6676, 4422, 0 },
+  { 6709, 4381, 0 }, { 6688, 4341, 0 }, { 6679, 4383, 0 }, { 0, 4385, 1178 },
+  { 6649, 4333, 0 }, { 0, 4386, 1179 }, { 6646, 4332, 0 }, { 6711, 4387, 0 },
+  { 0, 4397, 508 }, { 6713, 4388, 0 }, { 6714, 4389, 1182 }, { 0, 4420, 1183 },
+  { 6654, 4350, 0 }, { 0, 4392, 731 }, { 6715, 4393, 0 }, { 6716, 4399, 0 },
+  { 0, 4400, 1188 }, { 6692, 4377, 0 }, { 6686, 4339, 0 }, { 0, 4401, 1189 },
+  { 6717, 4403, 1192 }, { 0, 4404, 1194 }, { 0, 4406, 726 }, { 0, 4407, 1195 },
+  { 6673, 4408, 0 }, { 0, 4409, 360 }, { 0, 4410, 1198 }, { 0, 4411, 1199 },
+  { 6679, 4412, 0 }, { 6720, 4414, 0 }, { 0, 4417, 1204 }, { 0, 4418, 47 },
+  { 0, 4419, 727 }, { 0, 4421, 1207 }, { 6722, 4425, 0 }, { 6692, 4427, 0 },
+  { 6724, 4429, 1214 }, { 6725, 4431, 1216 }, { 6726, 4432, 0 }, { 0, 4434, 1219 },
+  { 6696, 4473, 0 }, { 6728, 4436, 0 }, { 0, 4439, 1222 }, { 6729, 4438, 0 },
+  { 6730, 4440, 0 }, { 6731, 4441, 0 }, { 6695, 4443, 0 }, { 6733, 4445, 0 },
+  { 0, 4446, 1231 }, { 6663, 4397, 0 }, { 6693, 4447, 0 }, { 6735, 4448, 0 },
+  { 6736, 4456, 0 }, { 6702, 4476, 0 }, { 0, 4477, 679 }, { 6694, 4478, 0 },
+  { 6739, 4479, 0 }, { 0, 4480, 1239 }, { 6741, 4488, 369 }, { 6703, 4494, 0 },
+  { 6702, 4495, 0 }, { 6704, 4450, 0 }, { 6740, 4479, 0 }, { 0, 4452, 1244 },
+  { 0, 4454, 374 }, { 6703, 4485, 0 }, { 6702, 4487, 0 }, { 6747, 4489, 0 },
+  { 6706, 4498, 0 }, { 6712, 4503, 0 }, { 0, 4455, 1250 }, { 0, 4459, 1247 },
+  { 6706, 4498, 0 }, { 6754, 4460, 0 }, { 6689, 4421, 0 }, { 6728, 4463, 0 },
+  { 6716, 4474, 0 }, { 6713, 4481, 0 }, { 6758, 4508, 0 }, { 0, 4464, 375 },
+  { 6759, 4465, 0 }, { 6760, 4467, 0 }, { 6761, 4470, 0 }, { 6722, 4482, 0 },
+  { 6717, 4486, 0 }, { 0, 4472, 1263 }, { 6715, 4498, 0 }, { 0, 4483, 423 },
+  { 6765, 4490, 0 }, { 0, 4491, 775 }, { 6766, 4496, 0 }, { 0, 4497, 441 },
+  { 6716, 4499, 0 }, { 0, 4530, 1269 }, { 0, 4531, 1270 }, { 6768, 4538, 0 },
+  { 0, 4501, 1271 }, { 6770, 4532, 0 }, { 0, 4533, 401 }, { 0, 4534, 1274 },
+  { 6772, 4537, 0 }, { 6773, 4539, 0 }, { 6774, 4543, 0 }, { 6775, 4547, 0 },
+  { 6737, 4550, 0 }, { 6777, 4551, 0 }, { 0, 4554, 1279 }, { 6778, 4502, 0 },
+  { 0, 4504, 1281 }, { 0, 4506, 633 }, { 0, 4507, 1282 }, { 6780, 4509, 0 },
+  { 0, 4510, 1285 }, { 6752, 4524, 0 }, { 6783, 4511, 0 }, { 6752, 4455, 0 },
+  { 6721, 4472, 0 }, { 6781, 4509, 0 }, { 6784, 4512, 0 }, { 0, 4513, 403 },
+  { 6741, 4516, 0 }, { 0, 4517, 50 }, { 6756, 4555, 0 }, { 6744, 4562, 0 },
+  { 0, 4565, 421 }, { 6789, 4521, 0 }, { 6790, 4522, 0 }, { 0, 4523, 107 },
+  { 0, 4540, 419 }, { 6768, 4528, 0 }, { 6726, 4533, 0 }, { 0, 4529, 402 },
+  { 6748, 4526, 0 }, { 0, 4535, 131 }, { 6800, 4536, 0 }, { 0, 4541, 1305 },
+  { 0, 4542, 1306 }, { 0, 4544, 1307 }, { 0, 4545, 404 }, { 6766, 4526, 0 },
+  { 0, 4546, 1308 }, { 6801, 4549, 0 }, { 6757, 4552, 0 }, { 6763, 4526, 0 },
+  { 6803, 4586, 0 }, { 6764, 4556, 0 }, { 0, 4557, 1300 }, { 6805, 4558, 0 },
+  { 6752, 4504, 0 }, { 6760, 4526, 0 }, { 6753, 4526, 0 }, { 6763, 4526, 0 },
+  { 0, 4561, 51 }, { 6807, 4563, 0 }, { 6808, 4564, 0 }, { 0, 4597, 414 },
+  { 0, 4598, 638 }, { 6765, 4604, 0 }, { 6766, 4567, 0 }, { 6811, 4568, 0 },
+  { 0, 4569, 1074 }, { 6812, 4571, 0 }, { 0, 4572, 455 }, { 6813, 4573, 0 },
+  { 0, 4574, 1327 }, { 6786, 4517, 0 }, { 6791, 4540, 0 }, { 0, 4576, 1329 },
+  { 6814, 4577, 0 }, { 6775, 4578, 0 }, { 0, 4579, 456 }, { 0, 4608, 798 },
+  { 0, 4611, 1334 }, { 0, 4581, 1335 }, { 6816, 4582, 0 }, { 0, 4592, 263 },
+  { 6818, 4585, 0 }, { 6772, 4588, 0 }, { 0, 4593, 20 }, { 6820, 4589, 0 },
+  { 0, 4590, 1341 }, { 6821, 4591, 0 }, { 6787, 4595, 0 }, { 0, 4596, 1345 },
+  { 6826, 4599, 0 }, { 6796, 4595, 0 }, { 0, 4643, 476 }, { 0, 4606, 1349 },
+  { 0, 4607, 1351 }, { 0, 4603, 1352 }, { 6783, 4605, 0 }, { 6785, 4609, 0 },
+  { 0, 4610, 225 }, { 6799, 4612, 0 }, { 6831, 4613, 0 }, { 6787, 4614, 0 },
+  { 6806, 4561, 0 }, { 0, 4616, 1357 }, { 0, 4662, 1360 }, { 6833, 4618, 0 },
+  { 6834, 4646, 0 }, { 6835, 4621, 0 }, { 0, 4623, 443 }, { 0, 4624, 448 },
+  { 0, 4625, 444 }, { 0, 4639, 446 }, { 6842, 4626, 0 }, { 6843, 4626, 0 },
+  { 0, 4628, 400 }, { 6844, 4630, 0 }, { 6845, 4631, 0 }, { 6846, 4632, 0 },
+  { 0, 4665, 629 }, { 6813, 4634, 0 }, { 0, 4635, 1087 }, { 6824, 4596, 0 },
+  { 6768, 4592, 0 }, { 6848, 4637, 0 }, { 6803, 4668, 0 }, { 6804, 4640, 0 },
+  { 0, 4641, 1376 }, { 0, 4667, 1377 }, { 6806, 4642, 0 }, { 6808, 4644, 0 },
+  { 6853, 4645, 0 }, { 6854, 4649, 0 }, { 6855, 4661, 0 }, { 6815, 4674, 0 },
+  { 6814, 4676, 0 }, { 6859, 4678, 0 }, { 6824, 4692, 0 }, { 6825, 4596, 0 },
+  { 6864, 4654, 0 }, { 6818, 4687, 0 }, { 6837, 4658, 0 }, { 6838, 4625, 0 },
+  { 6840, 4639, 0 }, { 6818, 4687, 0 }, { 6820, 4685, 0 }, { 6829, 4656, 0 },
+  { 6856, 4661, 0 }, { 6825, 4657, 0 }, { 6824, 4659, 0 }, { 0, 4660, 1395 },
+  { 0, 4686, 1396 }, { 6840, 4656, 0 }, { 6826, 4663, 0 }, { 6836, 4623, 0 },
+  { 6837, 4624, 0 }, { 6808, 4625, 0 }, { 6810, 4639, 0 }, { 6827, 4687, 0 },
+  { 6872, 4666, 0 }, { 6873, 4670, 0 }, { 6874, 4682, 0 }, { 0, 4664, 1401 },
+  { 6876, 4669, 0 }, { 0, 4679, 262 }, { 6878, 4671, 0 }, { 0, 4672, 1403 },
+  { 6879, 4673, 0 }, { 6880, 4677, 0 }, { 6881, 4680, 0 }, { 6883, 4683, 0 },
+  { 6885, 4684, 0 }, { 0, 4688, 1411 }, { 6847, 4689, 0 }, { 6891, 4690, 0 },
+  { 6875, 4682, 0 }, { 0, 4691, 478 }, { 6892, 4693, 0 }, { 0, 4694, 1413 },
+  { 0, 4695, 80 }, { 6896, 4699, 0 }, { 0, 4696, 1414 }, { 6897, 4700, 0 },
+  { 6861, 4742, 0 }, { 6899, 4703, 0 }, { 0, 4704, 462 }, { 6862, 4705, 0 },
+  { 6901, 4706, 0 }, { 6855, 4708, 0 }, { 6859, 4709, 0 }, { 0, 4710, 1427 },
+  { 6855, 4689, 0 }, { 6874, 4711, 0 }, { 6859, 4712, 0 }, { 0, 4715, 1432 },
+  { 6907, 4716, 0 }, { 0, 4717, 622 }, { 6878, 4718, 0 }, { 6909, 4721, 1435 },
+  { 0, 4723, 1436 }, { 6910, 4724, 0 }, { 0, 4725, 1438 }, { 0, 4726, 503 },
+  { 6911, 4727, 0 }, { 0, 4728, 505 }, { 6828, 4679, 0 }, { 6913, 4729, 0 },
+  { 6914, 4730, 1443 }, { 6845, 4684, 0 }, { 6894, 4696, 0 }, { 0, 4731, 244 },
+  { 6895, 4696, 0 }, { 0, 4737, 417 }, { 0, 4732, 1444 }, { 6915, 4733, 0 },
+  { 6916, 4734, 0 }, { 0, 4735, 1447 }, { 6836, 4688, 0 }, { 0, 4736, 1448 },
+  { 0, 4738, 1449 }, { 6888, 4688, 0 }, { 6868, 4740, 0 }, { 6891, 4741, 0 },
+  { 6878, 4743, 0 }, { 0, 4744, 499 }, { 0, 4779, 510 }, { 6880, 4783, 0 },
+  { 6878, 4746, 0 }, { 6923, 4747, 0 }, { 6924, 4748, 0 }, { 0, 4749, 1455 },
+  { 0, 4750, 1456 }, { 0, 4752, 1458 }, { 6925, 4753, 0 }, { 0, 4786, 635 },
+  { 0, 4755, 1452 }, { 6895, 4757, 0 }, { 0, 4807, 1463 }, { 0, 4760, 94 },
+  { 6927, 4761, 0 }, { 6893, 4762, 0 }, { 6887, 4763, 0 }, { 6896, 4764, 0 },
+  { 6931, 4765, 0 }, { 0, 4766, 1233 }, { 6890, 4775, 0 }, { 6933, 4801, 0 },
+  { 6895, 4768, 0 }, { 6890, 4780, 0 }, { 6891, 4771, 0 }, { 6911, 4781, 0 },
+  { 0, 4769, 409 }, { 6939, 4770, 0 }, { 0, 4772, 1471 }, { 6940, 4773, 0 },
+  { 6941, 4774, 0 }, { 0, 4777, 239 }, { 0, 4778, 325 }, { 0, 4792, 331 },
+  { 0, 4784, 378 }, { 0, 4785, 412 }, { 6942, 4788, 0 }, { 6891, 4780, 0 },
+  { 6944, 4789, 0 }, { 6914, 4790, 0 }, { 0, 4791, 1477 }, { 6948, 4793, 0 },
+  { 0, 4794, 574 }, { 6950, 4795, 0 }, { 6951, 4797, 0 }, { 0, 4800, 624 },
+  { 0, 4803, 630 }, { 0, 4804, 91 }, { 0, 4805, 259 }, { 0, 4806, 90 },
+  { 0, 4808, 258 }, { 0, 4811, 625 }, { 6952, 4813, 0 }, { 6953, 4814, 0 },
+  { 0, 4815, 92 }, { 0, 4816, 260 }, { 6955, 4818, 0 }, { 6956, 4819, 0 },
+  { 0, 4820, 631 }, { 6957, 4822, 0 }, { 6958, 4823, 1489 }, { 0, 4825, 1491 },
+  { 6943, 4788, 0 }, { 6959, 4831, 0 }, { 6945, 4789, 0 }, { 6960, 4832, 0 },
+  { 6961, 4834, 0 }, { 6918, 4837, 0 }, { 0, 4842, 3 }, { 0, 4843, 4 },
+  { 0, 4845, 8 }, { 6923, 4849, 0 }, { 0, 4851, 17 }, { 0, 4852, 18 },
+  { 6919, 4853, 0 }, { 0, 4854, 22 }, { 6965, 4855, 0 }, { 6928, 4856, 0 },
+  { 0, 4858, 30 }, { 0, 4859, 33 }, { 6963, 4860, 0 }, { 6968, 4861, 0 },
+  { 0, 4862, 37 }, { 0, 4863, 38 }, { 6969, 4865, 0 }, { 6949, 4794, 0 },
+  { 6970, 4866, 0 }, { 6930, 4867, 0 }, { 6931, 4868, 0 }, { 6931, 4869, 0 },
+  { 6933, 4870, 0 }, { 0, 4902, 53 }, { 6938, 4872, 0 }, { 0, 4873, 55 },
+  { 6970, 4874, 0 }, { 6951, 4875, 0 }, { 6978, 4876, 0 }, { 6938, 4868, 0 },
+  { 0, 4878, 63 }, { 6952, 4879, 0 }, { 6936, 4868, 0 }, { 0, 4880, 68 },
+  { 0, 4882, 71 }, { 6948, 4884, 0 }, { 6940, 4868, 0 }, { 6984, 4885, 0 },
+  { 6945, 4886, 0 }, { 0, 4887, 85 }, { 6948, 4888, 0 }, { 6946, 4889, 0 },
+  { 6947, 4889, 0 }, { 6952, 4890, 0 }, { 6946, 4891, 0 }, { 6949, 4892, 0 },
+  { 6962, 4893, 0 }, { 6997, 4894, 0 }, { 6959, 4895, 0 }, { 0, 4896, 112 },
+  { 6958, 4889, 0 }, { 0, 4897, 115 }, { 0, 4898, 116 }, { 0, 4900, 121 },
+  { 7001, 4901, 0 }, { 6975, 4904, 0 }, { 6955, 4889, 0 }, { 6959, 4907, 0 },
+  { 7004, 4906, 0 }, { 6949, 4889, 0 }, { 6961, 4889, 0 }, { 6967, 4928, 0 },
+  { 6962, 4909, 0 }, { 0, 4910, 136 }, { 6961, 4911, 0 }, { 6969, 4912, 0 },
+  { 0, 4913, 143 }, { 6964, 4914, 0 }, { 6978, 4912, 0 }, { 0, 4945, 148 },
+  { 0, 4916, 149 }, { 0, 4917, 150 }, { 7006, 4919, 0 }, { 0, 4920, 166 },
+  { 6995, 4923, 0 }, { 6969, 4924, 0 }, { 0, 4925, 174 }, { 6976, 4926, 0 },
+  { 6990, 4927, 0 }, { 0, 4930, 179 }, { 0, 4932, 184 }, { 6975, 4934, 0 },
+  { 7020, 4935, 0 }, { 6983, 4936, 0 }, { 6993, 4937, 0 }, { 6985, 4938, 0 },
+  { 0, 4940, 196 }, { 0, 4943, 204 }, { 0, 4947, 209 }, { 0, 4948, 216 },
+  { 0, 4949, 217 }, { 6978, 4950, 0 }, { 0, 4951, 221 }, { 0, 4952, 222 },
+  { 6989, 4953, 0 }, { 6987, 4957, 0 }, { 6991, 4954, 0 }, { 7002, 4955, 0 },
+  { 6991, 4956, 0 }, { 6991, 4955, 0 }, { 6999, 4958, 0 }, { 7034, 4959, 0 },
+  { 7009, 4972, 0 }, { 6996, 4960, 0 }, { 6994, 4961, 0 }, { 7000, 4962, 0 },
+  { 7008, 4963, 0 }, { 7016, 4964, 0 }, { 7006, 4965, 0 }, { 7018, 4966, 0 },
+  { 7001, 4967, 0 }, { 7007, 4968, 0 }, { 7018, 4969, 0 }, { 7005, 4970, 0 },
+  { 0, 4971, 257 }, { 7004, 4973, 0 }, { 7017, 4974, 0 }, { 7006, 4975, 0 },
+  { 7019, 4976, 0 }, { 7007, 4960, 0 }, { 7022, 4977, 0 }, { 7008, 4960, 0 },
+  { 7022, 4983, 0 }, { 0, 4978, 265 }, { 7015, 4979, 0 }, { 7014, 4980, 0 },
+  { 7012, 4981, 0 }, { 0, 4982, 276 }, { 0, 4984, 277 }, { 0, 4985, 278 },
+  { 7029, 4986, 0 }, { 7017, 4987, 0 }, { 7063, 4988, 0 }, { 7064, 4989, 0 },
+  { 7028, 4990, 0 }, { 7022, 4991, 0 }, { 7031, 4987, 0 }, { 7040, 4992, 0 },
+  { 7030, 4993, 0 }, { 7038, 4994, 0 }, { 7032, 4995, 0 }, { 7025, 4996, 0 },
+  { 7026, 4997, 0 }, { 7069, 4998, 0 }, { 7055, 4999, 0 }, { 7076, 5012, 0 },
+  { 7046, 5000, 0 }, { 7047, 5001, 0 }, { 7035, 5002, 0 }, { 7034, 5003, 0 },
+  { 7038, 5004, 0 }, { 7053, 5005, 0 }, { 7054, 5006, 0 }, { 7042, 5019, 0 },
+  { 7056, 5007, 0 }, { 7054, 5008, 0 }, { 0, 5009, 339 }, { 0, 5011, 342 },
+  { 0, 5014, 345 }, { 0, 5015, 347 }, { 7090, 5018, 0 }, { 7053, 5020, 0 },
+  { 0, 5021, 356 }, { 0, 5022, 357 }, { 0, 5023, 358 }, { 7092, 5024, 0 },
+  { 7064, 5041, 0 }, { 7063, 5025, 0 }, { 7093, 5026, 0 }, { 7051, 5027, 0 },
+  { 7068, 5028, 0 }, { 7055, 5029, 0 }, { 7101, 5031, 0 }, { 7067, 5032, 0 },
+  { 0, 5034, 387 }, { 0, 5035, 390 }, { 0, 5036, 391 }, { 0, 5037, 392 },
+  { 7098, 5038, 0 }, { 7071, 5040, 0 }, { 7071, 5042, 0 }, { 7060, 5043, 0 },
+  { 7067, 5045, 0 }, { 7061, 5040, 0 }, { 7079, 5059, 0 }, { 7108, 5060, 0 },
+  { 7084, 5061, 0 }, { 7070, 5066, 0 }, { 7073, 5039, 0 }, { 7072, 5044, 0 },
+  { 7090, 5046, 0 }, { 0, 5047, 427 }, { 0, 5048, 429 }, { 0, 5049, 430 },
+  { 0, 5050, 432 }, { 0, 5051, 433 }, { 7069, 5054, 0 }, { 7076, 5059, 0 },
+  { 7088, 5062, 0 }, { 7088, 5068, 0 }, { 7121, 5071, 0 }, { 7079, 5055, 0 },
+  { 0, 5056, 442 }, { 0, 5057, 451 }, { 7084, 5058, 0 }, { 7085, 5063, 0 },
+  { 7086, 5064, 0 }, { 0, 5065, 458 }, { 7084, 5057, 0 }, { 0, 5072, 467 },
+  { 0, 5073, 468 }, { 7084, 5056, 0 }, { 7089, 5074, 0 }, { 7107, 5076, 0 },
+  { 7106, 5077, 0 }, { 7089, 5083, 0 }, { 7099, 5084, 0 }, { 7100, 5098, 0 },
+  { 7098, 5079, 0 }, { 0, 5080, 482 }, { 0, 5081, 483 }, { 7078, 5056, 0 },
+  { 7096, 5082, 0 }, { 7086, 5056, 0 }, { 0, 5086, 487 }, { 0, 5088, 490 },
+  { 0, 5089, 492 }, { 7097, 5091, 0 }, { 7099, 5105, 0 }, { 7097, 5108, 0 },
+  { 7145, 5094, 0 }, { 7102, 5095, 0 }, { 7113, 5096, 0 }, { 7106, 5100, 0 },
+  { 7151, 5097, 0 }, { 7108, 5101, 0 }, { 7121, 5103, 0 }, { 7121, 5109, 0 },
+  { 7155, 5102, 0 }, { 0, 5106, 514 }, { 0, 5148, 520 }, { 0, 5111, 522 },
+  { 7118, 5112, 0 }, { 7117, 5113, 0 }, { 7115, 5091, 0 }, { 0, 5114, 531 },
+  { 0, 5117, 544 }, { 0, 5119, 552 }, { 0, 5120, 553 }, { 7112, 5121, 0 },
+  { 0, 5122, 560 }, { 0, 5123, 561 }, { 0, 5127, 569 }, { 7159, 5128, 0 },
+  { 0, 5133, 575 }, { 7129, 5134, 0 }, { 0, 5136, 581 }, { 7169, 5185, 0 },
+  { 0, 5138, 593 }, { 7170, 5140, 0 }, { 0, 5142, 598 }, { 0, 5143, 478 },
+  { 7172, 5176, 0 }, { 0, 5146, 605 }, { 7127, 5147, 0 }, { 7141, 5150, 0 },
+  { 7140, 5151, 0 }, { 7137, 5152, 0 }, { 7177, 5153, 0 }, { 0, 5154, 614 },
+  { 0, 5155, 615 }, { 7142, 5156, 0 }, { 7181, 5160, 0 }, { 0, 5159, 24 },
+  { 0, 5162, 25 }, { 7182, 5163, 0 }, { 0, 5164, 189 }, { 7183, 5165, 0 },
+  { 0, 5166, 498 }, { 7184, 5167, 0 }, { 7140, 5168, 0 }, { 7155, 5169, 0 },
+  { 7145, 5170, 0 }, { 7134, 5136, 0 }, { 7188, 5171, 0 }, { 7149, 5172, 0 },
+  { 7145, 5173, 0 }, { 0, 5174, 521 }, { 7160, 5175, 0 }, { 0, 5177, 633 },
+  { 7140, 5179, 0 }, { 7146, 5186, 0 }, { 7128, 5143, 0 }, { 7159, 5187, 0 },
+  { 7195, 5184, 0 }, { 0, 5188, 506 }, { 0, 5189, 648 }, { 0, 5208, 669 },
+  { 7151, 5217, 0 }, { 7197, 5218, 0 }, { 7153, 5219, 0 }, { 0, 5230, 611 },
+  { 0, 5232, 692 }, { 7147, 5155, 0 }, { 7180, 5159, 0 }, { 7172, 5236, 0 },
+  { 0, 5237, 698 }, { 0, 5282, 175 }, { 0, 5240, 700 }, { 0, 5241, 702 },
+  { 7159, 5242, 0 }, { 0, 5243, 704 }, { 0, 5244, 705 }, { 0, 5245, 706 },
+  { 0, 5249, 710 }, { 0, 5250, 711 }, { 7202, 5297, 0 }, { 7203, 5254, 0 },
+  { 7163, 5255, 0 }, { 7161, 5295, 0 }, { 0, 5257, 725 }, { 7162, 5258, 0 },
+  { 7161, 5259, 0 }, { 0, 5260, 733 }, { 7191, 5258, 0 }, { 7211, 5261, 0 },
+  { 7166, 5309, 0 }, { 0, 5294, 17 }, { 0, 5310, 738 }, { 0, 5265, 439 },
+  { 7183, 5266, 0 }, { 7216, 5267, 0 }, { 0, 5268, 56 }, { 0, 5269, 58 },
+  { 0, 5270, 742 }, { 0, 5279, 755 }, { 7217, 5276, 0 }, { 7181, 5280, 0 },
+  { 0, 5281, 759 }, { 0, 5283, 760 }, { 0, 5284, 761 }, { 7184, 5266, 0 },
+  { 7219, 5276, 0 }, { 0, 5286, 764 }, { 7183, 5287, 0 }, { 7195, 5304, 0 },
+  { 7197, 5305, 0 }, { 0, 5288, 768 }, { 7185, 5289, 0 }, { 7184, 5292, 0 },
+  { 0, 5296, 770 }, { 0, 5298, 772 }, { 0, 5299, 773 }, { 7231, 5301, 0 },
+  { 0, 5303, 776 }, { 7232, 5306, 0 }, { 7233, 5308, 0 }, { 7234, 5312, 0 },
+  { 0, 5313, 783 }, { 7235, 5316, 0 }, { 7236, 5318, 0 }, { 0, 5320, 788 },
+  { 0, 5321, 789 }, { 0, 5322, 791 }, { 0, 5323, 792 }, { 0, 5324, 793 },
+  { 7192, 5355, 0 }, { 7194, 5326, 0 }, { 7240, 5327, 0 }, { 7197, 5328, 0 },
+  { 7213, 5294, 0 }, { 7215, 5329, 0 }, { 7202, 5330, 0 }, { 7204, 5331, 0 },
+  { 7203, 5332, 0 }, { 7197, 5333, 0 }, { 0, 5334, 799 }, { 7222, 5279, 0 },
+  { 0, 5335, 800 }, { 0, 5336, 804 }, { 7247, 5341, 0 }, { 7204, 5342, 0 },
+  { 7224, 5286, 0 }, { 0, 5344, 810 }, { 0, 5345, 811 }, { 0, 5346, 812 },
+  { 0, 5348, 815 }, { 0, 5350, 821 }, { 0, 5351, 823 }, { 7204, 5352, 0 },
+  { 0, 5353, 828 }, { 7204, 5401, 0 }, { 0, 5404, 830 }, { 0, 7, 831 },
+  { 0, 8, 832 }, { 0, 5358, 839 }, { 7251, 5360, 0 }, { 0, 5362, 813 },
+  { 7252, 5363, 0 }, { 7220, 5365, 0 }, { 0, 5366, 843 }, { 0, 5367, 844 },
+  { 7197, 5320, 0 }, { 7254, 5372, 0 }, { 7217, 5369, 0 }, { 7210, 5375, 0 },
+  { 7211, 5376, 0 }, { 7229, 5377, 0 }, { 0, 5378, 856 }, { 0, 5379, 857 },
+  { 0, 5381, 859 }, { 0, 5386, 143 }, { 7214, 5388, 0 }, { 0, 5389, 871 },
+  { 0, 5390, 872 }, { 0, 5391, 873 }, { 0, 5392, 874 }, { 0, 5393, 875 },
+  { 0, 5395, 876 }, { 0, 5394, 877 }, { 0, 5396, 878 }, { 0, 5398, 879 },
+  { 0, 5399, 880 }, { 0, 5402, 881 }, { 0, 5397, 882 }, { 0, 5403, 883 },
+  { 0, 5405, 884 }, { 0, 5400, 885 }, { 0, 5408, 890 }, { 0, 5439, 786 },
+  { 0, 5410, 893 }, { 7215, 5412, 0 }, { 0, 5414, 898 }, { 0, 5415, 902 },
+  { 7213, 5417, 0 }, { 0, 5425, 920 }, { 7264, 5426, 0 }, { 7224, 5427, 0 },
+  { 0, 5428, 922 }, { 0, 5429, 919 }, { 7221, 5430, 0 }, { 7236, 5435, 0 },
+  { 7268, 5431, 0 }, { 0, 5432, 163 }, { 7226, 5433, 0 }, { 0, 5434, 527 },
+  { 0, 5436, 171 }, { 0, 5437, 924 }, { 7270, 5438, 0 }, { 0, 5442, 929 },
+  { 0, 5443, 930 }, { 0, 5444, 931 }, { 7223, 5445, 0 }, { 7224, 5446, 0 },
+  { 0, 5448, 936 }, { 7228, 5449, 0 }, { 7241, 5450, 0 }, { 0, 5451, 940 },
+  { 0, 5452, 927 }, { 0, 5453, 942 }, { 0, 5454, 943 }, { 0, 5455, 774 },
+  { 0, 5456, 944 }, { 0, 5459, 950 }, { 0, 5460, 951 }, { 0, 5462, 953 },
+  { 7245, 5467, 0 }, { 7231, 5468, 0 }, { 0, 5471, 960 }, { 7247, 5518, 0 },
+  { 0, 5473, 957 }, { 0, 5474, 963 }, { 7234, 5475, 0 }, { 7262, 5414, 0 },
+  { 7243, 5476, 0 }, { 7245, 5477, 0 }, { 7283, 5478, 0 }, { 0, 5481, 970 },
+  { 7284, 5483, 0 }, { 0, 5532, 975 }, { 0, 5486, 976 }, { 0, 5490, 985 },
+  { 0, 5540, 988 }, { 0, 5493, 989 }, { 0, 5494, 992 }, { 0, 5496, 997 },
+  { 0, 5498, 1001 }, { 7237, 5499, 0 }, { 0, 5500, 219 }, { 0, 5501, 1003 },
+  { 0, 5503, 224 }, { 7286, 5537, 0 }, { 0, 5506, 1008 }, { 0, 5507, 937 },
+  { 0, 5508, 1009 }, { 0, 5509, 1010 }, { 7236, 5442, 0 }, { 7287, 5510, 0 },
+  { 0, 5511, 1012 }, { 0, 5512, 1014 }, { 0, 5516, 1019 }, { 0, 5522, 1020 },
+  { 7288, 5519, 0 }, { 0, 5520, 1024 }, { 0, 5521, 1025 }, { 0, 5568, 618 },
+  { 7290, 5525, 0 }, { 7247, 5526, 0 }, { 7251, 5527, 0 }, { 7251, 5528, 0 },
+  { 7248, 5529, 0 }, { 7261, 5530, 0 }, { 7265, 5531, 0 }, { 7251, 5533, 0 },
+  { 0, 5535, 1035 }, { 0, 5536, 1039 }, { 7255, 5538, 0 }, { 7301, 5539, 0 },
+  { 7256, 5541, 0 }, { 7289, 5519, 0 }, { 7304, 5542, 0 }, { 7305, 5543, 0 },
+  { 0, 5544, 1041 }, { 0, 5545, 233 }, { 0, 5585, 1044 }, { 7262, 5550, 0 },
+  { 0, 5551, 1047 }, { 0, 5553, 1049 }, { 7270, 5541, 0 }, { 0, 5554, 1050 },
+  { 7258, 5555, 0 }, { 7263, 5561, 0 }, { 7265, 5562, 0 }, { 7277, 5563, 0 },
+  { 7271, 5564, 0 }, { 0, 5566, 1061 }, { 7313, 5567, 0 }, { 0, 5569, 1063 },
+  { 0, 5570, 494 }, { 7314, 5571, 0 }, { 0, 5572, 1066 }, { 7271, 5574, 0 },
+  { 0, 5605, 1067 }, { 0, 5577, 1070 }, { 0, 5624, 1074 }, { 0, 5581, 1075 },
+  { 0, 5584, 1033 }, { 0, 5586, 1078 }, { 0, 5587, 1079 }, { 7316, 5588, 0 },
+  { 0, 5589, 1081 }, { 7273, 5592, 0 }, { 7318, 5593, 0 }, { 7276, 5594, 0 },
+  { 7320, 5596, 0 }, { 7298, 5535, 0 }, { 7278, 5554, 0 }, { 0, 5597, 410 },
+  { 0, 5598, 1090 }, { 0, 5599, 1091 }, { 7294, 5601, 0 }, { 0, 5603, 604 },
+  { 0, 5604, 1097 }, { 0, 5606, 43 }, { 0, 5635, 678 }, { 0, 5637, 796 },
+  { 0, 5608, 272 }, { 0, 5609, 1101 }, { 0, 5610, 562 }, { 7284, 5611, 0 },
+  { 7283, 5613, 0 }, { 7295, 5630, 0 }, { 7285, 5614, 0 }, { 0, 5615, 1113 },
+  { 0, 5616, 1114 }, { 0, 5618, 1115 }, { 7330, 5621, 0 }, { 7331, 5649, 0 },
+  { 0, 5654, 302 }, { 0, 5625, 1122 }, { 0, 5626, 1123 }, { 7286, 5657, 0 },
+  { 0, 5631, 1129 }, { 7333, 5673, 0 }, { 0, 5634, 287 }, { 0, 5636, 1131 },
+  { 0, 5639, 293 }, { 7280, 5597, 0 }, { 7295, 5641, 0 }, { 7292, 5648, 0 },
+  { 7304, 5665, 0 }, { 7298, 5651, 0 }, { 0, 5686, 305 }, { 0, 5663, 1143 },
+  { 7293, 5688, 0 }, { 7291, 5597, 0 }, { 7340, 5706, 0 }, { 7341, 5706, 0 },
+  { 7343, 5706, 0 }, { 7344, 5704, 0 }, { 7345, 5704, 0 }, { 7346, 5704, 0 },
+  { 7316, 5659, 0 }, { 0, 5660, 1149 }, { 7281, 5597, 0 }, { 7348, 5662, 0 },
+  { 0, 5664, 316 }, { 7349, 5697, 0 }, { 0, 5698, 1153 }, { 0, 5718, 1154 },
+  { 7306, 5668, 0 }, { 0, 5701, 320 }, { 7325, 5637, 0 }, { 0, 5671, 329 },
+  { 7316, 5672, 0 }, { 0, 5717, 334 }, { 7353, 5677, 0 }, { 7325, 5672, 0 },
+  { 7354, 5691, 0 }, { 7355, 5680, 0 }, { 7356, 5712, 0 }, { 7357, 5684, 0 },
+  { 0, 5685, 1160 }, { 7320, 5687, 0 }, { 0, 5689, 1163 }, { 0, 5692, 1165 },
+  { 0, 5693, 1166 }, { 0, 5694, 1168 }, { 7359, 5695, 0 }, { 0, 5696, 1172 },
+  { 7360, 5699, 0 }, { 7334, 5639, 0 }, { 0, 5700, 1176 }, { 7361, 5702, 0 },
+  { 0, 5707, 1180 }, { 7362, 5749, 0 }, { 0, 5709, 1181 }, { 0, 5710, 1182 },
+  { 0, 5714, 1185 }, { 0, 5715, 1187 }, { 0, 5720, 1192 }, { 7363, 5724, 0 },
+  { 7364, 5728, 0 }, { 0, 5729, 46 }, { 7365, 5774, 0 }, { 0, 5734, 1210 },
+  { 7366, 5735, 0 }, { 0, 5736, 1214 }, { 0, 5737, 1216 }, { 0, 5738, 48 },
+  { 7330, 5740, 0 }, { 0, 5741, 1221 }, { 0, 5743, 1224 }, { 0, 5744, 1225 },
+  { 0, 5745, 1226 }, { 7369, 5746, 0 }, { 0, 5747, 270 }, { 7326, 5750, 0 },
+  { 0, 5751, 927 }, { 0, 5752, 927 }, { 7328, 5753, 0 }, { 7373, 5755, 0 },
+  { 0, 5756, 797 }, { 0, 5762, 1238 }, { 0, 5758, 369 }, { 7374, 5759, 0 },
+  { 7375, 5760, 0 }, { 7331, 5761, 0 }, { 7334, 5765, 0 }, { 7341, 5766, 0 },
+  { 0, 5767, 373 }, { 7338, 5768, 0 }, { 7338, 5772, 0 }, { 7343, 5786, 0 },
+  { 7383, 5769, 0 }, { 0, 5815, 370 }, { 7322, 5738, 0 }, { 0, 5773, 1249 },
+  { 7340, 5775, 0 }, { 7354, 5776, 0 }, { 7355, 5777, 0 }, { 0, 5778, 378 },
+  { 0, 5780, 1254 }, { 0, 5781, 1257 }, { 0, 5782, 1260 }, { 7354, 5783, 0 },
+  { 7390, 5784, 0 }, { 7391, 5816, 0 }, { 0, 5788, 1264 }, { 0, 5790, 1267 },
+  { 7344, 5792, 0 }, { 0, 5795, 399 }, { 7371, 5751, 0 }, { 0, 5797, 1272 },
+  { 7393, 5830, 0 }, { 0, 5800, 1275 }, { 0, 5801, 938 }, { 0, 5802, 1058 },
+  { 0, 5803, 1276 }, { 7394, 5804, 0 }, { 0, 5805, 1278 }, { 0, 5807, 1280 },
+  { 7357, 5848, 0 }, { 0, 5811, 1283 }, { 0, 5817, 1284 }, { 7396, 5813, 0 },
+  { 0, 5814, 1288 }, { 0, 5818, 1289 }, { 7398, 5820, 0 }, { 0, 5865, 50 },
+  { 7399, 5822, 0 }, { 7354, 5823, 0 }, { 0, 5825, 1295 }, { 0, 5826, 408 },
+  { 0, 5866, 1297 }, { 7357, 5832, 0 }, { 7358, 5839, 0 }, { 7371, 5843, 0 },
+  { 7371, 5849, 0 }, { 7358, 5850, 0 }, { 7362, 5851, 0 }, { 7366, 5829, 0 },
+  { 7397, 5813, 0 }, { 0, 5834, 1304 }, { 0, 5841, 1310 }, { 7409, 5842, 0 },
+  { 0, 5844, 1313 }, { 7364, 5845, 0 }, { 0, 5847, 1315 }, { 0, 5896, 51 },
+  { 0, 5853, 1301 }, { 0, 5854, 1317 }, { 7376, 5857, 0 }, { 7412, 5858, 0 },
+  { 0, 5859, 1322 }, { 0, 5861, 1325 }, { 0, 5863, 1326 }, { 0, 5868, 1330 },
+  { 7367, 5869, 0 }, { 0, 5874, 933 }, { 7414, 5916, 0 }, { 0, 5876, 1338 },
+  { 7370, 5877, 0 }, { 0, 5879, 887 }, { 0, 5881, 1342 }, { 7386, 5882, 0 },
+  { 7373, 5885, 0 }, { 0, 5915, 1346 }, { 0, 5931, 1346 }, { 0, 5884, 1347 },
+  { 7379, 5834, 0 }, { 7418, 5890, 0 }, { 7419, 5891, 0 }, { 7374, 5893, 0 },
+  { 0, 5894, 1355 }, { 7383, 5895, 0 }, { 0, 5899, 1361 }, { 0, 5900, 1364 },
+  { 0, 5901, 1366 }, { 0, 5947, 1367 }, { 0, 5948, 1368 }, { 0, 5935, 445 },
+  { 7377, 5949, 0 }, { 0, 5936, 447 }, { 7378, 5950, 0 }, { 0, 5906, 442 },
+  { 0, 5907, 141 }, { 0, 5909, 20 }, { 0, 5910, 1357 }, { 0, 5911, 450 },
+  { 7379, 5913, 0 }, { 0, 5917, 1373 }, { 7426, 5918, 0 }, { 7427, 5919, 0 },
+  { 7428, 5922, 0 }, { 7429, 5923, 0 }, { 0, 5924, 1371 }, { 0, 5925, 1380 },
+  { 0, 5926, 1381 }, { 0, 5940, 1382 }, { 7388, 5927, 0 }, { 7395, 5928, 0 },
+  { 0, 5929, 454 }, { 7392, 5933, 0 }, { 7392, 5937, 0 }, { 7397, 5951, 0 },
+  { 7437, 5930, 0 }, { 0, 5932, 1388 }, { 7438, 5934, 0 }, { 7439, 5938, 0 },
+  { 7440, 5939, 0 }, { 7441, 5945, 0 }, { 7442, 5941, 0 }, { 7443, 5942, 0 },
+  { 7444, 5946, 0 }, { 0, 5952, 459 }, { 0, 5953, 1398 }, { 0, 5954, 1399 },
+  { 0, 5968, 1400 }, { 0, 5956, 934 }, { 7447, 5998, 0 }, { 0, 5958, 1402 },
+  { 0, 5960, 1404 }, { 0, 5961, 1406 }, { 0, 5962, 1407 }, { 7387, 5901, 0 },
+  { 0, 5963, 1409 }, { 7387, 5924, 0 }, { 0, 5964, 471 }, { 7404, 6001, 0 },
+  { 7410, 6010, 0 }, { 0, 6013, 1412 }, { 7408, 5966, 0 }, { 7412, 5984, 0 },
+  { 0, 5967, 474 }, { 0, 5970, 475 }, { 7400, 5924, 0 }, { 0, 6002, 680 },
+  { 0, 6004, 1416 }, { 0, 5973, 1417 }, { 0, 5975, 1418 }, { 7453, 5976, 0 },
+  { 0, 5977, 1421 }, { 7423, 5979, 0 }, { 0, 5980, 1424 }, { 7410, 5981, 0 },
+  { 7402, 5952, 0 }, { 7456, 5982, 0 }, { 7457, 5985, 0 }, { 7419, 5986, 0 },
+  { 0, 5988, 1433 }, { 7421, 5990, 0 }, { 0, 5991, 1435 }, { 0, 5993, 1437 },
+  { 0, 5996, 1440 }, { 7415, 5952, 0 }, { 0, 5999, 1441 }, { 0, 6000, 1443 },
+  { 0, 6007, 1445 }, { 0, 6008, 1446 }, { 7461, 6014, 0 }, { 7418, 6015, 0 },
+  { 7422, 6016, 0 }, { 7464, 6019, 0 }, { 7408, 6002, 0 }, { 7425, 6020, 0 },
+  { 0, 6021, 1453 }, { 0, 6022, 1454 }, { 0, 6026, 1459 }, { 7468, 6029, 0 },
+  { 0, 6032, 1464 }, { 7431, 6033, 0 }, { 7443, 6034, 0 }, { 7436, 6035, 0 },
+  { 0, 6036, 1230 }, { 7426, 6038, 0 }, { 0, 6039, 1299 }, { 7446, 6040, 0 },
+  { 7443, 6041, 0 }, { 7444, 6055, 0 }, { 7449, 6042, 0 }, { 7437, 6043, 0 },
+  { 0, 6045, 1470 }, { 0, 6047, 1472 }, { 0, 6048, 524 }, { 0, 6054, 1466 },
+  { 0, 6080, 1465 }, { 0, 6056, 1468 }, { 0, 6082, 1467 }, { 7416, 6007, 0 },
+  { 7478, 6057, 0 }, { 0, 6059, 1478 }, { 0, 6103, 1479 }, { 0, 6061, 1480 },
+  { 0, 6062, 526 }, { 0, 6070, 626 }, { 0, 6071, 627 }, { 7423, 6021, 0 },
+  { 0, 6074, 628 }, { 0, 6075, 632 }, { 0, 6077, 533 }, { 0, 6078, 1489 },
+  { 0, 6081, 1500 }, { 0, 6083, 1501 }, { 0, 6084, 557 }, { 7479, 6085, 0 },
+  { 7451, 6089, 0 }, { 7447, 6092, 0 }, { 0, 6094, 24 }, { 7447, 6095, 0 },
+  { 7448, 6098, 0 }, { 0, 6099, 36 }, { 0, 6102, 40 }, { 0, 6104, 42 },
+  { 7438, 6105, 0 }, { 7439, 6106, 0 }, { 7446, 6115, 0 }, { 7440, 6118, 0 },
+  { 7449, 6122, 0 }, { 7458, 6107, 0 }, { 7452, 6108, 0 }, { 7445, 6110, 0 },
+  { 7452, 6112, 0 }, { 7447, 6113, 0 }, { 7456, 6114, 0 }, { 7495, 6117, 0 },
+  { 7467, 6121, 0 }, { 0, 6123, 81 }, { 7451, 6124, 0 }, { 7498, 6126, 0 },
+  { 7459, 6127, 0 }, { 7454, 6128, 0 }, { 7469, 6136, 0 }, { 7471, 6142, 0 },
+  { 7504, 6145, 0 }, { 7462, 6146, 0 }, { 7458, 6129, 0 }, { 7478, 6130, 0 },
+  { 7492, 6131, 0 }, { 7465, 6132, 0 }, { 0, 6133, 109 }, { 7469, 6133, 0 },
+  { 7462, 6136, 0 }, { 7466, 6134, 0 }, { 0, 6140, 122 }, { 7478, 6141, 0 },
+  { 7466, 6143, 0 }, { 0, 6144, 128 }, { 7488, 6147, 0 }, { 7484, 6148, 0 },
+  { 7485, 6150, 0 }, { 7494, 6151, 0 }, { 7478, 6154, 0 }, { 7479, 6153, 0 },
+  { 7481, 6158, 0 }, { 7478, 6158, 0 }, { 7482, 6158, 0 }, { 7488, 6160, 0 },
+  { 7504, 6161, 0 }, { 7524, 6163, 0 }, { 7495, 6164, 0 }, { 7496, 6158, 0 },
+  { 7483, 6167, 0 }, { 0, 6168, 93 }, { 7535, 6169, 0 }, { 7490, 6170, 0 },
+  { 7506, 6171, 0 }, { 7494, 6177, 0 }, { 7490, 6158, 0 }, { 7494, 6158, 0 },
+  { 7508, 6180, 0 }, { 7491, 6181, 0 }, { 7506, 6182, 0 }, { 7504, 6183, 0 },
+  { 7523, 6185, 0 }, { 7500, 6184, 0 }, { 7500, 6186, 0 }, { 0, 6187, 236 },
+  { 7503, 6187, 0 }, { 7509, 6188, 0 }, { 7501, 6189, 0 }, { 7520, 6205, 0 },
+  { 7523, 6207, 0 }, { 7512, 6190, 0 }, { 7505, 6191, 0 }, { 7509, 6192, 0 },
+  { 7518, 6193, 0 }, { 7552, 6194, 0 }, { 7512, 6195, 0 }, { 7559, 6196, 0 },
+  { 7514, 6197, 0 }, { 7530, 6198, 0 }, { 7521, 6199, 0 }, { 7562, 6201, 0 },
+  { 7518, 6202, 0 }, { 7538, 6203, 0 }, { 7520, 6204, 0 }, { 7521, 6206, 0 },
+  { 7534, 6208, 0 }, { 7517, 6187, 0 }, { 7542, 6210, 0 }, { 7538, 6211, 0 },
+  { 7526, 6212, 0 }, { 7559, 6216, 0 }, { 7542, 6217, 0 }, { 7529, 6222, 0 },
+  { 0, 6218, 281 }, { 0, 6219, 283 }, { 7540, 6220, 0 }, { 7529, 6221, 0 },
+  { 7535, 6223, 0 }, { 7547, 6224, 0 }, { 7543, 6225, 0 }, { 7584, 6226, 0 },
+  { 7540, 6227, 0 }, { 7555, 6228, 0 }, { 7546, 6229, 0 }, { 7545, 6229, 0 },
+  { 7545, 6230, 0 }, { 0, 6231, 306 }, { 7565, 6232, 0 }, { 7566, 6233, 0 },
+  { 7552, 6234, 0 }, { 7578, 6235, 0 }, { 7547, 6231, 0 }, { 7568, 6236, 0 },
+  { 7547, 6231, 0 }, { 7554, 6237, 0 }, { 7570, 6238, 0 }, { 7557, 6239, 0 },
+  { 7603, 6240, 0 }, { 7561, 6231, 0 }, { 7576, 6241, 0 }, { 0, 6246, 350 },
+  { 7555, 6247, 0 }, { 0, 6251, 360 }, { 7576, 6252, 0 }, { 7570, 6253, 0 },
+  { 7555, 6231, 0 }, { 7559, 6231, 0 }, { 7611, 6254, 0 }, { 7567, 6255, 0 },
+  { 7572, 6256, 0 }, { 7615, 6257, 0 }, { 0, 6258, 377 }, { 7575, 6259, 0 },
+  { 7579, 6264, 0 }, { 7581, 6265, 0 }, { 7580, 6269, 0 }, { 7586, 6266, 0 },
+  { 7597, 6267, 0 }, { 7586, 6268, 0 }, { 7586, 6267, 0 }, { 7628, 6270, 0 },
+  { 7603, 6283, 0 }, { 7590, 6271, 0 }, { 7590, 6272, 0 }, { 7596, 6273, 0 },
+  { 7600, 6274, 0 }, { 7595, 6275, 0 }, { 7589, 6276, 0 }, { 7601, 6282, 0 },
+  { 7576, 6264, 0 }, { 7596, 6284, 0 }, { 7609, 6285, 0 }, { 7600, 6286, 0 },
+  { 7616, 6287, 0 }, { 7600, 6297, 0 }, { 7619, 6307, 0 }, { 7613, 6309, 0 },
+  { 7602, 6294, 0 }, { 7601, 6271, 0 }, { 7651, 6290, 0 }, { 7602, 6271, 0 },
+  { 7652, 6291, 0 }, { 7653, 6292, 0 }, { 7623, 6298, 0 }, { 7626, 6299, 0 },
+  { 7626, 6300, 0 }, { 7632, 6301, 0 }, { 7622, 6302, 0 }, { 7632, 6303, 0 },
+  { 7617, 6304, 0 }, { 7664, 6308, 0 }, { 7665, 6313, 0 }, { 7637, 6330, 0 },
+  { 7636, 6314, 0 }, { 7623, 6315, 0 }, { 0, 6316, 437 }, { 7629, 6317, 0 },
+  { 7642, 6316, 0 }, { 7646, 6318, 0 }, { 7631, 6316, 0 }, { 7634, 6319, 0 },
+  { 0, 6320, 95 }, { 7632, 6321, 0 }, { 7631, 6322, 0 }, { 7644, 6323, 0 },
+  { 0, 6324, 511 }, { 7677, 6328, 0 }, { 7661, 6329, 0 }, { 7647, 6335, 0 },
+  { 0, 6339, 570 }, { 7682, 6341, 0 }, { 7683, 6369, 0 }, { 7684, 6369, 0 },
+  { 7685, 6369, 0 }, { 7686, 6369, 0 }, { 7687, 6369, 0 }, { 7688, 6369, 0 },
+  { 7690, 6369, 0 }, { 7691, 6369, 0 }, { 0, 6343, 591 }, { 0, 6345, 594 },
+  { 7693, 6378, 0 }, { 0, 6348, 63 }, { 7694, 6350, 0 }, { 7695, 6351, 0 },
+  { 7660, 6352, 0 }, { 7668, 6353, 0 }, { 0, 6354, 612 }, { 7701, 6389, 0 },
+  { 7702, 6357, 0 }, { 0, 6390, 24 }, { 0, 6358, 619 }, { 0, 6361, 622 },
+  { 0, 6363, 624 }, { 0, 6365, 625 }, { 7703, 6366, 0 }, { 7659, 6367, 0 },
+  { 7705, 6368, 0 }, { 0, 6370, 629 }, { 7673, 6371, 0 }, { 7707, 6372, 0 },
+  { 7708, 6374, 0 }, { 7678, 6376, 0 }, { 7683, 6377, 0 }, { 7684, 6379, 0 },
+  { 0, 6380, 645 }, { 7712, 6384, 0 }, { 0, 6385, 679 }, { 7713, 6386, 0 },
+  { 7692, 6343, 0 }, { 7714, 6391, 0 }, { 7715, 6396, 0 }, { 0, 6402, 714 },
+  { 0, 6403, 716 }, { 7670, 6404, 0 }, { 7680, 6405, 0 }, { 7674, 6407, 0 },
+  { 7724, 6408, 0 }, { 7657, 6354, 0 }, { 7719, 6410, 0 }, { 7720, 6410, 0 },
+  { 0, 6411, 734 }, { 7725, 6412, 0 }, { 0, 6456, 17 }, { 7686, 6416, 0 },
+  { 7682, 6427, 0 }, { 0, 6417, 740 }, { 0, 6422, 751 }, { 7676, 6410, 0 },
+  { 0, 6428, 752 }, { 7687, 6410, 0 }, { 7696, 6410, 0 }, { 0, 6463, 756 },
+  { 7728, 6423, 0 }, { 0, 6468, 765 }, { 7685, 6430, 0 }, { 7731, 6431, 0 },
+  { 7699, 6432, 0 }, { 7683, 6430, 0 }, { 7692, 6434, 0 }, { 7734, 6435, 0 },
+  { 0, 6439, 775 }, { 0, 6441, 68 }, { 0, 6442, 779 }, { 0, 6443, 782 },
+  { 0, 6445, 81 }, { 0, 6446, 786 }, { 7690, 6488, 0 }, { 7737, 6452, 0 },
+  { 7738, 6453, 0 }, { 0, 6454, 797 }, { 7708, 6455, 0 }, { 7696, 6457, 0 },
+  { 7692, 6458, 0 }, { 7715, 6459, 0 }, { 7702, 6460, 0 }, { 7744, 6461, 0 },
+  { 0, 6466, 807 }, { 7745, 6467, 0 }, { 7746, 6475, 0 }, { 7747, 6477, 0 },
+  { 0, 6482, 841 }, { 0, 6484, 815 }, { 7702, 6485, 0 }, { 0, 6489, 845 },
+  { 7750, 6490, 0 }, { 7716, 6491, 0 }, { 7717, 6492, 0 }, { 7718, 6485, 0 },
+  { 7712, 6493, 0 }, { 7754, 6498, 0 }, { 7755, 6517, 0 }, { 0, 6559, 899 },
+  { 7757, 6520, 0 }, { 0, 6522, 921 }, { 7708, 6523, 0 }, { 7714, 6526, 0 },
+  { 7715, 6527, 0 }, { 0, 6528, 161 }, { 7718, 6530, 0 }, { 0, 6534, 925 },
+  { 7716, 6582, 0 }, { 7763, 6538, 0 }, { 7764, 6539, 0 }, { 7738, 6541, 0 },
+  { 7720, 6542, 0 }, { 7767, 6552, 0 }, { 7768, 6553, 0 }, { 7769, 6555, 0 },
+  { 7770, 6558, 0 }, { 7688, 6445, 0 }, { 7771, 6560, 0 }, { 7772, 6561, 0 },
+  { 0, 6562, 965 }, { 0, 6564, 973 }, { 7773, 6573, 0 }, { 0, 6577, 1007 },
+  { 0, 6583, 1011 }, { 0, 6588, 1022 }, { 0, 6605, 1023 }, { 0, 6592, 1028 },
+  { 7774, 6593, 0 }, { 7726, 6594, 0 }, { 7735, 6595, 0 }, { 7750, 6596, 0 },
+  { 7732, 6597, 0 }, { 7748, 6598, 0 }, { 7780, 6599, 0 }, { 0, 6641, 1036 },
+  { 7741, 6602, 0 }, { 7756, 6559, 0 }, { 0, 6603, 1040 }, { 7739, 6604, 0 },
+  { 7738, 6614, 0 }, { 0, 6606, 250 }, { 0, 6607, 253 }, { 7785, 6611, 0 },
+  { 7752, 6642, 0 }, { 7787, 6616, 0 }, { 7761, 6617, 0 }, { 7743, 6618, 0 },
+  { 7744, 6619, 0 }, { 7742, 6620, 0 }, { 0, 6622, 1062 }, { 0, 6625, 1064 },
+  { 7792, 6627, 0 }, { 0, 6635, 1080 }, { 7793, 6637, 0 }, { 0, 6638, 1084 },
+  { 7751, 6639, 0 }, { 0, 6640, 1089 }, { 7746, 6673, 0 }, { 7764, 6681, 0 },
+  { 7797, 6690, 0 }, { 7771, 6646, 0 }, { 0, 6698, 1099 }, { 7799, 6655, 0 },
+  { 7759, 6656, 0 }, { 7767, 6657, 0 }, { 7758, 6658, 0 }, { 0, 6662, 336 },
+  { 0, 6663, 1120 }, { 7804, 6667, 0 }, { 0, 6669, 509 }, { 0, 6717, 293 },
+  { 7760, 6674, 0 }, { 7766, 6675, 0 }, { 7774, 6676, 0 }, { 7763, 6677, 0 },
+  { 7810, 6680, 0 }, { 0, 6682, 290 }, { 0, 6683, 1145 }, { 7781, 6641, 0 },
+  { 0, 6684, 1146 }, { 0, 6685, 317 }, { 0, 6686, 1147 }, { 0, 6687, 1148 },
+  { 7773, 6688, 0 }, { 0, 6691, 1151 }, { 0, 6693, 315 }, { 7768, 6696, 0 },
+  { 7783, 6700, 0 }, { 7770, 6703, 0 }, { 0, 6702, 322 }, { 0, 6704, 324 },
+  { 0, 6705, 325 }, { 0, 6706, 328 }, { 0, 6707, 331 }, { 7786, 6709, 0 },
+  { 0, 6714, 1171 }, { 0, 6716, 1175 }, { 0, 6719, 1177 }, { 0, 6721, 508 },
+  { 0, 6727, 1196 }, { 0, 6728, 1200 }, { 0, 6730, 1207 }, { 0, 6732, 1212 },
+  { 7818, 6762, 0 }, { 7819, 6736, 0 }, { 0, 6741, 1227 }, { 7783, 6743, 0 },
+  { 0, 6778, 1234 }, { 7821, 6746, 0 }, { 0, 6747, 1237 }, { 0, 6751, 1240 },
+  { 0, 6752, 1241 }, { 7803, 6663, 0 }, { 7822, 6753, 0 }, { 7782, 6754, 0 },
+  { 7773, 6755, 0 }, { 7781, 6757, 0 }, { 7826, 6758, 0 }, { 7827, 6759, 0 },
+  { 0, 6760, 375 }, { 7828, 6764, 0 }, { 7829, 6765, 0 }, { 7772, 6705, 0 },
+  { 7830, 6766, 0 }, { 7773, 6707, 0 }, { 7790, 6771, 0 }, { 0, 6772, 1262 },
+  { 0, 6773, 844 }, { 7832, 6776, 0 }, { 0, 6780, 1273 }, { 0, 6785, 1277 },
+  { 7788, 6788, 0 }, { 0, 6791, 1286 }, { 0, 6808, 1287 }, { 0, 6794, 1292 },
+  { 0, 6796, 424 }, { 7834, 6797, 0 }, { 7794, 6801, 0 }, { 7794, 6802, 0 },
+  { 7791, 6803, 0 }, { 7804, 6804, 0 }, { 7804, 6805, 0 }, { 7809, 6806, 0 },
+  { 7795, 6807, 0 }, { 7808, 6836, 0 }, { 0, 6811, 1311 }, { 7843, 6813, 0 },
+  { 7844, 6818, 0 }, { 0, 6819, 1320 }, { 7845, 6824, 0 }, { 0, 6826, 263 },
+  { 7846, 6828, 0 }, { 7847, 6831, 0 }, { 7821, 6832, 0 }, { 0, 6837, 1353 },
+  { 0, 6838, 1354 }, { 7810, 6839, 0 }, { 7850, 6841, 0 }, { 7805, 6891, 0 },
+  { 7852, 6848, 0 }, { 7853, 6850, 0 }, { 7823, 6856, 0 }, { 0, 6858, 1374 },
+  { 0, 6859, 1375 }, { 0, 6860, 1378 }, { 0, 6861, 1379 }, { 7855, 6893, 0 },
+  { 7813, 6902, 0 }, { 7816, 6866, 0 }, { 7807, 6867, 0 }, { 7815, 6869, 0 },
+  { 7860, 6870, 0 }, { 7861, 6871, 0 }, { 0, 6872, 456 }, { 0, 6874, 1389 },
+  { 0, 6875, 1390 }, { 0, 6876, 1391 }, { 0, 6877, 1392 }, { 0, 6878, 1393 },
+  { 0, 6879, 1394 }, { 0, 6880, 1397 }, { 7862, 6912, 0 }, { 7820, 6921, 0 },
+  { 0, 6886, 262 }, { 7833, 6895, 0 }, { 7866, 6896, 0 }, { 7823, 6898, 0 },
+  { 7868, 6899, 0 }, { 7869, 6930, 0 }, { 0, 6907, 1420 }, { 7870, 6909, 0 },
+  { 7871, 6911, 0 }, { 0, 6913, 1426 }, { 0, 6914, 1428 }, { 7872, 6915, 0 },
+  { 7842, 6917, 0 }, { 7875, 6955, 0 }, { 0, 6926, 437 }, { 7832, 6927, 0 },
+  { 7837, 6928, 0 }, { 0, 6929, 1451 }, { 7839, 6917, 0 }, { 7829, 6931, 0 },
+  { 7879, 6963, 0 }, { 0, 6935, 1461 }, { 7839, 6937, 0 }, { 7881, 6938, 0 },
+  { 7842, 6939, 0 }, { 7844, 6941, 0 }, { 7886, 6943, 0 }, { 7841, 6944, 0 },
+  { 7842, 6945, 0 }, { 7889, 6946, 0 }, { 7857, 6947, 0 }, { 0, 6956, 1476 },
+  { 0, 6971, 1507 }, { 7845, 6972, 0 }, { 7892, 6973, 0 }, { 7848, 6975, 0 },
+  { 7862, 6976, 0 }, { 7895, 6980, 0 }, { 7896, 6981, 0 }, { 7850, 6982, 0 },
+  { 7854, 6983, 0 }, { 7870, 6984, 0 }, { 7899, 6985, 0 }, { 7852, 6986, 0 },
+  { 7904, 6987, 0 }, { 7860, 6988, 0 }, { 7907, 6989, 0 }, { 7868, 6990, 0 },
+  { 0, 6991, 64 }, { 7883, 6992, 0 }, { 7876, 6994, 0 }, { 0, 6995, 86 },
+  { 7866, 6996, 0 }, { 7915, 6997, 0 }, { 7871, 6998, 0 }, { 7885, 7008, 0 },
+  { 7876, 6997, 0 }, { 7885, 6999, 0 }, { 7876, 7000, 0 }, { 7876, 7001, 0 },
+  { 7923, 7002, 0 }, { 7880, 7000, 0 }, { 7924, 7003, 0 }, { 7891, 7004, 0 },
+  { 7909, 7005, 0 }, { 7896, 7004, 0 }, { 7886, 7007, 0 }, { 7897, 7004, 0 },
+  { 7932, 7009, 0 }, { 7895, 7011, 0 }, { 7915, 7012, 0 }, { 7904, 7014, 0 },
+  { 7889, 7015, 0 }, { 7910, 7016, 0 }, { 7900, 7017, 0 }, { 7888, 7018, 0 },
+  { 7908, 7019, 0 }, { 7894, 7020, 0 }, { 7904, 7021, 0 }, { 7912, 7022, 0 },
+  { 7900, 7027, 0 }, { 7919, 7034, 0 }, { 7909, 7035, 0 }, { 7921, 7023, 0 },
+  { 7911, 7024, 0 }, { 7903, 7025, 0 }, { 7951, 7026, 0 }, { 7943, 7028, 0 },
+  { 0, 7030, 188 }, { 7918, 7031, 0 }, { 7951, 7032, 0 }, { 7923, 7033, 0 },
+  { 7954, 7036, 0 }, { 7957, 7037, 0 }, { 7918, 7038, 0 }, { 7929, 7039, 0 },
+  { 7930, 7040, 0 }, { 7963, 7041, 0 }, { 7931, 7040, 0 }, { 7963, 7042, 0 },
+  { 7921, 7044, 0 }, { 7937, 7065, 0 }, { 7934, 7045, 0 }, { 7928, 7046, 0 },
+  { 7947, 7047, 0 }, { 7924, 7048, 0 }, { 7928, 7049, 0 }, { 7973, 7050, 0 },
+  { 7947, 7051, 0 }, { 7969, 7052, 0 }, { 7934, 7053, 0 }, { 7947, 7054, 0 },
+  { 0, 7055, 251 }, { 7974, 7056, 0 }, { 7980, 7057, 0 }, { 7932, 7058, 0 },
+  { 7938, 7059, 0 }, { 7983, 7060, 0 }, { 7942, 7061, 0 }, { 7961, 7062, 0 },
+  { 7988, 7063, 0 }, { 7944, 7064, 0 }, { 7962, 7066, 0 }, { 7992, 7067, 0 },
+  { 7993, 7068, 0 }, { 7963, 7069, 0 }, { 7970, 7070, 0 }, { 7953, 7071, 0 },
+  { 7959, 7074, 0 }, { 7969, 7075, 0 }, { 8001, 7076, 0 }, { 7980, 7077, 0 },
+  { 7961, 7069, 0 }, { 7948, 7059, 0 }, { 7965, 7069, 0 }, { 7952, 7061, 0 },
+  { 7957, 7078, 0 }, { 0, 7079, 291 }, { 8005, 7080, 0 }, { 7962, 7081, 0 },
+  { 7958, 7082, 0 }, { 7961, 7083, 0 }, { 7974, 7084, 0 }, { 7963, 7090, 0 },
+  { 7980, 7092, 0 }, { 7967, 7097, 0 }, { 7986, 7104, 0 }, { 7976, 7105, 0 },
+  { 8008, 7086, 0 }, { 7985, 7087, 0 }, { 7986, 7088, 0 }, { 7974, 7089, 0 },
+  { 8000, 7091, 0 }, { 8021, 7093, 0 }, { 7992, 7094, 0 }, { 7992, 7095, 0 },
+  { 0, 7096, 333 }, { 7969, 7079, 0 }, { 8001, 7098, 0 }, { 8025, 7100, 0 },
+  { 8030, 7102, 0 }, { 7981, 7096, 0 }, { 7978, 7096, 0 }, { 7986, 7103, 0 },
+  { 0, 7106, 364 }, { 8033, 7107, 0 }, { 8000, 7102, 0 }, { 7996, 7108, 0 },
+  { 0, 7109, 372 }, { 7998, 7111, 0 }, { 8008, 7112, 0 }, { 8036, 7128, 0 },
+  { 8012, 7113, 0 }, { 7992, 7109, 0 }, { 7995, 7114, 0 }, { 7993, 7112, 0 },
+  { 7992, 7096, 0 }, { 8010, 7115, 0 }, { 8008, 7116, 0 }, { 8027, 7118, 0 },
+  { 8004, 7117, 0 }, { 0, 7119, 409 }, { 8006, 7119, 0 }, { 8012, 7120, 0 },
+  { 8004, 7121, 0 }, { 8023, 7137, 0 }, { 8026, 7139, 0 }, { 7998, 7109, 0 },
+  { 8002, 7109, 0 }, { 8015, 7122, 0 }, { 8008, 7123, 0 }, { 8023, 7124, 0 },
+  { 8018, 7125, 0 }, { 8029, 7126, 0 }, { 8060, 7127, 0 }, { 8061, 7129, 0 },
+  { 8017, 7130, 0 }, { 8020, 7131, 0 }, { 8027, 7132, 0 }, { 8035, 7133, 0 },
+  { 8022, 7134, 0 }, { 8028, 7135, 0 }, { 8043, 7136, 0 }, { 8020, 7119, 0 },
+  { 0, 7138, 453 }, { 0, 7140, 395 }, { 0, 7141, 459 }, { 8075, 7142, 0 },
+  { 8045, 7143, 0 }, { 8028, 7138, 0 }, { 8077, 7144, 0 }, { 8031, 7141, 0 },
+  { 8040, 7145, 0 }, { 8074, 7146, 0 }, { 8037, 7134, 0 }, { 8049, 7147, 0 },
+  { 8081, 7148, 0 }, { 0, 7149, 485 }, { 0, 7150, 494 }, { 8051, 7151, 0 },
+  { 8043, 7152, 0 }, { 8084, 7153, 0 }, { 8041, 7156, 0 }, { 8034, 7138, 0 },
+  { 8038, 7138, 0 }, { 8037, 7158, 0 }, { 8046, 7155, 0 }, { 8045, 7157, 0 },
+  { 8041, 7159, 0 }, { 8050, 7161, 0 }, { 8091, 7162, 0 }, { 8047, 7163, 0 },
+  { 8067, 7165, 0 }, { 8056, 7166, 0 }, { 8080, 7167, 0 }, { 0, 7169, 577 },
+  { 0, 7170, 582 }, { 0, 7171, 583 }, { 0, 7172, 584 }, { 0, 7173, 585 },
+  { 0, 7174, 586 }, { 0, 7175, 587 }, { 8060, 7165, 0 }, { 0, 7176, 588 },
+  { 0, 7177, 589 }, { 0, 7208, 592 }, { 0, 7180, 599 }, { 0, 7182, 59 },
+  { 0, 7183, 609 }, { 8065, 7165, 0 }, { 8062, 7165, 0 }, { 8059, 7184, 0 },
+  { 8101, 7185, 0 }, { 8102, 7217, 0 }, { 0, 7187, 615 }, { 0, 7188, 616 },
+  { 0, 7194, 626 }, { 8103, 7195, 0 }, { 0, 7196, 628 }, { 8066, 7198, 0 },
+  { 0, 7199, 632 }, { 0, 7200, 533 }, { 8065, 7201, 0 }, { 8062, 7202, 0 },
+  { 8067, 7203, 0 }, { 0, 7205, 678 }, { 0, 7207, 680 }, { 0, 7209, 697 },
+  { 0, 7210, 703 }, { 8108, 7213, 0 }, { 8109, 7214, 0 }, { 8069, 7215, 0 },
+  { 0, 7218, 386 }, { 0, 7219, 728 }, { 8065, 7227, 0 }, { 8068, 7229, 0 },
+  { 8068, 7230, 0 }, { 0, 7216, 732 }, { 0, 7221, 735 }, { 8068, 7223, 0 },
+  { 8115, 7224, 0 }, { 0, 7232, 758 }, { 8085, 7234, 0 }, { 8088, 7237, 0 },
+  { 0, 7235, 766 }, { 8087, 7236, 0 }, { 8070, 7238, 0 }, { 0, 7239, 49 },
+  { 8085, 7289, 0 }, { 8086, 7246, 0 }, { 0, 7247, 795 }, { 0, 7248, 796 },
+  { 8122, 7250, 0 }, { 8074, 7251, 0 }, { 8124, 7252, 0 }, { 8081, 7253, 0 },
+  { 8085, 7254, 0 }, { 0, 7255, 385 }, { 0, 7257, 809 }, { 0, 7258, 825 },
+  { 0, 7259, 830 }, { 8083, 7262, 0 }, { 8083, 7267, 0 }, { 0, 7264, 846 },
+  { 8088, 7265, 0 }, { 8103, 7266, 0 }, { 8085, 7268, 0 }, { 0, 7269, 870 },
+  { 0, 7270, 162 }, { 0, 7309, 900 }, { 0, 7272, 910 }, { 8132, 7274, 0 },
+  { 8133, 7275, 0 }, { 8089, 7276, 0 }, { 8135, 7278, 0 }, { 8136, 7280, 0 },
+  { 0, 7281, 933 }, { 0, 7282, 934 }, { 8093, 7283, 0 }, { 8111, 7284, 0 },
+  { 0, 7285, 195 }, { 0, 7286, 183 }, { 0, 7287, 962 }, { 0, 7288, 558 },
+  { 0, 7290, 963 }, { 0, 7291, 964 }, { 0, 7294, 1002 }, { 0, 7300, 1029 },
+  { 8139, 7301, 0 }, { 8099, 7302, 0 }, { 8097, 7303, 0 }, { 8115, 7304, 0 },
+  { 8097, 7305, 0 }, { 0, 7306, 252 }, { 0, 7351, 1037 }, { 8094, 7308, 0 },
+  { 8145, 7311, 0 }, { 8102, 7312, 0 }, { 0, 7315, 791 }, { 8116, 7316, 0 },
+  { 0, 7317, 1052 }, { 8104, 7318, 0 }, { 8110, 7319, 0 }, { 8125, 7320, 0 },
+  { 8115, 7321, 0 }, { 0, 7324, 799 }, { 0, 7326, 1083 }, { 8154, 7328, 0 },
+  { 8115, 7330, 0 }, { 8110, 7331, 0 }, { 0, 7332, 507 }, { 8117, 7333, 0 },
+  { 0, 7335, 1105 }, { 8109, 7336, 0 }, { 8115, 7337, 0 }, { 8121, 7338, 0 },
+  { 0, 7385, 285 }, { 0, 7341, 1124 }, { 8115, 7318, 0 }, { 8163, 7344, 0 },
+  { 8115, 7345, 0 }, { 8119, 7346, 0 }, { 8166, 7347, 0 }, { 0, 7348, 1144 },
+  { 8167, 7356, 0 }, { 8127, 7359, 0 }, { 8169, 7360, 0 }, { 8143, 7361, 0 },
+  { 8171, 7395, 0 }, { 8172, 7397, 0 }, { 8135, 7367, 0 }, { 0, 7376, 1217 },
+  { 0, 7377, 97 }, { 8174, 7379, 0 }, { 0, 7381, 1236 }, { 0, 7386, 1242 },
+  { 8125, 7387, 0 }, { 8145, 7388, 0 }, { 8136, 7389, 0 }, { 0, 7390, 1248 },
+  { 0, 7391, 1249 }, { 0, 7393, 1251 }, { 0, 7394, 1252 }, { 0, 7396, 1253 },
+  { 8138, 7398, 0 }, { 0, 7401, 1268 }, { 8180, 7404, 0 }, { 0, 7409, 394 },
+  { 8132, 7410, 0 }, { 8141, 7411, 0 }, { 8156, 7412, 0 }, { 8138, 7413, 0 },
+  { 8153, 7414, 0 }, { 8156, 7415, 0 }, { 8143, 7416, 0 }, { 8158, 7417, 0 },
+  { 0, 7419, 1314 }, { 0, 7420, 1319 }, { 0, 7422, 1331 }, { 0, 7424, 20 },
+  { 0, 7425, 523 }, { 8153, 7426, 0 }, { 8157, 7429, 0 }, { 0, 7430, 1356 },
+  { 8193, 7431, 0 }, { 0, 7432, 444 }, { 0, 7433, 446 }, { 8154, 7434, 0 },
+  { 0, 7439, 452 }, { 8199, 7440, 0 }, { 8150, 7441, 0 }, { 8170, 7442, 0 },
+  { 8161, 7443, 0 }, { 0, 7444, 1328 }, { 0, 7445, 1330 }, { 0, 7454, 460 },
+  { 8204, 7455, 0 }, { 8205, 7457, 0 }, { 8163, 7434, 0 }, { 0, 7458, 1412 },
+  { 8165, 7459, 0 }, { 0, 7460, 475 }, { 0, 7461, 1415 }, { 0, 7463, 1422 },
+  { 0, 7464, 1425 }, { 0, 7467, 1429 }, { 8179, 7468, 0 }, { 8179, 7474, 0 },
+  { 0, 7469, 1445 }, { 8172, 7471, 0 }, { 8178, 7472, 0 }, { 8172, 7475, 0 },
+  { 0, 7476, 1453 }, { 8178, 7478, 0 }, { 0, 7479, 988 }, { 8186, 7480, 0 },
+  { 8151, 7432, 0 }, { 8152, 7433, 0 }, { 8220, 7481, 0 }, { 0, 7482, 1346 },
+  { 8181, 7483, 0 }, { 8183, 7484, 0 }, { 0, 7485, 1412 }, { 8186, 7486, 0 },
+  { 8190, 7489, 0 }, { 0, 7490, 20 }, { 8226, 7491, 0 }, { 8195, 7492, 0 },
+  { 0, 7493, 43 }, { 0, 7494, 45 }, { 8183, 7495, 0 }, { 8198, 7439, 0 },
+  { 8229, 7496, 0 }, { 8166, 7463, 0 }, { 8185, 7497, 0 }, { 8190, 7498, 0 },
+  { 8228, 7499, 0 }, { 0, 7500, 54 }, { 8203, 7454, 0 }, { 8202, 7501, 0 },
+  { 0, 7502, 58 }, { 8177, 7463, 0 }, { 8205, 7503, 0 }, { 8197, 7505, 0 },
+  { 8209, 7506, 0 }, { 8196, 7508, 0 }, { 8209, 7463, 0 }, { 8175, 7463, 0 },
+  { 0, 7509, 84 }, { 8237, 7512, 0 }, { 8238, 7510, 0 }, { 8228, 7511, 0 },
+  { 8195, 7513, 0 }, { 8199, 7514, 0 }, { 8195, 7517, 0 }, { 8213, 7515, 0 },
+  { 0, 7516, 98 }, { 0, 7518, 101 }, { 8222, 7516, 0 }, { 8218, 7519, 0 },
+  { 8221, 7521, 0 }, { 8224, 7523, 0 }, { 8223, 7520, 0 }, { 8216, 7522, 0 },
+  { 8224, 7520, 0 }, { 0, 7524, 87 }, { 8240, 7525, 0 }, { 8221, 7526, 0 },
+  { 8261, 7527, 0 }, { 8223, 7528, 0 }, { 8225, 7529, 0 }, { 8226, 7530, 0 },
+  { 8246, 7531, 0 }, { 8266, 7532, 0 }, { 8240, 7533, 0 }, { 8230, 7534, 0 },
+  { 8242, 7535, 0 }, { 8208, 7516, 0 }, { 8225, 7536, 0 }, { 8231, 7537, 0 },
+  { 8242, 7538, 0 }, { 8244, 7539, 0 }, { 8262, 7540, 0 }, { 8236, 7541, 0 },
+  { 0, 7542, 175 }, { 8276, 7543, 0 }, { 8236, 7545, 0 }, { 8237, 7546, 0 },
+  { 8280, 7547, 0 }, { 8237, 7548, 0 }, { 0, 7549, 225 }, { 8251, 7550, 0 },
+  { 8255, 7549, 0 }, { 8283, 7551, 0 }, { 8255, 7552, 0 }, { 8258, 7554, 0 },
+  { 0, 7553, 233 }, { 8244, 7555, 0 }, { 8249, 7556, 0 }, { 8245, 7557, 0 },
+  { 8254, 7558, 0 }, { 8271, 7559, 0 }, { 8263, 7560, 0 }, { 8254, 7561, 0 },
+  { 8244, 7546, 0 }, { 8296, 7562, 0 }, { 0, 7563, 88 }, { 8253, 7564, 0 },
+  { 8248, 7549, 0 }, { 8255, 7565, 0 }, { 8253, 7566, 0 }, { 8257, 7567, 0 },
+  { 8259, 7569, 0 }, { 0, 7570, 253 }, { 8303, 7571, 0 }, { 8260, 7572, 0 },
+  { 8272, 7589, 0 }, { 8262, 7573, 0 }, { 8258, 7555, 0 }, { 8263, 7574, 0 },
+  { 8275, 7591, 0 }, { 8265, 7575, 0 }, { 8266, 7576, 0 }, { 8310, 7577, 0 },
+  { 8281, 7578, 0 }, { 0, 7579, 270 }, { 0, 7580, 272 }, { 8283, 7581, 0 },
+  { 8279, 7588, 0 }, { 8271, 7590, 0 }, { 8270, 7582, 0 }, { 8305, 7583, 0 },
+  { 8285, 7584, 0 }, { 8279, 7585, 0 }, { 0, 7586, 288 }, { 8289, 7587, 0 },
+  { 8321, 7592, 0 }, { 8284, 7613, 0 }, { 0, 7594, 293 }, { 8323, 7595, 0 },
+  { 8284, 7596, 0 }, { 8298, 7597, 0 }, { 8299, 7598, 0 }, { 8300, 7599, 0 },
+  { 8304, 7600, 0 }, { 8287, 7601, 0 }, { 8293, 7602, 0 }, { 8304, 7603, 0 },
+  { 8292, 7604, 0 }, { 8293, 7605, 0 }, { 8334, 7606, 0 }, { 8305, 7607, 0 },
+  { 8294, 7608, 0 }, { 8306, 7604, 0 }, { 0, 7609, 325 }, { 8300, 7610, 0 },
+  { 8300, 7611, 0 }, { 8300, 7617, 0 }, { 8310, 7618, 0 }, { 8301, 7609, 0 },
+  { 8311, 7632, 0 }, { 8312, 7614, 0 }, { 8310, 7615, 0 }, { 0, 7616, 361 },
+  { 8307, 7622, 0 }, { 8320, 7619, 0 }, { 0, 7621, 369 }, { 8328, 7623, 0 },
+  { 8309, 7629, 0 }, { 8330, 7643, 0 }, { 8320, 7644, 0 }, { 8359, 7625, 0 },
+  { 8321, 7626, 0 }, { 8326, 7631, 0 }, { 8319, 7627, 0 }, { 8305, 7615, 0 },
+  { 8361, 7628, 0 }, { 8364, 7630, 0 }, { 8325, 7633, 0 }, { 8336, 7634, 0 },
+  { 8337, 7635, 0 }, { 8370, 7636, 0 }, { 8338, 7635, 0 }, { 8327, 7638, 0 },
+  { 8343, 7659, 0 }, { 8340, 7639, 0 }, { 8334, 7640, 0 }, { 8353, 7641, 0 },
+  { 8331, 7642, 0 }, { 8334, 7645, 0 }, { 8379, 7646, 0 }, { 8349, 7647, 0 },
+  { 8332, 7648, 0 }, { 8352, 7649, 0 }, { 8339, 7650, 0 }, { 8340, 7651, 0 },
+  { 8384, 7652, 0 }, { 8346, 7653, 0 }, { 8357, 7654, 0 }, { 8345, 7655, 0 },
+  { 8359, 7656, 0 }, { 8347, 7670, 0 }, { 8352, 7657, 0 }, { 8355, 7658, 0 },
+  { 8347, 7665, 0 }, { 8368, 7679, 0 }, { 8358, 7680, 0 }, { 8350, 7667, 0 },
+  { 0, 7663, 471 }, { 8398, 7664, 0 }, { 0, 7666, 474 }, { 8399, 7668, 0 },
+  { 8357, 7669, 0 }, { 8401, 7671, 0 }, { 0, 7672, 480 }, { 8402, 7675, 0 },
+  { 8358, 7676, 0 }, { 0, 7677, 499 }, { 8405, 7678, 0 }, { 8366, 7681, 0 },
+  { 8358, 7682, 0 }, { 8372, 7675, 0 }, { 8373, 7683, 0 }, { 8409, 7684, 0 },
+  { 8361, 7685, 0 }, { 8367, 7686, 0 }, { 8411, 7687, 0 }, { 8369, 7688, 0 },
+  { 8374, 7698, 0 }, { 8373, 7705, 0 }, { 8378, 7706, 0 }, { 8390, 7689, 0 },
+  { 8376, 7690, 0 }, { 8379, 7707, 0 }, { 0, 7708, 611 }, { 0, 7709, 613 },
+  { 0, 7713, 627 }, { 8389, 7715, 0 }, { 8388, 7718, 0 }, { 8391, 7719, 0 },
+  { 8390, 7720, 0 }, { 0, 7725, 43 }, { 0, 7726, 720 }, { 8375, 7727, 0 },
+  { 8425, 7730, 0 }, { 8397, 7731, 0 }, { 8393, 7732, 0 }, { 8428, 7735, 0 },
+  { 0, 7736, 57 }, { 8400, 7738, 0 }, { 8401, 7739, 0 }, { 8431, 7741, 0 },
+  { 8394, 7742, 0 }, { 8387, 7744, 0 }, { 8395, 7745, 0 }, { 0, 7748, 798 },
+  { 8404, 7749, 0 }, { 0, 7750, 98 }, { 8392, 7751, 0 }, { 8397, 7752, 0 },
+  { 8439, 7757, 0 }, { 8395, 7758, 0 }, { 8401, 7760, 0 }, { 8404, 7761, 0 },
+  { 8398, 7762, 0 }, { 0, 7767, 892 }, { 0, 7768, 158 }, { 8444, 7769, 0 },
+  { 0, 7770, 923 }, { 0, 7771, 929 }, { 8401, 7774, 0 }, { 8402, 7775, 0 },
+  { 0, 7784, 225 }, { 8408, 7785, 0 }, { 8405, 7786, 0 }, { 8406, 7787, 0 },
+  { 8418, 7788, 0 }, { 8454, 7791, 0 }, { 0, 7792, 248 }, { 8455, 7793, 0 },
+  { 8456, 7795, 0 }, { 8413, 7797, 0 }, { 8424, 7787, 0 }, { 8425, 7814, 0 },
+  { 8459, 7798, 0 }, { 8416, 7799, 0 }, { 8430, 7800, 0 }, { 0, 7803, 1085 },
+  { 8463, 7804, 0 }, { 8464, 7805, 0 }, { 8432, 7807, 0 }, { 8466, 7809, 0 },
+  { 8427, 7800, 0 }, { 8409, 7787, 0 }, { 8440, 7810, 0 }, { 8419, 7811, 0 },
+  { 0, 7815, 299 }, { 8469, 7816, 0 }, { 8443, 7817, 0 }, { 0, 7818, 310 },
+  { 0, 7820, 289 }, { 8422, 7821, 0 }, { 0, 7822, 337 }, { 8434, 7823, 0 },
+  { 0, 7824, 326 }, { 0, 7825, 332 }, { 8444, 7826, 0 }, { 0, 7829, 868 },
+  { 8477, 7832, 0 }, { 8435, 7833, 0 }, { 8429, 7834, 0 }, { 8435, 7840, 0 },
+  { 8441, 7826, 0 }, { 0, 7842, 383 }, { 8481, 7844, 0 }, { 8441, 7845, 0 },
+  { 8439, 7846, 0 }, { 8458, 7847, 0 }, { 8420, 7784, 0 }, { 8459, 7848, 0 },
+  { 8441, 7849, 0 }, { 8457, 7850, 0 }, { 8489, 7851, 0 }, { 8457, 7846, 0 },
+  { 8452, 7857, 0 }, { 8451, 7858, 0 }, { 0, 7860, 1366 }, { 8492, 7892, 0 },
+  { 8493, 7893, 0 }, { 8449, 7863, 0 }, { 8460, 7874, 0 }, { 0, 7907, 1372 },
+  { 0, 7865, 1377 }, { 8497, 7866, 0 }, { 8455, 7867, 0 }, { 8449, 7868, 0 },
+  { 0, 7914, 1387 }, { 0, 7872, 1396 }, { 0, 7873, 471 }, { 8451, 7876, 0 },
+  { 8453, 7909, 0 }, { 8471, 7917, 0 }, { 0, 7922, 1423 }, { 8471, 7923, 0 },
+  { 8459, 7882, 0 }, { 8472, 7883, 0 }, { 8458, 7885, 0 }, { 8473, 7824, 0 },
+  { 8474, 7825, 0 }, { 8477, 7886, 0 }, { 8510, 7887, 0 }, { 8511, 7889, 0 },
+  { 8512, 7891, 0 }, { 0, 7894, 378 }, { 8482, 7896, 0 }, { 8474, 7886, 0 },
+  { 8483, 7897, 0 }, { 8484, 7899, 0 }, { 8475, 7900, 0 }, { 0, 7902, 25 },
+  { 8486, 7903, 0 }, { 8518, 7906, 0 }, { 0, 7908, 47 }, { 8519, 7910, 0 },
+  { 8480, 7911, 0 }, { 8480, 7912, 0 }, { 8490, 7915, 0 }, { 8487, 7918, 0 },
+  { 8524, 7919, 0 }, { 8488, 7920, 0 }, { 8482, 7921, 0 }, { 8486, 7925, 0 },
+  { 8488, 7926, 0 }, { 8504, 7927, 0 }, { 8536, 7928, 0 }, { 8496, 7865, 0 },
+  { 8497, 7929, 0 }, { 8499, 7930, 0 }, { 8475, 7912, 0 }, { 8501, 7927, 0 },
+  { 8500, 7872, 0 }, { 8511, 7931, 0 }, { 8497, 7934, 0 }, { 8541, 7953, 0 },
+  { 8509, 7935, 0 }, { 8523, 7936, 0 }, { 8500, 7937, 0 }, { 8516, 7938, 0 },
+  { 8519, 7940, 0 }, { 8498, 7926, 0 }, { 8500, 7939, 0 }, { 8503, 7926, 0 },
+  { 8507, 7942, 0 }, { 8524, 7943, 0 }, { 0, 7944, 130 }, { 8552, 7945, 0 },
+  { 8548, 7946, 0 }, { 8535, 7947, 0 }, { 8516, 7948, 0 }, { 0, 7949, 144 },
+  { 8519, 7950, 0 }, { 8553, 7951, 0 }, { 8513, 7952, 0 }, { 8560, 7954, 0 },
+  { 8515, 7955, 0 }, { 8531, 7956, 0 }, { 8532, 7957, 0 }, { 8529, 7958, 0 },
+  { 8523, 7959, 0 }, { 0, 7961, 186 }, { 8526, 7962, 0 }, { 8528, 7963, 0 },
+  { 8529, 7980, 0 }, { 0, 7964, 219 }, { 8542, 7965, 0 }, { 8526, 7968, 0 },
+  { 8538, 7984, 0 }, { 8572, 7967, 0 }, { 8529, 7969, 0 }, { 8552, 7970, 0 },
+  { 8529, 7971, 0 }, { 8532, 7973, 0 }, { 8548, 7994, 0 }, { 8529, 7974, 0 },
+  { 8538, 7975, 0 }, { 8549, 7976, 0 }, { 8550, 7977, 0 }, { 8553, 7978, 0 },
+  { 8539, 7979, 0 }, { 0, 7981, 246 }, { 8541, 7983, 0 }, { 8557, 7981, 0 },
+  { 8555, 7985, 0 }, { 8560, 7986, 0 }, { 8588, 7987, 0 }, { 8542, 7988, 0 },
+  { 0, 7990, 256 }, { 8549, 7991, 0 }, { 8557, 7992, 0 }, { 8548, 7993, 0 },
+  { 8552, 7995, 0 }, { 8560, 7996, 0 }, { 8551, 7997, 0 }, { 8552, 7998, 0 },
+  { 8553, 7999, 0 }, { 8598, 8000, 0 }, { 8564, 8003, 0 }, { 8571, 8004, 0 },
+  { 8550, 8005, 0 }, { 8571, 8006, 0 }, { 8572, 8007, 0 }, { 8585, 8008, 0 },
+  { 8559, 8009, 0 }, { 8562, 8011, 0 }, { 0, 8012, 290 }, { 8577, 8013, 0 },
+  { 0, 8015, 294 }, { 8607, 8016, 0 }, { 8578, 8017, 0 }, { 8577, 8018, 0 },
+  { 8580, 8019, 0 }, { 8565, 8015, 0 }, { 8562, 8015, 0 }, { 8566, 8015, 0 },
+  { 8573, 8020, 0 }, { 8620, 8021, 0 }, { 8575, 8022, 0 }, { 8591, 8023, 0 },
+  { 8581, 8015, 0 }, { 8592, 8024, 0 }, { 8579, 8029, 0 }, { 8625, 8025, 0 },
+  { 8588, 8026, 0 }, { 8600, 8027, 0 }, { 8600, 8028, 0 }, { 8575, 8015, 0 },
+  { 8579, 8015, 0 }, { 8582, 8035, 0 }, { 8631, 8031, 0 }, { 8632, 8032, 0 },
+  { 8606, 8033, 0 }, { 8596, 8034, 0 }, { 8605, 8036, 0 }, { 8636, 8037, 0 },
+  { 8592, 8038, 0 }, { 8599, 8051, 0 }, { 8641, 8040, 0 }, { 8612, 8041, 0 },
+  { 8605, 8043, 0 }, { 8619, 8044, 0 }, { 8607, 8045, 0 }, { 8618, 8046, 0 },
+  { 0, 8047, 52 }, { 8621, 8048, 0 }, { 8615, 8049, 0 }, { 8607, 8050, 0 },
+  { 8611, 8052, 0 }, { 0, 8053, 400 }, { 8625, 8054, 0 }, { 8629, 8053, 0 },
+  { 8657, 8055, 0 }, { 8629, 8056, 0 }, { 8632, 8058, 0 }, { 0, 8057, 408 },
+  { 8621, 8059, 0 }, { 8617, 8060, 0 }, { 8626, 8061, 0 }, { 8643, 8062, 0 },
+  { 8635, 8063, 0 }, { 8626, 8053, 0 }, { 8626, 8064, 0 }, { 8668, 8065, 0 },
+  { 0, 8066, 93 }, { 8624, 8067, 0 }, { 8671, 8068, 0 }, { 8672, 8069, 0 },
+  { 8629, 8070, 0 }, { 8630, 8071, 0 }, { 8631, 8072, 0 }, { 8611, 8047, 0 },
+  { 8627, 8073, 0 }, { 8677, 8074, 0 }, { 8633, 8075, 0 }, { 8633, 8076, 0 },
+  { 8635, 8077, 0 }, { 8681, 8078, 0 }, { 8682, 8079, 0 }, { 8656, 8080, 0 },
+  { 8644, 8081, 0 }, { 8655, 8082, 0 }, { 8659, 8083, 0 }, { 0, 8085, 473 },
+  { 0, 8087, 476 }, { 8640, 8088, 0 }, { 0, 8089, 478 }, { 0, 8091, 495 },
+  { 8642, 8097, 0 }, { 8655, 8092, 0 }, { 0, 8094, 502 }, { 8689, 8095, 0 },
+  { 8691, 8096, 0 }, { 8645, 8098, 0 }, { 0, 8099, 507 }, { 8693, 8100, 0 },
+  { 8650, 8101, 0 }, { 8651, 8102, 0 }, { 8696, 8103, 0 }, { 8666, 8104, 0 },
+  { 8671, 8105, 0 }, { 8669, 8106, 0 }, { 8671, 8107, 0 }, { 8674, 8108, 0 },
+  { 8702, 8109, 0 }, { 8673, 8113, 0 }, { 8673, 8114, 0 }, { 8705, 8115, 0 },
+  { 8668, 8116, 0 }, { 8669, 8119, 0 }, { 0, 8120, 729 }, { 8708, 8121, 0 },
+  { 8709, 8122, 0 }, { 0, 8123, 739 }, { 8710, 8125, 0 }, { 8711, 8126, 0 },
+  { 0, 8127, 767 }, { 8681, 8128, 0 }, { 8715, 8129, 0 }, { 8685, 8130, 0 },
+  { 8687, 8132, 0 }, { 8677, 8134, 0 }, { 8681, 8135, 0 }, { 8679, 8128, 0 },
+  { 0, 8136, 822 }, { 8721, 8137, 0 }, { 8722, 8138, 0 }, { 8692, 8139, 0 },
+  { 8693, 8140, 0 }, { 0, 8143, 889 }, { 8685, 8146, 0 }, { 8683, 8147, 0 },
+  { 8693, 8194, 0 }, { 8699, 8149, 0 }, { 8689, 8150, 0 }, { 8687, 8151, 0 },
+  { 8688, 8158, 0 }, { 8686, 8169, 0 }, { 8695, 8152, 0 }, { 0, 8153, 1005 },
+  { 0, 8155, 999 }, { 0, 8156, 1050 }, { 8694, 8157, 0 }, { 8702, 8159, 0 },
+  { 0, 8160, 1057 }, { 8693, 8161, 0 }, { 8706, 8162, 0 }, { 8706, 8168, 0 },
+  { 0, 8164, 110 }, { 0, 8165, 237 }, { 8702, 8166, 0 }, { 0, 8167, 1108 },
+  { 8697, 8170, 0 }, { 8742, 8171, 0 }, { 0, 8173, 1139 }, { 8699, 8174, 0 },
+  { 8744, 8177, 0 }, { 8707, 8179, 0 }, { 0, 8223, 1157 }, { 0, 8224, 1159 },
+  { 8715, 8182, 0 }, { 8715, 8188, 0 }, { 0, 8184, 1246 }, { 8749, 8185, 0 },
+  { 8750, 8186, 0 }, { 8751, 8187, 0 }, { 0, 8190, 400 }, { 8713, 8191, 0 },
+  { 8710, 8192, 0 }, { 8711, 8199, 0 }, { 8712, 8193, 0 }, { 8713, 8195, 0 },
+  { 8723, 8196, 0 }, { 8716, 8197, 0 }, { 0, 8198, 1304 }, { 8729, 8200, 0 },
+  { 8714, 8201, 0 }, { 0, 8203, 445 }, { 0, 8204, 447 }, { 8727, 8205, 0 },
+  { 8763, 8206, 0 }, { 0, 8251, 1376 }, { 0, 8209, 1324 }, { 8764, 8210, 0 },
+  { 8765, 8211, 0 }, { 0, 8256, 1395 }, { 8766, 8215, 0 }, { 8727, 8216, 0 },
+  { 8722, 8217, 0 }, { 8735, 8219, 0 }, { 8743, 8220, 0 }, { 8725, 8221, 0 },
+  { 8772, 8222, 0 }, { 8741, 8225, 0 }, { 8741, 8231, 0 }, { 0, 8226, 1452 },
+  { 0, 8227, 842 }, { 0, 8228, 830 }, { 8732, 8230, 0 }, { 8733, 8232, 0 },
+  { 8739, 8233, 0 }, { 8738, 8234, 0 }, { 8735, 8236, 0 }, { 0, 8237, 46 },
+  { 0, 8239, 48 }, { 8734, 8240, 0 }, { 8734, 8241, 0 }, { 8741, 8254, 0 },
+  { 8740, 8242, 0 }, { 8736, 8243, 0 }, { 8757, 8244, 0 }, { 8786, 8245, 0 },
+  { 8725, 8190, 0 }, { 8746, 8244, 0 }, { 8747, 8246, 0 }, { 8748, 8247, 0 },
+  { 8744, 8244, 0 }, { 8749, 8248, 0 }, { 8761, 8265, 0 }, { 8764, 8267, 0 },
+  { 8764, 8249, 0 }, { 8764, 8255, 0 }, { 8754, 8250, 0 }, { 8751, 8252, 0 },
+  { 8800, 8253, 0 }, { 8775, 8257, 0 }, { 8803, 8258, 0 }, { 8760, 8259, 0 },
+  { 8759, 8260, 0 }, { 8754, 8244, 0 }, { 8775, 8261, 0 }, { 8766, 8262, 0 },
+  { 8786, 8263, 0 }, { 8763, 8264, 0 }, { 8810, 8266, 0 }, { 8764, 8268, 0 },
+  { 8774, 8269, 0 }, { 0, 8271, 131 }, { 8813, 8272, 0 }, { 8771, 8273, 0 },
+  { 8788, 8274, 0 }, { 8768, 8250, 0 }, { 8816, 8276, 0 }, { 8774, 8277, 0 },
+  { 8787, 8278, 0 }, { 0, 8279, 161 }, { 8814, 8280, 0 }, { 8820, 8281, 0 },
+  { 8821, 8282, 0 }, { 8782, 8283, 0 }, { 8823, 8284, 0 }, { 8824, 8286, 0 },
+  { 8786, 8287, 0 }, { 8795, 8288, 0 }, { 8798, 8290, 0 }, { 8829, 8291, 0 },
+  { 8796, 8292, 0 }, { 0, 8293, 228 }, { 8804, 8294, 0 }, { 8801, 8295, 0 },
+  { 8792, 8296, 0 }, { 8793, 8297, 0 }, { 8789, 8298, 0 }, { 8836, 8299, 0 },
+  { 8793, 8300, 0 }, { 8838, 8301, 0 }, { 8810, 8302, 0 }, { 8795, 8303, 0 },
+  { 8842, 8304, 0 }, { 8801, 8307, 0 }, { 8805, 8306, 0 }, { 8820, 8308, 0 },
+  { 8810, 8309, 0 }, { 0, 8310, 250 }, { 8822, 8311, 0 }, { 8801, 8313, 0 },
+  { 8805, 8314, 0 }, { 8811, 8315, 0 }, { 8804, 8316, 0 }, { 8808, 8317, 0 },
+  { 8814, 8318, 0 }, { 8815, 8319, 0 }, { 8813, 8320, 0 }, { 0, 8321, 269 },
+  { 8811, 8322, 0 }, { 8822, 8323, 0 }, { 8841, 8324, 0 }, { 8818, 8325, 0 },
+  { 8818, 8326, 0 }, { 8822, 8327, 0 }, { 8865, 8328, 0 }, { 8820, 8329, 0 },
+  { 8836, 8331, 0 }, { 8821, 8337, 0 }, { 8831, 8338, 0 }, { 8839, 8339, 0 },
+  { 8841, 8323, 0 }, { 8826, 8344, 0 }, { 8845, 8351, 0 }, { 8835, 8352, 0 },
+  { 8827, 8333, 0 }, { 8875, 8334, 0 }, { 8843, 8335, 0 }, { 8877, 8336, 0 },
+  { 8847, 8340, 0 }, { 0, 8341, 309 }, { 8874, 8342, 0 }, { 8880, 8343, 0 },
+  { 8854, 8345, 0 }, { 8837, 8346, 0 }, { 0, 8347, 314 }, { 8854, 8348, 0 },
+  { 8846, 8349, 0 }, { 8842, 8350, 0 }, { 8862, 8353, 0 }, { 8840, 8347, 0 },
+  { 0, 8354, 327 }, { 0, 8355, 331 }, { 8856, 8356, 0 }, { 8890, 8357, 0 },
+  { 8865, 8358, 0 }, { 8847, 8354, 0 }, { 8850, 8355, 0 }, { 8870, 8359, 0 },
+  { 8870, 8360, 0 }, { 8853, 8361, 0 }, { 0, 8362, 362 }, { 8857, 8350, 0 },
+  { 8855, 8363, 0 }, { 8846, 8347, 0 }, { 8870, 8364, 0 }, { 8864, 8365, 0 },
+  { 8857, 8366, 0 }, { 8873, 8367, 0 }, { 8905, 8395, 0 }, { 8853, 8354, 0 },
+  { 8857, 8354, 0 }, { 8866, 8369, 0 }, { 8872, 8370, 0 }, { 8873, 8371, 0 },
+  { 8882, 8372, 0 }, { 8866, 8375, 0 }, { 8879, 8385, 0 }, { 8912, 8374, 0 },
+  { 8869, 8376, 0 }, { 8892, 8377, 0 }, { 8869, 8378, 0 }, { 8867, 8380, 0 },
+  { 8876, 8381, 0 }, { 8887, 8382, 0 }, { 8888, 8383, 0 }, { 8891, 8384, 0 },
+  { 8877, 8386, 0 }, { 0, 8387, 419 }, { 8923, 8389, 0 }, { 8895, 8387, 0 },
+  { 0, 8390, 423 }, { 0, 8391, 426 }, { 8883, 8392, 0 }, { 8884, 8393, 0 },
+  { 8882, 8394, 0 }, { 8927, 8396, 0 }, { 0, 8397, 439 }, { 8897, 8398, 0 },
+  { 8929, 8399, 0 }, { 8899, 8400, 0 }, { 0, 8401, 448 }, { 0, 8402, 452 },
+  { 8893, 8403, 0 }, { 8886, 8404, 0 }, { 8902, 8405, 0 }, { 8897, 8406, 0 },
+  { 8909, 8409, 0 }, { 8937, 8412, 0 }, { 8907, 8413, 0 }, { 8895, 8415, 0 },
+  { 0, 8416, 504 }, { 8901, 8417, 0 }, { 0, 8419, 96 }, { 8900, 8420, 0 },
+  { 8898, 8421, 0 }, { 0, 8422, 523 }, { 8943, 8423, 0 }, { 8900, 8424, 0 },
+  { 8914, 8425, 0 }, { 8915, 8426, 0 }, { 8918, 8427, 0 }, { 0, 8428, 610 },
+  { 8907, 8429, 0 }, { 8950, 8430, 0 }, { 0, 8431, 141 }, { 8920, 8432, 0 },
+  { 8921, 8433, 0 }, { 0, 8435, 730 }, { 0, 8436, 731 }, { 0, 8438, 753 },
+  { 0, 8439, 754 }, { 8922, 8441, 0 }, { 8918, 8433, 0 }, { 8922, 8447, 0 },
+  { 0, 8442, 785 }, { 8911, 8443, 0 }, { 8924, 8444, 0 }, { 8909, 8445, 0 },
+  { 8928, 8446, 0 }, { 8907, 8429, 0 }, { 0, 8449, 827 }, { 0, 8450, 132 },
+  { 8961, 8451, 0 }, { 8919, 8452, 0 }, { 8925, 8446, 0 }, { 8914, 8454, 0 },
+  { 8923, 8455, 0 }, { 8927, 8456, 0 }, { 8925, 8457, 0 }, { 8919, 8458, 0 },
+  { 8928, 8459, 0 }, { 8928, 8460, 0 }, { 8936, 8461, 0 }, { 8941, 8462, 0 },
+  { 8924, 8466, 0 }, { 8928, 8467, 0 }, { 8934, 8469, 0 }, { 8930, 8470, 0 },
+  { 8943, 8471, 0 }, { 8947, 8474, 0 }, { 8935, 8476, 0 }, { 0, 8477, 1112 },
+  { 8936, 8479, 0 }, { 0, 8480, 1152 }, { 8950, 8481, 0 }, { 8925, 8457, 0 },
+  { 8936, 8484, 0 }, { 8949, 8485, 0 }, { 0, 8487, 374 }, { 0, 8488, 1247 },
+  { 0, 8489, 172 }, { 8949, 8536, 0 }, { 8955, 8491, 0 }, { 8945, 8492, 0 },
+  { 8945, 8493, 0 }, { 8944, 8494, 0 }, { 8945, 8495, 0 }, { 8951, 8496, 0 },
+  { 8991, 8497, 0 }, { 8954, 8499, 0 }, { 8948, 8500, 0 }, { 8956, 8503, 0 },
+  { 0, 8504, 1230 }, { 0, 8507, 455 }, { 0, 8508, 1329 }, { 0, 8510, 478 },
+  { 8995, 8511, 0 }, { 8996, 8512, 0 }, { 8951, 8513, 0 }, { 8954, 8514, 0 },
+  { 8972, 8515, 0 }, { 0, 8516, 504 }, { 8954, 8517, 0 }, { 8967, 8518, 0 },
+  { 9003, 8522, 0 }, { 9004, 8523, 0 }, { 8974, 8524, 0 }, { 9007, 8525, 0 },
+  { 8977, 8526, 0 }, { 8968, 8529, 0 }, { 8982, 8530, 0 }, { 8965, 8531, 0 },
+  { 8971, 8524, 0 }, { 8985, 8532, 0 }, { 8978, 8533, 0 }, { 8967, 8534, 0 },
+  { 8969, 8537, 0 }, { 8990, 8540, 0 }, { 8980, 8553, 0 }, { 9019, 8535, 0 },
+  { 9011, 8538, 0 }, { 8980, 8539, 0 }, { 8981, 8541, 0 }, { 8989, 8542, 0 },
+  { 9024, 8543, 0 }, { 8979, 8544, 0 }, { 8992, 8545, 0 }, { 8984, 8546, 0 },
+  { 8998, 8565, 0 }, { 9030, 8547, 0 }, { 8987, 8548, 0 }, { 8994, 8549, 0 },
+  { 0, 8550, 99 }, { 8989, 8551, 0 }, { 9012, 8552, 0 }, { 9006, 8554, 0 },
+  { 8992, 8555, 0 }, { 9006, 8556, 0 }, { 8997, 8557, 0 }, { 0, 8558, 110 },
+  { 9012, 8559, 0 }, { 9002, 8560, 0 }, { 0, 8562, 137 }, { 8994, 8563, 0 },
+  { 9004, 8564, 0 }, { 0, 8566, 157 }, { 8997, 8567, 0 }, { 9001, 8568, 0 },
+  { 9005, 8570, 0 }, { 0, 8571, 163 }, { 0, 8572, 171 }, { 9018, 8573, 0 },
+  { 0, 8574, 30 }, { 0, 8575, 189 }, { 9023, 8576, 0 }, { 9006, 8577, 0 },
+  { 9015, 8578, 0 }, { 9012, 8566, 0 }, { 0, 8579, 226 }, { 9007, 8580, 0 },
+  { 9025, 8582, 0 }, { 9026, 8583, 0 }, { 9012, 8584, 0 }, { 9008, 8585, 0 },
+  { 9017, 8586, 0 }, { 0, 8587, 237 }, { 9059, 8588, 0 }, { 0, 8589, 239 },
+  { 9016, 8590, 0 }, { 9033, 8589, 0 }, { 9022, 8591, 0 }, { 0, 8592, 244 },
+  { 9018, 8589, 0 }, { 9037, 8592, 0 }, { 9065, 8593, 0 }, { 9017, 8594, 0 },
+  { 9021, 8595, 0 }, { 9068, 8596, 0 }, { 9031, 8598, 0 }, { 9070, 8599, 0 },
+  { 9070, 8600, 0 }, { 9023, 8601, 0 }, { 9073, 8602, 0 }, { 9047, 8603, 0 },
+  { 9026, 8604, 0 }, { 9027, 8605, 0 }, { 9036, 8606, 0 }, { 9039, 8608, 0 },
+  { 9060, 8609, 0 }, { 9038, 8620, 0 }, { 9047, 8610, 0 }, { 9075, 8611, 0 },
+  { 9038, 8612, 0 }, { 9057, 8613, 0 }, { 0, 8614, 287 }, { 9050, 8615, 0 },
+  { 9086, 8616, 0 }, { 9060, 8617, 0 }, { 9050, 8618, 0 }, { 9062, 8619, 0 },
+  { 9045, 8621, 0 }, { 9051, 8622, 0 }, { 9062, 8623, 0 }, { 9054, 8624, 0 },
+  { 0, 8625, 302 }, { 9056, 8626, 0 }, { 0, 8627, 307 }, { 9051, 8628, 0 },
+  { 9053, 8630, 0 }, { 0, 8631, 311 }, { 9051, 8632, 0 }, { 9086, 8633, 0 },
+  { 9052, 8639, 0 }, { 9073, 8653, 0 }, { 9062, 8635, 0 }, { 9069, 8636, 0 },
+  { 9072, 8637, 0 }, { 9060, 8651, 0 }, { 9067, 8638, 0 }, { 9059, 8645, 0 },
+  { 9080, 8659, 0 }, { 9070, 8660, 0 }, { 9062, 8646, 0 }, { 9110, 8642, 0 },
+  { 9068, 8643, 0 }, { 9112, 8644, 0 }, { 9069, 8647, 0 }, { 9076, 8648, 0 },
+  { 9084, 8649, 0 }, { 9081, 8652, 0 }, { 9117, 8654, 0 }, { 9118, 8655, 0 },
+  { 9114, 8656, 0 }, { 9120, 8657, 0 }, { 0, 8658, 378 }, { 9075, 8661, 0 },
+  { 9094, 8662, 0 }, { 9085, 8663, 0 }, { 9095, 8664, 0 }, { 9125, 8665, 0 },
+  { 9080, 8666, 0 }, { 0, 8667, 403 }, { 9100, 8668, 0 }, { 9097, 8669, 0 },
+  { 9088, 8670, 0 }, { 9130, 8671, 0 }, { 9087, 8672, 0 }, { 9132, 8673, 0 },
+  { 9104, 8674, 0 }, { 9089, 8675, 0 }, { 9136, 8676, 0 }, { 9095, 8679, 0 },
+  { 0, 8678, 422 }, { 9091, 8682, 0 }, { 9092, 8683, 0 }, { 9101, 8684, 0 },
+  { 0, 8685, 437 }, { 9114, 8687, 0 }, { 0, 8688, 444 }, { 9099, 8689, 0 },
+  { 9146, 8692, 0 }, { 9142, 8693, 0 }, { 9148, 8694, 0 }, { 9101, 8688, 0 },
+  { 9149, 8695, 0 }, { 9112, 8696, 0 }, { 0, 8697, 496 }, { 9106, 8698, 0 },
+  { 9108, 8699, 0 }, { 9153, 8701, 0 }, { 9105, 8703, 0 }, { 9114, 8704, 0 },
+  { 0, 8706, 524 }, { 9129, 8707, 0 }, { 9157, 8708, 0 }, { 9158, 8709, 0 },
+  { 9128, 8710, 0 }, { 9111, 8712, 0 }, { 9161, 8729, 0 }, { 0, 8713, 634 },
+  { 9162, 8715, 0 }, { 9131, 8716, 0 }, { 9131, 8722, 0 }, { 9119, 8721, 0 },
+  { 9132, 8723, 0 }, { 9167, 8725, 0 }, { 9137, 8726, 0 }, { 9124, 8727, 0 },
+  { 9138, 8728, 0 }, { 9138, 8734, 0 }, { 0, 8732, 137 }, { 9172, 8733, 0 },
+  { 9173, 8735, 0 }, { 9125, 8736, 0 }, { 9175, 8737, 0 }, { 9127, 8738, 0 },
+  { 9177, 8755, 0 }, { 9133, 8739, 0 }, { 9130, 8740, 0 }, { 9139, 8741, 0 },
+  { 9148, 8742, 0 }, { 9137, 8743, 0 }, { 9183, 8744, 0 }, { 9157, 8745, 0 },
+  { 9136, 8746, 0 }, { 9186, 8747, 0 }, { 9141, 8748, 0 }, { 9188, 8749, 0 },
+  { 9148, 8750, 0 }, { 9149, 8752, 0 }, { 9153, 8754, 0 }, { 9193, 8756, 0 },
+  { 9148, 8757, 0 }, { 9157, 8761, 0 }, { 9155, 8762, 0 }, { 9149, 8763, 0 },
+  { 9158, 8764, 0 }, { 9160, 8765, 0 }, { 9161, 8766, 0 }, { 9172, 8767, 0 },
+  { 0, 8768, 847 }, { 9204, 8769, 0 }, { 9205, 8770, 0 }, { 9166, 8771, 0 },
+  { 0, 8776, 806 }, { 0, 8777, 1082 }, { 9209, 8778, 0 }, { 9166, 8779, 0 },
+  { 9167, 8780, 0 }, { 9212, 8782, 0 }, { 9167, 8783, 0 }, { 9155, 8762, 0 },
+  { 0, 8784, 1465 }, { 0, 8785, 1467 }, { 9184, 8786, 0 }, { 9184, 8792, 0 },
+  { 0, 8787, 14 }, { 9178, 8788, 0 }, { 9172, 8789, 0 }, { 9182, 8790, 0 },
+  { 9190, 8791, 0 }, { 9184, 8793, 0 }, { 9178, 8794, 0 }, { 9179, 8795, 0 },
+  { 9226, 8796, 0 }, { 9199, 8796, 0 }, { 9180, 8797, 0 }, { 9199, 8798, 0 },
+  { 0, 8799, 82 }, { 9190, 8800, 0 }, { 9182, 8801, 0 }, { 9183, 8802, 0 },
+  { 9187, 8803, 0 }, { 0, 8804, 70 }, { 9233, 8805, 0 }, { 9189, 8806, 0 },
+  { 9165, 8777, 0 }, { 9195, 8807, 0 }, { 9237, 8808, 0 }, { 0, 8809, 95 },
+  { 9194, 8810, 0 }, { 9237, 8811, 0 }, { 9200, 8813, 0 }, { 9211, 8814, 0 },
+  { 9197, 8815, 0 }, { 9244, 8816, 0 }, { 9216, 8817, 0 }, { 9203, 8818, 0 },
+  { 9204, 8820, 0 }, { 9230, 8821, 0 }, { 9223, 8823, 0 }, { 9214, 8824, 0 },
+  { 9208, 8837, 0 }, { 9227, 8826, 0 }, { 9255, 8827, 0 }, { 9214, 8784, 0 },
+  { 9215, 8785, 0 }, { 9209, 8828, 0 }, { 9257, 8831, 0 }, { 9258, 8834, 0 },
+  { 9259, 8835, 0 }, { 9229, 8836, 0 }, { 9260, 8839, 0 }, { 9225, 8840, 0 },
+  { 9217, 8841, 0 }, { 9264, 8842, 0 }, { 9265, 8843, 0 }, { 9223, 8844, 0 },
+  { 0, 8846, 238 }, { 9224, 8849, 0 }, { 9222, 8852, 0 }, { 9229, 8848, 0 },
+  { 9227, 8850, 0 }, { 9228, 8853, 0 }, { 0, 8854, 247 }, { 9273, 8855, 0 },
+  { 9243, 8856, 0 }, { 0, 8857, 249 }, { 9275, 8858, 0 }, { 0, 8859, 258 },
+  { 9232, 8860, 0 }, { 9277, 8861, 0 }, { 0, 8862, 90 }, { 9234, 8863, 0 },
+  { 9279, 8864, 0 }, { 9280, 8865, 0 }, { 9232, 8866, 0 }, { 9263, 8867, 0 },
+  { 9241, 8868, 0 }, { 9257, 8869, 0 }, { 9250, 8870, 0 }, { 9242, 8871, 0 },
+  { 9287, 8872, 0 }, { 9259, 8873, 0 }, { 9260, 8875, 0 }, { 0, 8876, 292 },
+  { 9252, 8877, 0 }, { 9286, 8878, 0 }, { 9246, 8879, 0 }, { 9293, 8880, 0 },
+  { 9248, 8881, 0 }, { 9264, 8882, 0 }, { 9254, 8883, 0 }, { 9266, 8885, 0 },
+  { 9298, 8887, 0 }, { 9252, 8888, 0 }, { 9269, 8890, 0 }, { 9270, 8891, 0 },
+  { 9275, 8892, 0 }, { 9263, 8893, 0 }, { 9273, 8894, 0 }, { 9267, 8895, 0 },
+  { 9260, 8896, 0 }, { 9262, 8897, 0 }, { 9308, 8898, 0 }, { 9282, 8899, 0 },
+  { 9270, 8900, 0 }, { 9281, 8901, 0 }, { 9285, 8902, 0 }, { 0, 8903, 334 },
+  { 9266, 8904, 0 }, { 0, 8905, 336 }, { 9314, 8906, 0 }, { 9284, 8907, 0 },
+  { 9316, 8908, 0 }, { 9272, 8909, 0 }, { 0, 8910, 170 }, { 0, 8911, 373 },
+  { 9275, 8912, 0 }, { 0, 8913, 375 }, { 9319, 8915, 0 }, { 9276, 8916, 0 },
+  { 9286, 8917, 0 }, { 9285, 8918, 0 }, { 0, 8919, 401 }, { 9322, 8920, 0 },
+  { 9295, 8922, 0 }, { 9296, 8923, 0 }, { 9282, 8924, 0 }, { 0, 8925, 410 },
+  { 9327, 8926, 0 }, { 0, 8927, 412 }, { 9284, 8928, 0 }, { 9301, 8927, 0 },
+  { 9290, 8929, 0 }, { 0, 8930, 417 }, { 9286, 8927, 0 }, { 9305, 8930, 0 },
+  { 9333, 8931, 0 }, { 9334, 8933, 0 }, { 9335, 8934, 0 }, { 9287, 8935, 0 },
+  { 9291, 8937, 0 }, { 9291, 8943, 0 }, { 9339, 8939, 0 }, { 0, 8940, 454 },
+  { 9297, 8941, 0 }, { 0, 8942, 456 }, { 0, 8944, 460 }, { 9341, 8945, 0 },
+  { 9307, 8947, 0 }, { 9302, 8948, 0 }, { 0, 8949, 505 }, { 9345, 8950, 0 },
+  { 9297, 8951, 0 }, { 9301, 8953, 0 }, { 0, 8954, 526 }, { 0, 8955, 527 },
+  { 9348, 8956, 0 }, { 9309, 8957, 0 }, { 0, 8958, 631 }, { 0, 8960, 635 },
+  { 9307, 8961, 0 }, { 9320, 8962, 0 }, { 9355, 8963, 0 }, { 9310, 8964, 0 },
+  { 0, 8965, 789 }, { 9357, 8966, 0 }, { 9358, 8967, 0 }, { 9313, 8968, 0 },
+  { 9326, 8969, 0 }, { 0, 8971, 818 }, { 0, 8972, 937 }, { 9361, 8973, 0 },
+  { 0, 8974, 1012 }, { 9322, 8975, 0 }, { 0, 8976, 246 }, { 9363, 8977, 0 },
+  { 9364, 8978, 0 }, { 9324, 8979, 0 }, { 9339, 8980, 0 }, { 9367, 8981, 0 },
+  { 0, 8982, 258 }, { 9324, 8983, 0 }, { 9369, 8984, 0 }, { 0, 8985, 1009 },
+  { 9370, 8986, 0 }, { 0, 8987, 581 }, { 9322, 8988, 0 }, { 9323, 8989, 0 },
+  { 9373, 8990, 0 }, { 9309, 8960, 0 }, { 0, 8991, 303 }, { 9375, 8992, 0 },
+  { 9376, 8993, 0 }, { 9328, 8994, 0 }, { 9378, 9011, 0 }, { 9334, 8995, 0 },
+  { 9339, 8996, 0 }, { 9320, 8960, 0 }, { 9332, 8997, 0 }, { 9333, 8998, 0 },
+  { 9338, 8999, 0 }, { 0, 9001, 97 }, { 0, 9002, 20 }, { 9317, 8960, 0 },
+  { 9344, 9003, 0 }, { 9385, 9036, 0 }, { 0, 9006, 1318 }, { 9346, 9007, 0 },
+  { 9344, 9008, 0 }, { 0, 9009, 244 }, { 9389, 9010, 0 }, { 0, 9055, 1466 },
+  { 0, 9056, 1468 }, { 9344, 9014, 0 }, { 9357, 9015, 0 }, { 9346, 9017, 0 },
+  { 9349, 9018, 0 }, { 9363, 9019, 0 }, { 9395, 9020, 0 }, { 9396, 9021, 0 },
+  { 9366, 9022, 0 }, { 9331, 8991, 0 }, { 9367, 9023, 0 }, { 0, 9024, 77 },
+  { 9361, 9025, 0 }, { 9369, 9026, 0 }, { 9370, 9027, 0 }, { 9356, 9029, 0 },
+  { 9403, 9030, 0 }, { 9404, 9031, 0 }, { 9404, 9032, 0 }, { 9363, 9034, 0 },
+  { 9409, 9035, 0 }, { 9362, 9037, 0 }, { 0, 9038, 94 }, { 9371, 9040, 0 },
+  { 9386, 9041, 0 }, { 9343, 9006, 0 }, { 9365, 9042, 0 }, { 9386, 9043, 0 },
+  { 9375, 9044, 0 }, { 0, 9045, 104 }, { 9372, 9046, 0 }, { 9390, 9045, 0 },
+  { 9419, 9047, 0 }, { 9389, 9048, 0 }, { 9379, 9049, 0 }, { 9379, 9050, 0 },
+  { 9373, 9034, 0 }, { 9405, 9051, 0 }, { 9380, 9052, 0 }, { 9388, 9053, 0 },
+  { 0, 9054, 160 }, { 9400, 9057, 0 }, { 0, 9058, 173 }, { 0, 9059, 190 },
+  { 0, 9060, 191 }, { 9382, 9061, 0 }, { 9385, 9062, 0 }, { 9399, 9063, 0 },
+  { 9390, 9064, 0 }, { 0, 9065, 231 }, { 0, 9066, 234 }, { 9405, 9065, 0 },
+  { 9433, 9067, 0 }, { 9434, 9069, 0 }, { 9408, 9070, 0 }, { 9392, 9071, 0 },
+  { 9437, 9072, 0 }, { 9438, 9073, 0 }, { 0, 9075, 89 }, { 9395, 9076, 0 },
+  { 0, 9078, 252 }, { 9396, 9080, 0 }, { 0, 9081, 260 }, { 9397, 9083, 0 },
+  { 0, 9084, 92 }, { 0, 9085, 262 }, { 9442, 9086, 0 }, { 9401, 9087, 0 },
+  { 9417, 9088, 0 }, { 9416, 9089, 0 }, { 9406, 9090, 0 }, { 9416, 9091, 0 },
+  { 0, 9092, 266 }, { 9417, 9093, 0 }, { 9422, 9094, 0 }, { 9450, 9096, 0 },
+  { 9408, 9097, 0 }, { 9421, 9098, 0 }, { 0, 9099, 298 }, { 9448, 9100, 0 },
+  { 9454, 9101, 0 }, { 9455, 9102, 0 }, { 9456, 9103, 0 }, { 0, 9104, 308 },
+  { 9430, 9105, 0 }, { 9415, 9106, 0 }, { 9415, 9107, 0 }, { 9424, 9108, 0 },
+  { 9417, 9109, 0 }, { 9424, 9110, 0 }, { 9434, 9111, 0 }, { 9466, 9112, 0 },
+  { 9436, 9113, 0 }, { 0, 9114, 326 }, { 9430, 9115, 0 }, { 9423, 9116, 0 },
+  { 9439, 9117, 0 }, { 9434, 9118, 0 }, { 9446, 9120, 0 }, { 0, 9122, 337 },
+  { 9457, 9123, 0 }, { 0, 9124, 353 }, { 9475, 9125, 0 }, { 9429, 9128, 0 },
+  { 0, 9130, 395 }, { 9442, 9131, 0 }, { 9450, 9132, 0 }, { 9448, 9133, 0 },
+  { 9436, 9135, 0 }, { 9444, 9136, 0 }, { 9436, 9137, 0 }, { 9483, 9138, 0 },
+  { 0, 9140, 411 }, { 9440, 9143, 0 }, { 9439, 9146, 0 }, { 9446, 9142, 0 },
+  { 9444, 9144, 0 }, { 9445, 9147, 0 }, { 0, 9148, 420 }, { 0, 9149, 98 },
+  { 0, 9150, 225 }, { 9490, 9151, 0 }, { 9456, 9152, 0 }, { 9465, 9153, 0 },
+  { 0, 9154, 446 }, { 9447, 9156, 0 }, { 0, 9159, 477 }, { 9450, 9160, 0 },
+  { 9447, 9161, 0 }, { 9450, 9154, 0 }, { 0, 9163, 508 }, { 9497, 9164, 0 },
+  { 9457, 9165, 0 }, { 0, 9168, 280 }, { 9499, 9169, 0 }, { 9451, 9201, 0 },
+  { 9469, 9209, 0 }, { 9469, 9215, 0 }, { 9503, 9172, 0 }, { 9458, 9173, 0 },
+  { 0, 9174, 755 }, { 9505, 9175, 0 }, { 0, 9177, 22 }, { 0, 9178, 778 },
+  { 9506, 9179, 0 }, { 9461, 9180, 0 }, { 0, 9183, 938 }, { 9508, 9185, 0 },
+  { 0, 9187, 1032 }, { 0, 9188, 234 }, { 9470, 9189, 0 }, { 9467, 9190, 0 },
+  { 0, 9191, 1033 }, { 9468, 9193, 0 }, { 0, 9194, 260 }, { 0, 9196, 1058 },
+  { 9513, 9198, 0 }, { 9514, 9199, 0 }, { 0, 9200, 289 }, { 9515, 9233, 0 },
+  { 0, 9203, 318 }, { 0, 9204, 1278 }, { 9477, 9205, 0 }, { 0, 9206, 419 },
+  { 9518, 9207, 0 }, { 9479, 9208, 0 }, { 9475, 9210, 0 }, { 9521, 9211, 0 },
+  { 9522, 9212, 0 }, { 9523, 9216, 0 }, { 0, 9217, 241 }, { 9524, 9249, 0 },
+  { 9476, 9219, 0 }, { 9485, 9220, 0 }, { 0, 9222, 417 }, { 9527, 9225, 0 },
+  { 9482, 9226, 0 }, { 9494, 9227, 0 }, { 9521, 9228, 0 }, { 9514, 9229, 0 },
+  { 0, 9230, 51 }, { 0, 9231, 56 }, { 9529, 9232, 0 }, { 9533, 9234, 0 },
+  { 9503, 9236, 0 }, { 9535, 9237, 0 }, { 9536, 9238, 0 }, { 9506, 9239, 0 },
+  { 0, 9240, 87 }, { 0, 9241, 88 }, { 9494, 9242, 0 }, { 9473, 9203, 0 },
+  { 9495, 9243, 0 }, { 9507, 9260, 0 }, { 9509, 9188, 0 }, { 9497, 9244, 0 },
+  { 9542, 9245, 0 }, { 9494, 9247, 0 }, { 9500, 9248, 0 }, { 9545, 9250, 0 },
+  { 9500, 9251, 0 }, { 9503, 9252, 0 }, { 9504, 9255, 0 }, { 9508, 9254, 0 },
+  { 0, 9256, 107 }, { 9551, 9257, 0 }, { 9523, 9256, 0 }, { 9505, 9258, 0 },
+  { 9522, 9259, 0 }, { 9511, 9261, 0 }, { 9555, 9262, 0 }, { 9556, 9263, 0 },
+  { 9519, 9265, 0 }, { 9558, 9269, 0 }, { 9515, 9270, 0 }, { 9514, 9271, 0 },
+  { 9517, 9272, 0 }, { 9518, 9275, 0 }, { 0, 9276, 235 }, { 0, 9277, 240 },
+  { 9525, 9278, 0 }, { 9564, 9279, 0 }, { 0, 9280, 243 }, { 0, 9281, 245 },
+  { 9565, 9283, 0 }, { 9525, 9285, 0 }, { 9526, 9287, 0 }, { 0, 9290, 263 },
+  { 9541, 9291, 0 }, { 9540, 9292, 0 }, { 9539, 9293, 0 }, { 9552, 9294, 0 },
+  { 9545, 9295, 0 }, { 9573, 9297, 0 }, { 9536, 9298, 0 }, { 0, 9299, 295 },
+  { 9528, 9300, 0 }, { 9532, 9301, 0 }, { 9534, 9303, 0 }, { 0, 9304, 300 },
+  { 0, 9305, 301 }, { 0, 9306, 303 }, { 9542, 9308, 0 }, { 9551, 9306, 0 },
+  { 9574, 9309, 0 }, { 9537, 9310, 0 }, { 9536, 9306, 0 }, { 9583, 9311, 0 },
+  { 9579, 9312, 0 }, { 9539, 9313, 0 }, { 9586, 9314, 0 }, { 0, 9315, 321 },
+  { 9543, 9316, 0 }, { 9590, 9318, 0 }, { 9587, 9319, 0 }, { 9593, 9320, 0 },
+  { 9544, 9315, 0 }, { 9594, 9321, 0 }, { 9557, 9322, 0 }, { 9549, 9324, 0 },
+  { 0, 9326, 363 }, { 9570, 9327, 0 }, { 9551, 9329, 0 }, { 9555, 9330, 0 },
+  { 9554, 9331, 0 }, { 9557, 9332, 0 }, { 9571, 9333, 0 }, { 9562, 9334, 0 },
+  { 0, 9335, 406 }, { 9605, 9337, 0 }, { 9577, 9335, 0 }, { 9579, 9338, 0 },
+  { 9563, 9339, 0 }, { 9608, 9340, 0 }, { 9609, 9341, 0 }, { 0, 9345, 400 },
+  { 9569, 9346, 0 }, { 9573, 9347, 0 }, { 9565, 9353, 0 }, { 9586, 9349, 0 },
+  { 9614, 9351, 0 }, { 9615, 9352, 0 }, { 0, 9355, 509 }, { 9572, 9356, 0 },
+  { 0, 9358, 630 }, { 9577, 9359, 0 }, { 9572, 9360, 0 }, { 9585, 9361, 0 },
+  { 0, 9362, 726 }, { 9620, 9363, 0 }, { 0, 9365, 764 }, { 0, 9368, 231 },
+  { 9621, 9369, 0 }, { 0, 9371, 104 }, { 0, 9418, 227 }, { 9577, 9374, 0 },
+  { 9579, 9375, 0 }, { 9583, 9377, 0 }, { 0, 9380, 1109 }, { 0, 9381, 1133 },
+  { 0, 9383, 305 }, { 9625, 9415, 0 }, { 9626, 9386, 0 }, { 0, 9388, 402 },
+  { 9582, 9389, 0 }, { 9628, 9390, 0 }, { 0, 9391, 1279 }, { 0, 9392, 1301 },
+  { 0, 9393, 842 }, { 0, 9395, 414 }, { 9629, 9396, 0 }, { 9581, 9397, 0 },
+  { 0, 9399, 239 }, { 9631, 9400, 0 }, { 9605, 9401, 0 }, { 9593, 9402, 0 },
+  { 9587, 9403, 0 }, { 9594, 9406, 0 }, { 0, 9407, 76 }, { 9635, 9408, 0 },
+  { 0, 9409, 79 }, { 0, 9410, 80 }, { 9604, 9411, 0 }, { 9594, 9414, 0 },
+  { 9598, 9416, 0 }, { 9606, 9417, 0 }, { 9597, 9419, 0 }, { 0, 9420, 93 },
+  { 9642, 9421, 0 }, { 9643, 9422, 0 }, { 0, 9423, 100 }, { 9603, 9424, 0 },
+  { 9645, 9425, 0 }, { 9646, 9426, 0 }, { 9603, 9427, 0 }, { 9604, 9430, 0 },
+  { 0, 9429, 124 }, { 9622, 9431, 0 }, { 9650, 9432, 0 }, { 9604, 9433, 0 },
+  { 0, 9434, 158 }, { 0, 9435, 159 }, { 9652, 9436, 0 }, { 0, 9437, 224 },
+  { 9612, 9438, 0 }, { 9654, 9439, 0 }, { 9655, 9440, 0 }, { 9656, 9441, 0 },
+  { 9657, 9444, 0 }, { 0, 9445, 242 }, { 0, 9448, 248 }, { 9609, 9449, 0 },
+  { 9610, 9450, 0 }, { 9631, 9452, 0 }, { 9630, 9453, 0 }, { 9662, 9454, 0 },
+  { 9621, 9455, 0 }, { 9618, 9456, 0 }, { 0, 9457, 284 }, { 9663, 9458, 0 },
+  { 9639, 9460, 0 }, { 9667, 9461, 0 }, { 9621, 9462, 0 }, { 9625, 9467, 0 },
+  { 9623, 9470, 0 }, { 9671, 9466, 0 }, { 9628, 9468, 0 }, { 9673, 9469, 0 },
+  { 0, 9471, 315 }, { 9631, 9472, 0 }, { 9675, 9473, 0 }, { 0, 9474, 318 },
+  { 9631, 9480, 0 }, { 9649, 9474, 0 }, { 9679, 9476, 0 }, { 0, 9477, 328 },
+  { 9634, 9474, 0 }, { 9637, 9478, 0 }, { 0, 9479, 330 }, { 0, 9481, 332 },
+  { 9681, 9482, 0 }, { 9641, 9483, 0 }, { 9645, 9485, 0 }, { 9646, 9486, 0 },
+  { 9651, 9487, 0 }, { 9687, 9488, 0 }, { 9647, 9489, 0 }, { 9643, 9490, 0 },
+  { 9646, 9491, 0 }, { 9647, 9494, 0 }, { 0, 9493, 413 }, { 9654, 9495, 0 },
+  { 9693, 9496, 0 }, { 0, 9497, 416 }, { 0, 9498, 418 }, { 9654, 9500, 0 },
+  { 9695, 9501, 0 }, { 9669, 9502, 0 }, { 9659, 9503, 0 }, { 0, 9504, 497 },
+  { 0, 9505, 503 }, { 9698, 9507, 0 }, { 9699, 9509, 0 }, { 9700, 9510, 0 },
+  { 9655, 9511, 0 }, { 0, 9513, 727 }, { 0, 9516, 406 }, { 9702, 9519, 0 },
+  { 9662, 9520, 0 }, { 9655, 9521, 0 }, { 0, 9525, 320 }, { 0, 9526, 107 },
+  { 9705, 9528, 0 }, { 0, 9529, 1300 }, { 0, 9534, 220 }, { 9706, 9535, 0 },
+  { 0, 9537, 412 }, { 9669, 9538, 0 }, { 9662, 9539, 0 }, { 9668, 9540, 0 },
+  { 9670, 9541, 0 }, { 9682, 9543, 0 }, { 9668, 9546, 0 }, { 9672, 9547, 0 },
+  { 9665, 9548, 0 }, { 9669, 9549, 0 }, { 9675, 9550, 0 }, { 0, 9552, 96 },
+  { 0, 9553, 97 }, { 9673, 9555, 0 }, { 0, 9556, 103 }, { 0, 9557, 105 },
+  { 9718, 9558, 0 }, { 9719, 9559, 0 }, { 9676, 9561, 0 }, { 0, 9562, 140 },
+  { 9694, 9563, 0 }, { 0, 9566, 162 }, { 9673, 9568, 0 }, { 0, 9569, 229 },
+  { 0, 9570, 230 }, { 0, 9571, 232 }, { 0, 9572, 241 }, { 9723, 9575, 0 },
+  { 9724, 9576, 0 }, { 9694, 9577, 0 }, { 9726, 9578, 0 }, { 0, 9579, 280 },
+  { 9700, 9580, 0 }, { 9697, 9581, 0 }, { 9702, 9583, 0 }, { 9692, 9584, 0 },
+  { 0, 9585, 297 }, { 9704, 9586, 0 }, { 9732, 9587, 0 }, { 9706, 9588, 0 },
+  { 0, 9589, 310 }, { 9703, 9590, 0 }, { 0, 9591, 313 }, { 9688, 9593, 0 },
+  { 0, 9594, 317 }, { 9692, 9597, 0 }, { 9690, 9600, 0 }, { 9711, 9596, 0 },
+  { 0, 9598, 323 }, { 9693, 9601, 0 }, { 0, 9604, 335 }, { 9695, 9605, 0 },
+  { 9742, 9606, 0 }, { 9696, 9598, 0 }, { 9743, 9607, 0 }, { 9697, 9608, 0 },
+  { 0, 9609, 399 }, { 9696, 9610, 0 }, { 9746, 9611, 0 }, { 9747, 9612, 0 },
+  { 9748, 9613, 0 }, { 9749, 9615, 0 }, { 0, 9616, 415 }, { 9750, 9619, 0 },
+  { 0, 9620, 445 }, { 9713, 9621, 0 }, { 9752, 9622, 0 }, { 0, 9625, 525 },
+  { 0, 9626, 636 }, { 0, 9627, 637 }, { 9753, 9628, 0 }, { 0, 9631, 396 },
+  { 9705, 9632, 0 }, { 9755, 9633, 0 }, { 0, 9636, 131 }, { 0, 9639, 389 },
+  { 9752, 9641, 0 }, { 9726, 9642, 0 }, { 9712, 9643, 0 }, { 9713, 9644, 0 },
+  { 9713, 9645, 0 }, { 9734, 9646, 0 }, { 9713, 9647, 0 }, { 9763, 9648, 0 },
+  { 9763, 9649, 0 }, { 9716, 9650, 0 }, { 9766, 9653, 0 }, { 0, 9656, 106 },
+  { 0, 9657, 108 }, { 9736, 9658, 0 }, { 9724, 9660, 0 }, { 9769, 9662, 0 },
+  { 0, 9667, 259 }, { 0, 9668, 91 }, { 9770, 9669, 0 }, { 0, 9670, 280 },
+  { 9742, 9672, 0 }, { 9728, 9673, 0 }, { 9729, 9674, 0 }, { 9774, 9675, 0 },
+  { 9737, 9677, 0 }, { 0, 9678, 304 }, { 9738, 9679, 0 }, { 9750, 9681, 0 },
+  { 9751, 9683, 0 }, { 9779, 9685, 0 }, { 9753, 9686, 0 }, { 9743, 9687, 0 },
+  { 9735, 9693, 0 }, { 9756, 9689, 0 }, { 9753, 9691, 0 }, { 0, 9692, 374 },
+  { 0, 9694, 396 }, { 9746, 9695, 0 }, { 9786, 9697, 0 }, { 0, 9698, 404 },
+  { 0, 9699, 405 }, { 0, 9700, 407 }, { 0, 9701, 414 }, { 0, 9703, 443 },
+  { 9787, 9705, 0 }, { 0, 9706, 455 }, { 0, 9710, 638 }, { 9788, 9712, 0 },
+  { 0, 9713, 259 }, { 9789, 9716, 0 }, { 9757, 9717, 0 }, { 9760, 9718, 0 },
+  { 9751, 9719, 0 }, { 9747, 9720, 0 }, { 9756, 9721, 0 }, { 9795, 9722, 0 },
+  { 0, 9723, 90 }, { 9752, 9724, 0 }, { 9797, 9725, 0 }, { 0, 9726, 102 },
+  { 9798, 9729, 0 }, { 9768, 9730, 0 }, { 0, 9731, 227 }, { 0, 9734, 280 },
+  { 9769, 9736, 0 }, { 9801, 9737, 0 }, { 9802, 9738, 0 }, { 0, 9739, 296 },
+  { 9803, 9740, 0 }, { 9804, 9742, 0 }, { 9759, 9743, 0 }, { 9768, 9744, 0 },
+  { 0, 9745, 319 }, { 9769, 9746, 0 }, { 9808, 9747, 0 }, { 9782, 9748, 0 },
+  { 9772, 9749, 0 }, { 9811, 9750, 0 }, { 9812, 9753, 0 }, { 0, 9754, 402 },
+  { 0, 9760, 447 }, { 0, 9763, 926 }, { 0, 9765, 35 }, { 9769, 9766, 0 },
+  { 9814, 9767, 0 }, { 9768, 9768, 0 }, { 9785, 9769, 0 }, { 9817, 9770, 0 },
+  { 0, 9771, 89 }, { 9774, 9773, 0 }, { 0, 9774, 92 }, { 0, 9776, 125 },
+  { 9819, 9777, 0 }, { 9820, 9780, 0 }, { 0, 9781, 165 }, { 0, 9782, 289 },
+  { 0, 9784, 299 }, { 0, 9785, 305 }, { 9790, 9786, 0 }, { 9822, 9787, 0 },
+  { 9823, 9789, 0 }, { 0, 9790, 322 }, { 9786, 9791, 0 }, { 9825, 9792, 0 },
+  { 0, 9793, 352 }, { 0, 9794, 397 }, { 9799, 9799, 0 }, { 0, 9800, 50 },
+  { 9783, 9801, 0 }, { 9828, 9802, 0 }, { 0, 9803, 55 }, { 9788, 9805, 0 },
+  { 0, 9808, 141 }, { 0, 9809, 280 }, { 9786, 9814, 0 }, { 0, 9815, 316 },
+  { 0, 9816, 320 }, { 9831, 9818, 0 }, { 0, 9819, 329 }, { 9794, 9822, 0 },
+  { 9824, 9824, 0 }, { 0, 9825, 78 }, { 9785, 9827, 0 }, { 9835, 9830, 0 },
+  { 0, 9833, 324 }, { 9836, 9835, 0 }, { 9797, 9836, 0 }, { 9838, 9838, 0 },
+  { 0, 9839, 312 }, { 0, 9841, 49 }, { 9793, 9842, 0 }, { 0, 9843, 91 },
+  { 9809, 9846, 0 }, { 9808, 9848, 0 }, { 9798, 9849, 0 }, { 9816, 9850, 0 },
+  { 9806, 9851, 0 }, { 9845, 9852, 0 }, { 0, 9853, 59 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+};
+
+// Indexed by value - 1
+static const OneOrTwoCodepoints kCharRefValues[] = {
+  { 0xc6, -1 },
+  { 0x26, -1 },
+  { 0xc1, -1 },
+  { 0x102, -1 },
+  { 0xc2, -1 },
+  { 0x410, -1 },
+  { 0x1d504, -1 },
+  { 0xc0, -1 },
+  { 0x391, -1 },
+  { 0x100, -1 },
+  { 0x2a53, -1 },
+  { 0x104, -1 },
+  { 0x1d538, -1 },
+  { 0x2061, -1 },
+  { 0xc5, -1 },
+  { 0x1d49c, -1 },
+  { 0x2254, -1 },
+  { 0xc3, -1 },
+  { 0xc4, -1 },
+  { 0x2216, -1 },
+  { 0x2ae7, -1 },
+  { 0x2306, -1 },
+  { 0x411, -1 },
+  { 0x2235, -1 },
+  { 0x212c, -1 },
+  { 0x392, -1 },
+  { 0x1d505, -1 },
+  { 0x1d539, -1 },
+  { 0x2d8, -1 },
+  { 0x224e, -1 },
+  { 0x427, -1 },
+  { 0xa9, -1 },
+  { 0x106, -1 },
+  { 0x22d2, -1 },
+  { 0x2145, -1 },
+  { 0x212d, -1 },
+  { 0x10c, -1 },
+  { 0xc7, -1 },
+  { 0x108, -1 },
+  { 0x2230, -1 },
+  { 0x10a, -1 },
+  { 0xb8, -1 },
+  { 0xb7, -1 },
+  { 0x3a7, -1 },
+  { 0x2299, -1 },
+  { 0x2296, -1 },
+  { 0x2295, -1 },
+  { 0x2297, -1 },
+  { 0x2232, -1 },
+  { 0x201d, -1 },
+  { 0x2019, -1 },
+  { 0x2237, -1 },
+  { 0x2a74, -1 },
+  { 0x2261, -1 },
+  { 0x222f, -1 },
+  { 0x222e, -1 },
+  { 0x2102, -1 },
+  { 0x2210, -1 },
+  { 0x2233, -1 },
+  { 0x2a2f, -1 },
+  { 0x1d49e, -1 },
+  { 0x22d3, -1 },
+  { 0x224d, -1 },
+  { 0x2911, -1 },
+  { 0x402, -1 },
+  { 0x405, -1 },
+  { 0x40f, -1 },
+  { 0x2021, -1 },
+  { 0x21a1, -1 },
+  { 0x2ae4, -1 },
+  { 0x10e, -1 },
+  { 0x414, -1 },
+  { 0x2207, -1 },
+  { 0x394, -1 },
+  { 0x1d507, -1 },
+  { 0xb4, -1 },
+  { 0x2d9, -1 },
+  { 0x2dd, -1 },
+  { 0x60, -1 },
+  { 0x2dc, -1 },
+  { 0x22c4, -1 },
+  { 0x2146, -1 },
+  { 0x1d53b, -1 },
+  { 0xa8, -1 },
+  { 0x20dc, -1 },
+  { 0x2250, -1 },
+  { 0x21d3, -1 },
+  { 0x21d0, -1 },
+  { 0x21d4, -1 },
+  { 0x27f8, -1 },
+  { 0x27fa, -1 },
+  { 0x27f9, -1 },
+  { 0x21d2, -1 },
+  { 0x22a8, -1 },
+  { 0x21d1, -1 },
+  { 0x21d5, -1 },
+  { 0x2225, -1 },
+  { 0x2193, -1 },
+  { 0x2913, -1 },
+  { 0x21f5, -1 },
+  { 0x311, -1 },
+  { 0x2950, -1 },
+  { 0x295e, -1 },
+  { 0x21bd, -1 },
+  { 0x2956, -1 },
+  { 0x295f, -1 },
+  { 0x21c1, -1 },
+  { 0x2957, -1 },
+  { 0x22a4, -1 },
+  { 0x21a7, -1 },
+  { 0x1d49f, -1 },
+  { 0x110, -1 },
+  { 0x14a, -1 },
+  { 0xd0, -1 },
+  { 0xc9, -1 },
+  { 0x11a, -1 },
+  { 0xca, -1 },
+  { 0x42d, -1 },
+  { 0x116, -1 },
+  { 0x1d508, -1 },
+  { 0xc8, -1 },
+  { 0x2208, -1 },
+  { 0x112, -1 },
+  { 0x25fb, -1 },
+  { 0x25ab, -1 },
+  { 0x118, -1 },
+  { 0x1d53c, -1 },
+  { 0x395, -1 },
+  { 0x2a75, -1 },
+  { 0x2242, -1 },
+  { 0x21cc, -1 },
+  { 0x2130, -1 },
+  { 0x2a73, -1 },
+  { 0x397, -1 },
+  { 0xcb, -1 },
+  { 0x2203, -1 },
+  { 0x2147, -1 },
+  { 0x424, -1 },
+  { 0x1d509, -1 },
+  { 0x25fc, -1 },
+  { 0x25aa, -1 },
+  { 0x1d53d, -1 },
+  { 0x2200, -1 },
+  { 0x2131, -1 },
+  { 0x403, -1 },
+  { 0x3e, -1 },
+  { 0x393, -1 },
+  { 0x3dc, -1 },
+  { 0x11e, -1 },
+  { 0x122, -1 },
+  { 0x11c, -1 },
+  { 0x413, -1 },
+  { 0x120, -1 },
+  { 0x1d50a, -1 },
+  { 0x22d9, -1 },
+  { 0x1d53e, -1 },
+  { 0x2265, -1 },
+  { 0x22db, -1 },
+  { 0x2267, -1 },
+  { 0x2aa2, -1 },
+  { 0x2277, -1 },
+  { 0x2a7e, -1 },
+  { 0x2273, -1 },
+  { 0x1d4a2, -1 },
+  { 0x226b, -1 },
+  { 0x42a, -1 },
+  { 0x2c7, -1 },
+  { 0x5e, -1 },
+  { 0x124, -1 },
+  { 0x210c, -1 },
+  { 0x210b, -1 },
+  { 0x210d, -1 },
+  { 0x2500, -1 },
+  { 0x126, -1 },
+  { 0x224f, -1 },
+  { 0x415, -1 },
+  { 0x132, -1 },
+  { 0x401, -1 },
+  { 0xcd, -1 },
+  { 0xce, -1 },
+  { 0x418, -1 },
+  { 0x130, -1 },
+  { 0x2111, -1 },
+  { 0xcc, -1 },
+  { 0x12a, -1 },
+  { 0x2148, -1 },
+  { 0x222c, -1 },
+  { 0x222b, -1 },
+  { 0x22c2, -1 },
+  { 0x2063, -1 },
+  { 0x2062, -1 },
+  { 0x12e, -1 },
+  { 0x1d540, -1 },
+  { 0x399, -1 },
+  { 0x2110, -1 },
+  { 0x128, -1 },
+  { 0x406, -1 },
+  { 0xcf, -1 },
+  { 0x134, -1 },
+  { 0x419, -1 },
+  { 0x1d50d, -1 },
+  { 0x1d541, -1 },
+  { 0x1d4a5, -1 },
+  { 0x408, -1 },
+  { 0x404, -1 },
+  { 0x425, -1 },
+  { 0x40c, -1 },
+  { 0x39a, -1 },
+  { 0x136, -1 },
+  { 0x41a, -1 },
+  { 0x1d50e, -1 },
+  { 0x1d542, -1 },
+  { 0x1d4a6, -1 },
+  { 0x409, -1 },
+  { 0x3c, -1 },
+  { 0x139, -1 },
+  { 0x39b, -1 },
+  { 0x27ea, -1 },
+  { 0x2112, -1 },
+  { 0x219e, -1 },
+  { 0x13d, -1 },
+  { 0x13b, -1 },
+  { 0x41b, -1 },
+  { 0x27e8, -1 },
+  { 0x2190, -1 },
+  { 0x21e4, -1 },
+  { 0x21c6, -1 },
+  { 0x2308, -1 },
+  { 0x27e6, -1 },
+  { 0x2961, -1 },
+  { 0x21c3, -1 },
+  { 0x2959, -1 },
+  { 0x230a, -1 },
+  { 0x2194, -1 },
+  { 0x294e, -1 },
+  { 0x22a3, -1 },
+  { 0x21a4, -1 },
+  { 0x295a, -1 },
+  { 0x22b2, -1 },
+  { 0x29cf, -1 },
+  { 0x22b4, -1 },
+  { 0x2951, -1 },
+  { 0x2960, -1 },
+  { 0x21bf, -1 },
+  { 0x2958, -1 },
+  { 0x21bc, -1 },
+  { 0x2952, -1 },
+  { 0x22da, -1 },
+  { 0x2266, -1 },
+  { 0x2276, -1 },
+  { 0x2aa1, -1 },
+  { 0x2a7d, -1 },
+  { 0x2272, -1 },
+  { 0x1d50f, -1 },
+  { 0x22d8, -1 },
+  { 0x21da, -1 },
+  { 0x13f, -1 },
+  { 0x27f5, -1 },
+  { 0x27f7, -1 },
+  { 0x27f6, -1 },
+  { 0x1d543, -1 },
+  { 0x2199, -1 },
+  { 0x2198, -1 },
+  { 0x21b0, -1 },
+  { 0x141, -1 },
+  { 0x226a, -1 },
+  { 0x2905, -1 },
+  { 0x41c, -1 },
+  { 0x205f, -1 },
+  { 0x2133, -1 },
+  { 0x1d510, -1 },
+  { 0x2213, -1 },
+  { 0x1d544, -1 },
+  { 0x39c, -1 },
+  { 0x40a, -1 },
+  { 0x143, -1 },
+  { 0x147, -1 },
+  { 0x145, -1 },
+  { 0x41d, -1 },
+  { 0x200b, -1 },
+  { 0xa, -1 },
+  { 0x1d511, -1 },
+  { 0x2060, -1 },
+  { 0xa0, -1 },
+  { 0x2115, -1 },
+  { 0x2aec, -1 },
+  { 0x2262, -1 },
+  { 0x226d, -1 },
+  { 0x2226, -1 },
+  { 0x2209, -1 },
+  { 0x2260, -1 },
+  { 0x2242, 0x338 },
+  { 0x2204, -1 },
+  { 0x226f, -1 },
+  { 0x2271, -1 },
+  { 0x2267, 0x338 },
+  { 0x226b, 0x338 },
+  { 0x2279, -1 },
+  { 0x2a7e, 0x338 },
+  { 0x2275, -1 },
+  { 0x224e, 0x338 },
+  { 0x224f, 0x338 },
+  { 0x22ea, -1 },
+  { 0x29cf, 0x338 },
+  { 0x22ec, -1 },
+  { 0x226e, -1 },
+  { 0x2270, -1 },
+  { 0x2278, -1 },
+  { 0x226a, 0x338 },
+  { 0x2a7d, 0x338 },
+  { 0x2274, -1 },
+  { 0x2aa2, 0x338 },
+  { 0x2aa1, 0x338 },
+  { 0x2280, -1 },
+  { 0x2aaf, 0x338 },
+  { 0x22e0, -1 },
+  { 0x220c, -1 },
+  { 0x22eb, -1 },
+  { 0x29d0, 0x338 },
+  { 0x22ed, -1 },
+  { 0x228f, 0x338 },
+  { 0x22e2, -1 },
+  { 0x2290, 0x338 },
+  { 0x22e3, -1 },
+  { 0x2282, 0x20d2 },
+  { 0x2288, -1 },
+  { 0x2281, -1 },
+  { 0x2ab0, 0x338 },
+  { 0x22e1, -1 },
+  { 0x227f, 0x338 },
+  { 0x2283, 0x20d2 },
+  { 0x2289, -1 },
+  { 0x2241, -1 },
+  { 0x2244, -1 },
+  { 0x2247, -1 },
+  { 0x2249, -1 },
+  { 0x2224, -1 },
+  { 0x1d4a9, -1 },
+  { 0xd1, -1 },
+  { 0x39d, -1 },
+  { 0x152, -1 },
+  { 0xd3, -1 },
+  { 0xd4, -1 },
+  { 0x41e, -1 },
+  { 0x150, -1 },
+  { 0x1d512, -1 },
+  { 0xd2, -1 },
+  { 0x14c, -1 },
+  { 0x3a9, -1 },
+  { 0x39f, -1 },
+  { 0x1d546, -1 },
+  { 0x201c, -1 },
+  { 0x2018, -1 },
+  { 0x2a54, -1 },
+  { 0x1d4aa, -1 },
+  { 0xd8, -1 },
+  { 0xd5, -1 },
+  { 0x2a37, -1 },
+  { 0xd6, -1 },
+  { 0x203e, -1 },
+  { 0x23de, -1 },
+  { 0x23b4, -1 },
+  { 0x23dc, -1 },
+  { 0x2202, -1 },
+  { 0x41f, -1 },
+  { 0x1d513, -1 },
+  { 0x3a6, -1 },
+  { 0x3a0, -1 },
+  { 0xb1, -1 },
+  { 0x2119, -1 },
+  { 0x2abb, -1 },
+  { 0x227a, -1 },
+  { 0x2aaf, -1 },
+  { 0x227c, -1 },
+  { 0x227e, -1 },
+  { 0x2033, -1 },
+  { 0x220f, -1 },
+  { 0x221d, -1 },
+  { 0x1d4ab, -1 },
+  { 0x3a8, -1 },
+  { 0x22, -1 },
+  { 0x1d514, -1 },
+  { 0x211a, -1 },
+  { 0x1d4ac, -1 },
+  { 0x2910, -1 },
+  { 0xae, -1 },
+  { 0x154, -1 },
+  { 0x27eb, -1 },
+  { 0x21a0, -1 },
+  { 0x2916, -1 },
+  { 0x158, -1 },
+  { 0x156, -1 },
+  { 0x420, -1 },
+  { 0x211c, -1 },
+  { 0x220b, -1 },
+  { 0x21cb, -1 },
+  { 0x296f, -1 },
+  { 0x3a1, -1 },
+  { 0x27e9, -1 },
+  { 0x2192, -1 },
+  { 0x21e5, -1 },
+  { 0x21c4, -1 },
+  { 0x2309, -1 },
+  { 0x27e7, -1 },
+  { 0x295d, -1 },
+  { 0x21c2, -1 },
+  { 0x2955, -1 },
+  { 0x230b, -1 },
+  { 0x22a2, -1 },
+  { 0x21a6, -1 },
+  { 0x295b, -1 },
+  { 0x22b3, -1 },
+  { 0x29d0, -1 },
+  { 0x22b5, -1 },
+  { 0x294f, -1 },
+  { 0x295c, -1 },
+  { 0x21be, -1 },
+  { 0x2954, -1 },
+  { 0x21c0, -1 },
+  { 0x2953, -1 },
+  { 0x211d, -1 },
+  { 0x2970, -1 },
+  { 0x21db, -1 },
+  { 0x211b, -1 },
+  { 0x21b1, -1 },
+  { 0x29f4, -1 },
+  { 0x429, -1 },
+  { 0x428, -1 },
+  { 0x42c, -1 },
+  { 0x15a, -1 },
+  { 0x2abc, -1 },
+  { 0x160, -1 },
+  { 0x15e, -1 },
+  { 0x15c, -1 },
+  { 0x421, -1 },
+  { 0x1d516, -1 },
+  { 0x2191, -1 },
+  { 0x3a3, -1 },
+  { 0x2218, -1 },
+  { 0x1d54a, -1 },
+  { 0x221a, -1 },
+  { 0x25a1, -1 },
+  { 0x2293, -1 },
+  { 0x228f, -1 },
+  { 0x2291, -1 },
+  { 0x2290, -1 },
+  { 0x2292, -1 },
+  { 0x2294, -1 },
+  { 0x1d4ae, -1 },
+  { 0x22c6, -1 },
+  { 0x22d0, -1 },
+  { 0x2286, -1 },
+  { 0x227b, -1 },
+  { 0x2ab0, -1 },
+  { 0x227d, -1 },
+  { 0x227f, -1 },
+  { 0x2211, -1 },
+  { 0x22d1, -1 },
+  { 0x2283, -1 },
+  { 0x2287, -1 },
+  { 0xde, -1 },
+  { 0x2122, -1 },
+  { 0x40b, -1 },
+  { 0x426, -1 },
+  { 0x9, -1 },
+  { 0x3a4, -1 },
+  { 0x164, -1 },
+  { 0x162, -1 },
+  { 0x422, -1 },
+  { 0x1d517, -1 },
+  { 0x2234, -1 },
+  { 0x398, -1 },
+  { 0x205f, 0x200a },
+  { 0x2009, -1 },
+  { 0x223c, -1 },
+  { 0x2243, -1 },
+  { 0x2245, -1 },
+  { 0x2248, -1 },
+  { 0x1d54b, -1 },
+  { 0x20db, -1 },
+  { 0x1d4af, -1 },
+  { 0x166, -1 },
+  { 0xda, -1 },
+  { 0x219f, -1 },
+  { 0x2949, -1 },
+  { 0x40e, -1 },
+  { 0x16c, -1 },
+  { 0xdb, -1 },
+  { 0x423, -1 },
+  { 0x170, -1 },
+  { 0x1d518, -1 },
+  { 0xd9, -1 },
+  { 0x16a, -1 },
+  { 0x5f, -1 },
+  { 0x23df, -1 },
+  { 0x23b5, -1 },
+  { 0x23dd, -1 },
+  { 0x22c3, -1 },
+  { 0x228e, -1 },
+  { 0x172, -1 },
+  { 0x1d54c, -1 },
+  { 0x2912, -1 },
+  { 0x21c5, -1 },
+  { 0x2195, -1 },
+  { 0x296e, -1 },
+  { 0x22a5, -1 },
+  { 0x21a5, -1 },
+  { 0x2196, -1 },
+  { 0x2197, -1 },
+  { 0x3d2, -1 },
+  { 0x3a5, -1 },
+  { 0x16e, -1 },
+  { 0x1d4b0, -1 },
+  { 0x168, -1 },
+  { 0xdc, -1 },
+  { 0x22ab, -1 },
+  { 0x2aeb, -1 },
+  { 0x412, -1 },
+  { 0x22a9, -1 },
+  { 0x2ae6, -1 },
+  { 0x22c1, -1 },
+  { 0x2016, -1 },
+  { 0x2223, -1 },
+  { 0x7c, -1 },
+  { 0x2758, -1 },
+  { 0x2240, -1 },
+  { 0x200a, -1 },
+  { 0x1d519, -1 },
+  { 0x1d54d, -1 },
+  { 0x1d4b1, -1 },
+  { 0x22aa, -1 },
+  { 0x174, -1 },
+  { 0x22c0, -1 },
+  { 0x1d51a, -1 },
+  { 0x1d54e, -1 },
+  { 0x1d4b2, -1 },
+  { 0x1d51b, -1 },
+  { 0x39e, -1 },
+  { 0x1d54f, -1 },
+  { 0x1d4b3, -1 },
+  { 0x42f, -1 },
+  { 0x407, -1 },
+  { 0x42e, -1 },
+  { 0xdd, -1 },
+  { 0x176, -1 },
+  { 0x42b, -1 },
+  { 0x1d51c, -1 },
+  { 0x1d550, -1 },
+  { 0x1d4b4, -1 },
+  { 0x178, -1 },
+  { 0x416, -1 },
+  { 0x179, -1 },
+  { 0x17d, -1 },
+  { 0x417, -1 },
+  { 0x17b, -1 },
+  { 0x396, -1 },
+  { 0x2128, -1 },
+  { 0x2124, -1 },
+  { 0x1d4b5, -1 },
+  { 0xe1, -1 },
+  { 0x103, -1 },
+  { 0x223e, -1 },
+  { 0x223e, 0x333 },
+  { 0x223f, -1 },
+  { 0xe2, -1 },
+  { 0x430, -1 },
+  { 0xe6, -1 },
+  { 0x1d51e, -1 },
+  { 0xe0, -1 },
+  { 0x2135, -1 },
+  { 0x3b1, -1 },
+  { 0x101, -1 },
+  { 0x2a3f, -1 },
+  { 0x2227, -1 },
+  { 0x2a55, -1 },
+  { 0x2a5c, -1 },
+  { 0x2a58, -1 },
+  { 0x2a5a, -1 },
+  { 0x2220, -1 },
+  { 0x29a4, -1 },
+  { 0x2221, -1 },
+  { 0x29a8, -1 },
+  { 0x29a9, -1 },
+  { 0x29aa, -1 },
+  { 0x29ab, -1 },
+  { 0x29ac, -1 },
+  { 0x29ad, -1 },
+  { 0x29ae, -1 },
+  { 0x29af, -1 },
+  { 0x221f, -1 },
+  { 0x22be, -1 },
+  { 0x299d, -1 },
+  { 0x2222, -1 },
+  { 0x237c, -1 },
+  { 0x105, -1 },
+  { 0x1d552, -1 },
+  { 0x2a70, -1 },
+  { 0x2a6f, -1 },
+  { 0x224a, -1 },
+  { 0x224b, -1 },
+  { 0x27, -1 },
+  { 0xe5, -1 },
+  { 0x1d4b6, -1 },
+  { 0x2a, -1 },
+  { 0xe3, -1 },
+  { 0xe4, -1 },
+  { 0x2a11, -1 },
+  { 0x2aed, -1 },
+  { 0x224c, -1 },
+  { 0x3f6, -1 },
+  { 0x2035, -1 },
+  { 0x223d, -1 },
+  { 0x22cd, -1 },
+  { 0x22bd, -1 },
+  { 0x2305, -1 },
+  { 0x23b6, -1 },
+  { 0x431, -1 },
+  { 0x201e, -1 },
+  { 0x29b0, -1 },
+  { 0x3b2, -1 },
+  { 0x2136, -1 },
+  { 0x226c, -1 },
+  { 0x1d51f, -1 },
+  { 0x25ef, -1 },
+  { 0x2a00, -1 },
+  { 0x2a01, -1 },
+  { 0x2a02, -1 },
+  { 0x2a06, -1 },
+  { 0x2605, -1 },
+  { 0x25bd, -1 },
+  { 0x25b3, -1 },
+  { 0x2a04, -1 },
+  { 0x290d, -1 },
+  { 0x29eb, -1 },
+  { 0x25b4, -1 },
+  { 0x25be, -1 },
+  { 0x25c2, -1 },
+  { 0x25b8, -1 },
+  { 0x2423, -1 },
+  { 0x2592, -1 },
+  { 0x2591, -1 },
+  { 0x2593, -1 },
+  { 0x2588, -1 },
+  { 0x3d, 0x20e5 },
+  { 0x2261, 0x20e5 },
+  { 0x2310, -1 },
+  { 0x1d553, -1 },
+  { 0x22c8, -1 },
+  { 0x2557, -1 },
+  { 0x2554, -1 },
+  { 0x2556, -1 },
+  { 0x2553, -1 },
+  { 0x2550, -1 },
+  { 0x2566, -1 },
+  { 0x2569, -1 },
+  { 0x2564, -1 },
+  { 0x2567, -1 },
+  { 0x255d, -1 },
+  { 0x255a, -1 },
+  { 0x255c, -1 },
+  { 0x2559, -1 },
+  { 0x2551, -1 },
+  { 0x256c, -1 },
+  { 0x2563, -1 },
+  { 0x2560, -1 },
+  { 0x256b, -1 },
+  { 0x2562, -1 },
+  { 0x255f, -1 },
+  { 0x29c9, -1 },
+  { 0x2555, -1 },
+  { 0x2552, -1 },
+  { 0x2510, -1 },
+  { 0x250c, -1 },
+  { 0x2565, -1 },
+  { 0x2568, -1 },
+  { 0x252c, -1 },
+  { 0x2534, -1 },
+  { 0x229f, -1 },
+  { 0x229e, -1 },
+  { 0x22a0, -1 },
+  { 0x255b, -1 },
+  { 0x2558, -1 },
+  { 0x2518, -1 },
+  { 0x2514, -1 },
+  { 0x2502, -1 },
+  { 0x256a, -1 },
+  { 0x2561, -1 },
+  { 0x255e, -1 },
+  { 0x253c, -1 },
+  { 0x2524, -1 },
+  { 0x251c, -1 },
+  { 0xa6, -1 },
+  { 0x1d4b7, -1 },
+  { 0x204f, -1 },
+  { 0x5c, -1 },
+  { 0x29c5, -1 },
+  { 0x27c8, -1 },
+  { 0x2022, -1 },
+  { 0x2aae, -1 },
+  { 0x107, -1 },
+  { 0x2229, -1 },
+  { 0x2a44, -1 },
+  { 0x2a49, -1 },
+  { 0x2a4b, -1 },
+  { 0x2a47, -1 },
+  { 0x2a40, -1 },
+  { 0x2229, 0xfe00 },
+  { 0x2041, -1 },
+  { 0x2a4d, -1 },
+  { 0x10d, -1 },
+  { 0xe7, -1 },
+  { 0x109, -1 },
+  { 0x2a4c, -1 },
+  { 0x2a50, -1 },
+  { 0x10b, -1 },
+  { 0x29b2, -1 },
+  { 0xa2, -1 },
+  { 0x1d520, -1 },
+  { 0x447, -1 },
+  { 0x2713, -1 },
+  { 0x3c7, -1 },
+  { 0x25cb, -1 },
+  { 0x29c3, -1 },
+  { 0x2c6, -1 },
+  { 0x2257, -1 },
+  { 0x21ba, -1 },
+  { 0x21bb, -1 },
+  { 0x24c8, -1 },
+  { 0x229b, -1 },
+  { 0x229a, -1 },
+  { 0x229d, -1 },
+  { 0x2a10, -1 },
+  { 0x2aef, -1 },
+  { 0x29c2, -1 },
+  { 0x2663, -1 },
+  { 0x3a, -1 },
+  { 0x2c, -1 },
+  { 0x40, -1 },
+  { 0x2201, -1 },
+  { 0x2a6d, -1 },
+  { 0x1d554, -1 },
+  { 0x2117, -1 },
+  { 0x21b5, -1 },
+  { 0x2717, -1 },
+  { 0x1d4b8, -1 },
+  { 0x2acf, -1 },
+  { 0x2ad1, -1 },
+  { 0x2ad0, -1 },
+  { 0x2ad2, -1 },
+  { 0x22ef, -1 },
+  { 0x2938, -1 },
+  { 0x2935, -1 },
+  { 0x22de, -1 },
+  { 0x22df, -1 },
+  { 0x21b6, -1 },
+  { 0x293d, -1 },
+  { 0x222a, -1 },
+  { 0x2a48, -1 },
+  { 0x2a46, -1 },
+  { 0x2a4a, -1 },
+  { 0x228d, -1 },
+  { 0x2a45, -1 },
+  { 0x222a, 0xfe00 },
+  { 0x21b7, -1 },
+  { 0x293c, -1 },
+  { 0x22ce, -1 },
+  { 0x22cf, -1 },
+  { 0xa4, -1 },
+  { 0x2231, -1 },
+  { 0x232d, -1 },
+  { 0x2965, -1 },
+  { 0x2020, -1 },
+  { 0x2138, -1 },
+  { 0x2010, -1 },
+  { 0x290f, -1 },
+  { 0x10f, -1 },
+  { 0x434, -1 },
+  { 0x21ca, -1 },
+  { 0x2a77, -1 },
+  { 0xb0, -1 },
+  { 0x3b4, -1 },
+  { 0x29b1, -1 },
+  { 0x297f, -1 },
+  { 0x1d521, -1 },
+  { 0x2666, -1 },
+  { 0x3dd, -1 },
+  { 0x22f2, -1 },
+  { 0xf7, -1 },
+  { 0x22c7, -1 },
+  { 0x452, -1 },
+  { 0x231e, -1 },
+  { 0x230d, -1 },
+  { 0x24, -1 },
+  { 0x1d555, -1 },
+  { 0x2251, -1 },
+  { 0x2238, -1 },
+  { 0x2214, -1 },
+  { 0x22a1, -1 },
+  { 0x231f, -1 },
+  { 0x230c, -1 },
+  { 0x1d4b9, -1 },
+  { 0x455, -1 },
+  { 0x29f6, -1 },
+  { 0x111, -1 },
+  { 0x22f1, -1 },
+  { 0x25bf, -1 },
+  { 0x29a6, -1 },
+  { 0x45f, -1 },
+  { 0x27ff, -1 },
+  { 0xe9, -1 },
+  { 0x2a6e, -1 },
+  { 0x11b, -1 },
+  { 0x2256, -1 },
+  { 0xea, -1 },
+  { 0x2255, -1 },
+  { 0x44d, -1 },
+  { 0x117, -1 },
+  { 0x2252, -1 },
+  { 0x1d522, -1 },
+  { 0x2a9a, -1 },
+  { 0xe8, -1 },
+  { 0x2a96, -1 },
+  { 0x2a98, -1 },
+  { 0x2a99, -1 },
+  { 0x23e7, -1 },
+  { 0x2113, -1 },
+  { 0x2a95, -1 },
+  { 0x2a97, -1 },
+  { 0x113, -1 },
+  { 0x2205, -1 },
+  { 0x2004, -1 },
+  { 0x2005, -1 },
+  { 0x2003, -1 },
+  { 0x14b, -1 },
+  { 0x2002, -1 },
+  { 0x119, -1 },
+  { 0x1d556, -1 },
+  { 0x22d5, -1 },
+  { 0x29e3, -1 },
+  { 0x2a71, -1 },
+  { 0x3b5, -1 },
+  { 0x3f5, -1 },
+  { 0x3d, -1 },
+  { 0x225f, -1 },
+  { 0x2a78, -1 },
+  { 0x29e5, -1 },
+  { 0x2253, -1 },
+  { 0x2971, -1 },
+  { 0x212f, -1 },
+  { 0x3b7, -1 },
+  { 0xf0, -1 },
+  { 0xeb, -1 },
+  { 0x20ac, -1 },
+  { 0x21, -1 },
+  { 0x444, -1 },
+  { 0x2640, -1 },
+  { 0xfb03, -1 },
+  { 0xfb00, -1 },
+  { 0xfb04, -1 },
+  { 0x1d523, -1 },
+  { 0xfb01, -1 },
+  { 0x66, 0x6a },
+  { 0x266d, -1 },
+  { 0xfb02, -1 },
+  { 0x25b1, -1 },
+  { 0x192, -1 },
+  { 0x1d557, -1 },
+  { 0x22d4, -1 },
+  { 0x2ad9, -1 },
+  { 0x2a0d, -1 },
+  { 0xbd, -1 },
+  { 0x2153, -1 },
+  { 0xbc, -1 },
+  { 0x2155, -1 },
+  { 0x2159, -1 },
+  { 0x215b, -1 },
+  { 0x2154, -1 },
+  { 0x2156, -1 },
+  { 0xbe, -1 },
+  { 0x2157, -1 },
+  { 0x215c, -1 },
+  { 0x2158, -1 },
+  { 0x215a, -1 },
+  { 0x215d, -1 },
+  { 0x215e, -1 },
+  { 0x2044, -1 },
+  { 0x2322, -1 },
+  { 0x1d4bb, -1 },
+  { 0x2a8c, -1 },
+  { 0x1f5, -1 },
+  { 0x3b3, -1 },
+  { 0x2a86, -1 },
+  { 0x11f, -1 },
+  { 0x11d, -1 },
+  { 0x433, -1 },
+  { 0x121, -1 },
+  { 0x2aa9, -1 },
+  { 0x2a80, -1 },
+  { 0x2a82, -1 },
+  { 0x2a84, -1 },
+  { 0x22db, 0xfe00 },
+  { 0x2a94, -1 },
+  { 0x1d524, -1 },
+  { 0x2137, -1 },
+  { 0x453, -1 },
+  { 0x2a92, -1 },
+  { 0x2aa5, -1 },
+  { 0x2aa4, -1 },
+  { 0x2269, -1 },
+  { 0x2a8a, -1 },
+  { 0x2a88, -1 },
+  { 0x22e7, -1 },
+  { 0x1d558, -1 },
+  { 0x210a, -1 },
+  { 0x2a8e, -1 },
+  { 0x2a90, -1 },
+  { 0x2aa7, -1 },
+  { 0x2a7a, -1 },
+  { 0x22d7, -1 },
+  { 0x2995, -1 },
+  { 0x2a7c, -1 },
+  { 0x2978, -1 },
+  { 0x2269, 0xfe00 },
+  { 0x44a, -1 },
+  { 0x2948, -1 },
+  { 0x21ad, -1 },
+  { 0x210f, -1 },
+  { 0x125, -1 },
+  { 0x2665, -1 },
+  { 0x2026, -1 },
+  { 0x22b9, -1 },
+  { 0x1d525, -1 },
+  { 0x2925, -1 },
+  { 0x2926, -1 },
+  { 0x21ff, -1 },
+  { 0x223b, -1 },
+  { 0x21a9, -1 },
+  { 0x21aa, -1 },
+  { 0x1d559, -1 },
+  { 0x2015, -1 },
+  { 0x1d4bd, -1 },
+  { 0x127, -1 },
+  { 0x2043, -1 },
+  { 0xed, -1 },
+  { 0xee, -1 },
+  { 0x438, -1 },
+  { 0x435, -1 },
+  { 0xa1, -1 },
+  { 0x1d526, -1 },
+  { 0xec, -1 },
+  { 0x2a0c, -1 },
+  { 0x222d, -1 },
+  { 0x29dc, -1 },
+  { 0x2129, -1 },
+  { 0x133, -1 },
+  { 0x12b, -1 },
+  { 0x131, -1 },
+  { 0x22b7, -1 },
+  { 0x1b5, -1 },
+  { 0x2105, -1 },
+  { 0x221e, -1 },
+  { 0x29dd, -1 },
+  { 0x22ba, -1 },
+  { 0x2a17, -1 },
+  { 0x2a3c, -1 },
+  { 0x451, -1 },
+  { 0x12f, -1 },
+  { 0x1d55a, -1 },
+  { 0x3b9, -1 },
+  { 0xbf, -1 },
+  { 0x1d4be, -1 },
+  { 0x22f9, -1 },
+  { 0x22f5, -1 },
+  { 0x22f4, -1 },
+  { 0x22f3, -1 },
+  { 0x129, -1 },
+  { 0x456, -1 },
+  { 0xef, -1 },
+  { 0x135, -1 },
+  { 0x439, -1 },
+  { 0x1d527, -1 },
+  { 0x237, -1 },
+  { 0x1d55b, -1 },
+  { 0x1d4bf, -1 },
+  { 0x458, -1 },
+  { 0x454, -1 },
+  { 0x3ba, -1 },
+  { 0x3f0, -1 },
+  { 0x137, -1 },
+  { 0x43a, -1 },
+  { 0x1d528, -1 },
+  { 0x138, -1 },
+  { 0x445, -1 },
+  { 0x45c, -1 },
+  { 0x1d55c, -1 },
+  { 0x1d4c0, -1 },
+  { 0x291b, -1 },
+  { 0x290e, -1 },
+  { 0x2a8b, -1 },
+  { 0x2962, -1 },
+  { 0x13a, -1 },
+  { 0x29b4, -1 },
+  { 0x3bb, -1 },
+  { 0x2991, -1 },
+  { 0x2a85, -1 },
+  { 0xab, -1 },
+  { 0x291f, -1 },
+  { 0x291d, -1 },
+  { 0x21ab, -1 },
+  { 0x2939, -1 },
+  { 0x2973, -1 },
+  { 0x21a2, -1 },
+  { 0x2aab, -1 },
+  { 0x2919, -1 },
+  { 0x2aad, -1 },
+  { 0x2aad, 0xfe00 },
+  { 0x290c, -1 },
+  { 0x2772, -1 },
+  { 0x7b, -1 },
+  { 0x5b, -1 },
+  { 0x298b, -1 },
+  { 0x298f, -1 },
+  { 0x298d, -1 },
+  { 0x13e, -1 },
+  { 0x13c, -1 },
+  { 0x43b, -1 },
+  { 0x2936, -1 },
+  { 0x2967, -1 },
+  { 0x294b, -1 },
+  { 0x21b2, -1 },
+  { 0x2264, -1 },
+  { 0x21c7, -1 },
+  { 0x22cb, -1 },
+  { 0x2aa8, -1 },
+  { 0x2a7f, -1 },
+  { 0x2a81, -1 },
+  { 0x2a83, -1 },
+  { 0x22da, 0xfe00 },
+  { 0x2a93, -1 },
+  { 0x22d6, -1 },
+  { 0x297c, -1 },
+  { 0x1d529, -1 },
+  { 0x2a91, -1 },
+  { 0x296a, -1 },
+  { 0x2584, -1 },
+  { 0x459, -1 },
+  { 0x296b, -1 },
+  { 0x25fa, -1 },
+  { 0x140, -1 },
+  { 0x23b0, -1 },
+  { 0x2268, -1 },
+  { 0x2a89, -1 },
+  { 0x2a87, -1 },
+  { 0x22e6, -1 },
+  { 0x27ec, -1 },
+  { 0x21fd, -1 },
+  { 0x27fc, -1 },
+  { 0x21ac, -1 },
+  { 0x2985, -1 },
+  { 0x1d55d, -1 },
+  { 0x2a2d, -1 },
+  { 0x2a34, -1 },
+  { 0x2217, -1 },
+  { 0x25ca, -1 },
+  { 0x28, -1 },
+  { 0x2993, -1 },
+  { 0x296d, -1 },
+  { 0x200e, -1 },
+  { 0x22bf, -1 },
+  { 0x2039, -1 },
+  { 0x1d4c1, -1 },
+  { 0x2a8d, -1 },
+  { 0x2a8f, -1 },
+  { 0x201a, -1 },
+  { 0x142, -1 },
+  { 0x2aa6, -1 },
+  { 0x2a79, -1 },
+  { 0x22c9, -1 },
+  { 0x2976, -1 },
+  { 0x2a7b, -1 },
+  { 0x2996, -1 },
+  { 0x25c3, -1 },
+  { 0x294a, -1 },
+  { 0x2966, -1 },
+  { 0x2268, 0xfe00 },
+  { 0x223a, -1 },
+  { 0xaf, -1 },
+  { 0x2642, -1 },
+  { 0x2720, -1 },
+  { 0x25ae, -1 },
+  { 0x2a29, -1 },
+  { 0x43c, -1 },
+  { 0x2014, -1 },
+  { 0x1d52a, -1 },
+  { 0x2127, -1 },
+  { 0xb5, -1 },
+  { 0x2af0, -1 },
+  { 0x2212, -1 },
+  { 0x2a2a, -1 },
+  { 0x2adb, -1 },
+  { 0x22a7, -1 },
+  { 0x1d55e, -1 },
+  { 0x1d4c2, -1 },
+  { 0x3bc, -1 },
+  { 0x22b8, -1 },
+  { 0x22d9, 0x338 },
+  { 0x226b, 0x20d2 },
+  { 0x21cd, -1 },
+  { 0x21ce, -1 },
+  { 0x22d8, 0x338 },
+  { 0x226a, 0x20d2 },
+  { 0x21cf, -1 },
+  { 0x22af, -1 },
+  { 0x22ae, -1 },
+  { 0x144, -1 },
+  { 0x2220, 0x20d2 },
+  { 0x2a70, 0x338 },
+  { 0x224b, 0x338 },
+  { 0x149, -1 },
+  { 0x266e, -1 },
+  { 0x2a43, -1 },
+  { 0x148, -1 },
+  { 0x146, -1 },
+  { 0x2a6d, 0x338 },
+  { 0x2a42, -1 },
+  { 0x43d, -1 },
+  { 0x2013, -1 },
+  { 0x21d7, -1 },
+  { 0x2924, -1 },
+  { 0x2250, 0x338 },
+  { 0x2928, -1 },
+  { 0x1d52b, -1 },
+  { 0x21ae, -1 },
+  { 0x2af2, -1 },
+  { 0x22fc, -1 },
+  { 0x22fa, -1 },
+  { 0x45a, -1 },
+  { 0x2266, 0x338 },
+  { 0x219a, -1 },
+  { 0x2025, -1 },
+  { 0x1d55f, -1 },
+  { 0xac, -1 },
+  { 0x22f9, 0x338 },
+  { 0x22f5, 0x338 },
+  { 0x22f7, -1 },
+  { 0x22f6, -1 },
+  { 0x22fe, -1 },
+  { 0x22fd, -1 },
+  { 0x2afd, 0x20e5 },
+  { 0x2202, 0x338 },
+  { 0x2a14, -1 },
+  { 0x219b, -1 },
+  { 0x2933, 0x338 },
+  { 0x219d, 0x338 },
+  { 0x1d4c3, -1 },
+  { 0x2284, -1 },
+  { 0x2ac5, 0x338 },
+  { 0x2285, -1 },
+  { 0x2ac6, 0x338 },
+  { 0xf1, -1 },
+  { 0x3bd, -1 },
+  { 0x23, -1 },
+  { 0x2116, -1 },
+  { 0x2007, -1 },
+  { 0x22ad, -1 },
+  { 0x2904, -1 },
+  { 0x224d, 0x20d2 },
+  { 0x22ac, -1 },
+  { 0x2265, 0x20d2 },
+  { 0x3e, 0x20d2 },
+  { 0x29de, -1 },
+  { 0x2902, -1 },
+  { 0x2264, 0x20d2 },
+  { 0x3c, 0x20d2 },
+  { 0x22b4, 0x20d2 },
+  { 0x2903, -1 },
+  { 0x22b5, 0x20d2 },
+  { 0x223c, 0x20d2 },
+  { 0x21d6, -1 },
+  { 0x2923, -1 },
+  { 0x2927, -1 },
+  { 0xf3, -1 },
+  { 0xf4, -1 },
+  { 0x43e, -1 },
+  { 0x151, -1 },
+  { 0x2a38, -1 },
+  { 0x29bc, -1 },
+  { 0x153, -1 },
+  { 0x29bf, -1 },
+  { 0x1d52c, -1 },
+  { 0x2db, -1 },
+  { 0xf2, -1 },
+  { 0x29c1, -1 },
+  { 0x29b5, -1 },
+  { 0x29be, -1 },
+  { 0x29bb, -1 },
+  { 0x29c0, -1 },
+  { 0x14d, -1 },
+  { 0x3c9, -1 },
+  { 0x3bf, -1 },
+  { 0x29b6, -1 },
+  { 0x1d560, -1 },
+  { 0x29b7, -1 },
+  { 0x29b9, -1 },
+  { 0x2228, -1 },
+  { 0x2a5d, -1 },
+  { 0x2134, -1 },
+  { 0xaa, -1 },
+  { 0xba, -1 },
+  { 0x22b6, -1 },
+  { 0x2a56, -1 },
+  { 0x2a57, -1 },
+  { 0x2a5b, -1 },
+  { 0xf8, -1 },
+  { 0x2298, -1 },
+  { 0xf5, -1 },
+  { 0x2a36, -1 },
+  { 0xf6, -1 },
+  { 0x233d, -1 },
+  { 0xb6, -1 },
+  { 0x2af3, -1 },
+  { 0x2afd, -1 },
+  { 0x43f, -1 },
+  { 0x25, -1 },
+  { 0x2e, -1 },
+  { 0x2030, -1 },
+  { 0x2031, -1 },
+  { 0x1d52d, -1 },
+  { 0x3c6, -1 },
+  { 0x3d5, -1 },
+  { 0x260e, -1 },
+  { 0x3c0, -1 },
+  { 0x3d6, -1 },
+  { 0x210e, -1 },
+  { 0x2b, -1 },
+  { 0x2a23, -1 },
+  { 0x2a22, -1 },
+  { 0x2a25, -1 },
+  { 0x2a72, -1 },
+  { 0x2a26, -1 },
+  { 0x2a27, -1 },
+  { 0x2a15, -1 },
+  { 0x1d561, -1 },
+  { 0xa3, -1 },
+  { 0x2ab3, -1 },
+  { 0x2ab7, -1 },
+  { 0x2ab9, -1 },
+  { 0x2ab5, -1 },
+  { 0x22e8, -1 },
+  { 0x2032, -1 },
+  { 0x232e, -1 },
+  { 0x2312, -1 },
+  { 0x2313, -1 },
+  { 0x22b0, -1 },
+  { 0x1d4c5, -1 },
+  { 0x3c8, -1 },
+  { 0x2008, -1 },
+  { 0x1d52e, -1 },
+  { 0x1d562, -1 },
+  { 0x2057, -1 },
+  { 0x1d4c6, -1 },
+  { 0x2a16, -1 },
+  { 0x3f, -1 },
+  { 0x291c, -1 },
+  { 0x2964, -1 },
+  { 0x223d, 0x331 },
+  { 0x155, -1 },
+  { 0x29b3, -1 },
+  { 0x2992, -1 },
+  { 0x29a5, -1 },
+  { 0xbb, -1 },
+  { 0x2975, -1 },
+  { 0x2920, -1 },
+  { 0x2933, -1 },
+  { 0x291e, -1 },
+  { 0x2945, -1 },
+  { 0x2974, -1 },
+  { 0x21a3, -1 },
+  { 0x219d, -1 },
+  { 0x291a, -1 },
+  { 0x2236, -1 },
+  { 0x2773, -1 },
+  { 0x7d, -1 },
+  { 0x5d, -1 },
+  { 0x298c, -1 },
+  { 0x298e, -1 },
+  { 0x2990, -1 },
+  { 0x159, -1 },
+  { 0x157, -1 },
+  { 0x440, -1 },
+  { 0x2937, -1 },
+  { 0x2969, -1 },
+  { 0x21b3, -1 },
+  { 0x25ad, -1 },
+  { 0x297d, -1 },
+  { 0x1d52f, -1 },
+  { 0x296c, -1 },
+  { 0x3c1, -1 },
+  { 0x3f1, -1 },
+  { 0x21c9, -1 },
+  { 0x22cc, -1 },
+  { 0x2da, -1 },
+  { 0x200f, -1 },
+  { 0x23b1, -1 },
+  { 0x2aee, -1 },
+  { 0x27ed, -1 },
+  { 0x21fe, -1 },
+  { 0x2986, -1 },
+  { 0x1d563, -1 },
+  { 0x2a2e, -1 },
+  { 0x2a35, -1 },
+  { 0x29, -1 },
+  { 0x2994, -1 },
+  { 0x2a12, -1 },
+  { 0x203a, -1 },
+  { 0x1d4c7, -1 },
+  { 0x22ca, -1 },
+  { 0x25b9, -1 },
+  { 0x29ce, -1 },
+  { 0x2968, -1 },
+  { 0x211e, -1 },
+  { 0x15b, -1 },
+  { 0x2ab4, -1 },
+  { 0x2ab8, -1 },
+  { 0x161, -1 },
+  { 0x15f, -1 },
+  { 0x15d, -1 },
+  { 0x2ab6, -1 },
+  { 0x2aba, -1 },
+  { 0x22e9, -1 },
+  { 0x2a13, -1 },
+  { 0x441, -1 },
+  { 0x22c5, -1 },
+  { 0x2a66, -1 },
+  { 0x21d8, -1 },
+  { 0xa7, -1 },
+  { 0x3b, -1 },
+  { 0x2929, -1 },
+  { 0x2736, -1 },
+  { 0x1d530, -1 },
+  { 0x266f, -1 },
+  { 0x449, -1 },
+  { 0x448, -1 },
+  { 0xad, -1 },
+  { 0x3c3, -1 },
+  { 0x3c2, -1 },
+  { 0x2a6a, -1 },
+  { 0x2a9e, -1 },
+  { 0x2aa0, -1 },
+  { 0x2a9d, -1 },
+  { 0x2a9f, -1 },
+  { 0x2246, -1 },
+  { 0x2a24, -1 },
+  { 0x2972, -1 },
+  { 0x2a33, -1 },
+  { 0x29e4, -1 },
+  { 0x2323, -1 },
+  { 0x2aaa, -1 },
+  { 0x2aac, -1 },
+  { 0x2aac, 0xfe00 },
+  { 0x44c, -1 },
+  { 0x2f, -1 },
+  { 0x29c4, -1 },
+  { 0x233f, -1 },
+  { 0x1d564, -1 },
+  { 0x2660, -1 },
+  { 0x2293, 0xfe00 },
+  { 0x2294, 0xfe00 },
+  { 0x1d4c8, -1 },
+  { 0x2606, -1 },
+  { 0x2282, -1 },
+  { 0x2ac5, -1 },
+  { 0x2abd, -1 },
+  { 0x2ac3, -1 },
+  { 0x2ac1, -1 },
+  { 0x2acb, -1 },
+  { 0x228a, -1 },
+  { 0x2abf, -1 },
+  { 0x2979, -1 },
+  { 0x2ac7, -1 },
+  { 0x2ad5, -1 },
+  { 0x2ad3, -1 },
+  { 0x266a, -1 },
+  { 0xb9, -1 },
+  { 0xb2, -1 },
+  { 0xb3, -1 },
+  { 0x2ac6, -1 },
+  { 0x2abe, -1 },
+  { 0x2ad8, -1 },
+  { 0x2ac4, -1 },
+  { 0x27c9, -1 },
+  { 0x2ad7, -1 },
+  { 0x297b, -1 },
+  { 0x2ac2, -1 },
+  { 0x2acc, -1 },
+  { 0x228b, -1 },
+  { 0x2ac0, -1 },
+  { 0x2ac8, -1 },
+  { 0x2ad4, -1 },
+  { 0x2ad6, -1 },
+  { 0x21d9, -1 },
+  { 0x292a, -1 },
+  { 0xdf, -1 },
+  { 0x2316, -1 },
+  { 0x3c4, -1 },
+  { 0x165, -1 },
+  { 0x163, -1 },
+  { 0x442, -1 },
+  { 0x2315, -1 },
+  { 0x1d531, -1 },
+  { 0x3b8, -1 },
+  { 0x3d1, -1 },
+  { 0xfe, -1 },
+  { 0xd7, -1 },
+  { 0x2a31, -1 },
+  { 0x2a30, -1 },
+  { 0x2336, -1 },
+  { 0x2af1, -1 },
+  { 0x1d565, -1 },
+  { 0x2ada, -1 },
+  { 0x2034, -1 },
+  { 0x25b5, -1 },
+  { 0x225c, -1 },
+  { 0x25ec, -1 },
+  { 0x2a3a, -1 },
+  { 0x2a39, -1 },
+  { 0x29cd, -1 },
+  { 0x2a3b, -1 },
+  { 0x23e2, -1 },
+  { 0x1d4c9, -1 },
+  { 0x446, -1 },
+  { 0x45b, -1 },
+  { 0x167, -1 },
+  { 0x2963, -1 },
+  { 0xfa, -1 },
+  { 0x45e, -1 },
+  { 0x16d, -1 },
+  { 0xfb, -1 },
+  { 0x443, -1 },
+  { 0x171, -1 },
+  { 0x297e, -1 },
+  { 0x1d532, -1 },
+  { 0xf9, -1 },
+  { 0x2580, -1 },
+  { 0x231c, -1 },
+  { 0x230f, -1 },
+  { 0x25f8, -1 },
+  { 0x16b, -1 },
+  { 0x173, -1 },
+  { 0x1d566, -1 },
+  { 0x3c5, -1 },
+  { 0x21c8, -1 },
+  { 0x231d, -1 },
+  { 0x230e, -1 },
+  { 0x16f, -1 },
+  { 0x25f9, -1 },
+  { 0x1d4ca, -1 },
+  { 0x22f0, -1 },
+  { 0x169, -1 },
+  { 0xfc, -1 },
+  { 0x29a7, -1 },
+  { 0x2ae8, -1 },
+  { 0x2ae9, -1 },
+  { 0x299c, -1 },
+  { 0x228a, 0xfe00 },
+  { 0x2acb, 0xfe00 },
+  { 0x228b, 0xfe00 },
+  { 0x2acc, 0xfe00 },
+  { 0x432, -1 },
+  { 0x22bb, -1 },
+  { 0x225a, -1 },
+  { 0x22ee, -1 },
+  { 0x1d533, -1 },
+  { 0x1d567, -1 },
+  { 0x1d4cb, -1 },
+  { 0x299a, -1 },
+  { 0x175, -1 },
+  { 0x2a5f, -1 },
+  { 0x2259, -1 },
+  { 0x2118, -1 },
+  { 0x1d534, -1 },
+  { 0x1d568, -1 },
+  { 0x1d4cc, -1 },
+  { 0x1d535, -1 },
+  { 0x3be, -1 },
+  { 0x22fb, -1 },
+  { 0x1d569, -1 },
+  { 0x1d4cd, -1 },
+  { 0xfd, -1 },
+  { 0x44f, -1 },
+  { 0x177, -1 },
+  { 0x44b, -1 },
+  { 0xa5, -1 },
+  { 0x1d536, -1 },
+  { 0x457, -1 },
+  { 0x1d56a, -1 },
+  { 0x1d4ce, -1 },
+  { 0x44e, -1 },
+  { 0xff, -1 },
+  { 0x17a, -1 },
+  { 0x17e, -1 },
+  { 0x437, -1 },
+  { 0x17c, -1 },
+  { 0x3b6, -1 },
+  { 0x1d537, -1 },
+  { 0x436, -1 },
+  { 0x21dd, -1 },
+  { 0x1d56b, -1 },
+  { 0x1d4cf, -1 },
+  { 0x200d, -1 },
+  { 0x200c, -1 },
+};
@@ -156,9 +156,15 @@ static const char* find_next_newline(const char* error_location) {
 }
 
 GumboError* gumbo_add_error(GumboParser* parser) {
-  unsigned int max_errors = parser->_options->max_errors;
-  if (parser->_options->max_errors >= 0 &&
-      parser->_output->errors.length >= max_errors) {
+  const GumboOptions* options = parser->_options;
+  if (options->error_mode == GUMBO_ERRORS_NONE) {
+    return NULL;
+  }
+  ++parser->_output->error_count;
+  unsigned int max_errors = options->max_errors;
+  if (options->error_mode == GUMBO_ERRORS_COUNT ||
+      (options->max_errors >= 0 &&
+          parser->_output->errors.length >= max_errors)) {
     return NULL;
   }
   GumboError* error = gumbo_malloc(sizeof(GumboError));
@@ -266,7 +272,9 @@ void gumbo_error_destroy(GumboError* error) {
 }
 
 void gumbo_init_errors(GumboParser* parser) {
-  gumbo_vector_init(5, &parser->_output->errors);
+  bool is_recording = parser->_options->error_mode == GUMBO_ERRORS_FULL;
+  gumbo_vector_init(is_recording ? 5 : 0, &parser->_output->errors);
+  parser->_output->error_count = 0;
 }
 
 void gumbo_destroy_errors(GumboParser* parser) {
@@ -183,8 +183,10 @@ typedef struct GumboInternalError {
 } GumboError;
 
 // Adds a new error to the parser's error list, and returns a pointer to it so
-// that clients can fill out the rest of its fields.  May return NULL if we're
-// already over the max_errors field specified in GumboOptions.
+// that clients can fill out the rest of its fields.  Returns NULL, having done
+// no more than count the error, if the error_mode in GumboOptions isn't
+// GUMBO_ERRORS_FULL or we're already over its max_errors field, so callers
+// should build anything that only goes into the error after checking.
 GumboError* gumbo_add_error(struct GumboInternalParser* parser);
 
 // Initializes the errors vector in the parser.
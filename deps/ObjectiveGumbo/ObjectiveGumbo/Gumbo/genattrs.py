@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+# Generates attr_enum.h, attr_strings.h, attr_sizes.h and attr_perf.h from
+# attr.in, as a hash-and-displace perfect hash over lowercased attribute names.
+# Must stay in sync with attr_hash() and attr_slot() in attribute.c.
+import sys
+
+TABLE_BITS = 8
+BUCKET_BITS = 6
+
+
+def attr_hash(name):
+    h = 2166136261
+    for c in name.lower().encode('ascii'):
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+
+def attr_slot(hash, displacement):
+    mixed = (hash ^ ((displacement * 0x9e3779b9) & 0xffffffff)) * 0x85ebca6b
+    return (mixed & 0xffffffff) >> (32 - TABLE_BITS)
+
+
+def build(names):
+    size, buckets = 1 << TABLE_BITS, 1 << BUCKET_BITS
+    groups = [[] for _ in range(buckets)]
+    for i, name in enumerate(names):
+        groups[attr_hash(name) & (buckets - 1)].append(i)
+
+    displacements = [0] * buckets
+    slots = [None] * size
+    for b in sorted(range(buckets), key=lambda b: -len(groups[b])):
+        if not groups[b]:
+            continue
+        for d in range(1 << 16):
+            wanted = [attr_slot(attr_hash(names[i]), d) for i in groups[b]]
+            if len(set(wanted)) == len(wanted) and \
+                    all(slots[w] is None for w in wanted):
+                for w, i in zip(wanted, groups[b]):
+                    slots[w] = i
+                displacements[b] = d
+                break
+        else:
+            sys.exit('no displacement for bucket %d' % b)
+    return displacements, slots
+
+
+def ident(name):
+    return 'GUMBO_ATTRIBUTE_' + name.upper().replace('-', '_').replace(':', '_')
+
+
+def main(directory):
+    names = [line.strip() for line in open(directory + '/attr.in')
+             if line.strip()]
+    displacements, slots = build(names)
+    header = '// Do not edit\n// Generated from attr.in (see genattrs.py)\n\n'
+
+    with open(directory + '/attr_enum.h', 'w') as f:
+        f.write(header + ''.join('%s,\n' % ident(n) for n in names))
+    with open(directory + '/attr_strings.h', 'w') as f:
+        f.write(header + ''.join('"%s",\n' % n for n in names))
+    with open(directory + '/attr_sizes.h', 'w') as f:
+        f.write(header + ', '.join(str(len(n)) for n in names) + ', \n')
+    with open(directory + '/attr_perf.h', 'w') as f:
+        f.write(header)
+        f.write('#define ATTR_TABLE_BITS %d\n' % TABLE_BITS)
+        f.write('#define ATTR_BUCKET_BITS %d\n\n' % BUCKET_BITS)
+        f.write('static const uint16_t kGumboAttributeDisplacements[] = {\n')
+        for i in range(0, len(displacements), 10):
+            row = displacements[i:i + 10]
+            f.write('  ' + ', '.join('%5d' % d for d in row) + ',\n')
+        f.write('};\n\nstatic const GumboAttributeName kGumboAttributeMap[] = {\n')
+        for s in slots:
+            f.write('  %s,\n' % (ident(names[s]) if s is not None
+                                 else 'GUMBO_ATTRIBUTE_LAST'))
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main(sys.argv[1] if len(sys.argv) > 1 else '.')
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+# Generates char_ref_trie.h from char_ref.in, as a double-array trie over the
+# named character references.  Each line of char_ref.in is a reference name
+# (with its trailing semicolon, if any) and one or two hex codepoints.
+#
+# A state s moves on byte c to t = base[s] + code(c) when check[t] == s.  Index
+# 0 is never a state, so free slots have check 0; the root is CHAR_REF_ROOT.
+# The table is padded so that base + code never runs off its end.
+import sys
+
+ROOT = 1
+
+
+def build(entries):
+    alphabet = sorted({c for name, _ in entries for c in name})
+    code = {c: i + 1 for i, c in enumerate(alphabet)}
+    assert len(alphabet) < 256
+
+    values, value_index = [], {}
+    children, terminal = [{}], [0]
+    for name, value in entries:
+        if value not in value_index:
+            values.append(value)
+            value_index[value] = len(values)
+        node = 0
+        for c in name:
+            if c not in children[node]:
+                children.append({})
+                terminal.append(0)
+                children[node][c] = len(children) - 1
+            node = children[node][c]
+        terminal[node] = value_index[value]
+
+    slot = {0: ROOT}
+    base, check, value = {}, {ROOT: 0}, {}
+    used = {ROOT}
+    low = ROOT + 1
+    queue = [0]
+    for node in queue:
+        codes = sorted(code[c] for c in children[node])
+        b = 0
+        if codes:
+            while low in used:
+                low += 1
+            b = max(low - codes[0], 0)
+            while any(b + k in used for k in codes):
+                b += 1
+        s = slot[node]
+        base[s] = b
+        value[s] = terminal[node]
+        for c, child in sorted(children[node].items()):
+            t = b + code[c]
+            used.add(t)
+            check[t] = s
+            slot[child] = t
+            queue.append(child)
+
+    size = max(max(base.values()) + len(alphabet) + 1, max(used) + 1)
+    assert size < 1 << 16 and len(values) < 1 << 16
+    table = [(base.get(i, 0), check.get(i, 0), value.get(i, 0))
+             for i in range(size)]
+    return alphabet, code, table, values
+
+
+def main(directory):
+    entries = []
+    for line in open(directory + '/char_ref.in'):
+        fields = line.split()
+        if fields:
+            codepoints = [int(f, 16) for f in fields[1:]] + [-1]
+            entries.append((fields[0], tuple(codepoints[:2])))
+    alphabet, code, table, values = build(entries)
+
+    with open(directory + '/char_ref_trie.h', 'w') as f:
+        f.write('// Do not edit\n// Generated from char_ref.in '
+                '(see gencharrefs.py)\n\n')
+        f.write('#define CHAR_REF_ROOT %d\n\n' % ROOT)
+        f.write('static const uint8_t kCharRefAlphabet[256] = {\n')
+        row = [code.get(chr(i), 0) for i in range(256)]
+        for i in range(0, 256, 16):
+            f.write('  ' + ', '.join('%2d' % c for c in row[i:i + 16]) +
+                    ',\n')
+        f.write('};\n\n// { base, check, value }\n')
+        f.write('static const CharRefTrieNode kCharRefTrie[] = {\n')
+        for i in range(0, len(table), 4):
+            f.write('  ' + ' '.join('{ %d, %d, %d },' % t
+                                    for t in table[i:i + 4]) + '\n')
+        f.write('};\n\n// Indexed by value - 1\n')
+        f.write('static const OneOrTwoCodepoints kCharRefValues[] = {\n')
+        for first, second in values:
+            # -1 is kGumboNoChar, which is not a constant expression
+            f.write('  { 0x%x, %s },\n' % (
+                first, '-1' if second < 0 else '0x%x' % second))
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main(sys.argv[1] if len(sys.argv) > 1 else '.')
@@ -208,6 +208,36 @@ const char* gumbo_normalize_svg_tagname(const GumboStringPiece* tagname);
 GumboTag gumbo_tag_enum(const char* tagname);
 GumboTag gumbo_tagn_enum(const char* tagname, unsigned int length);
 
+/**
+ * An enum for the attribute names that HTML documents commonly use, plus every
+ * name the parser itself asks about.  Attribute names are interned to one of
+ * these when they are tokenized, so that looking an attribute up by name is an
+ * integer comparison rather than a strcasecmp.  Anything else is
+ * GUMBO_ATTRIBUTE_UNKNOWN and is matched by name.
+ */
+typedef enum {
+  // Load all the attribute names from an external source, generated from
+  // attr.in.
+# include "attr_enum.h"
+  // Used for all attribute names not listed in attr.in.
+  GUMBO_ATTRIBUTE_UNKNOWN,
+  // A marker value to indicate the end of the enum.
+  GUMBO_ATTRIBUTE_LAST,
+} GumboAttributeName;
+
+/**
+ * Returns the lowercased name for a GumboAttributeName enum.  Return value is
+ * static data owned by the library.
+ */
+const char* gumbo_normalized_attribute_name(GumboAttributeName name);
+
+/**
+ * Converts an attribute name string (which may be in upper or mixed case) to
+ * an attribute enum.  The non-`n` version expects `name` to be NULL-terminated.
+ */
+GumboAttributeName gumbo_attribute_enum(const char* name);
+GumboAttributeName gumbo_attributen_enum(const char* name, unsigned int length);
+
 /**
  * Attribute namespaces.
  * HTML includes special handling for XLink, XML, and XMLNS namespaces on
@@ -220,6 +250,12 @@ typedef enum {
   GUMBO_ATTR_NAMESPACE_XMLNS,
 } GumboAttributeNamespaceEnum;
 
+/**
+ * Slab storage that a parse carves its tree from, and which is released with
+ * the GumboOutput.  Opaque to clients.
+ */
+typedef struct GumboInternalPool GumboPool;
+
 /**
  * A struct representing a single attribute on an HTML tag.  This is a
  * name-value pair, but also includes information about source locations and
@@ -279,6 +315,19 @@ typedef struct {
 
   /** The ending position of the attribute value. */
   GumboSourcePosition value_end;
+
+  /**
+   * The interned form of name, or GUMBO_ATTRIBUTE_UNKNOWN.  This always
+   * matches name case-insensitively, so anything that renames an attribute
+   * must update it.
+   */
+  GumboAttributeName name_atom;
+
+  /**
+   * The pool this attribute and its strings were carved from, or NULL if they
+   * were allocated individually.  Not owned.
+   */
+  GumboPool* pool;
 } GumboAttribute;
 
 /**
@@ -288,6 +337,13 @@ typedef struct {
  */
 GumboAttribute* gumbo_get_attribute(const GumboVector* attrs, const char* name);
 
+/**
+ * As gumbo_get_attribute, for a name that has already been interned.  This
+ * must not be passed GUMBO_ATTRIBUTE_UNKNOWN.
+ */
+GumboAttribute* gumbo_get_attribute_by_atom(
+    const GumboVector* attrs, GumboAttributeName atom);
+
 /**
  * Enum denoting the type of node.  This determines the type of the node.v
  * union.
@@ -468,6 +524,16 @@ typedef struct {
   GumboSourcePosition start_pos;
 } GumboText;
 
+/**
+ * How many children and attributes an element holds without allocating an
+ * array for them.  Most elements have a single child and two attributes or
+ * fewer.  The storage directly follows the vector it belongs to, which is how
+ * vector operations recognize it; a GumboElement that is copied by value has to
+ * have its vectors re-initialized rather than sharing the original's storage.
+ */
+#define GUMBO_ELEMENT_INLINE_CHILDREN 2
+#define GUMBO_ELEMENT_INLINE_ATTRIBUTES 2
+
 /**
  * The struct used to represent all HTML elements.  This contains information
  * about the tag, attributes, and child nodes.
@@ -479,6 +545,12 @@ typedef struct {
    */
   GumboVector /* GumboNode* */ children;
 
+  /**
+   * Storage for the first children, which children.data points to until there
+   * are more of them than fit.  Only the library should touch it.
+   */
+  void* inline_children[GUMBO_ELEMENT_INLINE_CHILDREN];
+
   /** The GumboTag enum for this element. */
   GumboTag tag;
 
@@ -511,6 +583,17 @@ typedef struct {
    * order that they were parsed.  Pointers are owned.
    */
   GumboVector /* GumboAttribute* */ attributes;
+
+  /** Storage for the first attributes, like inline_children. */
+  void* inline_attributes[GUMBO_ELEMENT_INLINE_ATTRIBUTES];
+
+  /**
+   * Parser bookkeeping: this element's position in the stack of open elements
+   * and in the list of active formatting elements, or -1 if it is in neither.
+   * Only meaningful while the tree is being built.
+   */
+  int open_element_index;
+  int formatting_element_index;
 } GumboElement;
 
 /**
@@ -534,7 +617,19 @@ struct GumboInternalNode {
    */
   GumboParseFlags parse_flags;
 
-  /** The actual node data. */
+  /**
+   * The pool this node, its strings and its children and attribute vectors
+   * were carved from, or NULL if they were allocated individually.  Pooled
+   * nodes can only be moved within the tree they were parsed into, and their
+   * vectors must only be grown through the gumbo_edit.h functions.  Not owned.
+   */
+  GumboPool* pool;
+
+  /**
+   * The actual node data.  Pooled text, whitespace, CDATA and comment nodes
+   * are allocated only as large as their GumboText, so never copy a node by
+   * value unless it's an element.
+   */
   union {
     GumboDocument document;      // For GUMBO_NODE_DOCUMENT.
     GumboElement element;        // For GUMBO_NODE_ELEMENT.
@@ -557,6 +652,18 @@ typedef void* (*GumboAllocatorFunction)(void* userdata, size_t size);
  */
 typedef void (*GumboDeallocatorFunction)(void* userdata, void* ptr);
 
+/**
+ * How much the parser keeps of the parse errors it finds.
+ */
+typedef enum {
+  /** Errors are neither recorded nor counted. */
+  GUMBO_ERRORS_NONE,
+  /** Errors are counted in GumboOutput.error_count, but not recorded. */
+  GUMBO_ERRORS_COUNT,
+  /** Errors are counted, and recorded in GumboOutput.errors up to max_errors. */
+  GUMBO_ERRORS_FULL
+} GumboErrorMode;
+
 /**
  * Input struct containing configuration options for the parser.
  * These let you specify alternate memory managers, provide different error
@@ -590,6 +697,27 @@ typedef struct GumboInternalOptions {
    * Default: -1
    */
   int max_errors;
+
+  /**
+   * The number of threads, counting the caller's, that may tokenize a document
+   * at once.  The extra threads each tokenize a part of a large document ahead
+   * of the parser, guessing the tokenizer state at its start, and the parser
+   * takes their tokens wherever the guess turns out right and tokenizes the
+   * rest itself, so the result is the same as with one thread.  Fragments,
+   * documents too small to split and parses that stop on the first error use
+   * the caller's thread alone.
+   * Default: 1
+   */
+  int tokenizer_threads;
+
+  /**
+   * How much to keep of the parse errors.  Building a GumboError means
+   * allocating it and copying out positions, text and the stack of open tags,
+   * which a caller that never looks at the errors can skip with
+   * GUMBO_ERRORS_NONE.  max_errors only applies to GUMBO_ERRORS_FULL.
+   * Default: GUMBO_ERRORS_FULL
+   */
+  GumboErrorMode error_mode;
 } GumboOptions;
 
 /** Default options struct; use this with gumbo_parse_with_options. */
@@ -617,6 +745,18 @@ typedef struct GumboInternalOutput {
    * reported so we can work out something appropriate for your use-case.
    */
   GumboVector /* GumboError */ errors;
+
+  /**
+   * The number of parse errors found, including any past max_errors.  Always 0
+   * with GUMBO_ERRORS_NONE.
+   */
+  unsigned int error_count;
+
+  /**
+   * Storage for the parse tree, or NULL for an output made by
+   * gumbo_new_output_init.
+   */
+  GumboPool* pool;
 } GumboOutput;
 
 /**
@@ -643,13 +783,86 @@ GumboOutput* gumbo_parse_fragment(
     const GumboOptions* options, const char* buffer, size_t length,
     const GumboTag fragment_ctx, const GumboNamespaceEnum fragment_namespace);
 
+/**
+ * Parses a buffer like gumbo_parse_with_options, but into an output returned by
+ * an earlier parse instead of a new one.  The previous tree and errors are
+ * released first, and the storage they were carved from is reused, so a loop
+ * of parses into the same output soon stops allocating for its trees at all.
+ * Returns output.
+ */
+GumboOutput* gumbo_parse_into(GumboOutput* output, const GumboOptions* options,
+    const char* buffer, size_t buffer_length);
+
 /** Release the memory used for the parse tree & parse errors. */
 void gumbo_destroy_output(GumboOutput* output);
 
+/**
+ * A script element found by gumbo_locate_scripts.  Everything but the
+ * attributes points into the buffer that was searched.
+ */
+typedef struct {
+  /** The start tag, from its '<' to its '>'. */
+  GumboStringPiece start_tag;
+
+  /** The source position of the start tag. */
+  GumboSourcePosition start_pos;
+
+  /**
+   * The attributes of the start tag, as they would be on the element.  Their
+   * original_name and original_value give their ranges in the buffer.
+   */
+  GumboVector /* GumboAttribute* */ attributes;
+
+  /**
+   * The text of the script, exactly as it appears in the buffer: no
+   * characters are replaced and no newlines normalized.
+   */
+  GumboStringPiece body;
+
+  /**
+   * The end tag, as GumboElement.original_end_tag gives it: empty, with NULL
+   * data, for a script left open at the end of the buffer, and the start tag
+   * again for a self-closing script under use_xhtml_rules.
+   */
+  GumboStringPiece end_tag;
+} GumboScript;
+
+/** The result of gumbo_locate_scripts. */
+typedef struct GumboInternalScriptList {
+  /** The scripts in the order of their start tags. */
+  GumboVector /* GumboScript* */ scripts;
+
+  /** Storage for the scripts and their attributes. */
+  GumboPool* pool;
+
+  /**
+   * Whether the buffer had markup that the locator doesn't follow, so that it
+   * was parsed in full to find the scripts.
+   */
+  bool parsed_in_full;
+} GumboScriptList;
+
+/**
+ * Finds the HTML script elements that a parse of the buffer would create,
+ * without building a tree: only the tokenizer runs, along with the few parts
+ * of the tree builder's state that decide which start tags become scripts and
+ * how the text after them is tokenized.  A buffer with markup those don't
+ * cover is parsed in full instead.  Scripts in SVG, which don't contain script
+ * text, are not included, and no parse errors are recorded.
+ */
+GumboScriptList* gumbo_locate_scripts(
+    const GumboOptions* options, const char* buffer, size_t buffer_length);
+
+/** Release the memory used by the result of gumbo_locate_scripts. */
+void gumbo_destroy_script_list(GumboScriptList* scripts);
+
 /** Allocate a new freestanding node */
 GumboNode *gumbo_create_node(GumboNodeType type);
 
-/** Release the memory used for a single node */
+/**
+ * Release the memory used for a single node and its descendants.  Pooled
+ * storage among them goes back to its pool for reuse rather than being freed.
+ */
 void gumbo_destroy_node(GumboNode *node);
 
 /**
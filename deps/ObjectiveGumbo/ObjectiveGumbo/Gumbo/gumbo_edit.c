@@ -21,6 +21,7 @@
 
 #include "attribute.h"
 #include "gumbo.h"
+#include "pool.h"
 #include "utf8.h"
 #include "util.h"
 #include "vector.h"
@@ -39,16 +40,10 @@
  * void gumbo_element_remove_attribute(GumboElement *element, GumboAttribute
  *attr);
 
- * void gumbo_vector_init(size_t initial_capacity, GumboVector* vector);
- * void gumbo_vector_destroy(GumboVector* vector);
- * void gumbo_vector_add(void* element, GumboVector* vector);
  * void* gumbo_vector_pop(GumboVector* vector);
- * void gumbo_vector_insert_at(void* element, int index, GumboVector* vector);
  * void gumbo_vector_remove(const void* element, GumboVector* vector);
  * void* gumbo_vector_remove_at(int index, GumboVector* vector);
  * int gumbo_vector_index_of(GumboVector* vector, const void* element);
- * void gumbo_vector_splice(int where, int n_to_remove, void **data, int
- n_to_insert, GumboVector* vector);
 
  * GumboTag gumbo_tag_enum(const char* tagname);
  * GumboTag gumbo_tagn_enum(const char* tagname, int length);
@@ -75,6 +70,8 @@ GumboOutput* gumbo_new_output_init(void) {
   output->root = NULL;
   output->document = gumbo_new_document_node();
   gumbo_vector_init(0, &output->errors);
+  output->error_count = 0;
+  output->pool = NULL;
   return output;
 }
 
@@ -104,14 +101,17 @@ GumboNode* gumbo_create_text_node(GumboNodeType type, const char* text) {
 GumboNode* gumbo_create_element_node(GumboTag tag, GumboNamespaceEnum gns) {
   GumboNode* node = gumbo_create_node(GUMBO_NODE_ELEMENT);
   GumboElement* element = &node->v.element;
-  gumbo_vector_init(1, &element->children);
-  gumbo_vector_init(0, &element->attributes);
+  gumbo_vector_init_inline(GUMBO_ELEMENT_INLINE_CHILDREN, &element->children);
+  gumbo_vector_init_inline(
+      GUMBO_ELEMENT_INLINE_ATTRIBUTES, &element->attributes);
   element->tag = tag;
   element->tag_namespace = gns;
   element->original_tag = kGumboEmptyString;
   element->original_end_tag = kGumboEmptyString;
   element->start_pos = kGumboEmptySourcePosition;
   element->end_pos = kGumboEmptySourcePosition;
+  element->open_element_index = -1;
+  element->formatting_element_index = -1;
   return node;
 }
 
@@ -119,17 +119,28 @@ GumboNode* gumbo_create_element_node(GumboTag tag, GumboNamespaceEnum gns) {
 GumboNode* gumbo_create_template_node(void) {
   GumboNode* node = gumbo_create_node(GUMBO_NODE_TEMPLATE);
   GumboElement* element = &node->v.element;
-  gumbo_vector_init(1, &element->children);
-  gumbo_vector_init(0, &element->attributes);
+  gumbo_vector_init_inline(GUMBO_ELEMENT_INLINE_CHILDREN, &element->children);
+  gumbo_vector_init_inline(
+      GUMBO_ELEMENT_INLINE_ATTRIBUTES, &element->attributes);
   element->tag = GUMBO_TAG_TEMPLATE;
   element->tag_namespace = GUMBO_NAMESPACE_HTML;
   element->original_tag = kGumboEmptyString;
   element->original_end_tag = kGumboEmptyString;
   element->start_pos = kGumboEmptySourcePosition;
   element->end_pos = kGumboEmptySourcePosition;
+  element->open_element_index = -1;
+  element->formatting_element_index = -1;
   return node;
 }
 
+// Records that a node which has to be freed by itself is joining a pooled
+// tree, so that destroying the tree goes looking for it.
+static void note_foreign_node(GumboNode* parent, GumboNode* node) {
+  if (parent->pool && node->pool != parent->pool) {
+    parent->pool->has_foreign_nodes = true;
+  }
+}
+
 // Appends a node to the end of its parent, setting the "parent" and
 // "index_within_parent" fields appropriately.
 void gumbo_append_node(GumboNode* parent, GumboNode* node) {
@@ -143,9 +154,10 @@ void gumbo_append_node(GumboNode* parent, GumboNode* node) {
     assert(parent->type == GUMBO_NODE_DOCUMENT);
     children = &parent->v.document.children;
   }
+  note_foreign_node(parent, node);
   node->parent = parent;
   node->index_within_parent = children->length;
-  gumbo_vector_add((void*) node, children);
+  gumbo_pool_vector_add(parent->pool, (void*) node, children);
   assert(node->index_within_parent < children->length);
 }
 
@@ -171,9 +183,10 @@ void gumbo_insert_node(
     }
     assert(index >= 0);
     assert((unsigned int) index < children->length);
+    note_foreign_node(parent, node);
     node->parent = parent;
     node->index_within_parent = index;
-    gumbo_vector_insert_at((void*) node, index, children);
+    gumbo_pool_vector_insert_at(parent->pool, (void*) node, index, children);
     assert(node->index_within_parent < children->length);
     for (unsigned int i = index + 1; i < children->length; ++i) {
       GumboNode* sibling = children->data[i];
@@ -210,21 +223,27 @@ void gumbo_remove_from_parent(GumboNode* node) {
 // Clones attributes, tags, etc. of a node, but does not copy the content (its
 // children).
 // The clone shares no structure with the original node: all owned strings and
-// values are fresh copies.
+// values are fresh copies, allocated individually even if the original was
+// pooled.
 GumboNode* clone_element_node(const GumboNode* node) {
   assert(node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE);
   GumboNode* new_node = gumbo_malloc(sizeof(GumboNode));
   *new_node = *node;
+  new_node->pool = NULL;
   new_node->parent = NULL;
   new_node->index_within_parent = -1;
   GumboElement* element = &new_node->v.element;
-  gumbo_vector_init(1, &element->children);
+  element->open_element_index = -1;
+  element->formatting_element_index = -1;
+  gumbo_vector_init_inline(GUMBO_ELEMENT_INLINE_CHILDREN, &element->children);
   const GumboVector* old_attributes = &node->v.element.attributes;
-  gumbo_vector_init(old_attributes->length, &element->attributes);
+  gumbo_vector_init_inline(
+      GUMBO_ELEMENT_INLINE_ATTRIBUTES, &element->attributes);
   for (unsigned int i = 0; i < old_attributes->length; ++i) {
     const GumboAttribute* old_attr = old_attributes->data[i];
     GumboAttribute* attr = gumbo_malloc(sizeof(GumboAttribute));
     *attr = *old_attr;
+    attr->pool = NULL;
     attr->name = gumbo_strdup(old_attr->name);
     attr->value = gumbo_strdup(old_attr->value);
     gumbo_vector_add(attr, &element->attributes);
@@ -92,24 +92,16 @@ extern "C" {
   void gumbo_element_remove_attribute(GumboElement *element, GumboAttribute *attr);
 
   // interface from vector.h
-  // Initializes a new GumboVector with the specified initial capacity.
-  void gumbo_vector_init(size_t initial_capacity, GumboVector* vector);
-
-  // Frees the memory used by an GumboVector.  Does not free the contained pointers.
-  void gumbo_vector_destroy(GumboVector* vector);
-
-  // Adds a new element to an GumboVector.
-  void gumbo_vector_add(void* element, GumboVector* vector);
+  // Only the functions that never allocate or free the vector's storage: on a
+  // pooled node's children or attributes that storage belongs to the pool, so
+  // grow them with gumbo_append_node, gumbo_insert_node and
+  // gumbo_element_set_attribute above instead.
 
   // Removes and returns the element most recently added to the GumboVector.
   // Ownership is transferred to caller.  Capacity is unchanged.  If the vector is
   // empty, NULL is returned.
   void* gumbo_vector_pop(GumboVector* vector);
 
-  // Inserts an element at a specific index.  This is potentially O(N) time, but
-  // is necessary for some of the spec's behavior.
-  void gumbo_vector_insert_at(void* element, int index, GumboVector* vector);
-
   // Removes an element from the vector, or does nothing if the element is not in the vector.
   void gumbo_vector_remove(const void* element, GumboVector* vector);
 
@@ -118,7 +110,6 @@ extern "C" {
   void* gumbo_vector_remove_at(int index, GumboVector* vector);
 
   int gumbo_vector_index_of(GumboVector* vector, const void* element);
-  void gumbo_vector_splice(int where, int n_to_remove, void **data, int n_to_insert, GumboVector* vector);
 
 #ifdef __cplusplus
 }
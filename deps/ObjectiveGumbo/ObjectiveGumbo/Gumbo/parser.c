@@ -25,12 +25,14 @@
 #include "gumbo.h"
 #include "insertion_mode.h"
 #include "parser.h"
+#include "pool.h"
 #include "tokenizer.h"
 #include "tokenizer_states.h"
 #include "utf8.h"
 #include "util.h"
 #include "vector.h"
 #include "replacement.h"
+#include "speculation.h"
 
 #define AVOID_UNUSED_VARIABLE_WARNING(i) (void) (i)
 
@@ -59,6 +61,7 @@ const GumboOptions kGumboDefaultOptions = {
     4, true, false,
     50,  // limited to 50 max errors by default to avoid quadratic worst case
          // performance
+    1, GUMBO_ERRORS_FULL,
 };
 
 static const GumboStringPiece kDoctypeHtml = GUMBO_STRING("html");
@@ -236,6 +239,10 @@ typedef struct GumboInternalParserState {
   // http://www.whatwg.org/specs/web-apps/current-work/complete/parsing.html#the-stack-of-open-elements
   GumboVector /*GumboNode*/ _open_elements;
 
+  // How many HTML elements of each tag are on the stack of open elements, so
+  // that looking for a tag that isn't open doesn't walk the whole stack.
+  unsigned int _open_html_elements[GUMBO_TAG_LAST];
+
   // http://www.whatwg.org/specs/web-apps/current-work/complete/parsing.html#the-list-of-active-formatting-elements
   GumboVector /*GumboNode*/ _active_formatting_elements;
 
@@ -301,34 +308,47 @@ static inline bool gumbo_isspace(unsigned char c) {
   }
 }
 
-static bool token_has_attribute(const GumboToken* token, const char* name) {
+static bool token_has_attribute(
+    const GumboToken* token, GumboAttributeName name) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
-  return gumbo_get_attribute(&token->v.start_tag.attributes, name) != NULL;
+  return gumbo_get_attribute_by_atom(
+             &token->v.start_tag.attributes, name) != NULL;
 }
 
 // Checks if the value of the specified attribute is a case-insensitive match
 // for the specified string.
-static bool attribute_matches(
-    const GumboVector* attributes, const char* name, const char* value) {
-  const GumboAttribute* attr = gumbo_get_attribute(attributes, name);
+static bool attribute_matches(const GumboVector* attributes,
+    GumboAttributeName name, const char* value) {
+  const GumboAttribute* attr = gumbo_get_attribute_by_atom(attributes, name);
   return attr ? strcasecmp(value, attr->value) == 0 : false;
 }
 
 // Checks if the value of the specified attribute is a case-sensitive match
 // for the specified string.
-static bool attribute_matches_case_sensitive(
-    const GumboVector* attributes, const char* name, const char* value) {
-  const GumboAttribute* attr = gumbo_get_attribute(attributes, name);
+static bool attribute_matches_case_sensitive(const GumboVector* attributes,
+    GumboAttributeName name, const char* value) {
+  const GumboAttribute* attr = gumbo_get_attribute_by_atom(attributes, name);
   return attr ? strcmp(value, attr->value) == 0 : false;
 }
 
+// Finds the attribute in attributes with the same name as attr, going by its
+// atom where it has one.
+static GumboAttribute* get_same_attribute(
+    const GumboVector* attributes, const GumboAttribute* attr) {
+  if (attr->name_atom != GUMBO_ATTRIBUTE_UNKNOWN) {
+    return gumbo_get_attribute_by_atom(attributes, attr->name_atom);
+  }
+  return gumbo_get_attribute(attributes, attr->name);
+}
+
 // Checks if the specified attribute vectors are identical.
 static bool all_attributes_match(
     const GumboVector* attr1, const GumboVector* attr2) {
   int num_unmatched_attr2_elements = attr2->length;
   for (unsigned int i = 0; i < attr1->length; ++i) {
     const GumboAttribute* attr = attr1->data[i];
-    if (attribute_matches_case_sensitive(attr2, attr->name, attr->value)) {
+    const GumboAttribute* other = get_same_attribute(attr2, attr);
+    if (other && strcmp(attr->value, other->value) == 0) {
       --num_unmatched_attr2_elements;
     } else {
       return false;
@@ -342,21 +362,20 @@ static void set_frameset_not_ok(GumboParser* parser) {
   parser->_parser_state->_frameset_ok = false;
 }
 
-static GumboNode* create_node(GumboNodeType type) {
-  GumboNode* node = gumbo_malloc(sizeof(GumboNode));
+static GumboNode* create_node(GumboPool* pool, GumboNodeType type) {
+  GumboNode* node = gumbo_pool_alloc_node(pool, type);
 
   node->parent = NULL;
   node->index_within_parent = -1;
-  node->type = type;
   node->parse_flags = GUMBO_INSERTION_NORMAL;
 
   return node;
 }
 
-static GumboNode* new_document_node(void) {
-  GumboNode* document_node = create_node(GUMBO_NODE_DOCUMENT);
+static GumboNode* new_document_node(GumboPool* pool) {
+  GumboNode* document_node = create_node(pool, GUMBO_NODE_DOCUMENT);
   document_node->parse_flags = GUMBO_INSERTION_BY_PARSER;
-  gumbo_vector_init(1, &document_node->v.document.children);
+  gumbo_pool_vector_init(pool, 1, &document_node->v.document.children);
 
   // Must be initialized explicitly, as there's no guarantee that we'll see a
   // doc type token.
@@ -368,10 +387,63 @@ static GumboNode* new_document_node(void) {
   return document_node;
 }
 
-static void output_init(GumboParser* parser) {
-  GumboOutput* output = gumbo_malloc(sizeof(GumboOutput));
+// Frees the nodes attached to a pooled tree that weren't carved from its pool
+// (through the gumbo_edit.h functions); everything else goes with the pool.
+static void free_foreign_nodes(GumboNode* document) {
+  GumboPool* pool = document->pool;
+  GumboNode* node;
+  GumboVector nodestack = kGumboEmptyVector;
+  gumbo_vector_init(10, &nodestack);
+  gumbo_vector_add((void*) document, &nodestack);
+  while ((node = (GumboNode*) gumbo_vector_pop(&nodestack)) != NULL) {
+    const GumboVector* children;
+    if (node->pool != pool) {
+      free_node(node);
+      continue;
+    } else if (node->type == GUMBO_NODE_DOCUMENT) {
+      children = &node->v.document.children;
+    } else if (node->type == GUMBO_NODE_ELEMENT ||
+               node->type == GUMBO_NODE_TEMPLATE) {
+      children = &node->v.element.children;
+    } else {
+      continue;
+    }
+    for (unsigned int i = 0; i < children->length; ++i) {
+      gumbo_vector_add(children->data[i], &nodestack);
+    }
+  }
+  gumbo_vector_destroy(&nodestack);
+}
+
+// Releases the tree and errors of an output, leaving its pool (if any) to be
+// destroyed or reused by the caller.
+static void release_output_contents(GumboOutput* output) {
+  if (!output->pool) {
+    free_node(output->document);
+  } else if (output->pool->has_foreign_nodes) {
+    free_foreign_nodes(output->document);
+  }
+  for (unsigned int i = 0; i < output->errors.length; ++i) {
+    gumbo_error_destroy(output->errors.data[i]);
+  }
+  gumbo_vector_destroy(&output->errors);
+}
+
+// Sets up parser->_output to hold a new tree, carved from the pool of recycled
+// if that's given.
+static void output_init(GumboParser* parser, GumboOutput* recycled) {
+  GumboOutput* output = recycled;
+  if (!output) {
+    output = gumbo_malloc(sizeof(GumboOutput));
+    output->pool = NULL;
+  }
+  if (output->pool) {
+    gumbo_pool_reset(output->pool);
+  } else {
+    output->pool = gumbo_pool_create();
+  }
   output->root = NULL;
-  output->document = new_document_node();
+  output->document = new_document_node(output->pool);
   parser->_output = output;
   gumbo_init_errors(parser);
 }
@@ -386,6 +458,8 @@ static void parser_state_init(GumboParser* parser) {
   parser_state->_text_node._type = GUMBO_NODE_WHITESPACE;
   gumbo_string_buffer_init(&parser_state->_text_node._buffer);
   gumbo_vector_init(10, &parser_state->_open_elements);
+  memset(parser_state->_open_html_elements, 0,
+      sizeof(parser_state->_open_html_elements));
   gumbo_vector_init(5, &parser_state->_active_formatting_elements);
   gumbo_vector_init(5, &parser_state->_template_insertion_modes);
   parser_state->_head_element = NULL;
@@ -418,6 +492,162 @@ static bool is_fragment_parser(const GumboParser* parser) {
   return !!parser->_parser_state->_fragment_ctx;
 }
 
+// The stack of open elements and the list of active formatting elements are
+// only changed through the functions below, which keep every element's
+// position in them (open_element_index and formatting_element_index) current,
+// along with the count of open HTML elements of each tag.  That makes
+// membership and index queries O(1); pushes and pops stay O(1), and the rarer
+// inserts and removals in the middle only renumber what the vector already had
+// to shift.
+
+static void count_open_element(
+    GumboParserState* state, const GumboNode* node, bool is_open) {
+  if (node->v.element.tag_namespace == GUMBO_NAMESPACE_HTML) {
+    unsigned int* count = &state->_open_html_elements[node->v.element.tag];
+    assert(is_open || *count > 0);
+    *count = is_open ? *count + 1 : *count - 1;
+  }
+}
+
+static void reindex_open_elements(GumboParserState* state, unsigned int from) {
+  for (unsigned int i = from; i < state->_open_elements.length; ++i) {
+    GumboNode* node = state->_open_elements.data[i];
+    node->v.element.open_element_index = i;
+  }
+}
+
+// Returns the index of node in the stack of open elements, or -1.
+static int open_element_index(
+    const GumboParserState* state, const GumboNode* node) {
+  int index = node->v.element.open_element_index;
+  assert(index == -1 || state->_open_elements.data[index] == node);
+  return index;
+}
+
+static void push_open_element(GumboParserState* state, GumboNode* node) {
+  assert(node->v.element.open_element_index == -1);
+  node->v.element.open_element_index = state->_open_elements.length;
+  gumbo_vector_add((void*) node, &state->_open_elements);
+  count_open_element(state, node, true);
+}
+
+static GumboNode* pop_open_element(GumboParserState* state) {
+  GumboNode* node = gumbo_vector_pop(&state->_open_elements);
+  if (node) {
+    node->v.element.open_element_index = -1;
+    count_open_element(state, node, false);
+  }
+  return node;
+}
+
+static void insert_open_element_at(
+    GumboParserState* state, GumboNode* node, unsigned int index) {
+  assert(node->v.element.open_element_index == -1);
+  gumbo_vector_insert_at((void*) node, index, &state->_open_elements);
+  reindex_open_elements(state, index);
+  count_open_element(state, node, true);
+}
+
+static void remove_open_element_at(GumboParserState* state, unsigned int index) {
+  GumboNode* node = gumbo_vector_remove_at(index, &state->_open_elements);
+  node->v.element.open_element_index = -1;
+  reindex_open_elements(state, index);
+  count_open_element(state, node, false);
+}
+
+// Removes node from the stack of open elements, if it is there.
+static void remove_open_element(GumboParserState* state, GumboNode* node) {
+  int index = open_element_index(state, node);
+  if (index != -1) {
+    remove_open_element_at(state, index);
+  }
+}
+
+static void replace_open_element_at(
+    GumboParserState* state, GumboNode* node, unsigned int index) {
+  GumboNode* old_node = state->_open_elements.data[index];
+  old_node->v.element.open_element_index = -1;
+  count_open_element(state, old_node, false);
+  state->_open_elements.data[index] = node;
+  node->v.element.open_element_index = index;
+  count_open_element(state, node, true);
+}
+
+// Scope markers are a single shared constant, so they carry no index.
+static void reindex_formatting_elements(
+    GumboParserState* state, unsigned int from) {
+  for (unsigned int i = from; i < state->_active_formatting_elements.length;
+       ++i) {
+    GumboNode* node = state->_active_formatting_elements.data[i];
+    if (node != &kActiveFormattingScopeMarker) {
+      node->v.element.formatting_element_index = i;
+    }
+  }
+}
+
+// Returns the index of node in the list of active formatting elements, or -1.
+static int formatting_element_index(
+    const GumboParserState* state, const GumboNode* node) {
+  assert(node != &kActiveFormattingScopeMarker);
+  int index = node->v.element.formatting_element_index;
+  assert(index == -1 || state->_active_formatting_elements.data[index] == node);
+  return index;
+}
+
+static void push_formatting_element(
+    GumboParserState* state, const GumboNode* node) {
+  if (node != &kActiveFormattingScopeMarker) {
+    GumboElement* element = &((GumboNode*) node)->v.element;
+    assert(element->formatting_element_index == -1);
+    element->formatting_element_index =
+        state->_active_formatting_elements.length;
+  }
+  gumbo_vector_add((void*) node, &state->_active_formatting_elements);
+}
+
+static GumboNode* pop_formatting_element(GumboParserState* state) {
+  GumboNode* node = gumbo_vector_pop(&state->_active_formatting_elements);
+  if (node && node != &kActiveFormattingScopeMarker) {
+    node->v.element.formatting_element_index = -1;
+  }
+  return node;
+}
+
+static void insert_formatting_element_at(
+    GumboParserState* state, GumboNode* node, unsigned int index) {
+  assert(node->v.element.formatting_element_index == -1);
+  gumbo_vector_insert_at(
+      (void*) node, index, &state->_active_formatting_elements);
+  reindex_formatting_elements(state, index);
+}
+
+static GumboNode* remove_formatting_element_at(
+    GumboParserState* state, unsigned int index) {
+  GumboNode* node =
+      gumbo_vector_remove_at(index, &state->_active_formatting_elements);
+  if (node != &kActiveFormattingScopeMarker) {
+    node->v.element.formatting_element_index = -1;
+  }
+  reindex_formatting_elements(state, index);
+  return node;
+}
+
+static void remove_formatting_element(GumboParserState* state, GumboNode* node) {
+  int index = formatting_element_index(state, node);
+  if (index != -1) {
+    remove_formatting_element_at(state, index);
+  }
+}
+
+static void replace_formatting_element_at(
+    GumboParserState* state, GumboNode* node, unsigned int index) {
+  GumboNode* old_node = state->_active_formatting_elements.data[index];
+  assert(old_node != &kActiveFormattingScopeMarker);
+  old_node->v.element.formatting_element_index = -1;
+  state->_active_formatting_elements.data[index] = node;
+  node->v.element.formatting_element_index = index;
+}
+
 // Returns the node at the bottom of the stack of open elements, or NULL if no
 // elements have been added yet.
 static GumboNode* get_current_node(GumboParser* parser) {
@@ -662,10 +892,10 @@ static bool is_html_integration_point(const GumboNode* node) {
                                    TAG_SVG(DESC), TAG_SVG(TITLE)}) ||
          (node_qualified_tag_is(
               node, GUMBO_NAMESPACE_MATHML, GUMBO_TAG_ANNOTATION_XML) &&
-             (attribute_matches(
-                  &node->v.element.attributes, "encoding", "text/html") ||
-                 attribute_matches(&node->v.element.attributes, "encoding",
-                     "application/xhtml+xml")));
+             (attribute_matches(&node->v.element.attributes,
+                  GUMBO_ATTRIBUTE_ENCODING, "text/html") ||
+                 attribute_matches(&node->v.element.attributes,
+                     GUMBO_ATTRIBUTE_ENCODING, "application/xhtml+xml")));
 }
 
 // This represents a place to insert a node, consisting of a target parent and a
@@ -739,7 +969,7 @@ static void append_node(GumboNode* parent, GumboNode* node) {
   }
   node->parent = parent;
   node->index_within_parent = children->length;
-  gumbo_vector_add((void*) node, children);
+  gumbo_pool_vector_add(parent->pool, (void*) node, children);
   assert(node->index_within_parent < children->length);
 }
 
@@ -767,7 +997,7 @@ static void insert_node(GumboNode* node, InsertionLocation location) {
     assert((unsigned int) index < children->length);
     node->parent = parent;
     node->index_within_parent = index;
-    gumbo_vector_insert_at((void*) node, index, children);
+    gumbo_pool_vector_insert_at(parent->pool, (void*) node, index, children);
     assert(node->index_within_parent < children->length);
     for (unsigned int i = index + 1; i < children->length; ++i) {
       GumboNode* sibling = children->data[i];
@@ -789,9 +1019,11 @@ static void maybe_flush_text_node_buffer(GumboParser* parser) {
   assert(buffer_state->_type == GUMBO_NODE_WHITESPACE ||
          buffer_state->_type == GUMBO_NODE_TEXT ||
          buffer_state->_type == GUMBO_NODE_CDATA);
-  GumboNode* text_node = create_node(buffer_state->_type);
+  GumboPool* pool = parser->_output->pool;
+  GumboNode* text_node = create_node(pool, buffer_state->_type);
   GumboText* text_node_data = &text_node->v.text;
-  text_node_data->text = gumbo_string_buffer_to_string(&buffer_state->_buffer);
+  text_node_data->text = gumbo_pool_strndup(
+      pool, buffer_state->_buffer.data, buffer_state->_buffer.length);
   text_node_data->original_text.data = buffer_state->_start_original_text;
   text_node_data->original_text.length =
       state->_current_token->original_text.data -
@@ -831,7 +1063,7 @@ static GumboNode* pop_current_node(GumboParser* parser) {
     gumbo_debug("Popping %s node.\n",
         gumbo_normalized_tagname(get_current_node(parser)->v.element.tag));
   }
-  GumboNode* current_node = gumbo_vector_pop(&state->_open_elements);
+  GumboNode* current_node = pop_open_element(state);
   if (!current_node) {
     assert(state->_open_elements.length == 0);
     return NULL;
@@ -857,7 +1089,7 @@ static GumboNode* pop_current_node(GumboParser* parser) {
 static void append_comment_node(
     GumboParser* parser, GumboNode* node, const GumboToken* token) {
   maybe_flush_text_node_buffer(parser);
-  GumboNode* comment = create_node(GUMBO_NODE_COMMENT);
+  GumboNode* comment = create_node(parser->_output->pool, GUMBO_NODE_COMMENT);
   comment->type = GUMBO_NODE_COMMENT;
   comment->parse_flags = GUMBO_INSERTION_NORMAL;
   comment->v.text.text = token->v.text;
@@ -893,10 +1125,12 @@ void clear_stack_to_table_body_context(GumboParser* parser) {
 
 // Creates a parser-inserted element in the HTML namespace and returns it.
 static GumboNode* create_element(GumboParser* parser, GumboTag tag) {
-  GumboNode* node = create_node(GUMBO_NODE_ELEMENT);
+  GumboPool* pool = parser->_output->pool;
+  GumboNode* node = create_node(pool, GUMBO_NODE_ELEMENT);
   GumboElement* element = &node->v.element;
-  gumbo_vector_init(1, &element->children);
-  gumbo_vector_init(0, &element->attributes);
+  gumbo_vector_init_inline(GUMBO_ELEMENT_INLINE_CHILDREN, &element->children);
+  gumbo_vector_init_inline(
+      GUMBO_ELEMENT_INLINE_ATTRIBUTES, &element->attributes);
   element->tag = tag;
   element->tag_namespace = GUMBO_NAMESPACE_HTML;
   element->original_tag = kGumboEmptyString;
@@ -905,11 +1139,32 @@ static GumboNode* create_element(GumboParser* parser, GumboTag tag) {
                            ? parser->_parser_state->_current_token->position
                            : kGumboEmptySourcePosition;
   element->end_pos = kGumboEmptySourcePosition;
+  element->open_element_index = -1;
+  element->formatting_element_index = -1;
   return node;
 }
 
+// Moves the attributes of a start tag token to a new element, leaving the token
+// with none.  The usual handful are copied into the element's inline storage and
+// the token's array goes back to the pool; only longer lists are taken over.
+static void take_attributes(
+    GumboPool* pool, GumboVector* token_attributes, GumboVector* attributes) {
+  if (token_attributes->length > GUMBO_ELEMENT_INLINE_ATTRIBUTES) {
+    *attributes = *token_attributes;
+  } else {
+    gumbo_vector_init_inline(GUMBO_ELEMENT_INLINE_ATTRIBUTES, attributes);
+    if (token_attributes->length) {
+      memcpy(attributes->data, token_attributes->data,
+          sizeof(void*) * token_attributes->length);
+    }
+    attributes->length = token_attributes->length;
+    gumbo_pool_vector_destroy(pool, token_attributes);
+  }
+  *token_attributes = kGumboEmptyVector;
+}
+
 // Constructs an element from the given start tag token.
-static GumboNode* create_element_from_token(
+static GumboNode* create_element_from_token(GumboParser* parser,
     GumboToken* token, GumboNamespaceEnum tag_namespace) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
   GumboTokenStartTag* start_tag = &token->v.start_tag;
@@ -919,10 +1174,11 @@ static GumboNode* create_element_from_token(
                            ? GUMBO_NODE_TEMPLATE
                            : GUMBO_NODE_ELEMENT;
 
-  GumboNode* node = create_node(type);
+  GumboPool* pool = parser->_output->pool;
+  GumboNode* node = create_node(pool, type);
   GumboElement* element = &node->v.element;
-  gumbo_vector_init(1, &element->children);
-  element->attributes = start_tag->attributes;
+  gumbo_vector_init_inline(GUMBO_ELEMENT_INLINE_CHILDREN, &element->children);
+  take_attributes(pool, &start_tag->attributes, &element->attributes);
   element->tag = start_tag->tag;
   element->tag_namespace = tag_namespace;
 
@@ -933,10 +1189,9 @@ static GumboNode* create_element_from_token(
   element->start_pos = token->position;
   element->original_end_tag = kGumboEmptyString;
   element->end_pos = kGumboEmptySourcePosition;
+  element->open_element_index = -1;
+  element->formatting_element_index = -1;
 
-  // The element takes ownership of the attributes from the token, so any
-  // allocated-memory fields should be nulled out.
-  start_tag->attributes = kGumboEmptyVector;
   return node;
 }
 
@@ -958,7 +1213,7 @@ static void insert_element(GumboParser* parser, GumboNode* node,
   }
   InsertionLocation location = get_appropriate_insertion_location(parser, NULL);
   insert_node(node, location);
-  gumbo_vector_add((void*) node, &state->_open_elements);
+  push_open_element(state, node);
 }
 
 // Convenience method that combines create_element_from_token and
@@ -966,7 +1221,7 @@ static void insert_element(GumboParser* parser, GumboNode* node,
 // node.  Returns the node inserted.
 static GumboNode* insert_element_from_token(
     GumboParser* parser, GumboToken* token) {
-  GumboNode* element = create_element_from_token(token, GUMBO_NAMESPACE_HTML);
+  GumboNode* element = create_element_from_token(parser, token, GUMBO_NAMESPACE_HTML);
   insert_element(parser, element, false);
   gumbo_debug("Inserting <%s> element (@%x) from token.\n",
       gumbo_normalized_tagname(element->v.element.tag), element);
@@ -991,18 +1246,18 @@ static GumboNode* insert_element_of_tag_type(
 static GumboNode* insert_foreign_element(
     GumboParser* parser, GumboToken* token, GumboNamespaceEnum tag_namespace) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
-  GumboNode* element = create_element_from_token(token, tag_namespace);
+  GumboNode* element = create_element_from_token(parser, token, tag_namespace);
   insert_element(parser, element, false);
-  if (token_has_attribute(token, "xmlns") &&
-      !attribute_matches_case_sensitive(&token->v.start_tag.attributes, "xmlns",
-          kLegalXmlns[tag_namespace])) {
+  if (token_has_attribute(token, GUMBO_ATTRIBUTE_XMLNS) &&
+      !attribute_matches_case_sensitive(&token->v.start_tag.attributes,
+          GUMBO_ATTRIBUTE_XMLNS, kLegalXmlns[tag_namespace])) {
     // TODO(jdtang): Since there're multiple possible error codes here, we
     // eventually need reason codes to differentiate them.
     parser_add_parse_error(parser, token);
   }
-  if (token_has_attribute(token, "xmlns:xlink") &&
+  if (token_has_attribute(token, GUMBO_ATTRIBUTE_XMLNS_XLINK) &&
       !attribute_matches_case_sensitive(&token->v.start_tag.attributes,
-          "xmlns:xlink", "http://www.w3.org/1999/xlink")) {
+          GUMBO_ATTRIBUTE_XMLNS_XLINK, "http://www.w3.org/1999/xlink")) {
     parser_add_parse_error(parser, token);
   }
   return element;
@@ -1105,28 +1360,26 @@ static void add_formatting_element(GumboParser* parser, const GumboNode* node) {
   if (num_identical_elements >= 3) {
     gumbo_debug("Noah's ark clause: removing element at %d.\n",
         earliest_identical_element);
-    gumbo_vector_remove_at(earliest_identical_element, elements);
+    remove_formatting_element_at(
+        parser->_parser_state, earliest_identical_element);
   }
 
-  gumbo_vector_add((void*) node, elements);
+  push_formatting_element(parser->_parser_state, node);
 }
 
 static bool is_open_element(GumboParser* parser, const GumboNode* node) {
-  GumboVector* open_elements = &parser->_parser_state->_open_elements;
-  for (unsigned int i = 0; i < open_elements->length; ++i) {
-    if (open_elements->data[i] == node) {
-      return true;
-    }
-  }
-  return false;
+  return open_element_index(parser->_parser_state, node) != -1;
 }
 
 // Clones attributes, tags, etc. of a node, but does not copy the content.  The
-// clone shares no structure with the original node: all owned strings and
-// values are fresh copies.
+// clone is carved from the same pool as the original, and since pooled strings
+// are never freed before the pool is, its attributes share their names and
+// values with the original's.
 GumboNode* clone_node(const GumboNode* node, GumboParseFlags reason) {
   assert(node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE);
-  GumboNode* new_node = gumbo_malloc(sizeof(GumboNode));
+  assert(node->pool);
+  GumboPool* pool = node->pool;
+  GumboNode* new_node = gumbo_pool_alloc_node(pool, node->type);
   *new_node = *node;
   new_node->parent = NULL;
   new_node->index_within_parent = -1;
@@ -1135,17 +1388,17 @@ GumboNode* clone_node(const GumboNode* node, GumboParseFlags reason) {
   new_node->parse_flags &= ~GUMBO_INSERTION_IMPLICIT_END_TAG;
   new_node->parse_flags |= reason | GUMBO_INSERTION_BY_PARSER;
   GumboElement* element = &new_node->v.element;
-  gumbo_vector_init(1, &element->children);
+  element->open_element_index = -1;
+  element->formatting_element_index = -1;
+  gumbo_vector_init_inline(GUMBO_ELEMENT_INLINE_CHILDREN, &element->children);
 
   const GumboVector* old_attributes = &node->v.element.attributes;
-  gumbo_vector_init(old_attributes->length, &element->attributes);
+  gumbo_vector_init_inline(
+      GUMBO_ELEMENT_INLINE_ATTRIBUTES, &element->attributes);
   for (unsigned int i = 0; i < old_attributes->length; ++i) {
-    const GumboAttribute* old_attr = old_attributes->data[i];
-    GumboAttribute* attr = gumbo_malloc(sizeof(GumboAttribute));
-    *attr = *old_attr;
-    attr->name = gumbo_strdup(old_attr->name);
-    attr->value = gumbo_strdup(old_attr->value);
-    gumbo_vector_add(attr, &element->attributes);
+    GumboAttribute* attr = gumbo_pool_alloc_attribute(pool);
+    *attr = *(const GumboAttribute*) old_attributes->data[i];
+    gumbo_pool_vector_add(pool, attr, &element->attributes);
   }
   return new_node;
 }
@@ -1196,21 +1449,20 @@ static void reconstruct_active_formatting_elements(GumboParser* parser) {
     InsertionLocation location =
         get_appropriate_insertion_location(parser, NULL);
     insert_node(clone, location);
-    gumbo_vector_add((void*) clone, &parser->_parser_state->_open_elements);
+    push_open_element(parser->_parser_state, clone);
 
     // Step 10.
-    elements->data[c] = clone;
+    replace_formatting_element_at(parser->_parser_state, clone, c);
     gumbo_debug("Reconstructed %s element at %d.\n",
         gumbo_normalized_tagname(clone->v.element.tag), c);
   }
 }
 
 static void clear_active_formatting_elements(GumboParser* parser) {
-  GumboVector* elements = &parser->_parser_state->_active_formatting_elements;
   int num_elements_cleared = 0;
   const GumboNode* node;
   do {
-    node = gumbo_vector_pop(elements);
+    node = pop_formatting_element(parser->_parser_state);
     ++num_elements_cleared;
   } while (node && node != &kActiveFormattingScopeMarker);
   gumbo_debug("Cleared %d elements from active formatting list.\n",
@@ -1255,6 +1507,15 @@ static GumboQuirksModeEnum compute_quirks_mode(
 static bool has_an_element_in_specific_scope(GumboParser* parser,
     int expected_size, const GumboTag* expected, bool negate,
     const gumbo_tagset tags) {
+  // Only an open HTML element with one of the tags can be found.
+  bool is_open = false;
+  for (int j = 0; j < expected_size && !is_open; ++j) {
+    is_open = parser->_parser_state->_open_html_elements[expected[j]] != 0;
+  }
+  if (!is_open) {
+    return false;
+  }
+
   GumboVector* open_elements = &parser->_parser_state->_open_elements;
   for (int i = open_elements->length; --i >= 0;) {
     const GumboNode* node = open_elements->data[i];
@@ -1543,7 +1804,8 @@ static void maybe_implicitly_close_list_tag(
   }
 }
 
-static void merge_attributes(GumboToken* token, GumboNode* node) {
+static void merge_attributes(
+    GumboParser* parser, GumboToken* token, GumboNode* node) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
   assert(node->type == GUMBO_NODE_ELEMENT);
   const GumboVector* token_attr = &token->v.start_tag.attributes;
@@ -1551,11 +1813,11 @@ static void merge_attributes(GumboToken* token, GumboNode* node) {
 
   for (unsigned int i = 0; i < token_attr->length; ++i) {
     GumboAttribute* attr = token_attr->data[i];
-    if (!gumbo_get_attribute(node_attr, attr->name)) {
+    if (!get_same_attribute(node_attr, attr)) {
       // Ownership of the attribute is transferred by this gumbo_vector_add,
       // so it has to be nulled out of the original token so it doesn't get
       // double-deleted.
-      gumbo_vector_add(attr, node_attr);
+      gumbo_pool_vector_add(node->pool, attr, node_attr);
       token_attr->data[i] = NULL;
     }
   }
@@ -1563,7 +1825,7 @@ static void merge_attributes(GumboToken* token, GumboNode* node) {
   // with another token, so we need to free its memory.  The attributes that are
   // transferred need to be nulled-out in the vector above so that they aren't
   // double-deleted.
-  gumbo_token_destroy(token);
+  gumbo_token_destroy(parser, token);
 
 #ifndef NDEBUG
   // Mark this sentinel so the assertion in the main loop knows it's been
@@ -1584,19 +1846,24 @@ const char* gumbo_normalize_svg_tagname(
 static void adjust_foreign_attributes(GumboToken* token) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
   const GumboVector* attributes = &token->v.start_tag.attributes;
-  for (unsigned int i = 0; i < sizeof(kForeignAttributeReplacements) /
-                                   sizeof(NamespacedAttributeReplacement);
-       ++i) {
-    const NamespacedAttributeReplacement* entry =
-        &kForeignAttributeReplacements[i];
-    GumboAttribute* attr = gumbo_get_attribute(attributes, entry->from);
-    if (!attr) {
+  // Walk the token's attributes rather than looking each replacement up, so
+  // the common case of no xlink/xml/xmlns attributes costs one compare each.
+  for (unsigned int i = 0; i < attributes->length; ++i) {
+    GumboAttribute* attr = attributes->data[i];
+    if (gumbo_tolower(attr->name[0]) != 'x') {
       continue;
     }
-    /* TODO:vmg refactor to use attribute helpers */
-    gumbo_free((void*) attr->name);
-    attr->attr_namespace = entry->attr_namespace;
-    attr->name = gumbo_strdup(entry->local_name);
+    for (unsigned int j = 0; j < sizeof(kForeignAttributeReplacements) /
+                                     sizeof(NamespacedAttributeReplacement);
+         ++j) {
+      const NamespacedAttributeReplacement* entry =
+          &kForeignAttributeReplacements[j];
+      if (!strcasecmp(attr->name, entry->from)) {
+        attr->attr_namespace = entry->attr_namespace;
+        gumbo_attribute_set_name(attr, entry->local_name);
+        break;
+      }
+    }
   }
 }
 
@@ -1611,9 +1878,7 @@ static void adjust_svg_attributes(GumboToken* token) {
     if (!replacement) {
       continue;
     }
-    /* TODO:vmg refactor to use attribute helpers */
-    gumbo_free((void*) attr->name);
-    attr->name = gumbo_strdup(replacement->to);
+    gumbo_attribute_set_name(attr, replacement->to);
   }
 }
 
@@ -1622,13 +1887,12 @@ static void adjust_svg_attributes(GumboToken* token) {
 // value.
 static void adjust_mathml_attributes(GumboToken* token) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
-  GumboAttribute* attr =
-      gumbo_get_attribute(&token->v.start_tag.attributes, "definitionurl");
+  GumboAttribute* attr = gumbo_get_attribute_by_atom(
+      &token->v.start_tag.attributes, GUMBO_ATTRIBUTE_DEFINITIONURL);
   if (!attr) {
     return;
   }
-  gumbo_free((void*) attr->name);
-  attr->name = gumbo_strdup("definitionURL");
+  gumbo_attribute_set_name(attr, "definitionURL");
 }
 
 static bool doctype_matches(const GumboTokenDocType* doctype,
@@ -1693,8 +1957,7 @@ static bool adoption_agency_algorithm(
   GumboNode* current_node = get_current_node(parser);
   if (current_node->v.element.tag_namespace == GUMBO_NAMESPACE_HTML &&
       current_node->v.element.tag == subject &&
-      gumbo_vector_index_of(
-          &state->_active_formatting_elements, current_node) == -1) {
+      formatting_element_index(state, current_node) == -1) {
     pop_current_node(parser);
     return false;
   }
@@ -1714,7 +1977,7 @@ static bool adoption_agency_algorithm(
         // Found it.
         formatting_node = current_node;
         formatting_node_in_open_elements =
-            gumbo_vector_index_of(&state->_open_elements, formatting_node);
+            open_element_index(state, formatting_node);
         gumbo_debug("Formatting element of tag %s at %d.\n",
             gumbo_normalized_tagname(subject),
             formatting_node_in_open_elements);
@@ -1733,7 +1996,7 @@ static bool adoption_agency_algorithm(
     if (formatting_node_in_open_elements == -1) {
       gumbo_debug("Formatting node not on stack of open elements.\n");
       parser_add_parse_error(parser, token);
-      gumbo_vector_remove(formatting_node, &state->_active_formatting_elements);
+      remove_formatting_element(state, formatting_node);
       return false;
     }
 
@@ -1771,7 +2034,7 @@ static bool adoption_agency_algorithm(
       }
       // And the formatting element itself.
       pop_current_node(parser);
-      gumbo_vector_remove(formatting_node, &state->_active_formatting_elements);
+      remove_formatting_element(state, formatting_node);
       return false;
     }
     assert(!node_html_tag_is(furthest_block, GUMBO_TAG_HTML));
@@ -1781,31 +2044,28 @@ static bool adoption_agency_algorithm(
     // Elements may be moved and reparented by this algorithm, so
     // common_ancestor is not necessarily the same as formatting_node->parent.
     GumboNode* common_ancestor =
-        state->_open_elements.data[gumbo_vector_index_of(&state->_open_elements,
-                                       formatting_node) -
+        state->_open_elements.data[open_element_index(state, formatting_node) -
                                    1];
     gumbo_debug("Common ancestor tag = %s, furthest block tag = %s.\n",
         gumbo_normalized_tagname(common_ancestor->v.element.tag),
         gumbo_normalized_tagname(furthest_block->v.element.tag));
 
     // Step 12.
-    int bookmark = gumbo_vector_index_of(
-                       &state->_active_formatting_elements, formatting_node) +
-                   1;
+    int bookmark = formatting_element_index(state, formatting_node) + 1;
     gumbo_debug("Bookmark at %d.\n", bookmark);
     // Step 13.
     GumboNode* node = furthest_block;
     GumboNode* last_node = furthest_block;
     // Must be stored explicitly, in case node is removed from the stack of open
     // elements, to handle step 9.4.
-    int saved_node_index = gumbo_vector_index_of(&state->_open_elements, node);
+    int saved_node_index = open_element_index(state, node);
     assert(saved_node_index > 0);
     // Step 13.1.
     for (int j = 0;;) {
       // Step 13.2.
       ++j;
       // Step 13.3.
-      int node_index = gumbo_vector_index_of(&state->_open_elements, node);
+      int node_index = open_element_index(state, node);
       gumbo_debug(
           "Current index: %d, last index: %d.\n", node_index, saved_node_index);
       if (node_index == -1) {
@@ -1820,13 +2080,11 @@ static bool adoption_agency_algorithm(
         // Step 13.4.
         break;
       }
-      int formatting_index =
-          gumbo_vector_index_of(&state->_active_formatting_elements, node);
+      int formatting_index = formatting_element_index(state, node);
       if (j > 3 && formatting_index != -1) {
         // Step 13.5.
         gumbo_debug("Removing formatting element at %d.\n", formatting_index);
-        gumbo_vector_remove_at(
-            formatting_index, &state->_active_formatting_elements);
+        remove_formatting_element_at(state, formatting_index);
         // Removing the element shifts all indices over by one, so we may need
         // to move the bookmark.
         if (formatting_index < bookmark) {
@@ -1837,7 +2095,7 @@ static bool adoption_agency_algorithm(
       }
       if (formatting_index == -1) {
         // Step 13.6.
-        gumbo_vector_remove_at(node_index, &state->_open_elements);
+        remove_open_element_at(state, node_index);
         continue;
       }
       // Step 13.7.
@@ -1845,9 +2103,9 @@ static bool adoption_agency_algorithm(
       // it into the common ancestor; that happens below.
       node = clone_node(node, GUMBO_INSERTION_ADOPTION_AGENCY_CLONED);
       assert(formatting_index >= 0);
-      state->_active_formatting_elements.data[formatting_index] = node;
+      replace_formatting_element_at(state, node, formatting_index);
       assert(node_index >= 0);
-      state->_open_elements.data[node_index] = node;
+      replace_open_element_at(state, node, node_index);
       // Step 13.8.
       if (last_node == furthest_block) {
         bookmark = formatting_index + 1;
@@ -1883,14 +2141,12 @@ static bool adoption_agency_algorithm(
     // vector of furthest_block with the empty children of new_formatting_node,
     // reducing memory traffic and allocations.  We still have to reset their
     // parent pointers, though.
-    GumboVector temp = new_formatting_node->v.element.children;
-    new_formatting_node->v.element.children =
-        furthest_block->v.element.children;
-    furthest_block->v.element.children = temp;
-
-    temp = new_formatting_node->v.element.children;
-    for (unsigned int i = 0; i < temp.length; ++i) {
-      GumboNode* child = temp.data[i];
+    gumbo_vector_swap(&new_formatting_node->v.element.children,
+        &furthest_block->v.element.children);
+
+    GumboVector* temp = &new_formatting_node->v.element.children;
+    for (unsigned int i = 0; i < temp->length; ++i) {
+      GumboNode* child = temp->data[i];
       child->parent = new_formatting_node;
     }
 
@@ -1901,8 +2157,8 @@ static bool adoption_agency_algorithm(
     // If the formatting node was before the bookmark, it may shift over all
     // indices after it, so we need to explicitly find the index and possibly
     // adjust the bookmark.
-    int formatting_node_index = gumbo_vector_index_of(
-        &state->_active_formatting_elements, formatting_node);
+    int formatting_node_index =
+        formatting_element_index(state, formatting_node);
     assert(formatting_node_index != -1);
     if (formatting_node_index < bookmark) {
       gumbo_debug(
@@ -1910,22 +2166,18 @@ static bool adoption_agency_algorithm(
           formatting_node_index, bookmark);
       --bookmark;
     }
-    gumbo_vector_remove_at(
-        formatting_node_index, &state->_active_formatting_elements);
+    remove_formatting_element_at(state, formatting_node_index);
     assert(bookmark >= 0);
     assert(
         (unsigned int) bookmark <= state->_active_formatting_elements.length);
-    gumbo_vector_insert_at(
-        new_formatting_node, bookmark, &state->_active_formatting_elements);
+    insert_formatting_element_at(state, new_formatting_node, bookmark);
 
     // Step 19.
-    gumbo_vector_remove(formatting_node, &state->_open_elements);
-    int insert_at =
-        gumbo_vector_index_of(&state->_open_elements, furthest_block) + 1;
+    remove_open_element(state, formatting_node);
+    int insert_at = open_element_index(state, furthest_block) + 1;
     assert(insert_at >= 0);
     assert((unsigned int) insert_at <= state->_open_elements.length);
-    gumbo_vector_insert_at(
-        new_formatting_node, insert_at, &state->_open_elements);
+    insert_open_element_at(state, new_formatting_node, insert_at);
   }  // Step 20.
   return true;
 }
@@ -1937,7 +2189,7 @@ static void ignore_token(GumboParser* parser) {
   // element, but if no element is emitted (as happens in non-verbatim-mode
   // when a token is ignored), we need to free it here to prevent a memory
   // leak.
-  gumbo_token_destroy(token);
+  gumbo_token_destroy(parser, token);
 #ifndef NDEBUG
   if (token->type == GUMBO_TOKEN_START_TAG) {
     // Mark this sentinel so the assertion in the main loop knows it's been
@@ -2310,9 +2562,9 @@ static bool handle_after_head(GumboParser* parser, GumboToken* token) {
           // may be
           // pending character tokens that should be attached to the root.
           maybe_flush_text_node_buffer(parser);
-          gumbo_vector_add(state->_head_element, &state->_open_elements);
+          push_open_element(state, state->_head_element);
           bool result = handle_in_head(parser, token);
-          gumbo_vector_remove(state->_head_element, &state->_open_elements);
+          remove_open_element(state, state->_head_element);
           return result;
         case GUMBO_TAG_HEAD:
           parser_add_parse_error(parser, token);
@@ -2345,6 +2597,8 @@ static bool handle_after_head(GumboParser* parser, GumboToken* token) {
   return true;
 }
 
+// Frees a node and its descendants one by one.  Pooled ones are given back to
+// their pool rather than freed, and their strings are left for it.
 static void free_node(GumboNode* node_to_free) {
   GumboNode* node;
   GumboVector nodestack = kGumboEmptyVector;
@@ -2357,10 +2611,12 @@ static void free_node(GumboNode* node_to_free) {
         for (unsigned int i = 0; i < doc->children.length; ++i) {
           gumbo_vector_add((void*) (doc->children.data[i]), &nodestack);
         }
-        gumbo_free((void*) doc->children.data);
-        gumbo_free((void*) doc->name);
-        gumbo_free((void*) doc->public_identifier);
-        gumbo_free((void*) doc->system_identifier);
+        gumbo_pool_vector_destroy(node->pool, &doc->children);
+        if (!node->pool) {
+          gumbo_free((void*) doc->name);
+          gumbo_free((void*) doc->public_identifier);
+          gumbo_free((void*) doc->system_identifier);
+        }
       } break;
       case GUMBO_NODE_TEMPLATE:
       case GUMBO_NODE_ELEMENT:
@@ -2371,17 +2627,19 @@ static void free_node(GumboNode* node_to_free) {
           gumbo_vector_add(
               (void*) (node->v.element.children.data[i]), &nodestack);
         }
-        gumbo_free(node->v.element.attributes.data);
-        gumbo_free(node->v.element.children.data);
+        gumbo_pool_vector_destroy(node->pool, &node->v.element.attributes);
+        gumbo_pool_vector_destroy(node->pool, &node->v.element.children);
         break;
       case GUMBO_NODE_TEXT:
       case GUMBO_NODE_CDATA:
       case GUMBO_NODE_COMMENT:
       case GUMBO_NODE_WHITESPACE:
-        gumbo_free((void*) node->v.text.text);
+        if (!node->pool) {
+          gumbo_free((void*) node->v.text.text);
+        }
         break;
     }
-    gumbo_free(node);
+    gumbo_pool_free_node(node);
   }
   gumbo_vector_destroy(&nodestack);
 }
@@ -2436,7 +2694,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
           }
           assert(parser->_output->root != NULL);
           assert(parser->_output->root->type == GUMBO_NODE_ELEMENT);
-          merge_attributes(token, parser->_output->root);
+          merge_attributes(parser, token, parser->_output->root);
           return false;
         case GUMBO_TAG_BASE:
         case GUMBO_TAG_BASEFONT:
@@ -2460,7 +2718,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
             return false;
           }
           state->_frameset_ok = false;
-          merge_attributes(token, state->_open_elements.data[1]);
+          merge_attributes(parser, token, state->_open_elements.data[1]);
           return false;
         case GUMBO_TAG_FRAMESET:
           parser_add_parse_error(parser, token);
@@ -2622,9 +2880,9 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
             // are
             // listed in the spec.)
             if (find_last_anchor_index(parser, &last_a)) {
-              void* last_element = gumbo_vector_remove_at(
-                  last_a, &state->_active_formatting_elements);
-              gumbo_vector_remove(last_element, &state->_open_elements);
+              GumboNode* last_element =
+                  remove_formatting_element_at(state, last_a);
+              remove_open_element(state, last_element);
             }
             success = false;
           }
@@ -2707,7 +2965,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
         }
         case GUMBO_TAG_INPUT:
           if (!attribute_matches(
-                  &token->v.start_tag.attributes, "type", "hidden")) {
+                  &token->v.start_tag.attributes, GUMBO_ATTRIBUTE_TYPE, "hidden")) {
             // Must be before the element is inserted, as that takes ownership
             // of the
             // token's attribute vector.
@@ -2746,10 +3004,11 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
 
           GumboVector* token_attrs = &token->v.start_tag.attributes;
           GumboAttribute* prompt_attr =
-              gumbo_get_attribute(token_attrs, "prompt");
+              gumbo_get_attribute_by_atom(token_attrs, GUMBO_ATTRIBUTE_PROMPT);
           GumboAttribute* action_attr =
-              gumbo_get_attribute(token_attrs, "action");
-          GumboAttribute* name_attr = gumbo_get_attribute(token_attrs, "name");
+              gumbo_get_attribute_by_atom(token_attrs, GUMBO_ATTRIBUTE_ACTION);
+          GumboAttribute* name_attr =
+              gumbo_get_attribute_by_atom(token_attrs, GUMBO_ATTRIBUTE_NAME);
 
           GumboNode* form = insert_element_of_tag_type(
               parser, GUMBO_TAG_FORM, GUMBO_INSERTION_FROM_ISINDEX);
@@ -2757,7 +3016,8 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
             parser->_parser_state->_form_element = form;
           }
           if (action_attr) {
-            gumbo_vector_add(action_attr, &form->v.element.attributes);
+            gumbo_pool_vector_add(
+                form->pool, action_attr, &form->v.element.attributes);
           }
           insert_element_of_tag_type(
               parser, GUMBO_TAG_HR, GUMBO_INSERTION_FROM_ISINDEX);
@@ -2789,7 +3049,8 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
             GumboAttribute* attr = token_attrs->data[i];
             if (attr != prompt_attr && attr != action_attr &&
                 attr != name_attr) {
-              gumbo_vector_add(attr, &input->v.element.attributes);
+              gumbo_pool_vector_add(
+                  input->pool, attr, &input->v.element.attributes);
             }
             token_attrs->data[i] = NULL;
           }
@@ -2810,19 +3071,21 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
             gumbo_destroy_attribute(name_attr);
           }
 
-          GumboAttribute* name = gumbo_malloc(sizeof(GumboAttribute));
+          GumboAttribute* name = gumbo_pool_alloc_attribute(input->pool);
           GumboStringPiece name_str = GUMBO_STRING("name");
           GumboStringPiece isindex_str = GUMBO_STRING("isindex");
           name->attr_namespace = GUMBO_ATTR_NAMESPACE_NONE;
-          name->name = gumbo_strdup("name");
-          name->value = gumbo_strdup("isindex");
+          name->name = gumbo_pool_strdup(input->pool, "name");
+          name->name_atom = GUMBO_ATTRIBUTE_NAME;
+          name->value = gumbo_pool_strdup(input->pool, "isindex");
           name->original_name = name_str;
           name->original_value = isindex_str;
           name->name_start = kGumboEmptySourcePosition;
           name->name_end = kGumboEmptySourcePosition;
           name->value_start = kGumboEmptySourcePosition;
           name->value_end = kGumboEmptySourcePosition;
-          gumbo_vector_add(name, &input->v.element.attributes);
+          gumbo_pool_vector_add(
+              input->pool, name, &input->v.element.attributes);
 
           pop_current_node(parser);  // <input>
           pop_current_node(parser);  // <label>
@@ -3066,10 +3329,9 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
             } else
               record_end_of_element(token, &node->v.element);
 
-            GumboVector* open_elements = &state->_open_elements;
-            int index = gumbo_vector_index_of(open_elements, node);
+            int index = open_element_index(state, node);
             assert(index >= 0);
-            gumbo_vector_remove_at(index, open_elements);
+            remove_open_element_at(state, index);
             return result;
           }
         }
@@ -3338,7 +3600,7 @@ static bool handle_in_table(GumboParser* parser, GumboToken* token) {
 
         case GUMBO_TAG_INPUT:
           if (attribute_matches(
-                  &token->v.start_tag.attributes, "type", "hidden")) {
+                  &token->v.start_tag.attributes, GUMBO_ATTRIBUTE_TYPE, "hidden")) {
             parser_add_parse_error(parser, token);
             insert_element_from_token(parser, token);
             pop_current_node(parser);
@@ -4342,9 +4604,9 @@ static bool handle_in_foreign_content(GumboParser* parser, GumboToken* token) {
               TAG(STRIKE), TAG(SUB), TAG(SUP), TAG(TABLE), TAG(TT), TAG(U),
               TAG(UL), TAG(VAR)}) ||
       (tag_is(token, kStartTag, GUMBO_TAG_FONT) &&
-          (token_has_attribute(token, "color") ||
-              token_has_attribute(token, "face") ||
-              token_has_attribute(token, "size")))) {
+          (token_has_attribute(token, GUMBO_ATTRIBUTE_COLOR) ||
+              token_has_attribute(token, GUMBO_ATTRIBUTE_FACE) ||
+              token_has_attribute(token, GUMBO_ATTRIBUTE_SIZE)))) {
     /* Parse error */
     parser_add_parse_error(parser, token);
 
@@ -4549,18 +4811,8 @@ static void fragment_parser_init(GumboParser* parser, GumboTag fragment_ctx,
   reset_insertion_mode_appropriately(parser);
 }
 
-GumboOutput* gumbo_parse(const char* buffer) {
-  return gumbo_parse_with_options(
-      &kGumboDefaultOptions, buffer, strlen(buffer));
-}
-
-GumboOutput* gumbo_parse_with_options(
-    const GumboOptions* options, const char* buffer, size_t length) {
-  return gumbo_parse_fragment(
-      options, buffer, length, GUMBO_TAG_LAST, GUMBO_NAMESPACE_HTML);
-}
-
-GumboOutput* gumbo_parse_fragment(const GumboOptions* options,
+// Parses into recycled, or a new output if that's NULL.
+static GumboOutput* parse(GumboOutput* recycled, const GumboOptions* options,
     const char* buffer, size_t length, const GumboTag fragment_ctx,
     const GumboNamespaceEnum fragment_namespace) {
   GumboParser parser;
@@ -4568,14 +4820,17 @@ GumboOutput* gumbo_parse_fragment(const GumboOptions* options,
   parser_state_init(&parser);
   // Must come after parser_state_init, since creating the document node must
   // reference parser_state->_current_node.
-  output_init(&parser);
+  output_init(&parser, recycled);
   // And this must come after output_init, because initializing the tokenizer
   // reads the first character and that may cause a UTF-8 decode error
   // (inserting into output->errors) if that's invalid.
   gumbo_tokenizer_state_init(&parser, buffer, length);
 
+  GumboSpeculation* speculation = NULL;
   if (fragment_ctx != GUMBO_TAG_LAST) {
     fragment_parser_init(&parser, fragment_ctx, fragment_namespace);
+  } else {
+    speculation = gumbo_speculation_start(&parser, buffer, length);
   }
 
   GumboParserState* state = parser._parser_state;
@@ -4601,7 +4856,10 @@ GumboOutput* gumbo_parse_fragment(const GumboOptions* options,
       gumbo_tokenizer_set_is_current_node_foreign(&parser,
           current_node &&
               current_node->v.element.tag_namespace != GUMBO_NAMESPACE_HTML);
-      has_error = !gumbo_lex(&parser, &token) || has_error;
+      bool lexed = speculation
+                       ? gumbo_speculation_lex(speculation, &parser, &token)
+                       : gumbo_lex(&parser, &token);
+      has_error = !lexed || has_error;
     }
 #ifdef GUMBO_DEBUG
     const char* token_type = "text";
@@ -4680,7 +4938,13 @@ GumboOutput* gumbo_parse_fragment(const GumboOptions* options,
         // non-void start tag was just processed
         // which the html5 parser treats only as a start tag
         state->_current_token = &injected_token;
-        has_error = !handle_token(&parser, &injected_token) || has_error;
+        // The end tag can be reprocessed in another mode, as </table> is
+        // from a table body; that's the end tag's to finish, not the start
+        // tag's, which may have been ignored and its attributes freed.
+        do {
+          state->_reprocess_current_token = false;
+          has_error = !handle_token(&parser, &injected_token) || has_error;
+        } while (state->_reprocess_current_token);
         inject_end = false;
       }
     }
@@ -4703,29 +4967,57 @@ GumboOutput* gumbo_parse_fragment(const GumboOptions* options,
   // empty strings.
   GumboDocument* doc_type = &parser._output->document->v.document;
   if (doc_type->name == NULL) {
-    doc_type->name = gumbo_strdup("");
+    doc_type->name = gumbo_pool_strdup(parser._output->pool, "");
   }
   if (doc_type->public_identifier == NULL) {
-    doc_type->public_identifier = gumbo_strdup("");
+    doc_type->public_identifier = gumbo_pool_strdup(parser._output->pool, "");
   }
   if (doc_type->system_identifier == NULL) {
-    doc_type->system_identifier = gumbo_strdup("");
+    doc_type->system_identifier = gumbo_pool_strdup(parser._output->pool, "");
   }
 
+  if (speculation) {
+    gumbo_speculation_finish(speculation, &parser);
+  }
   parser_state_destroy(&parser);
   gumbo_tokenizer_state_destroy(&parser);
   return parser._output;
 }
 
+GumboOutput* gumbo_parse(const char* buffer) {
+  return gumbo_parse_with_options(
+      &kGumboDefaultOptions, buffer, strlen(buffer));
+}
+
+GumboOutput* gumbo_parse_with_options(
+    const GumboOptions* options, const char* buffer, size_t length) {
+  return gumbo_parse_fragment(
+      options, buffer, length, GUMBO_TAG_LAST, GUMBO_NAMESPACE_HTML);
+}
+
+GumboOutput* gumbo_parse_fragment(const GumboOptions* options,
+    const char* buffer, size_t length, const GumboTag fragment_ctx,
+    const GumboNamespaceEnum fragment_namespace) {
+  return parse(NULL, options, buffer, length, fragment_ctx, fragment_namespace);
+}
+
+GumboOutput* gumbo_parse_into(GumboOutput* output, const GumboOptions* options,
+    const char* buffer, size_t length) {
+  release_output_contents(output);
+  return parse(
+      output, options, buffer, length, GUMBO_TAG_LAST, GUMBO_NAMESPACE_HTML);
+}
+
 void gumbo_destroy_output(GumboOutput* output) {
-  free_node(output->document);
-  for (unsigned int i = 0; i < output->errors.length; ++i) {
-    gumbo_error_destroy(output->errors.data[i]);
+  release_output_contents(output);
+  if (output->pool) {
+    gumbo_pool_destroy(output->pool);
   }
-  gumbo_vector_destroy(&output->errors);
   gumbo_free(output);
 }
 
-GumboNode* gumbo_create_node(GumboNodeType type) { return create_node(type); }
+GumboNode* gumbo_create_node(GumboNodeType type) {
+  return create_node(NULL, type);
+}
 
 void gumbo_destroy_node(GumboNode* node) { free_node(node); }
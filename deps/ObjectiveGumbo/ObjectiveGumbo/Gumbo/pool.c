@@ -0,0 +1,329 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pool.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "util.h"
+#include "vector.h"
+
+struct GumboInternalPoolChunk {
+  GumboPoolChunk* next;
+  // Bytes available after this header.
+  size_t size;
+};
+
+// A document of a couple of dozen elements fits in the first chunk of each
+// slab; after that chunks double, so even multi-megabyte documents only take a
+// few dozen of them.
+static const size_t kMinChunkSize = 4096;
+static const size_t kMaxChunkSize = 256 * 1024;
+
+// Everything carved from a slab is rounded up to this, which keeps nodes,
+// attributes and vector data aligned without tracking alignment per request.
+#define POOL_ALIGNMENT sizeof(void*)
+
+static void slab_init(GumboSlab* slab) {
+  slab->first = NULL;
+  slab->current = NULL;
+  slab->cursor = NULL;
+  slab->limit = NULL;
+  slab->chunk_size = kMinChunkSize;
+}
+
+static void slab_rewind(GumboSlab* slab) {
+  slab->current = NULL;
+  slab->cursor = NULL;
+  slab->limit = NULL;
+}
+
+static void slab_destroy(GumboSlab* slab) {
+  GumboPoolChunk* chunk = slab->first;
+  while (chunk) {
+    GumboPoolChunk* next = chunk->next;
+    gumbo_free(chunk);
+    chunk = next;
+  }
+}
+
+// Moves the slab on to a chunk with room for size bytes: the next one kept from
+// before a reset if it's big enough, otherwise a new one inserted after the
+// current chunk.  A chunk that's skipped over stays in the list for later.
+static void slab_next_chunk(GumboSlab* slab, size_t size) {
+  GumboPoolChunk* next = slab->current ? slab->current->next : slab->first;
+  if (!next || next->size < size) {
+    size_t chunk_size = slab->chunk_size;
+    if (slab->chunk_size < kMaxChunkSize) {
+      slab->chunk_size *= 2;
+    }
+    if (chunk_size < size) {
+      chunk_size = size;
+    }
+    GumboPoolChunk* chunk = gumbo_malloc(sizeof(GumboPoolChunk) + chunk_size);
+    chunk->next = next;
+    chunk->size = chunk_size;
+    if (slab->current) {
+      slab->current->next = chunk;
+    } else {
+      slab->first = chunk;
+    }
+    next = chunk;
+  }
+  slab->current = next;
+  slab->cursor = (char*) (next + 1);
+  slab->limit = slab->cursor + next->size;
+}
+
+static void* slab_carve(GumboSlab* slab, size_t size) {
+  size = (size + POOL_ALIGNMENT - 1) & ~(POOL_ALIGNMENT - 1);
+  if ((size_t) (slab->limit - slab->cursor) < size) {
+    slab_next_chunk(slab, size);
+  }
+  void* result = slab->cursor;
+  slab->cursor += size;
+  return result;
+}
+
+// Free lists are threaded through the first word of each free block.
+static void* pop_free_block(void** list) {
+  void* block = *list;
+  if (block) {
+    *list = *(void**) block;
+  }
+  return block;
+}
+
+static void push_free_block(void** list, void* block) {
+  *(void**) block = *list;
+  *list = block;
+}
+
+GumboPool* gumbo_pool_create(void) {
+  GumboPool* pool = gumbo_malloc(sizeof(GumboPool));
+  slab_init(&pool->nodes);
+  slab_init(&pool->attributes);
+  slab_init(&pool->bytes);
+  pool->free_nodes = NULL;
+  pool->free_text_nodes = NULL;
+  pool->free_attributes = NULL;
+  memset(pool->free_vectors, 0, sizeof(pool->free_vectors));
+  pool->has_foreign_nodes = false;
+  pool->adopted = NULL;
+  pool->next_adopted = NULL;
+  return pool;
+}
+
+static void destroy_adopted(GumboPool* pool) {
+  GumboPool* adopted = pool->adopted;
+  while (adopted) {
+    GumboPool* next = adopted->next_adopted;
+    gumbo_pool_destroy(adopted);
+    adopted = next;
+  }
+  pool->adopted = NULL;
+}
+
+void gumbo_pool_reset(GumboPool* pool) {
+  slab_rewind(&pool->nodes);
+  slab_rewind(&pool->attributes);
+  slab_rewind(&pool->bytes);
+  pool->free_nodes = NULL;
+  pool->free_text_nodes = NULL;
+  pool->free_attributes = NULL;
+  memset(pool->free_vectors, 0, sizeof(pool->free_vectors));
+  pool->has_foreign_nodes = false;
+  destroy_adopted(pool);
+}
+
+void gumbo_pool_destroy(GumboPool* pool) {
+  destroy_adopted(pool);
+  slab_destroy(&pool->nodes);
+  slab_destroy(&pool->attributes);
+  slab_destroy(&pool->bytes);
+  gumbo_free(pool);
+}
+
+// Text, whitespace, CDATA and comment nodes only use the GumboText member of
+// the union, which is a fraction of the size of a GumboElement with its inline
+// storage, so pooled ones are carved at that size and kept on their own free
+// list.
+static bool is_text_node(GumboNodeType type) {
+  return type != GUMBO_NODE_DOCUMENT && type != GUMBO_NODE_ELEMENT &&
+         type != GUMBO_NODE_TEMPLATE;
+}
+
+static const size_t kTextNodeSize = offsetof(GumboNode, v) + sizeof(GumboText);
+
+GumboNode* gumbo_pool_alloc_node(GumboPool* pool, GumboNodeType type) {
+  GumboNode* node;
+  if (!pool) {
+    node = gumbo_malloc(sizeof(GumboNode));
+  } else if (is_text_node(type)) {
+    node = pop_free_block(&pool->free_text_nodes);
+    if (!node) {
+      node = slab_carve(&pool->nodes, kTextNodeSize);
+    }
+  } else {
+    node = pop_free_block(&pool->free_nodes);
+    if (!node) {
+      node = slab_carve(&pool->nodes, sizeof(GumboNode));
+    }
+  }
+  node->type = type;
+  node->pool = pool;
+  return node;
+}
+
+GumboAttribute* gumbo_pool_alloc_attribute(GumboPool* pool) {
+  GumboAttribute* attr;
+  if (!pool) {
+    attr = gumbo_malloc(sizeof(GumboAttribute));
+  } else {
+    attr = pop_free_block(&pool->free_attributes);
+    if (!attr) {
+      attr = slab_carve(&pool->attributes, sizeof(GumboAttribute));
+    }
+  }
+  attr->pool = pool;
+  return attr;
+}
+
+void gumbo_pool_free_node(GumboNode* node) {
+  if (node->pool) {
+    push_free_block(is_text_node(node->type) ? &node->pool->free_text_nodes
+                                             : &node->pool->free_nodes,
+        node);
+  } else {
+    gumbo_free(node);
+  }
+}
+
+void gumbo_pool_free_attribute(GumboAttribute* attr) {
+  if (attr->pool) {
+    push_free_block(&attr->pool->free_attributes, attr);
+  } else {
+    gumbo_free(attr);
+  }
+}
+
+void gumbo_pool_adopt(GumboPool* pool, GumboPool* other) {
+  other->next_adopted = pool->adopted;
+  pool->adopted = other;
+}
+
+void* gumbo_pool_alloc(GumboPool* pool, size_t size) {
+  return pool ? slab_carve(&pool->bytes, size) : gumbo_malloc(size);
+}
+
+char* gumbo_pool_strndup(GumboPool* pool, const char* data, size_t length) {
+  char* copy = pool ? slab_carve(&pool->bytes, length + 1)
+                    : gumbo_malloc(length + 1);
+  memcpy(copy, data, length);
+  copy[length] = '\0';
+  return copy;
+}
+
+char* gumbo_pool_strdup(GumboPool* pool, const char* str) {
+  return gumbo_pool_strndup(pool, str, strlen(str));
+}
+
+static unsigned int vector_class(size_t capacity) {
+  unsigned int size_class = 0;
+  while (((size_t) 1 << size_class) < capacity) {
+    ++size_class;
+  }
+  assert(size_class < GUMBO_POOL_VECTOR_CLASSES);
+  return size_class;
+}
+
+// Pooled vectors always have a power-of-two capacity, so it gives their class.
+// Inline data belongs to the element it's stored in.
+static void free_vector_data(GumboPool* pool, GumboVector* vector) {
+  if (vector->data && !gumbo_vector_has_inline_data(vector)) {
+    push_free_block(
+        &pool->free_vectors[vector_class(vector->capacity)], vector->data);
+  }
+}
+
+static void** alloc_vector_data(GumboPool* pool, unsigned int size_class) {
+  void** data = pop_free_block(&pool->free_vectors[size_class]);
+  if (!data) {
+    data = slab_carve(&pool->bytes, sizeof(void*) << size_class);
+  }
+  return data;
+}
+
+static void enlarge_vector_if_full(
+    GumboPool* pool, GumboVector* vector, unsigned int new_length) {
+  if (new_length <= vector->capacity) {
+    return;
+  }
+  unsigned int size_class = vector_class(new_length);
+  void** data = alloc_vector_data(pool, size_class);
+  if (vector->length) {
+    memcpy(data, vector->data, sizeof(void*) * vector->length);
+  }
+  free_vector_data(pool, vector);
+  vector->data = data;
+  vector->capacity = 1u << size_class;
+}
+
+void gumbo_pool_vector_init(
+    GumboPool* pool, size_t initial_capacity, GumboVector* vector) {
+  if (!pool) {
+    gumbo_vector_init(initial_capacity, vector);
+    return;
+  }
+  vector->data = NULL;
+  vector->length = 0;
+  vector->capacity = 0;
+  if (initial_capacity) {
+    unsigned int size_class = vector_class(initial_capacity);
+    vector->data = alloc_vector_data(pool, size_class);
+    vector->capacity = 1u << size_class;
+  }
+}
+
+void gumbo_pool_vector_destroy(GumboPool* pool, GumboVector* vector) {
+  if (pool) {
+    free_vector_data(pool, vector);
+  } else {
+    gumbo_vector_destroy(vector);
+  }
+}
+
+void gumbo_pool_vector_add(
+    GumboPool* pool, void* element, GumboVector* vector) {
+  if (!pool) {
+    gumbo_vector_add(element, vector);
+    return;
+  }
+  enlarge_vector_if_full(pool, vector, vector->length + 1);
+  vector->data[vector->length++] = element;
+}
+
+void gumbo_pool_vector_insert_at(
+    GumboPool* pool, void* element, int index, GumboVector* vector) {
+  if (!pool) {
+    gumbo_vector_insert_at(element, index, vector);
+    return;
+  }
+  assert(index >= 0);
+  assert((unsigned int) index <= vector->length);
+  enlarge_vector_if_full(pool, vector, vector->length + 1);
+  memmove(&vector->data[index + 1], &vector->data[index],
+      sizeof(void*) * (vector->length - index));
+  vector->data[index] = element;
+  ++vector->length;
+}
@@ -0,0 +1,126 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Storage for the tree of a parse.  Nodes and attributes are carved from slabs
+// of their own type, and strings and the data arrays of children and attribute
+// vectors from a slab of bytes, so that a whole tree is released (or, through
+// gumbo_parse_into, reused) a chunk at a time instead of with one free per
+// allocation.
+//
+// Nodes and attributes record the pool they were carved from, and it's NULL for
+// those allocated individually (gumbo_create_node and the gumbo_edit.h
+// constructors).  Every function here falls back to the heap when given a NULL
+// pool, so code that edits a tree can just pass node->pool along.
+
+#ifndef GUMBO_POOL_H_
+#define GUMBO_POOL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gumbo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Pooled vector data comes in power-of-two capacities, one free list for each.
+#define GUMBO_POOL_VECTOR_CLASSES 32
+
+typedef struct GumboInternalPoolChunk GumboPoolChunk;
+
+typedef struct {
+  // Every chunk the slab has allocated, in the order they're carved from.  A
+  // reset rewinds to the first one rather than freeing them.
+  GumboPoolChunk* first;
+  GumboPoolChunk* current;
+  char* cursor;
+  char* limit;
+
+  // Size of the next chunk to allocate; it doubles up to a limit, so that big
+  // documents don't need many chunks and small ones don't waste much.
+  size_t chunk_size;
+} GumboSlab;
+
+struct GumboInternalPool {
+  GumboSlab nodes;
+  GumboSlab attributes;
+  GumboSlab bytes;
+
+  // Storage given back before the pool is reset, linked through its first
+  // word.  Strings are never given back.
+  void* free_nodes;
+  void* free_text_nodes;
+  void* free_attributes;
+  void* free_vectors[GUMBO_POOL_VECTOR_CLASSES];
+
+  // Set once an individually allocated node is attached to a tree in this
+  // pool, which then has to be walked for nodes to free one by one before the
+  // pool can go.
+  bool has_foreign_nodes;
+
+  // Pools whose storage the tree may point into, such as those tokens were
+  // carved from on other threads (see speculation.h); they live until this pool
+  // is reset or destroyed.  Linked through next_adopted.
+  struct GumboInternalPool* adopted;
+  struct GumboInternalPool* next_adopted;
+};
+
+GumboPool* gumbo_pool_create(void);
+
+// Makes all the storage carved from the pool available again, keeping the
+// chunks it was carved from.
+void gumbo_pool_reset(GumboPool* pool);
+
+void gumbo_pool_destroy(GumboPool* pool);
+
+// Hands other over to pool, which destroys it along with itself or on its next
+// reset.  Nodes, attributes and vector data from other keep their pool fields,
+// so anything given back goes on other's free lists.
+void gumbo_pool_adopt(GumboPool* pool, GumboPool* other);
+
+// Allocates a node or attribute with its pool field (and a node's type) set.
+// Everything else is left for the caller to initialize.  A pooled node of a
+// text type is only big enough for a GumboText, so it must not be copied by
+// value or have its type changed to a non-text one.
+GumboNode* gumbo_pool_alloc_node(GumboPool* pool, GumboNodeType type);
+GumboAttribute* gumbo_pool_alloc_attribute(GumboPool* pool);
+
+// Frees a node or attribute alone, whether pooled or not; nothing it points to
+// is touched.
+void gumbo_pool_free_node(GumboNode* node);
+void gumbo_pool_free_attribute(GumboAttribute* attr);
+
+// Allocates size bytes, aligned for a pointer, that last as long as the pool.
+void* gumbo_pool_alloc(GumboPool* pool, size_t size);
+
+// Returns a NUL-terminated copy of a string.  A pooled copy can't be freed
+// before the pool is; callers check the owning node or attribute's pool field
+// before calling gumbo_free.
+char* gumbo_pool_strndup(GumboPool* pool, const char* data, size_t length);
+char* gumbo_pool_strdup(GumboPool* pool, const char* str);
+
+// Counterparts of the vector.h functions that allocate or free, for vectors
+// owned by a node or attribute from pool.  The others (index_of, remove_at,
+// pop) work on pooled vectors unchanged.
+void gumbo_pool_vector_init(
+    GumboPool* pool, size_t initial_capacity, GumboVector* vector);
+void gumbo_pool_vector_destroy(GumboPool* pool, GumboVector* vector);
+void gumbo_pool_vector_add(GumboPool* pool, void* element, GumboVector* vector);
+void gumbo_pool_vector_insert_at(
+    GumboPool* pool, void* element, int index, GumboVector* vector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GUMBO_POOL_H_
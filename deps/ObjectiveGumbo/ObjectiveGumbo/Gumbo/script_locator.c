@@ -0,0 +1,1955 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// gumbo_locate_scripts: runs the tokenizer over a document without building a
+// tree, keeping only as much of the tree builder's state as decides which start
+// tags become script elements and which tokenizer state the text after a start
+// tag is read in.  That is:
+//
+// - the elements whose text is RCDATA, RAWTEXT or PLAINTEXT, so that markup in
+//   a <textarea> or <style> isn't mistaken for a script;
+// - the stack of open elements, as far as it decides when SVG or MathML
+//   content is open: a <script> there is an SVG script whose text is ordinary
+//   markup.  Integration points and breakout tags, which return to HTML, are
+//   followed as the tree builder does, as are the end tags that close an
+//   element (by name and in scope, the way each is matched) and the elements
+//   that table parts imply and close;
+// - the list of active formatting elements, with its markers, since the
+//   adoption agency and the reconstruction of formatting elements push and
+//   pop elements that a later end tag might stop at;
+// - whether a <select> is open, since it ignores most start tags, and whether
+//   it's in a table, where table tags close it;
+// - whether a <form> is open, since another is ignored; and
+// - whether the body has been started, and whether a <frameset> would still
+//   replace it, dropping the scripts in it; after one is accepted, scripts are
+//   ignored.
+//
+// Foster parenting moves elements out of a table without changing the stack,
+// so it isn't modelled.  The few constructs that aren't followed (the table
+// modes a template's content switches it to, a template in a select, and a
+// <script/> that a select or template leaves open under XHTML rules) mark the
+// locator unsure, and gumbo_locate_scripts parses those documents in full.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "gumbo.h"
+#include "parser.h"
+#include "pool.h"
+#include "script_locator.h"
+#include "tokenizer.h"
+#include "util.h"
+#include "vector.h"
+
+typedef struct GumboInternalOpenElement {
+  GumboTag tag;
+  GumboNamespaceEnum tag_namespace;
+  // An HTML or MathML text integration point: start tags inside it are HTML
+  // (for MathML text integration points, all but <mglyph> and <malignmark>).
+  bool is_integration_point;
+  // Numbers the elements pushed, from 1, for the list of formatting elements.
+  unsigned int id;
+  // The name as written, which is what foreign end tags are matched against.
+  GumboStringPiece name;
+} OpenElement;
+
+// An entry in the list of active formatting elements: the element's tag and
+// number, which is 0 for the markers that cells, captions, templates and
+// <applet>, <marquee> and <object> add.
+typedef struct GumboInternalFormattingEntry {
+  GumboTag tag;
+  unsigned int id;
+  // The element's attributes, hashed, to tell identical elements apart.
+  unsigned int attributes;
+} FormattingEntry;
+
+static bool is_mathml_text_integration_point(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_MI:
+    case GUMBO_TAG_MO:
+    case GUMBO_TAG_MN:
+    case GUMBO_TAG_MS:
+    case GUMBO_TAG_MTEXT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool is_integration_point(GumboNamespaceEnum tag_namespace,
+    GumboTag tag, const GumboVector* attributes) {
+  if (tag_namespace == GUMBO_NAMESPACE_SVG) {
+    return tag == GUMBO_TAG_FOREIGNOBJECT || tag == GUMBO_TAG_DESC ||
+           tag == GUMBO_TAG_TITLE;
+  }
+  assert(tag_namespace == GUMBO_NAMESPACE_MATHML);
+  if (is_mathml_text_integration_point(tag)) {
+    return true;
+  }
+  if (tag != GUMBO_TAG_ANNOTATION_XML) {
+    return false;
+  }
+  const GumboAttribute* encoding = gumbo_get_attribute(attributes, "encoding");
+  return encoding &&
+         (!strcasecmp(encoding->value, "text/html") ||
+             !strcasecmp(encoding->value, "application/xhtml+xml"));
+}
+
+// Start tags that end foreign content and are handled as HTML.
+// http://www.whatwg.org/specs/web-apps/current-work/complete/tokenization.html#parsing-main-inforeign
+static bool is_breakout_tag(const GumboTokenStartTag* start_tag) {
+  switch (start_tag->tag) {
+    case GUMBO_TAG_B:
+    case GUMBO_TAG_BIG:
+    case GUMBO_TAG_BLOCKQUOTE:
+    case GUMBO_TAG_BODY:
+    case GUMBO_TAG_BR:
+    case GUMBO_TAG_CENTER:
+    case GUMBO_TAG_CODE:
+    case GUMBO_TAG_DD:
+    case GUMBO_TAG_DIV:
+    case GUMBO_TAG_DL:
+    case GUMBO_TAG_DT:
+    case GUMBO_TAG_EM:
+    case GUMBO_TAG_EMBED:
+    case GUMBO_TAG_H1:
+    case GUMBO_TAG_H2:
+    case GUMBO_TAG_H3:
+    case GUMBO_TAG_H4:
+    case GUMBO_TAG_H5:
+    case GUMBO_TAG_H6:
+    case GUMBO_TAG_HEAD:
+    case GUMBO_TAG_HR:
+    case GUMBO_TAG_I:
+    case GUMBO_TAG_IMG:
+    case GUMBO_TAG_LI:
+    case GUMBO_TAG_LISTING:
+    case GUMBO_TAG_MENU:
+    case GUMBO_TAG_META:
+    case GUMBO_TAG_NOBR:
+    case GUMBO_TAG_OL:
+    case GUMBO_TAG_P:
+    case GUMBO_TAG_PRE:
+    case GUMBO_TAG_RUBY:
+    case GUMBO_TAG_S:
+    case GUMBO_TAG_SMALL:
+    case GUMBO_TAG_SPAN:
+    case GUMBO_TAG_STRONG:
+    case GUMBO_TAG_STRIKE:
+    case GUMBO_TAG_SUB:
+    case GUMBO_TAG_SUP:
+    case GUMBO_TAG_TABLE:
+    case GUMBO_TAG_TT:
+    case GUMBO_TAG_U:
+    case GUMBO_TAG_UL:
+    case GUMBO_TAG_VAR:
+      return true;
+    case GUMBO_TAG_FONT:
+      return gumbo_get_attribute(&start_tag->attributes, "color") ||
+             gumbo_get_attribute(&start_tag->attributes, "face") ||
+             gumbo_get_attribute(&start_tag->attributes, "size");
+    default:
+      return false;
+  }
+}
+
+// Start tags that can come before the body without starting it: the ones the
+// tree builder puts in the head, and <frameset>, which takes the body's place.
+// Any other start tag, or text that isn't whitespace, starts the body.
+static bool is_head_tag(GumboTag tag, bool head_closed) {
+  switch (tag) {
+    case GUMBO_TAG_HTML:
+    case GUMBO_TAG_HEAD:
+    case GUMBO_TAG_BASE:
+    case GUMBO_TAG_BASEFONT:
+    case GUMBO_TAG_BGSOUND:
+    case GUMBO_TAG_LINK:
+    case GUMBO_TAG_META:
+    case GUMBO_TAG_NOFRAMES:
+    case GUMBO_TAG_SCRIPT:
+    case GUMBO_TAG_STYLE:
+    case GUMBO_TAG_TEMPLATE:
+    case GUMBO_TAG_TITLE:
+    case GUMBO_TAG_FRAMESET:
+      return true;
+    case GUMBO_TAG_MENUITEM:
+    case GUMBO_TAG_NOSCRIPT:
+      // Only the head takes these; once it's closed they go in the body.
+      return !head_closed;
+    default:
+      return false;
+  }
+}
+
+// Under XHTML rules, the self-closing start tags that go in the head until
+// it's closed, rather than starting the body.
+static bool is_closed_head_tag(GumboTag tag, bool head_closed) {
+  switch (tag) {
+    case GUMBO_TAG_IFRAME:
+    case GUMBO_TAG_NOEMBED:
+    case GUMBO_TAG_NOSCRIPT:
+    case GUMBO_TAG_TEXTAREA:
+    case GUMBO_TAG_XMP:
+      return !head_closed;
+    default:
+      return false;
+  }
+}
+
+// Start tags that the tree builder's body rules clear the frameset-ok flag
+// for.  Others, like formatting elements, <div> and <p>, leave a <frameset>
+// free to replace the body.
+static bool sets_frameset_not_ok(const GumboTokenStartTag* start_tag) {
+  switch (start_tag->tag) {
+    case GUMBO_TAG_APPLET:
+    case GUMBO_TAG_AREA:
+    case GUMBO_TAG_BODY:
+    case GUMBO_TAG_BR:
+    case GUMBO_TAG_BUTTON:
+    case GUMBO_TAG_DD:
+    case GUMBO_TAG_DT:
+    case GUMBO_TAG_EMBED:
+    case GUMBO_TAG_HR:
+    case GUMBO_TAG_IFRAME:
+    case GUMBO_TAG_IMAGE:
+    case GUMBO_TAG_IMG:
+    case GUMBO_TAG_ISINDEX:
+    case GUMBO_TAG_KEYGEN:
+    case GUMBO_TAG_LI:
+    case GUMBO_TAG_LISTING:
+    case GUMBO_TAG_MARQUEE:
+    case GUMBO_TAG_OBJECT:
+    case GUMBO_TAG_PRE:
+    case GUMBO_TAG_SELECT:
+    case GUMBO_TAG_TABLE:
+    case GUMBO_TAG_TEMPLATE:
+    case GUMBO_TAG_TEXTAREA:
+    case GUMBO_TAG_WBR:
+    case GUMBO_TAG_XMP:
+      return true;
+    case GUMBO_TAG_INPUT: {
+      const GumboAttribute* type = gumbo_get_attribute_by_atom(
+          &start_tag->attributes, GUMBO_ATTRIBUTE_TYPE);
+      return !type || strcasecmp(type->value, "hidden");
+    }
+    default:
+      return false;
+  }
+}
+
+// The elements that an end tag with no rules of its own stops at, rather than
+// closing an element of its name further up.
+static bool is_special(const OpenElement* element) {
+  switch (element->tag_namespace) {
+    case GUMBO_NAMESPACE_HTML:
+      switch (element->tag) {
+        case GUMBO_TAG_ADDRESS:
+        case GUMBO_TAG_APPLET:
+        case GUMBO_TAG_AREA:
+        case GUMBO_TAG_ARTICLE:
+        case GUMBO_TAG_ASIDE:
+        case GUMBO_TAG_BASE:
+        case GUMBO_TAG_BASEFONT:
+        case GUMBO_TAG_BGSOUND:
+        case GUMBO_TAG_BLOCKQUOTE:
+        case GUMBO_TAG_BODY:
+        case GUMBO_TAG_BR:
+        case GUMBO_TAG_BUTTON:
+        case GUMBO_TAG_CAPTION:
+        case GUMBO_TAG_CENTER:
+        case GUMBO_TAG_COL:
+        case GUMBO_TAG_COLGROUP:
+        case GUMBO_TAG_MENUITEM:
+        case GUMBO_TAG_DD:
+        case GUMBO_TAG_DETAILS:
+        case GUMBO_TAG_DIR:
+        case GUMBO_TAG_DIV:
+        case GUMBO_TAG_DL:
+        case GUMBO_TAG_DT:
+        case GUMBO_TAG_EMBED:
+        case GUMBO_TAG_FIELDSET:
+        case GUMBO_TAG_FIGCAPTION:
+        case GUMBO_TAG_FIGURE:
+        case GUMBO_TAG_FOOTER:
+        case GUMBO_TAG_FORM:
+        case GUMBO_TAG_FRAME:
+        case GUMBO_TAG_FRAMESET:
+        case GUMBO_TAG_H1:
+        case GUMBO_TAG_H2:
+        case GUMBO_TAG_H3:
+        case GUMBO_TAG_H4:
+        case GUMBO_TAG_H5:
+        case GUMBO_TAG_H6:
+        case GUMBO_TAG_HEAD:
+        case GUMBO_TAG_HEADER:
+        case GUMBO_TAG_HGROUP:
+        case GUMBO_TAG_HR:
+        case GUMBO_TAG_HTML:
+        case GUMBO_TAG_IFRAME:
+        case GUMBO_TAG_IMG:
+        case GUMBO_TAG_INPUT:
+        case GUMBO_TAG_ISINDEX:
+        case GUMBO_TAG_LI:
+        case GUMBO_TAG_LINK:
+        case GUMBO_TAG_LISTING:
+        case GUMBO_TAG_MARQUEE:
+        case GUMBO_TAG_MENU:
+        case GUMBO_TAG_META:
+        case GUMBO_TAG_NAV:
+        case GUMBO_TAG_NOEMBED:
+        case GUMBO_TAG_NOFRAMES:
+        case GUMBO_TAG_NOSCRIPT:
+        case GUMBO_TAG_OBJECT:
+        case GUMBO_TAG_OL:
+        case GUMBO_TAG_P:
+        case GUMBO_TAG_PARAM:
+        case GUMBO_TAG_PLAINTEXT:
+        case GUMBO_TAG_PRE:
+        case GUMBO_TAG_SCRIPT:
+        case GUMBO_TAG_SECTION:
+        case GUMBO_TAG_SELECT:
+        case GUMBO_TAG_STYLE:
+        case GUMBO_TAG_SUMMARY:
+        case GUMBO_TAG_TABLE:
+        case GUMBO_TAG_TBODY:
+        case GUMBO_TAG_TD:
+        case GUMBO_TAG_TEMPLATE:
+        case GUMBO_TAG_TEXTAREA:
+        case GUMBO_TAG_TFOOT:
+        case GUMBO_TAG_TH:
+        case GUMBO_TAG_THEAD:
+        case GUMBO_TAG_TITLE:
+        case GUMBO_TAG_TR:
+        case GUMBO_TAG_UL:
+        case GUMBO_TAG_WBR:
+        case GUMBO_TAG_XMP:
+          return true;
+        default:
+          return false;
+      }
+    case GUMBO_NAMESPACE_SVG:
+      return element->tag == GUMBO_TAG_FOREIGNOBJECT ||
+             element->tag == GUMBO_TAG_DESC || element->tag == GUMBO_TAG_TITLE;
+    case GUMBO_NAMESPACE_MATHML:
+      return is_mathml_text_integration_point(element->tag) ||
+             element->tag == GUMBO_TAG_ANNOTATION_XML;
+    default:
+      return false;
+  }
+}
+
+// End tags that the body's rules look for in scope, and close along with
+// everything in them, or that run the adoption agency.  Any other end tag
+// closes an element of its name only if no special element is open inside it.
+// Table end tags have rules of their own.
+static bool closes_in_scope(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_A:
+    case GUMBO_TAG_ADDRESS:
+    case GUMBO_TAG_APPLET:
+    case GUMBO_TAG_ARTICLE:
+    case GUMBO_TAG_ASIDE:
+    case GUMBO_TAG_B:
+    case GUMBO_TAG_BIG:
+    case GUMBO_TAG_BLOCKQUOTE:
+    case GUMBO_TAG_BUTTON:
+    case GUMBO_TAG_CENTER:
+    case GUMBO_TAG_CODE:
+    case GUMBO_TAG_COLGROUP:
+    case GUMBO_TAG_DD:
+    case GUMBO_TAG_DETAILS:
+    case GUMBO_TAG_DIR:
+    case GUMBO_TAG_DIV:
+    case GUMBO_TAG_DL:
+    case GUMBO_TAG_DT:
+    case GUMBO_TAG_EM:
+    case GUMBO_TAG_FIELDSET:
+    case GUMBO_TAG_FIGCAPTION:
+    case GUMBO_TAG_FIGURE:
+    case GUMBO_TAG_FONT:
+    case GUMBO_TAG_FOOTER:
+    case GUMBO_TAG_FORM:
+    case GUMBO_TAG_H1:
+    case GUMBO_TAG_H2:
+    case GUMBO_TAG_H3:
+    case GUMBO_TAG_H4:
+    case GUMBO_TAG_H5:
+    case GUMBO_TAG_H6:
+    case GUMBO_TAG_HEADER:
+    case GUMBO_TAG_HGROUP:
+    case GUMBO_TAG_I:
+    case GUMBO_TAG_LI:
+    case GUMBO_TAG_LISTING:
+    case GUMBO_TAG_MARQUEE:
+    case GUMBO_TAG_MENU:
+    case GUMBO_TAG_NAV:
+    case GUMBO_TAG_NOBR:
+    case GUMBO_TAG_OBJECT:
+    case GUMBO_TAG_OL:
+    case GUMBO_TAG_P:
+    case GUMBO_TAG_PRE:
+    case GUMBO_TAG_S:
+    case GUMBO_TAG_SECTION:
+    case GUMBO_TAG_SMALL:
+    case GUMBO_TAG_STRIKE:
+    case GUMBO_TAG_STRONG:
+    case GUMBO_TAG_SUMMARY:
+    case GUMBO_TAG_TT:
+    case GUMBO_TAG_U:
+    case GUMBO_TAG_UL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Elements that never have an end tag.
+static bool is_void_element(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_AREA:
+    case GUMBO_TAG_BASE:
+    case GUMBO_TAG_BASEFONT:
+    case GUMBO_TAG_BGSOUND:
+    case GUMBO_TAG_BR:
+    case GUMBO_TAG_COL:
+    case GUMBO_TAG_EMBED:
+    case GUMBO_TAG_FRAME:
+    case GUMBO_TAG_HR:
+    case GUMBO_TAG_IMAGE:
+    case GUMBO_TAG_IMG:
+    case GUMBO_TAG_INPUT:
+    case GUMBO_TAG_ISINDEX:
+    case GUMBO_TAG_KEYGEN:
+    case GUMBO_TAG_LINK:
+    case GUMBO_TAG_MENUITEM:
+    case GUMBO_TAG_META:
+    case GUMBO_TAG_PARAM:
+    case GUMBO_TAG_SOURCE:
+    case GUMBO_TAG_TRACK:
+    case GUMBO_TAG_WBR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The elements that bound the scope an HTML end tag is looked for in.
+static bool is_scope_boundary(const OpenElement* element) {
+  switch (element->tag_namespace) {
+    case GUMBO_NAMESPACE_HTML:
+      switch (element->tag) {
+        case GUMBO_TAG_APPLET:
+        case GUMBO_TAG_CAPTION:
+        case GUMBO_TAG_HTML:
+        case GUMBO_TAG_TABLE:
+        case GUMBO_TAG_TD:
+        case GUMBO_TAG_TH:
+        case GUMBO_TAG_MARQUEE:
+        case GUMBO_TAG_OBJECT:
+        case GUMBO_TAG_TEMPLATE:
+          return true;
+        default:
+          return false;
+      }
+    case GUMBO_NAMESPACE_SVG:
+      return element->is_integration_point;
+    case GUMBO_NAMESPACE_MATHML:
+      return is_mathml_text_integration_point(element->tag) ||
+             element->tag == GUMBO_TAG_ANNOTATION_XML;
+    default:
+      return false;
+  }
+}
+
+static OpenElement* current_element(GumboScriptLocator* state) {
+  return state->open_length ? &state->open_elements[state->open_length - 1]
+                            : NULL;
+}
+
+static bool is_in_foreign_element(GumboScriptLocator* state) {
+  const OpenElement* current = current_element(state);
+  return current && current->tag_namespace != GUMBO_NAMESPACE_HTML;
+}
+
+// Pushes an HTML element that no tag opened, like the <tbody> a row implies.
+static void push_implied_element(GumboScriptLocator* state, GumboTag tag) {
+  if (state->open_length == state->open_capacity) {
+    state->open_capacity = state->open_capacity ? state->open_capacity * 2 : 16;
+    state->open_elements = gumbo_realloc(
+        state->open_elements, sizeof(OpenElement) * state->open_capacity);
+  }
+  OpenElement* element = &state->open_elements[state->open_length++];
+  element->tag = tag;
+  element->tag_namespace = GUMBO_NAMESPACE_HTML;
+  element->is_integration_point = false;
+  element->id = ++state->last_element_id;
+  element->name = kGumboEmptyString;
+}
+
+static void push_element(GumboScriptLocator* state,
+    GumboNamespaceEnum tag_namespace, const GumboToken* token) {
+  const GumboTokenStartTag* start_tag = &token->v.start_tag;
+  push_implied_element(state, start_tag->tag);
+  OpenElement* element = &state->open_elements[state->open_length - 1];
+  element->tag_namespace = tag_namespace;
+  element->name = token->original_text;
+  gumbo_tag_from_original_text(&element->name);
+  element->is_integration_point =
+      tag_namespace != GUMBO_NAMESPACE_HTML &&
+      is_integration_point(
+          tag_namespace, start_tag->tag, &start_tag->attributes);
+}
+
+// The elements the tree builder keeps in its list of active formatting
+// elements.
+static bool is_formatting_tag(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_A:
+    case GUMBO_TAG_B:
+    case GUMBO_TAG_BIG:
+    case GUMBO_TAG_CODE:
+    case GUMBO_TAG_EM:
+    case GUMBO_TAG_FONT:
+    case GUMBO_TAG_I:
+    case GUMBO_TAG_NOBR:
+    case GUMBO_TAG_S:
+    case GUMBO_TAG_SMALL:
+    case GUMBO_TAG_STRIKE:
+    case GUMBO_TAG_STRONG:
+    case GUMBO_TAG_TT:
+    case GUMBO_TAG_U:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The elements that add a marker to the list of formatting elements, and
+// clear it back to that when they're closed.
+static bool is_marker_tag(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_APPLET:
+    case GUMBO_TAG_CAPTION:
+    case GUMBO_TAG_MARQUEE:
+    case GUMBO_TAG_OBJECT:
+    case GUMBO_TAG_TD:
+    case GUMBO_TAG_TEMPLATE:
+    case GUMBO_TAG_TH:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Inserts an entry into the list of formatting elements, before the one at an
+// index.
+static void insert_formatting_entry(GumboScriptLocator* state,
+    unsigned int index, GumboTag tag, unsigned int id,
+    unsigned int attributes) {
+  if (state->formatting_length == state->formatting_capacity) {
+    state->formatting_capacity =
+        state->formatting_capacity ? state->formatting_capacity * 2 : 16;
+    state->formatting = gumbo_realloc(state->formatting,
+        sizeof(FormattingEntry) * state->formatting_capacity);
+  }
+  memmove(&state->formatting[index + 1], &state->formatting[index],
+      sizeof(FormattingEntry) * (state->formatting_length - index));
+  ++state->formatting_length;
+  FormattingEntry* entry = &state->formatting[index];
+  entry->tag = tag;
+  entry->id = id;
+  entry->attributes = attributes;
+}
+
+static void remove_formatting_entry(
+    GumboScriptLocator* state, unsigned int index) {
+  memmove(&state->formatting[index], &state->formatting[index + 1],
+      sizeof(FormattingEntry) * (state->formatting_length - index - 1));
+  --state->formatting_length;
+}
+
+// The index of the last entry for the tag after the last marker, or -1.
+static int find_formatting_entry(GumboScriptLocator* state, GumboTag tag) {
+  for (unsigned int i = state->formatting_length; i > 0; --i) {
+    const FormattingEntry* entry = &state->formatting[i - 1];
+    if (!entry->id) {
+      break;
+    }
+    if (entry->tag == tag) {
+      return (int) (i - 1);
+    }
+  }
+  return -1;
+}
+
+// The index of the entry for the open element with the number anywhere in the
+// list, or -1.
+static int find_listed_element(GumboScriptLocator* state, unsigned int id) {
+  for (unsigned int i = state->formatting_length; i > 0; --i) {
+    if (state->formatting[i - 1].id == id) {
+      return (int) (i - 1);
+    }
+  }
+  return -1;
+}
+
+// The index of the open element with the number, or -1.
+static int find_open_element(GumboScriptLocator* state, unsigned int id) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    if (state->open_elements[i - 1].id == id) {
+      return (int) (i - 1);
+    }
+  }
+  return -1;
+}
+
+static void remove_open_element(GumboScriptLocator* state, unsigned int index) {
+  memmove(&state->open_elements[index], &state->open_elements[index + 1],
+      sizeof(OpenElement) * (state->open_length - index - 1));
+  --state->open_length;
+}
+
+// Inserts an HTML element into the stack, before the one at an index.
+static void insert_open_element(
+    GumboScriptLocator* state, unsigned int index, GumboTag tag) {
+  push_implied_element(state, tag);
+  OpenElement element = state->open_elements[state->open_length - 1];
+  memmove(&state->open_elements[index + 1], &state->open_elements[index],
+      sizeof(OpenElement) * (state->open_length - 1 - index));
+  state->open_elements[index] = element;
+}
+
+// Pops the stack down to a length.  A select popped with it is closed.
+// Returns whether a cell or caption was popped, which is when the tree builder
+// clears the formatting elements opened in it.
+static bool pop_elements_to(GumboScriptLocator* state, unsigned int length) {
+  bool closed_cell = false;
+  while (state->open_length > length) {
+    const OpenElement* popped = &state->open_elements[--state->open_length];
+    if (popped->tag_namespace != GUMBO_NAMESPACE_HTML) {
+      continue;
+    }
+    if (popped->tag == GUMBO_TAG_SELECT) {
+      state->in_select = false;
+      state->in_select_in_table = false;
+    } else if (popped->tag == GUMBO_TAG_TD || popped->tag == GUMBO_TAG_TH ||
+               popped->tag == GUMBO_TAG_CAPTION) {
+      closed_cell = true;
+    }
+  }
+  return closed_cell;
+}
+
+// Removes the formatting elements after the last marker, and the marker.  The
+// tree builder does this once for each cell, caption, <applet>, <marquee>,
+// <object> or template it closes, however many of them it pops.
+static void clear_formatting_to_marker(GumboScriptLocator* state) {
+  while (state->formatting_length &&
+         state->formatting[--state->formatting_length].id) {
+  }
+}
+
+// Reopens the formatting elements after the last marker that something other
+// than their own end tags closed, as the tree builder does before most content
+// in the body.
+static void reconstruct_formatting_elements(GumboScriptLocator* state) {
+  unsigned int first = state->formatting_length;
+  while (first > 0 && state->formatting[first - 1].id &&
+         find_open_element(state, state->formatting[first - 1].id) < 0) {
+    --first;
+  }
+  for (unsigned int i = first; i < state->formatting_length; ++i) {
+    push_implied_element(state, state->formatting[i].tag);
+    state->formatting[i].id = state->last_element_id;
+  }
+}
+
+// Whether a <template> is open.  Before the body, one can only be in the head,
+// and what's in it doesn't start the body.
+static bool has_open_template(GumboScriptLocator* state) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+        element->tag == GUMBO_TAG_TEMPLATE) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Notes that the body has something in it, if it hadn't yet.  The scripts
+// recorded before this are in the head.
+static void start_body(GumboScriptLocator* state) {
+  if (!state->body_started) {
+    state->body_started = true;
+    state->head_scripts = state->result ? state->result->scripts.length : 0;
+  }
+}
+
+// A <frameset> that takes the body's place: it removes the body, with every
+// script in it, and from then on the tree builder ignores all but <noframes>.
+static void accept_frameset(GumboScriptLocator* state) {
+  if (state->result && state->body_started) {
+    state->result->scripts.length = state->head_scripts;
+  }
+  state->open_length = 0;
+  state->in_frameset = true;
+}
+
+// Pops foreign elements until the current one is an HTML element or an
+// integration point.
+static void pop_foreign_content(GumboScriptLocator* state) {
+  while (is_in_foreign_element(state) &&
+         !current_element(state)->is_integration_point) {
+    --state->open_length;
+  }
+}
+
+// The parts of a table below <table> itself: outside a table the body ignores
+// them, and in a template they switch it to one of the table modes.
+static bool is_table_part_tag(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_CAPTION:
+    case GUMBO_TAG_COL:
+    case GUMBO_TAG_COLGROUP:
+    case GUMBO_TAG_TBODY:
+    case GUMBO_TAG_TFOOT:
+    case GUMBO_TAG_THEAD:
+    case GUMBO_TAG_TR:
+    case GUMBO_TAG_TD:
+    case GUMBO_TAG_TH:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// How much of the stack is the innermost open <table> or <template> and what's
+// under it, or 0 if neither is open.
+static unsigned int innermost_table_or_template(GumboScriptLocator* state) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+        (element->tag == GUMBO_TAG_TABLE ||
+            element->tag == GUMBO_TAG_TEMPLATE)) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+static bool is_table_tag(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_CAPTION:
+    case GUMBO_TAG_TABLE:
+    case GUMBO_TAG_TBODY:
+    case GUMBO_TAG_TFOOT:
+    case GUMBO_TAG_THEAD:
+    case GUMBO_TAG_TR:
+    case GUMBO_TAG_TD:
+    case GUMBO_TAG_TH:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The elements whose whitespace the table's rules insert as it is.
+static bool is_table_text_parent(const OpenElement* element) {
+  if (!element || element->tag_namespace != GUMBO_NAMESPACE_HTML) {
+    return false;
+  }
+  switch (element->tag) {
+    case GUMBO_TAG_COLGROUP:
+    case GUMBO_TAG_TABLE:
+    case GUMBO_TAG_TBODY:
+    case GUMBO_TAG_TFOOT:
+    case GUMBO_TAG_THEAD:
+    case GUMBO_TAG_TR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether the tree builder would be in one of its table modes (in table, in
+// table body, in row or in column group), rather than in a cell, a caption or
+// the body.  Elements foster parented out of a table, and foreign ones, don't
+// change the mode, so they're passed over.
+static bool is_in_table_mode(GumboScriptLocator* state) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace != GUMBO_NAMESPACE_HTML) {
+      continue;
+    }
+    switch (element->tag) {
+      case GUMBO_TAG_TABLE:
+      case GUMBO_TAG_TBODY:
+      case GUMBO_TAG_THEAD:
+      case GUMBO_TAG_TFOOT:
+      case GUMBO_TAG_TR:
+      case GUMBO_TAG_COLGROUP:
+        return true;
+      case GUMBO_TAG_TD:
+      case GUMBO_TAG_TH:
+      case GUMBO_TAG_CAPTION:
+      case GUMBO_TAG_HTML:
+      case GUMBO_TAG_TEMPLATE:
+        return false;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
+// Pops the stack down to a length in a table, closing the cell or caption
+// that's popped with it.
+static void pop_table_parts_to(GumboScriptLocator* state, unsigned int length) {
+  if (pop_elements_to(state, length)) {
+    clear_formatting_to_marker(state);
+  }
+}
+
+// Pops the innermost open table and everything in it.
+static void close_table(GumboScriptLocator* state) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+        element->tag == GUMBO_TAG_TABLE) {
+      pop_table_parts_to(state, i - 1);
+      return;
+    }
+  }
+}
+
+// A table part start tag, from anywhere in the innermost table (whose length
+// of the stack is given): as the tree builder does, it closes the cell, row,
+// section, caption or column group that it can't go in, and opens the ones it
+// has to be in that aren't open.  <col> goes in the column group that's open
+// over everything, if there is one.
+static void open_table_part(
+    GumboScriptLocator* state, GumboTag tag, unsigned int table_length) {
+  unsigned int section_length = 0, row_length = 0;
+  for (unsigned int i = table_length; i < state->open_length; ++i) {
+    const OpenElement* element = &state->open_elements[i];
+    if (element->tag_namespace != GUMBO_NAMESPACE_HTML) {
+      continue;
+    }
+    if (!section_length && (element->tag == GUMBO_TAG_TBODY ||
+                               element->tag == GUMBO_TAG_THEAD ||
+                               element->tag == GUMBO_TAG_TFOOT)) {
+      section_length = i + 1;
+    } else if (section_length && !row_length && element->tag == GUMBO_TAG_TR) {
+      row_length = i + 1;
+    }
+  }
+
+  switch (tag) {
+    case GUMBO_TAG_TD:
+    case GUMBO_TAG_TH:
+      if (row_length) {
+        pop_table_parts_to(state, row_length);
+        return;
+      }
+      // Fall through.
+    case GUMBO_TAG_TR:
+      if (section_length) {
+        pop_table_parts_to(state, section_length);
+      } else {
+        pop_table_parts_to(state, table_length);
+        push_implied_element(state, GUMBO_TAG_TBODY);
+      }
+      if (tag != GUMBO_TAG_TR) {
+        push_implied_element(state, GUMBO_TAG_TR);
+      }
+      return;
+    case GUMBO_TAG_COL: {
+      const OpenElement* current = current_element(state);
+      if (current->tag_namespace == GUMBO_NAMESPACE_HTML &&
+          current->tag == GUMBO_TAG_COLGROUP) {
+        return;
+      }
+      pop_table_parts_to(state, table_length);
+      push_implied_element(state, GUMBO_TAG_COLGROUP);
+      return;
+    }
+    default:
+      pop_table_parts_to(state, table_length);
+      return;
+  }
+}
+
+// Pops the innermost open HTML element with the tag, and everything in it, if
+// there is one.  Returns whether a cell or caption was popped.
+static bool pop_to_element(GumboScriptLocator* state, GumboTag tag) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+        element->tag == tag) {
+      return pop_elements_to(state, i - 1);
+    }
+  }
+  return false;
+}
+
+// Closes the innermost <p> if one is open in button scope, as the block-level
+// start tags do.
+static void close_p_in_button_scope(GumboScriptLocator* state) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML) {
+      if (element->tag == GUMBO_TAG_P) {
+        pop_elements_to(state, i - 1);
+        return;
+      }
+      if (element->tag == GUMBO_TAG_BUTTON) {
+        return;
+      }
+    }
+    if (is_scope_boundary(element)) {
+      return;
+    }
+  }
+}
+
+// Closes the list item a new <li>, or <dd> or <dt>, ends: the innermost open
+// one of those tags, unless a special element other than <address>, <div> or
+// <p> is open inside it.
+static void close_list_item(GumboScriptLocator* state, GumboTag tag) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML) {
+      bool matches = tag == GUMBO_TAG_LI
+                         ? element->tag == GUMBO_TAG_LI
+                         : element->tag == GUMBO_TAG_DD ||
+                               element->tag == GUMBO_TAG_DT;
+      if (matches) {
+        pop_elements_to(state, i - 1);
+        return;
+      }
+      if (element->tag == GUMBO_TAG_ADDRESS || element->tag == GUMBO_TAG_DIV ||
+          element->tag == GUMBO_TAG_P) {
+        continue;
+      }
+    }
+    if (is_special(element)) {
+      return;
+    }
+  }
+}
+
+static bool is_heading(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_H1:
+    case GUMBO_TAG_H2:
+    case GUMBO_TAG_H3:
+    case GUMBO_TAG_H4:
+    case GUMBO_TAG_H5:
+    case GUMBO_TAG_H6:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Pops the innermost open HTML element with the tag, and everything in it, if
+// it's in scope.
+static void pop_in_scope(GumboScriptLocator* state, GumboTag tag) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+        element->tag == tag) {
+      pop_elements_to(state, i - 1);
+      return;
+    }
+    if (is_scope_boundary(element)) {
+      return;
+    }
+  }
+}
+
+// Whether an HTML element with the tag is open in scope.
+static bool has_in_scope(GumboScriptLocator* state, GumboTag tag) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+        element->tag == tag) {
+      return true;
+    }
+    if (is_scope_boundary(element)) {
+      return false;
+    }
+  }
+  return false;
+}
+
+// The adoption agency, which a formatting element's end tag runs, and an <a>
+// or <nobr> start tag that finds one open, as the tree builder has it: it
+// closes the last formatting element of the tag, if it's in scope.  Elements
+// open inside it stay open if they're special, or inside one that is; the
+// formatting element is reopened inside the innermost of those, and the
+// others in between are reopened or closed.
+static void adopt_formatting_element(GumboScriptLocator* state, GumboTag tag) {
+  const OpenElement* current = current_element(state);
+  if (current && current->tag_namespace == GUMBO_NAMESPACE_HTML &&
+      current->tag == tag && find_listed_element(state, current->id) < 0) {
+    pop_elements_to(state, state->open_length - 1);
+    return;
+  }
+
+  for (int round = 0; round < 8; ++round) {
+    int formatting_index = find_formatting_entry(state, tag);
+    if (formatting_index < 0) {
+      return;
+    }
+    FormattingEntry formatting = state->formatting[formatting_index];
+    int formatting_open = find_open_element(state, formatting.id);
+    if (formatting_open < 0) {
+      remove_formatting_entry(state, formatting_index);
+      return;
+    }
+    if (!has_in_scope(state, tag)) {
+      return;
+    }
+
+    int furthest = -1;
+    for (unsigned int i = formatting_open; i < state->open_length; ++i) {
+      if (is_special(&state->open_elements[i])) {
+        furthest = (int) i;
+        break;
+      }
+    }
+    if (furthest < 0) {
+      pop_elements_to(state, formatting_open + 1);
+      --state->open_length;
+      remove_formatting_entry(state, formatting_index);
+      return;
+    }
+
+    // Walks up from the furthest block to the formatting element.
+    int bookmark = formatting_index + 1;
+    unsigned int furthest_id = state->open_elements[furthest].id;
+    unsigned int node_id = furthest_id, last_id = furthest_id;
+    int saved_index = furthest;
+    for (int step = 1;; ++step) {
+      int node_index = find_open_element(state, node_id);
+      if (node_index < 0) {
+        node_index = saved_index;
+      }
+      saved_index = --node_index;
+      OpenElement* node = &state->open_elements[node_index];
+      node_id = node->id;
+      if (node_id == formatting.id) {
+        break;
+      }
+      int entry = find_listed_element(state, node_id);
+      if (step > 3 && entry >= 0) {
+        remove_formatting_entry(state, entry);
+        if (entry < bookmark) {
+          --bookmark;
+        }
+        continue;
+      }
+      if (entry < 0) {
+        remove_open_element(state, node_index);
+        continue;
+      }
+      node->id = node_id = ++state->last_element_id;
+      state->formatting[entry].id = node_id;
+      if (last_id == furthest_id) {
+        bookmark = entry + 1;
+      }
+      last_id = node_id;
+    }
+
+    // The formatting element is reopened inside the furthest block.
+    formatting_index = find_listed_element(state, formatting.id);
+    if (formatting_index < bookmark) {
+      --bookmark;
+    }
+    remove_formatting_entry(state, formatting_index);
+    remove_open_element(state, find_open_element(state, formatting.id));
+    insert_open_element(
+        state, find_open_element(state, furthest_id) + 1, formatting.tag);
+    insert_formatting_entry(state, bookmark, formatting.tag,
+        state->last_element_id, formatting.attributes);
+  }
+}
+
+// Start tags that close an open <p> first.  <table> only does outside quirks
+// mode, which isn't followed.
+static bool closes_p(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_ADDRESS:
+    case GUMBO_TAG_ARTICLE:
+    case GUMBO_TAG_ASIDE:
+    case GUMBO_TAG_BLOCKQUOTE:
+    case GUMBO_TAG_CENTER:
+    case GUMBO_TAG_DD:
+    case GUMBO_TAG_DETAILS:
+    case GUMBO_TAG_DIR:
+    case GUMBO_TAG_DIV:
+    case GUMBO_TAG_DL:
+    case GUMBO_TAG_DT:
+    case GUMBO_TAG_FIELDSET:
+    case GUMBO_TAG_FIGCAPTION:
+    case GUMBO_TAG_FIGURE:
+    case GUMBO_TAG_FOOTER:
+    case GUMBO_TAG_FORM:
+    case GUMBO_TAG_H1:
+    case GUMBO_TAG_H2:
+    case GUMBO_TAG_H3:
+    case GUMBO_TAG_H4:
+    case GUMBO_TAG_H5:
+    case GUMBO_TAG_H6:
+    case GUMBO_TAG_HEADER:
+    case GUMBO_TAG_HGROUP:
+    case GUMBO_TAG_HR:
+    case GUMBO_TAG_LI:
+    case GUMBO_TAG_LISTING:
+    case GUMBO_TAG_MENU:
+    case GUMBO_TAG_NAV:
+    case GUMBO_TAG_OL:
+    case GUMBO_TAG_P:
+    case GUMBO_TAG_PLAINTEXT:
+    case GUMBO_TAG_PRE:
+    case GUMBO_TAG_SECTION:
+    case GUMBO_TAG_SUMMARY:
+    case GUMBO_TAG_UL:
+    case GUMBO_TAG_XMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether an HTML element is open inside the innermost table, or is that table.
+static bool has_in_table_scope(GumboScriptLocator* state, GumboTag tag) {
+  for (unsigned int i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace != GUMBO_NAMESPACE_HTML) {
+      continue;
+    }
+    if (element->tag == tag) {
+      return true;
+    }
+    if (element->tag == GUMBO_TAG_TABLE || element->tag == GUMBO_TAG_HTML ||
+        element->tag == GUMBO_TAG_TEMPLATE) {
+      return false;
+    }
+  }
+  return false;
+}
+
+// Nothing but the select's own options are pushed while it's open, so it's in
+// select scope unless something else was left open over it.
+static bool is_select_in_select_scope(GumboScriptLocator* state) {
+  const OpenElement* current = current_element(state);
+  return current && current->tag_namespace == GUMBO_NAMESPACE_HTML &&
+         current->tag == GUMBO_TAG_SELECT;
+}
+
+// Pops the innermost open select and everything in it.
+static void close_select(GumboScriptLocator* state) {
+  pop_to_element(state, GUMBO_TAG_SELECT);
+  state->in_select = false;
+  state->in_select_in_table = false;
+}
+
+// Whether a start tag is handled by the rules for foreign content rather than
+// HTML ones.
+static bool in_foreign_content(
+    GumboScriptLocator* state, const GumboTokenStartTag* start_tag) {
+  if (!is_in_foreign_element(state)) {
+    return false;
+  }
+  const OpenElement* current = current_element(state);
+  if (!current->is_integration_point) {
+    return true;
+  }
+  if (current->tag_namespace == GUMBO_NAMESPACE_MATHML &&
+      is_mathml_text_integration_point(current->tag)) {
+    return start_tag->tag == GUMBO_TAG_MGLYPH ||
+           start_tag->tag == GUMBO_TAG_MALIGNMARK;
+  }
+  return false;
+}
+
+// Whether the body's rules reopen formatting elements before a start tag:
+// they do for inline content, but not for blocks, head content, table parts,
+// or elements whose text isn't markup.
+static bool reconstructs_formatting(
+    const GumboTokenStartTag* start_tag, bool is_closed) {
+  switch (start_tag->tag) {
+    case GUMBO_TAG_XMP:
+      return !is_closed;
+    case GUMBO_TAG_BASE:
+    case GUMBO_TAG_BASEFONT:
+    case GUMBO_TAG_BGSOUND:
+    case GUMBO_TAG_BODY:
+    case GUMBO_TAG_CAPTION:
+    case GUMBO_TAG_COL:
+    case GUMBO_TAG_COLGROUP:
+    case GUMBO_TAG_DIALOG:
+    case GUMBO_TAG_FORM:
+    case GUMBO_TAG_FRAME:
+    case GUMBO_TAG_FRAMESET:
+    case GUMBO_TAG_HEAD:
+    case GUMBO_TAG_HTML:
+    case GUMBO_TAG_IFRAME:
+    case GUMBO_TAG_ISINDEX:
+    case GUMBO_TAG_LINK:
+    case GUMBO_TAG_MAIN:
+    case GUMBO_TAG_MENUITEM:
+    case GUMBO_TAG_META:
+    case GUMBO_TAG_NOEMBED:
+    case GUMBO_TAG_NOFRAMES:
+    case GUMBO_TAG_PARAM:
+    case GUMBO_TAG_RB:
+    case GUMBO_TAG_RP:
+    case GUMBO_TAG_RT:
+    case GUMBO_TAG_RTC:
+    case GUMBO_TAG_SCRIPT:
+    case GUMBO_TAG_SOURCE:
+    case GUMBO_TAG_STYLE:
+    case GUMBO_TAG_TABLE:
+    case GUMBO_TAG_TBODY:
+    case GUMBO_TAG_TD:
+    case GUMBO_TAG_TEMPLATE:
+    case GUMBO_TAG_TEXTAREA:
+    case GUMBO_TAG_TFOOT:
+    case GUMBO_TAG_TH:
+    case GUMBO_TAG_THEAD:
+    case GUMBO_TAG_TITLE:
+    case GUMBO_TAG_TR:
+    case GUMBO_TAG_TRACK:
+      return false;
+    default:
+      return !closes_p(start_tag->tag) && !is_heading(start_tag->tag);
+  }
+}
+
+static bool is_hidden_input(const GumboTokenStartTag* start_tag) {
+  const GumboAttribute* type = gumbo_get_attribute_by_atom(
+      &start_tag->attributes, GUMBO_ATTRIBUTE_TYPE);
+  return type && !strcasecmp(type->value, "hidden");
+}
+
+// A hash of a start tag's attributes that doesn't depend on their order.
+static unsigned int hash_attributes(const GumboVector* attributes) {
+  unsigned int hash = attributes->length;
+  for (unsigned int i = 0; i < attributes->length; ++i) {
+    const GumboAttribute* attr = attributes->data[i];
+    unsigned int attribute_hash = 2166136261u;
+    for (const char* c = attr->name; *c; ++c) {
+      attribute_hash = (attribute_hash ^ (unsigned char) *c) * 16777619u;
+    }
+    attribute_hash = (attribute_hash ^ '=') * 16777619u;
+    for (const char* c = attr->value; *c; ++c) {
+      attribute_hash = (attribute_hash ^ (unsigned char) *c) * 16777619u;
+    }
+    hash += attribute_hash;
+  }
+  return hash;
+}
+
+// Adds an element just pushed to the list of formatting elements, if it's one
+// of them, or a marker for it.  Like the tree builder, the list keeps no more
+// than three identical elements after the last marker, dropping the earliest.
+static void add_to_formatting_list(
+    GumboScriptLocator* state, const GumboTokenStartTag* start_tag) {
+  if (is_marker_tag(start_tag->tag)) {
+    insert_formatting_entry(
+        state, state->formatting_length, start_tag->tag, 0, 0);
+    return;
+  }
+  if (!is_formatting_tag(start_tag->tag)) {
+    return;
+  }
+  unsigned int attributes = hash_attributes(&start_tag->attributes);
+  unsigned int identical = 0, earliest = 0;
+  for (unsigned int i = state->formatting_length;
+       i > 0 && state->formatting[i - 1].id; --i) {
+    const FormattingEntry* entry = &state->formatting[i - 1];
+    if (entry->tag == start_tag->tag && entry->attributes == attributes) {
+      ++identical;
+      earliest = i - 1;
+    }
+  }
+  if (identical >= 3) {
+    remove_formatting_entry(state, earliest);
+  }
+  insert_formatting_entry(state, state->formatting_length, start_tag->tag,
+      state->last_element_id, attributes);
+}
+
+static void begin_script(GumboScriptLocator* state, GumboToken* token) {
+  if (state->result) {
+    GumboScript* script =
+        gumbo_pool_alloc(state->result->pool, sizeof(GumboScript));
+    script->start_tag = token->original_text;
+    script->start_pos = token->position;
+    // The script takes the token's attributes, as the tree builder's elements
+    // do.
+    script->attributes = token->v.start_tag.attributes;
+    token->v.start_tag.attributes = kGumboEmptyVector;
+    script->body.data = token->original_text.data + token->original_text.length;
+    script->body.length = 0;
+    script->end_tag = kGumboEmptyString;
+    gumbo_vector_add(script, &state->result->scripts);
+    state->open_script = script;
+  }
+
+  if (state->parser->_options->use_xhtml_rules &&
+      token->v.start_tag.is_self_closing) {
+    // A self-closing <script/> is empty in XHTML, and its start tag stands in
+    // for the end tag, as it does in the tree.  A select, or a template before
+    // its content, ignores the injected end tag, leaving the script open over
+    // whatever follows.
+    if (state->in_select || has_open_template(state)) {
+      state->is_unsure = true;
+    }
+    if (state->open_script) {
+      state->open_script->end_tag = token->original_text;
+      state->open_script = NULL;
+    }
+    return;
+  }
+  gumbo_tokenizer_set_state(state->parser, GUMBO_LEX_SCRIPT);
+  state->in_script = true;
+}
+
+static void end_script(GumboScriptLocator* state, const GumboToken* token) {
+  GumboScript* script = state->open_script;
+  if (script) {
+    const char* end = token->original_text.data;
+    script->body.length = end - script->body.data;
+    if (token->type == GUMBO_TOKEN_END_TAG) {
+      script->end_tag = token->original_text;
+    }
+    state->open_script = NULL;
+  }
+  state->in_script = false;
+}
+
+// Sets the tokenizer state that the tree builder would for an HTML start tag.
+static void handle_html_start_tag(GumboScriptLocator* state, GumboToken* token) {
+  GumboTokenStartTag* start_tag = &token->v.start_tag;
+  GumboParser* parser = state->parser;
+  // Under XHTML rules a self-closing element is closed straight away.  <html>
+  // and <body> only ever add attributes to the ones already open.
+  bool is_closed = parser->_options->use_xhtml_rules &&
+                   start_tag->is_self_closing;
+  if (state->in_frameset) {
+    if (start_tag->tag == GUMBO_TAG_NOFRAMES && !is_closed) {
+      gumbo_tokenizer_set_state(parser, GUMBO_LEX_RAWTEXT);
+      state->in_text_element = true;
+    }
+    return;
+  }
+
+  if (state->in_select) {
+    switch (start_tag->tag) {
+      case GUMBO_TAG_SCRIPT:
+        if (parser->_options->use_xhtml_rules && start_tag->is_self_closing) {
+          // The select rules ignore the end tag injected for a <script/>, so
+          // the element stays open (as an ordinary one) over the select.
+          push_element(state, GUMBO_NAMESPACE_HTML, token);
+        }
+        begin_script(state, token);
+        return;
+      case GUMBO_TAG_SELECT:
+        if (is_select_in_select_scope(state)) {
+          close_select(state);
+        }
+        return;
+      case GUMBO_TAG_TEMPLATE:
+        // A template opens over the select, and its content is handled as
+        // it would be in the body until it closes; that isn't followed.
+        state->is_unsure = true;
+        return;
+      case GUMBO_TAG_INPUT:
+      case GUMBO_TAG_KEYGEN:
+      case GUMBO_TAG_TEXTAREA:
+        // These close the select and are then handled as usual.
+        if (!is_select_in_select_scope(state)) {
+          return;
+        }
+        close_select(state);
+        break;
+      default:
+        if (state->in_select_in_table && is_table_tag(start_tag->tag)) {
+          close_select(state);
+          break;
+        }
+        // Everything else in a select is ignored.
+        return;
+    }
+  }
+
+  if (!state->body_started &&
+      !is_head_tag(start_tag->tag, state->head_closed) &&
+      !(is_closed && is_closed_head_tag(start_tag->tag, state->head_closed)) &&
+      !has_open_template(state)) {
+    start_body(state);
+  }
+  // The head's rules leave frameset-ok alone, but for a template's.
+  if (sets_frameset_not_ok(start_tag) &&
+      (state->body_started || start_tag->tag == GUMBO_TAG_TEMPLATE)) {
+    state->frameset_ok = false;
+  }
+
+  // A column group is closed by anything but a column.
+  const OpenElement* current = current_element(state);
+  if (current && current->tag_namespace == GUMBO_NAMESPACE_HTML &&
+      current->tag == GUMBO_TAG_COLGROUP && start_tag->tag != GUMBO_TAG_COL &&
+      start_tag->tag != GUMBO_TAG_TEMPLATE) {
+    pop_elements_to(state, state->open_length - 1);
+  }
+
+  // A table start tag in a table, but not in one of its cells or its caption,
+  // closes that table before it opens its own.
+  if (start_tag->tag == GUMBO_TAG_TABLE && is_in_table_mode(state)) {
+    close_table(state);
+  }
+
+  if (is_table_part_tag(start_tag->tag)) {
+    unsigned int context_length = innermost_table_or_template(state);
+    if (!context_length) {
+      // Outside a table the body ignores these.
+      return;
+    }
+    if (state->open_elements[context_length - 1].tag == GUMBO_TAG_TEMPLATE) {
+      // The template switches to a table mode, which ignores most of what
+      // follows.
+      state->is_unsure = true;
+    } else {
+      open_table_part(state, start_tag->tag, context_length);
+    }
+  }
+
+  switch (start_tag->tag) {
+    case GUMBO_TAG_A: {
+      // A link in a link closes the outer one first, and takes it off the
+      // stack if it's out of scope.
+      int index = find_formatting_entry(state, GUMBO_TAG_A);
+      if (index >= 0) {
+        adopt_formatting_element(state, GUMBO_TAG_A);
+        index = find_formatting_entry(state, GUMBO_TAG_A);
+      }
+      if (index >= 0) {
+        int open_index = find_open_element(state, state->formatting[index].id);
+        if (open_index >= 0) {
+          remove_open_element(state, open_index);
+        }
+        remove_formatting_entry(state, index);
+      }
+      break;
+    }
+    case GUMBO_TAG_NOBR:
+      // So does a <nobr> in one.
+      reconstruct_formatting_elements(state);
+      if (has_in_scope(state, GUMBO_TAG_NOBR)) {
+        adopt_formatting_element(state, GUMBO_TAG_NOBR);
+      }
+      break;
+    case GUMBO_TAG_BUTTON:
+      pop_in_scope(state, GUMBO_TAG_BUTTON);
+      break;
+    case GUMBO_TAG_FORM: {
+      // Outside a template, a form in a form is ignored, and one in a table
+      // is closed straight away.
+      bool in_template = has_open_template(state);
+      if (state->has_form && !in_template) {
+        return;
+      }
+      if (!in_template && !is_closed) {
+        state->has_form = true;
+      }
+      if (is_in_table_mode(state)) {
+        return;
+      }
+      break;
+    }
+    case GUMBO_TAG_LI:
+    case GUMBO_TAG_DD:
+    case GUMBO_TAG_DT:
+      close_list_item(state, start_tag->tag);
+      break;
+    default:
+      break;
+  }
+  if (closes_p(start_tag->tag)) {
+    close_p_in_button_scope(state);
+  }
+  // A heading in a heading, or an option in an option, closes the first.
+  current = current_element(state);
+  if (current && current->tag_namespace == GUMBO_NAMESPACE_HTML &&
+      ((is_heading(start_tag->tag) && is_heading(current->tag)) ||
+          ((start_tag->tag == GUMBO_TAG_OPTION ||
+               start_tag->tag == GUMBO_TAG_OPTGROUP) &&
+              current->tag == GUMBO_TAG_OPTION))) {
+    pop_elements_to(state, state->open_length - 1);
+  }
+  if (reconstructs_formatting(start_tag, is_closed) &&
+      !(start_tag->tag == GUMBO_TAG_INPUT && is_in_table_mode(state) &&
+          is_hidden_input(start_tag))) {
+    reconstruct_formatting_elements(state);
+  }
+
+  // The head is closed before anything but head content, and a frameset is
+  // either ignored or replaces everything, so neither is kept on the stack,
+  // where a later end tag would stop at them.
+  if (!is_closed && !is_void_element(start_tag->tag) &&
+      start_tag->tag != GUMBO_TAG_SCRIPT && start_tag->tag != GUMBO_TAG_HTML &&
+      start_tag->tag != GUMBO_TAG_BODY && start_tag->tag != GUMBO_TAG_HEAD &&
+      start_tag->tag != GUMBO_TAG_FRAMESET) {
+    GumboNamespaceEnum tag_namespace = GUMBO_NAMESPACE_HTML;
+    if (start_tag->tag == GUMBO_TAG_SVG) {
+      tag_namespace = GUMBO_NAMESPACE_SVG;
+    } else if (start_tag->tag == GUMBO_TAG_MATH) {
+      tag_namespace = GUMBO_NAMESPACE_MATHML;
+    }
+    // Even without XHTML rules, a self-closing <svg/> or <math/> is closed.
+    if (tag_namespace == GUMBO_NAMESPACE_HTML || !start_tag->is_self_closing) {
+      push_element(state, tag_namespace, token);
+      if (tag_namespace == GUMBO_NAMESPACE_HTML) {
+        add_to_formatting_list(state, start_tag);
+      }
+    }
+  }
+
+  switch (start_tag->tag) {
+    case GUMBO_TAG_SCRIPT:
+      begin_script(state, token);
+      break;
+    case GUMBO_TAG_TITLE:
+    case GUMBO_TAG_TEXTAREA:
+      if (!is_closed) {
+        gumbo_tokenizer_set_state(parser, GUMBO_LEX_RCDATA);
+        state->in_text_element = true;
+      }
+      break;
+    case GUMBO_TAG_STYLE:
+    case GUMBO_TAG_XMP:
+    case GUMBO_TAG_IFRAME:
+    case GUMBO_TAG_NOEMBED:
+    case GUMBO_TAG_NOFRAMES:
+      if (!is_closed) {
+        gumbo_tokenizer_set_state(parser, GUMBO_LEX_RAWTEXT);
+        state->in_text_element = true;
+      }
+      break;
+    case GUMBO_TAG_PLAINTEXT:
+      gumbo_tokenizer_set_state(parser, GUMBO_LEX_PLAINTEXT);
+      break;
+    case GUMBO_TAG_SELECT:
+      if (!is_closed) {
+        state->in_select = true;
+        // The select itself has just been pushed.
+        state->in_select_in_table = has_in_table_scope(state, GUMBO_TAG_TABLE);
+      }
+      break;
+    case GUMBO_TAG_FRAMESET:
+      // Before the body, a frameset takes its place (unless it's in a
+      // template in the head); after, it replaces the body while nothing has
+      // cleared frameset-ok.
+      if (state->body_started ? state->frameset_ok
+                              : !has_open_template(state)) {
+        accept_frameset(state);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+static void handle_start_tag(GumboScriptLocator* state, GumboToken* token) {
+  GumboTokenStartTag* start_tag = &token->v.start_tag;
+  if (in_foreign_content(state, start_tag)) {
+    if (is_breakout_tag(start_tag)) {
+      pop_foreign_content(state);
+      handle_html_start_tag(state, token);
+    } else if (!start_tag->is_self_closing) {
+      const OpenElement* current = current_element(state);
+      GumboNamespaceEnum tag_namespace = current->tag_namespace;
+      if (start_tag->tag == GUMBO_TAG_SVG &&
+          current->tag == GUMBO_TAG_ANNOTATION_XML) {
+        tag_namespace = GUMBO_NAMESPACE_SVG;
+      }
+      push_element(state, tag_namespace, token);
+    }
+    return;
+  }
+  handle_html_start_tag(state, token);
+}
+
+static void handle_end_tag(GumboScriptLocator* state, const GumboToken* token) {
+  GumboTag tag = token->v.end_tag;
+  // In RCDATA and RAWTEXT the tokenizer only ends text at the element's own end
+  // tag.
+  state->in_text_element = false;
+  if (!state->body_started && !has_open_template(state)) {
+    // Before the body, </head> closes the head, and </body>, </html> and
+    // </br> start the body; other end tags are ignored.
+    if (tag == GUMBO_TAG_HEAD) {
+      state->head_closed = true;
+    } else if (tag == GUMBO_TAG_BODY || tag == GUMBO_TAG_HTML ||
+               tag == GUMBO_TAG_BR) {
+      start_body(state);
+    }
+  }
+  if (state->in_select) {
+    if (tag == GUMBO_TAG_SELECT) {
+      if (is_select_in_select_scope(state)) {
+        close_select(state);
+      }
+      return;
+    }
+    // </template> is handled as usual, as is a table end tag that closes a
+    // select in a table, if there's something for it to close.  Other end
+    // tags are ignored.
+    if (tag != GUMBO_TAG_TEMPLATE) {
+      if (!state->in_select_in_table || !is_table_tag(tag) ||
+          !has_in_table_scope(state, tag)) {
+        return;
+      }
+      close_select(state);
+    }
+  }
+  // In foreign content, an end tag closes the innermost foreign element it
+  // names, and everything in it.  The names are compared as written, ignoring
+  // case, so an unknown tag only closes an element of the same name.
+  GumboStringPiece name = token->original_text;
+  gumbo_tag_from_original_text(&name);
+  unsigned int i = state->open_length;
+  while (i > 0 &&
+         state->open_elements[i - 1].tag_namespace != GUMBO_NAMESPACE_HTML) {
+    if (gumbo_string_equals_ignore_case(
+            &state->open_elements[--i].name, &name)) {
+      state->open_length = i;
+      return;
+    }
+  }
+  // Otherwise it's handled by the HTML rules, from the current node: it closes
+  // the innermost HTML element it names, if that's in scope, or for an end tag
+  // without rules of its own, if no special element is open inside that.
+  // </body> and </html> only change the insertion mode.
+  if (tag == GUMBO_TAG_BODY || tag == GUMBO_TAG_HTML) {
+    return;
+  }
+  // A column group is closed by any end tag but a column's, and only its own
+  // closes it where it can't be.
+  const OpenElement* current = current_element(state);
+  if (current && current->tag_namespace == GUMBO_NAMESPACE_HTML &&
+      current->tag == GUMBO_TAG_COLGROUP && tag != GUMBO_TAG_COL &&
+      tag != GUMBO_TAG_TEMPLATE) {
+    pop_elements_to(state, state->open_length - 1);
+    if (tag == GUMBO_TAG_COLGROUP) {
+      return;
+    }
+  }
+  if (tag == GUMBO_TAG_COLGROUP) {
+    return;
+  }
+  // </template> closes the innermost template, wherever it is, and table end
+  // tags close what they name in table scope, with any cell or caption in it.
+  // The tree builder looks for <applet>, <marquee> and <object> in table scope
+  // too.
+  if (tag == GUMBO_TAG_TEMPLATE) {
+    if (has_open_template(state)) {
+      pop_to_element(state, tag);
+      clear_formatting_to_marker(state);
+    }
+    return;
+  }
+  if (is_table_tag(tag) || tag == GUMBO_TAG_APPLET ||
+      tag == GUMBO_TAG_MARQUEE || tag == GUMBO_TAG_OBJECT) {
+    if (has_in_table_scope(state, tag) &&
+        (pop_to_element(state, tag) || !is_table_tag(tag))) {
+      clear_formatting_to_marker(state);
+    }
+    return;
+  }
+  if (is_formatting_tag(tag)) {
+    adopt_formatting_element(state, tag);
+    return;
+  }
+  if (tag == GUMBO_TAG_BR) {
+    // </br> is taken for <br>.
+    reconstruct_formatting_elements(state);
+    return;
+  }
+  if (tag == GUMBO_TAG_FORM && !has_open_template(state)) {
+    // Outside a template, </form> closes the form the tree builder points at,
+    // if it's in scope, and nothing in it.
+    bool has_form = state->has_form;
+    state->has_form = false;
+    for (i = state->open_length; has_form && i > 0; --i) {
+      const OpenElement* element = &state->open_elements[i - 1];
+      if (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+          element->tag == GUMBO_TAG_FORM) {
+        memmove(&state->open_elements[i - 1], &state->open_elements[i],
+            sizeof(OpenElement) * (state->open_length - i));
+        --state->open_length;
+        return;
+      }
+      if (is_scope_boundary(element)) {
+        return;
+      }
+    }
+    return;
+  }
+  // Headings close each other; </li> stops at a list, and </p> at a button.
+  bool is_scoped = closes_in_scope(tag);
+  for (i = state->open_length; i > 0; --i) {
+    const OpenElement* element = &state->open_elements[i - 1];
+    if (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+        (element->tag == tag ||
+            (is_heading(tag) && is_heading(element->tag)))) {
+      pop_elements_to(state, i - 1);
+      return;
+    }
+    if (!is_scoped) {
+      if (is_special(element)) {
+        return;
+      }
+    } else if (is_scope_boundary(element) ||
+               (element->tag_namespace == GUMBO_NAMESPACE_HTML &&
+                   ((tag == GUMBO_TAG_LI && (element->tag == GUMBO_TAG_OL ||
+                                                element->tag == GUMBO_TAG_UL)) ||
+                       (tag == GUMBO_TAG_P &&
+                           element->tag == GUMBO_TAG_BUTTON)))) {
+      return;
+    }
+  }
+}
+
+void gumbo_script_locator_init(GumboScriptLocator* locator,
+    GumboParser* parser, GumboScriptList* result) {
+  memset(locator, 0, sizeof(*locator));
+  locator->parser = parser;
+  locator->result = result;
+  locator->frameset_ok = true;
+}
+
+bool gumbo_script_locator_prepare(GumboScriptLocator* locator) {
+  bool is_foreign = is_in_foreign_element(locator);
+  gumbo_tokenizer_set_is_current_node_foreign(locator->parser, is_foreign);
+  return is_foreign;
+}
+
+void gumbo_script_locator_handle_token(
+    GumboScriptLocator* locator, GumboToken* token) {
+  if (locator->in_script) {
+    // Script data ends at its end tag or the end of the buffer; whatever comes
+    // in between is the script's text.
+    if (token->type == GUMBO_TOKEN_END_TAG || token->type == GUMBO_TOKEN_EOF) {
+      end_script(locator, token);
+    }
+    return;
+  }
+
+  switch (token->type) {
+    case GUMBO_TOKEN_START_TAG:
+      handle_start_tag(locator, token);
+      break;
+    case GUMBO_TOKEN_END_TAG:
+      handle_end_tag(locator, token);
+      break;
+    case GUMBO_TOKEN_WHITESPACE:
+    case GUMBO_TOKEN_CHARACTER:
+    case GUMBO_TOKEN_CDATA:
+    case GUMBO_TOKEN_NULL: {
+      // Text in an RCDATA or RAWTEXT element, a select or a frameset leaves
+      // frameset-ok alone.  Anywhere else it starts the body, unless it's in a
+      // template in the head, or it's whitespace; a NUL, which the body
+      // ignores, clears nothing.  The body's rules reopen formatting elements
+      // before text, but foreign content's don't, and neither do a table's
+      // for whitespace.
+      if (locator->in_text_element || locator->in_select ||
+          locator->in_frameset) {
+        break;
+      }
+      const OpenElement* current = current_element(locator);
+      bool is_foreign = current &&
+                        current->tag_namespace != GUMBO_NAMESPACE_HTML &&
+                        !current->is_integration_point;
+      if (token->type == GUMBO_TOKEN_WHITESPACE) {
+        if (!is_foreign && !is_table_text_parent(current)) {
+          reconstruct_formatting_elements(locator);
+        }
+        break;
+      }
+      if (!locator->body_started && !has_open_template(locator)) {
+        start_body(locator);
+      }
+      if (current && current->tag_namespace == GUMBO_NAMESPACE_HTML &&
+          current->tag == GUMBO_TAG_COLGROUP) {
+        // Closing the column group, which is all a NUL does in a table.
+        pop_elements_to(locator, locator->open_length - 1);
+      }
+      if (token->type == GUMBO_TOKEN_CHARACTER && !is_foreign) {
+        reconstruct_formatting_elements(locator);
+      }
+      if (token->type != GUMBO_TOKEN_NULL) {
+        locator->frameset_ok = false;
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void gumbo_script_locator_destroy(GumboScriptLocator* locator) {
+  gumbo_free(locator->open_elements);
+  gumbo_free(locator->formatting);
+}
+
+// Adds a script element from a parse tree to the list, where foster parenting
+// may have put it ahead of scripts whose start tags came first.  Its
+// attributes are copied into the list's pool, and its text runs from its start
+// tag to its end tag or, when it was left open, to the end of its text.
+static void add_tree_script(
+    GumboScriptList* result, const GumboElement* element) {
+  GumboPool* pool = result->pool;
+  GumboScript* script = gumbo_pool_alloc(pool, sizeof(GumboScript));
+  script->start_tag = element->original_tag;
+  script->start_pos = element->start_pos;
+  script->end_tag = element->original_end_tag;
+
+  const char* start = element->original_tag.data + element->original_tag.length;
+  const char* end = start;
+  if (element->original_end_tag.data &&
+      element->original_end_tag.data != element->original_tag.data) {
+    end = element->original_end_tag.data;
+  } else if (element->children.length) {
+    const GumboNode* child = element->children.data[0];
+    if (child->type != GUMBO_NODE_ELEMENT &&
+        child->type != GUMBO_NODE_TEMPLATE) {
+      end = child->v.text.original_text.data +
+            child->v.text.original_text.length;
+    }
+  }
+  script->body.data = start;
+  script->body.length = end - start;
+
+  const GumboVector* attributes = &element->attributes;
+  gumbo_pool_vector_init(pool, attributes->length, &script->attributes);
+  for (unsigned int i = 0; i < attributes->length; ++i) {
+    const GumboAttribute* attr = attributes->data[i];
+    GumboAttribute* copy = gumbo_pool_alloc_attribute(pool);
+    *copy = *attr;
+    copy->pool = pool;
+    copy->name = gumbo_pool_strdup(pool, attr->name);
+    copy->value = gumbo_pool_strdup(pool, attr->value);
+    gumbo_pool_vector_add(pool, copy, &script->attributes);
+  }
+
+  GumboVector* scripts = &result->scripts;
+  unsigned int index = scripts->length;
+  while (index > 0 &&
+         ((const GumboScript*) scripts->data[index - 1])->start_tag.data >
+             script->start_tag.data) {
+    --index;
+  }
+  gumbo_vector_insert_at(script, index, scripts);
+}
+
+// Finds the scripts by parsing the buffer, for a document the locator isn't
+// sure of.
+static void locate_scripts_in_tree(GumboScriptList* result,
+    const GumboOptions* options, const char* buffer, size_t buffer_length) {
+  GumboOutput* output =
+      gumbo_parse_with_options(options, buffer, buffer_length);
+
+  // Misnested markup nests deep, so the walk keeps its own stack.
+  GumboVector stack;
+  gumbo_vector_init(16, &stack);
+  gumbo_vector_add(output->document, &stack);
+  while (stack.length) {
+    const GumboNode* node = gumbo_vector_pop(&stack);
+    const GumboVector* children;
+    if (node->type == GUMBO_NODE_DOCUMENT) {
+      children = &node->v.document.children;
+    } else if (node->type == GUMBO_NODE_ELEMENT ||
+               node->type == GUMBO_NODE_TEMPLATE) {
+      const GumboElement* element = &node->v.element;
+      if (element->tag == GUMBO_TAG_SCRIPT &&
+          element->tag_namespace == GUMBO_NAMESPACE_HTML) {
+        add_tree_script(result, element);
+      }
+      children = &element->children;
+    } else {
+      continue;
+    }
+    for (unsigned int i = children->length; i > 0; --i) {
+      gumbo_vector_add(children->data[i - 1], &stack);
+    }
+  }
+
+  gumbo_vector_destroy(&stack);
+  gumbo_destroy_output(output);
+  result->parsed_in_full = true;
+}
+
+GumboScriptList* gumbo_locate_scripts(
+    const GumboOptions* options, const char* buffer, size_t buffer_length) {
+  // Parse errors aren't reported, so none are recorded.
+  GumboOptions locator_options = *options;
+  locator_options.error_mode = GUMBO_ERRORS_NONE;
+
+  GumboScriptList* result = gumbo_malloc(sizeof(GumboScriptList));
+  result->pool = gumbo_pool_create();
+  gumbo_vector_init(0, &result->scripts);
+  result->parsed_in_full = false;
+
+  GumboOutput output;
+  memset(&output, 0, sizeof(output));
+  output.pool = result->pool;
+
+  GumboParser parser;
+  parser._options = &locator_options;
+  parser._output = &output;
+  parser._parser_state = NULL;
+  gumbo_tokenizer_state_init(&parser, buffer, buffer_length);
+
+  GumboScriptLocator locator;
+  gumbo_script_locator_init(&locator, &parser, result);
+
+  GumboToken token;
+  do {
+    gumbo_script_locator_prepare(&locator);
+    gumbo_lex(&parser, &token);
+    gumbo_script_locator_handle_token(&locator, &token);
+    gumbo_token_destroy(&parser, &token);
+  } while (token.type != GUMBO_TOKEN_EOF);
+
+  gumbo_tokenizer_state_destroy(&parser);
+  gumbo_script_locator_destroy(&locator);
+
+  if (locator.is_unsure) {
+    // The scripts found so far stay in the pool until the list is destroyed.
+    result->scripts.length = 0;
+    locate_scripts_in_tree(result, &locator_options, buffer, buffer_length);
+  }
+  return result;
+}
+
+void gumbo_destroy_script_list(GumboScriptList* scripts) {
+  gumbo_vector_destroy(&scripts->scripts);
+  gumbo_pool_destroy(scripts->pool);
+  gumbo_free(scripts);
+}
@@ -0,0 +1,102 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// The part of the tree builder's state that gumbo_locate_scripts keeps in
+// place of a tree: enough to set the tokenizer state after each start tag the
+// way the tree builder would, most of the time.  Speculative tokenization uses
+// it too, to lex parts of a document before the parser gets to them.
+
+#ifndef GUMBO_SCRIPT_LOCATOR_H_
+#define GUMBO_SCRIPT_LOCATOR_H_
+
+#include <stdbool.h>
+
+#include "gumbo.h"
+#include "tokenizer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct GumboInternalParser;
+struct GumboInternalOpenElement;
+struct GumboInternalFormattingEntry;
+
+typedef struct GumboInternalScriptLocator {
+  struct GumboInternalParser* parser;
+
+  // Where scripts are recorded, or NULL to only drive the tokenizer.
+  GumboScriptList* result;
+
+  // The stack of open elements, innermost last.
+  struct GumboInternalOpenElement* open_elements;
+  unsigned int open_length;
+  unsigned int open_capacity;
+
+  bool in_select;
+  // The select was opened inside a table, where table tags also close it.
+  bool in_select_in_table;
+  bool in_frameset;
+  // Whether a <frameset> would still replace the body, as the tree builder's
+  // frameset-ok flag.
+  bool frameset_ok;
+  // Something has put content in the body, or started it with <body>.
+  bool body_started;
+  // The head has been closed by </head>, so a <noscript> starts the body.
+  bool head_closed;
+  // How many scripts had been recorded when the body was started; a frameset
+  // that replaces the body drops the ones after them.
+  unsigned int head_scripts;
+  // A form is open outside a template, as the tree builder's form element
+  // pointer, so another <form> is ignored.
+  bool has_form;
+  // The tree builder's list of active formatting elements, which it reopens
+  // when something other than their own end tags closed them.  Open elements
+  // are numbered so that the list can tell which are still open.
+  struct GumboInternalFormattingEntry* formatting;
+  unsigned int formatting_length;
+  unsigned int formatting_capacity;
+  unsigned int last_element_id;
+  // The tokenizer is in RCDATA or RAWTEXT, whose text doesn't start the body.
+  bool in_text_element;
+  // The tokenizer is reading script data.
+  bool in_script;
+
+  // The script whose text is being read, if scripts are being recorded.
+  GumboScript* open_script;
+
+  // Markup the locator doesn't follow has been seen, such as table structure
+  // in a template or a <script/> whose injected end tag is ignored; from here
+  // the scripts it finds may not be the tree's.
+  bool is_unsure;
+} GumboScriptLocator;
+
+// Starts tracking a parser's tokenizer from the beginning of a document.
+void gumbo_script_locator_init(GumboScriptLocator* locator,
+    struct GumboInternalParser* parser, GumboScriptList* result);
+
+// Tells the tokenizer whether the current node is foreign, before each token,
+// and returns it.
+bool gumbo_script_locator_prepare(GumboScriptLocator* locator);
+
+// Follows a token just lexed, setting the tokenizer state for the next one.
+// When scripts are recorded, a script's start tag gives up its attributes.
+void gumbo_script_locator_handle_token(
+    GumboScriptLocator* locator, GumboToken* token);
+
+void gumbo_script_locator_destroy(GumboScriptLocator* locator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GUMBO_SCRIPT_LOCATOR_H_
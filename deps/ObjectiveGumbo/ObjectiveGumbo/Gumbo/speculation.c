@@ -0,0 +1,641 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "speculation.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <pthread.h>
+#include <string.h>
+#include <strings.h>
+
+#include "error.h"
+#include "gumbo.h"
+#include "parser.h"
+#include "pool.h"
+#include "script_locator.h"
+#include "tokenizer.h"
+#include "utf8.h"
+#include "util.h"
+#include "vector.h"
+
+// Parts shorter than this aren't worth a thread: the parser would usually get
+// to one before its thread had got far.
+static const size_t kMinPartLength = 64 * 1024;
+
+typedef struct {
+  // Where the token was lexed from, and in what state.  Lexing can carry on
+  // from the checkpoint if it's clean.
+  GumboTokenizerCheckpoint checkpoint;
+  bool is_clean;
+
+  // A CDATA section starts at the checkpoint, and is only lexed as one if the
+  // current node was foreign, as it was here.
+  bool checks_foreign;
+  bool is_current_node_foreign;
+
+  // What gumbo_lex returned, and the state it left the tokenizer in before the
+  // script locator saw the token.
+  bool result;
+  GumboTokenizerEnum next_state;
+
+  // The errors found while lexing this token are those between the previous
+  // token's errors_end and this one's.
+  unsigned int errors_end;
+
+  // Most tokens are characters in one of the text states, which would take a
+  // lot of room one by one.  Where they follow each other without errors or a
+  // change of state, only the first is kept, with the number of them and the
+  // end of the last; the others are read back from the buffer as they're taken.
+  // Zero for any other token.
+  unsigned int run_length;
+  const char* run_end;
+
+  GumboToken token;
+} SpeculativeToken;
+
+typedef struct {
+  // The buffer being parsed, and the part of it this thread starts in.
+  const char* buffer;
+  size_t length;
+  const char* start;
+  // The start of the next part, where the thread stops at the first clean
+  // checkpoint; NULL for the last part, which is lexed to the end.
+  const char* limit;
+
+  // The thread's own parser, output and pool, with the options of the real
+  // parse.
+  GumboOptions options;
+  GumboOutput output;
+  GumboParser parser;
+  pthread_t thread;
+  bool is_running;
+
+  SpeculativeToken* tokens;
+  unsigned int length_in_tokens;
+  unsigned int capacity;
+
+  // Where the thread stopped, unless it lexed the EOF token.
+  GumboTokenizerCheckpoint end;
+  bool reached_eof;
+
+  // Set once the parser has taken a token, whose strings and attributes then
+  // live in the output's pool.
+  bool is_used;
+} SpeculativePart;
+
+struct GumboInternalSpeculation {
+  SpeculativePart* parts;
+  unsigned int num_parts;
+
+  // The part the parser is in or coming up to, and the next of its tokens.
+  unsigned int part;
+  unsigned int token;
+  // Whether the parser is taking tokens from there, rather than lexing for
+  // itself until it comes into step with them.
+  bool is_taking;
+
+  // For a run of characters: how many of the token's have been taken (or, if
+  // the parser isn't taking, passed), and an iterator over the next one.  Set
+  // up for the token at run_token.
+  unsigned int run_token;
+  unsigned int run_index;
+  Utf8Iterator run_input;
+};
+
+// Thread side.
+
+// The line that starts at end, as the UTF-8 iterator counts them: one for every
+// newline before it and every carriage return not followed by one.
+static unsigned int count_lines(const char* buffer, const char* end) {
+  unsigned int line = 1;
+  for (const char* c = buffer; (c = memchr(c, '\n', end - c)); ++c) {
+    ++line;
+  }
+  for (const char* c = buffer; (c = memchr(c, '\r', end - c)); ++c) {
+    if (c + 1 == end || c[1] != '\n') {
+      ++line;
+    }
+  }
+  return line;
+}
+
+// Where the first character of a part is, as the parser's UTF-8 iterator will
+// find it.  Parts start just after a '>', which is never part of a multi-byte
+// character, so reading the line up to there from its start gives the same
+// positions.  Any errors are recorded in the thread's output.
+static GumboSourcePosition locate_part(
+    GumboParser* parser, const char* buffer, const char* start) {
+  const char* line_start = start;
+  while (line_start > buffer && line_start[-1] != '\n' &&
+         line_start[-1] != '\r') {
+    --line_start;
+  }
+  Utf8Iterator input;
+  utf8iterator_init(parser, line_start, start - line_start, &input);
+  while (utf8iterator_get_char_pointer(&input) < start) {
+    utf8iterator_next(&input);
+  }
+  GumboSourcePosition position;
+  utf8iterator_get_position(&input, &position);
+  position.line = count_lines(buffer, line_start);
+  position.offset += line_start - buffer;
+  return position;
+}
+
+static bool is_ascii_alpha(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static bool is_tag_name_char(char c) {
+  return is_ascii_alpha(c) || (c >= '0' && c <= '9');
+}
+
+static GumboTokenizerEnum text_state_of(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_SCRIPT:
+      return GUMBO_LEX_SCRIPT;
+    case GUMBO_TAG_STYLE:
+    case GUMBO_TAG_XMP:
+    case GUMBO_TAG_IFRAME:
+    case GUMBO_TAG_NOEMBED:
+    case GUMBO_TAG_NOFRAMES:
+      return GUMBO_LEX_RAWTEXT;
+    case GUMBO_TAG_TITLE:
+    case GUMBO_TAG_TEXTAREA:
+      return GUMBO_LEX_RCDATA;
+    default:
+      return GUMBO_LEX_DATA;
+  }
+}
+
+// Whether a start tag with the given name appears between start and end.
+static bool has_start_tag(
+    const char* start, const char* end, const char* name, size_t length) {
+  for (const char* c = start; (c = memchr(c, '<', end - c)); ++c) {
+    if ((size_t) (end - c) > length + 1 &&
+        !strncasecmp(c + 1, name, length) && !is_tag_name_char(c[length + 1])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Guesses the tokenizer state at the start of a part: it's inside a script,
+// a RAWTEXT or an RCDATA element if the first end tag in the part closes one
+// that wasn't opened in the part, and in data otherwise.
+static GumboTokenizerEnum guess_start_state(
+    const char* start, const char* end, GumboTag* last_start_tag) {
+  *last_start_tag = GUMBO_TAG_LAST;
+  for (const char* c = start; (c = memchr(c, '<', end - c)); ++c) {
+    if (end - c < 3 || c[1] != '/' || !is_ascii_alpha(c[2])) {
+      continue;
+    }
+    const char* name = c + 2;
+    const char* name_end = name;
+    while (name_end < end && is_tag_name_char(*name_end)) {
+      ++name_end;
+    }
+    GumboTag tag = gumbo_tagn_enum(name, name_end - name);
+    GumboTokenizerEnum state = text_state_of(tag);
+    if (state == GUMBO_LEX_DATA ||
+        has_start_tag(start, c, name, name_end - name)) {
+      return GUMBO_LEX_DATA;
+    }
+    *last_start_tag = tag;
+    return state;
+  }
+  return GUMBO_LEX_DATA;
+}
+
+static SpeculativeToken* add_token(SpeculativePart* part) {
+  if (part->length_in_tokens == part->capacity) {
+    part->capacity = part->capacity ? part->capacity * 2 : 1024;
+    part->tokens = gumbo_realloc(
+        part->tokens, sizeof(SpeculativeToken) * part->capacity);
+  }
+  return &part->tokens[part->length_in_tokens++];
+}
+
+static bool is_run_character(const GumboToken* token) {
+  return token->type == GUMBO_TOKEN_CHARACTER ||
+         token->type == GUMBO_TOKEN_WHITESPACE;
+}
+
+static bool is_same_position(
+    const GumboSourcePosition* a, const GumboSourcePosition* b) {
+  return a->offset == b->offset && a->line == b->line &&
+         a->column == b->column;
+}
+
+// Where the UTF-8 iterator goes from the character at a checkpoint, skipping
+// the carriage return of a CRLF as it does.
+static const char* next_character(
+    const GumboTokenizerCheckpoint* checkpoint, const char* end) {
+  const char* next = checkpoint->input + checkpoint->width;
+  if (next + 1 < end && next[0] == '\r' && next[1] == '\n') {
+    ++next;
+  }
+  return next;
+}
+
+static void* lex_part(void* arg) {
+  SpeculativePart* part = arg;
+  GumboParser* parser = &part->parser;
+  const char* buffer_end = part->buffer + part->length;
+  const char* guess_end = part->limit ? part->limit : buffer_end;
+
+  GumboTag last_start_tag;
+  GumboTokenizerEnum state =
+      guess_start_state(part->start, guess_end, &last_start_tag);
+  GumboSourcePosition start = locate_part(parser, part->buffer, part->start);
+  gumbo_tokenizer_state_init_at(
+      parser, part->buffer, part->length, &start, state, last_start_tag);
+  // The parser records the errors up to and in the first character as it reads
+  // them.
+  for (unsigned int i = 0; i < part->output.errors.length; ++i) {
+    gumbo_error_destroy(part->output.errors.data[i]);
+  }
+  part->output.errors.length = 0;
+  part->output.error_count = 0;
+
+  GumboScriptLocator locator;
+  gumbo_script_locator_init(&locator, parser, NULL);
+  // Whatever is before the part has started the body, and a guessed script or
+  // text element is open.
+  locator.frameset_ok = false;
+  locator.in_script = state == GUMBO_LEX_SCRIPT;
+  locator.in_text_element =
+      state == GUMBO_LEX_RAWTEXT || state == GUMBO_LEX_RCDATA;
+
+  GumboTokenizerCheckpoint checkpoint;
+  bool is_clean = gumbo_tokenizer_get_checkpoint(parser, &checkpoint);
+  for (;;) {
+    if (part->limit && is_clean && checkpoint.input >= part->limit) {
+      part->end = checkpoint;
+      break;
+    }
+    bool is_foreign = gumbo_script_locator_prepare(&locator);
+    // The tokenizer leaves is_injected to the parser.
+    GumboToken token = {0};
+    bool result = gumbo_lex(parser, &token);
+    GumboTokenizerEnum next_state = gumbo_tokenizer_get_state(parser);
+    bool has_errors = part->length_in_tokens
+        ? part->output.error_count !=
+              part->tokens[part->length_in_tokens - 1].errors_end
+        : part->output.error_count != 0;
+    gumbo_script_locator_handle_token(&locator, &token);
+
+    GumboTokenizerCheckpoint next;
+    bool next_is_clean = gumbo_tokenizer_get_checkpoint(parser, &next);
+
+    bool is_run = is_clean && result && !has_errors &&
+                  is_run_character(&token) && next_state == checkpoint.state &&
+                  token.v.character == checkpoint.current &&
+                  token.original_text.data == checkpoint.input &&
+                  is_same_position(&token.position, &checkpoint.position) &&
+                  next.input == next_character(&checkpoint, buffer_end);
+    SpeculativeToken* last = part->length_in_tokens
+                                 ? &part->tokens[part->length_in_tokens - 1]
+                                 : NULL;
+    if (is_run && last && last->run_length &&
+        last->checkpoint.state == checkpoint.state &&
+        last->checkpoint.last_start_tag == checkpoint.last_start_tag) {
+      ++last->run_length;
+      last->run_end = next.input;
+    } else {
+      SpeculativeToken* speculative = add_token(part);
+      speculative->checkpoint = checkpoint;
+      speculative->is_clean = is_clean;
+      speculative->checks_foreign =
+          is_clean && checkpoint.state == GUMBO_LEX_DATA &&
+          (size_t) (buffer_end - checkpoint.input) >= 9 &&
+          !memcmp(checkpoint.input, "<![CDATA[", 9);
+      speculative->is_current_node_foreign = is_foreign;
+      speculative->result = result;
+      speculative->next_state = next_state;
+      speculative->errors_end = part->output.error_count;
+      speculative->run_length = is_run ? 1 : 0;
+      speculative->run_end = next.input;
+      speculative->token = token;
+    }
+
+    if (token.type == GUMBO_TOKEN_EOF) {
+      part->reached_eof = true;
+      break;
+    }
+    checkpoint = next;
+    is_clean = next_is_clean;
+  }
+
+  gumbo_script_locator_destroy(&locator);
+  gumbo_tokenizer_state_destroy(parser);
+  return NULL;
+}
+
+GumboSpeculation* gumbo_speculation_start(
+    GumboParser* parser, const char* buffer, size_t length) {
+  const GumboOptions* options = parser->_options;
+  if (options->tokenizer_threads < 2 || options->stop_on_first_error ||
+      length / options->tokenizer_threads < kMinPartLength) {
+    return NULL;
+  }
+
+  GumboSpeculation* speculation = gumbo_malloc(sizeof(GumboSpeculation));
+  speculation->parts = gumbo_malloc(
+      sizeof(SpeculativePart) * (options->tokenizer_threads - 1));
+  speculation->num_parts = 0;
+  speculation->part = 0;
+  speculation->token = 0;
+  speculation->is_taking = false;
+  speculation->run_token = UINT_MAX;
+  speculation->run_index = 0;
+
+  // The parser lexes the first part itself.
+  const char* end = buffer + length;
+  const char* previous = buffer;
+  for (int i = 1; i < options->tokenizer_threads; ++i) {
+    const char* split = buffer + length / options->tokenizer_threads * i;
+    if (split < previous) {
+      split = previous;
+    }
+    const char* tag_end = memchr(split, '>', end - split);
+    if (!tag_end || tag_end + 1 == end) {
+      break;
+    }
+    SpeculativePart* part = &speculation->parts[speculation->num_parts++];
+    memset(part, 0, sizeof(*part));
+    part->buffer = buffer;
+    part->length = length;
+    part->start = tag_end + 1;
+    previous = part->start + 1;
+  }
+  if (!speculation->num_parts) {
+    gumbo_free(speculation->parts);
+    gumbo_free(speculation);
+    return NULL;
+  }
+  for (unsigned int i = 0; i < speculation->num_parts; ++i) {
+    SpeculativePart* part = &speculation->parts[i];
+    part->limit =
+        i + 1 < speculation->num_parts ? speculation->parts[i + 1].start : NULL;
+    part->options = *options;
+    // Which of a thread's errors the parser keeps under max_errors depends on
+    // where it starts taking tokens, so the threads keep them all.
+    part->options.max_errors = -1;
+    part->output.pool = gumbo_pool_create();
+    gumbo_vector_init(0, &part->output.errors);
+    part->output.error_count = 0;
+    part->parser._options = &part->options;
+    part->parser._output = &part->output;
+    part->parser._tokenizer_state = NULL;
+    part->parser._parser_state = NULL;
+    part->is_running =
+        pthread_create(&part->thread, NULL, lex_part, part) == 0;
+    if (!part->is_running) {
+      // Nothing to take; the parser passes the part by.
+      part->end.input = part->start;
+    }
+  }
+  return speculation;
+}
+
+// Parser side.
+
+static void join_part(SpeculativePart* part) {
+  if (part->is_running) {
+    pthread_join(part->thread, NULL);
+    part->is_running = false;
+  }
+}
+
+static void start_run(GumboSpeculation* speculation, GumboParser* parser) {
+  if (speculation->run_token == speculation->token) {
+    return;
+  }
+  const SpeculativePart* part = &speculation->parts[speculation->part];
+  const GumboTokenizerCheckpoint* checkpoint =
+      &part->tokens[speculation->token].checkpoint;
+  Utf8Iterator* input = &speculation->run_input;
+  input->_start = checkpoint->input;
+  input->_mark = checkpoint->input;
+  input->_end = part->buffer + part->length;
+  input->_current = checkpoint->current;
+  input->_width = checkpoint->width;
+  input->_pos = checkpoint->position;
+  input->_mark_pos = checkpoint->position;
+  input->_parser = parser;
+  speculation->run_token = speculation->token;
+  speculation->run_index = 0;
+}
+
+// The checkpoint of the next character of a run.
+static void get_run_checkpoint(const GumboSpeculation* speculation,
+    const SpeculativeToken* token, GumboTokenizerCheckpoint* checkpoint) {
+  const Utf8Iterator* input = &speculation->run_input;
+  *checkpoint = token->checkpoint;
+  checkpoint->input = utf8iterator_get_char_pointer(input);
+  checkpoint->current = utf8iterator_current(input);
+  checkpoint->width = input->_width;
+  utf8iterator_get_position(input, &checkpoint->position);
+}
+
+static void next_part(GumboSpeculation* speculation) {
+  ++speculation->part;
+  speculation->token = 0;
+  speculation->run_token = UINT_MAX;
+  speculation->is_taking = false;
+}
+
+// Whether the parser's tokenizer, at a clean checkpoint, would lex the same
+// tokens as a thread's from one of its own.
+static bool is_in_step(const GumboTokenizerCheckpoint* parser_checkpoint,
+    const GumboTokenizerCheckpoint* checkpoint) {
+  // The last start tag only matters in the states that end at an end tag.
+  return parser_checkpoint->input == checkpoint->input &&
+         parser_checkpoint->state == checkpoint->state &&
+         (checkpoint->state == GUMBO_LEX_DATA ||
+             checkpoint->state == GUMBO_LEX_PLAINTEXT ||
+             parser_checkpoint->last_start_tag == checkpoint->last_start_tag) &&
+         parser_checkpoint->current == checkpoint->current &&
+         is_same_position(&parser_checkpoint->position, &checkpoint->position);
+}
+
+// Called while the parser lexes for itself: moves on to the token in a part
+// where it is, and starts taking tokens if it's in step with that one.
+static bool catch_up(GumboSpeculation* speculation, GumboParser* parser) {
+  while (speculation->part < speculation->num_parts) {
+    SpeculativePart* part = &speculation->parts[speculation->part];
+    GumboTokenizerCheckpoint here;
+    bool is_clean = gumbo_tokenizer_get_checkpoint(parser, &here);
+    if (here.input < part->start) {
+      return false;
+    }
+    join_part(part);
+    if (!part->reached_eof && here.input >= part->end.input) {
+      next_part(speculation);
+      continue;
+    }
+    if (!is_clean || speculation->token >= part->length_in_tokens) {
+      return false;
+    }
+
+    const SpeculativeToken* tokens = part->tokens;
+    while (speculation->token + 1 < part->length_in_tokens &&
+           tokens[speculation->token + 1].checkpoint.input <= here.input) {
+      ++speculation->token;
+    }
+    const SpeculativeToken* token = &tokens[speculation->token];
+    if (token->run_length) {
+      start_run(speculation, parser);
+      // The parser may come into step part way through a run.
+      while (utf8iterator_get_char_pointer(&speculation->run_input) <
+                 here.input &&
+             speculation->run_index + 1 < token->run_length) {
+        utf8iterator_next(&speculation->run_input);
+        ++speculation->run_index;
+      }
+      GumboTokenizerCheckpoint checkpoint;
+      get_run_checkpoint(speculation, token, &checkpoint);
+      speculation->is_taking = is_in_step(&here, &checkpoint);
+    } else {
+      speculation->is_taking =
+          token->is_clean && is_in_step(&here, &token->checkpoint);
+    }
+    return speculation->is_taking;
+  }
+  return false;
+}
+
+// Moves a token's errors over to the parser's output, as far as max_errors
+// allows.  With GUMBO_ERRORS_COUNT the threads only count them.
+static void take_errors(SpeculativePart* part, GumboParser* parser,
+    unsigned int index) {
+  GumboVector* errors = &part->output.errors;
+  unsigned int begin = index ? part->tokens[index - 1].errors_end : 0;
+  for (unsigned int i = begin; i < part->tokens[index].errors_end; ++i) {
+    GumboError* copy = gumbo_add_error(parser);
+    if (i >= errors->length) {
+      continue;
+    }
+    GumboError* error = errors->data[i];
+    if (copy) {
+      *copy = *error;
+      gumbo_free(error);
+    } else {
+      gumbo_error_destroy(error);
+    }
+    errors->data[i] = NULL;
+  }
+}
+
+// Takes the next token from a part, or returns false, having moved the
+// parser's tokenizer on to where that token was lexed from, if the token was
+// lexed in a different state than the parser's tokenizer is in.
+static bool take_token(GumboSpeculation* speculation, GumboParser* parser,
+    GumboToken* output, bool* result) {
+  SpeculativePart* part = &speculation->parts[speculation->part];
+  SpeculativeToken* token = &part->tokens[speculation->token];
+  GumboTokenizerEnum state = gumbo_tokenizer_get_state(parser);
+
+  if (token->run_length) {
+    start_run(speculation, parser);
+    GumboTokenizerCheckpoint checkpoint;
+    get_run_checkpoint(speculation, token, &checkpoint);
+    if (state != checkpoint.state) {
+      gumbo_tokenizer_resume(parser, &checkpoint);
+      speculation->is_taking = false;
+      return false;
+    }
+    int c = checkpoint.current;
+    output->type = (c == '\t' || c == '\n' || c == '\f' || c == ' ')
+                       ? GUMBO_TOKEN_WHITESPACE
+                       : GUMBO_TOKEN_CHARACTER;
+    output->position = checkpoint.position;
+    output->original_text.data = checkpoint.input;
+    output->is_injected = false;
+    output->v.character = c;
+    const char* next;
+    if (++speculation->run_index < token->run_length) {
+      utf8iterator_next(&speculation->run_input);
+      next = utf8iterator_get_char_pointer(&speculation->run_input);
+    } else {
+      next = token->run_end;
+    }
+    output->original_text.length = next - checkpoint.input;
+    if (next[-1] == '\r') {
+      --output->original_text.length;
+    }
+    *result = true;
+    if (speculation->run_index == token->run_length) {
+      ++speculation->token;
+    }
+  } else {
+    if (state != token->checkpoint.state ||
+        (token->checks_foreign &&
+            gumbo_tokenizer_get_is_current_node_foreign(parser) !=
+                token->is_current_node_foreign)) {
+      // The tree builder only changes the tokenizer state after a start tag,
+      // which leaves the thread's tokenizer at a clean checkpoint too.
+      assert(token->is_clean);
+      gumbo_tokenizer_resume(parser, &token->checkpoint);
+      speculation->is_taking = false;
+      return false;
+    }
+    *output = token->token;
+    *result = token->result;
+    gumbo_tokenizer_set_state(parser, token->next_state);
+    take_errors(part, parser, speculation->token);
+    ++speculation->token;
+  }
+
+  part->is_used = true;
+  if (speculation->token == part->length_in_tokens && !part->reached_eof) {
+    gumbo_tokenizer_resume(parser, &part->end);
+    next_part(speculation);
+  }
+  return true;
+}
+
+bool gumbo_speculation_lex(
+    GumboSpeculation* speculation, GumboParser* parser, GumboToken* output) {
+  bool result;
+  if ((speculation->is_taking || catch_up(speculation, parser)) &&
+      take_token(speculation, parser, output, &result)) {
+    return result;
+  }
+  return gumbo_lex(parser, output);
+}
+
+void gumbo_speculation_finish(GumboSpeculation* speculation,
+    GumboParser* parser) {
+  for (unsigned int i = 0; i < speculation->num_parts; ++i) {
+    SpeculativePart* part = &speculation->parts[i];
+    join_part(part);
+    for (unsigned int j = 0; j < part->output.errors.length; ++j) {
+      if (part->output.errors.data[j]) {
+        gumbo_error_destroy(part->output.errors.data[j]);
+      }
+    }
+    gumbo_vector_destroy(&part->output.errors);
+    // Tokens left untaken are dropped with the pool, or with the output's if
+    // it takes this one over.
+    if (part->is_used) {
+      gumbo_pool_adopt(parser->_output->pool, part->output.pool);
+    } else {
+      gumbo_pool_destroy(part->output.pool);
+    }
+    gumbo_free(part->tokens);
+  }
+  gumbo_free(speculation->parts);
+  gumbo_free(speculation);
+}
@@ -0,0 +1,63 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Speculative tokenization, for GumboOptions.tokenizer_threads: threads that
+// lex the later parts of a large document while the parser works through the
+// start of it.
+//
+// Each part starts just after a '>'.  Its thread guesses the tokenizer state
+// there, and follows the start tags it lexes with a GumboScriptLocator in
+// place of the tree builder.  Every token it keeps records the state it was
+// lexed in and, where lexing could carry on from there, a checkpoint.  The
+// parser takes a thread's tokens only while its own tokenizer state agrees;
+// where it doesn't, it goes back to the checkpoint and lexes for itself, and
+// picks the thread's tokens up again if the two come back into step.  So a
+// wrong guess costs time, but the tokens, and with them the tree and the
+// errors, are the ones the parser would have lexed alone.
+
+#ifndef GUMBO_SPECULATION_H_
+#define GUMBO_SPECULATION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "tokenizer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct GumboInternalParser;
+
+typedef struct GumboInternalSpeculation GumboSpeculation;
+
+// Starts threads lexing parts of a document, which the parser's tokenizer has
+// just been initialized over.  Returns NULL if the options don't ask for more
+// than one thread, or the document is too small to be worth splitting.
+GumboSpeculation* gumbo_speculation_start(
+    struct GumboInternalParser* parser, const char* buffer, size_t length);
+
+// Lexes the next token like gumbo_lex, taking it from a thread's tokens when
+// they agree with the parser's tokenizer state.
+bool gumbo_speculation_lex(GumboSpeculation* speculation,
+    struct GumboInternalParser* parser, GumboToken* output);
+
+// Waits for the threads and frees everything the parser didn't take.  The
+// storage of tokens it took is handed over to the output's pool.
+void gumbo_speculation_finish(
+    GumboSpeculation* speculation, struct GumboInternalParser* parser);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GUMBO_SPECULATION_H_
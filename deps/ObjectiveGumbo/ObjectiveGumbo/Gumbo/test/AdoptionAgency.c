@@ -0,0 +1,121 @@
+//
+//  AdoptionAgency.c
+//  libwidgetinfo
+//
+//  The trees that misnested formatting builds, which is where the tree builder
+//  looks elements up in the stack of open elements and the list of active
+//  formatting elements most: the adoption agency's cases from the spec, then
+//  each of them repeated thousands of times under deep nesting. The repeats
+//  leave nothing open or listed behind them, so the tree is the one case's
+//  tree repeated, however far down the stack it is built, and whatever moved
+//  before it.
+//
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gumbo.h"
+
+#include "Markup.h"
+
+typedef struct {
+    const char *html;
+    // The body's children, with end tags for everything and no attributes
+    const char *expected;
+} Case;
+
+static const Case kCases[] = {
+    {"<b>1<p>2</b>3</p>", "<b>1</b><p><b>2</b>3</p>"},
+    {"<p>1<b>2<i>3</b>4</i>5</p>", "<p>1<b>2<i>3</i></b><i>4</i>5</p>"},
+    {"<a href=a>1<a href=b>2</a>3", "<a>1</a><a>2</a>3"},
+    {"<b><i><u>x</b>y</i>z</u>", "<b><i><u>x</u></i></b><i><u>y</u></i><u>z</u>"},
+    {"<div><a><div><div>x</a>y</div></div></div>", "<div><a></a><div><a></a><div><a>x</a>y</div></div></div>"},
+    {"<p><b><b><b><b>x</p>y</b></b></b>", "<p><b><b><b><b>x</b></b></b></b></p><b><b><b>y</b></b></b>"},
+    {"<nobr>1<nobr>2</nobr>3", "<nobr>1</nobr><nobr>2</nobr>3"},
+    {"<b><table><td><i>x</b>y</td></table>z</b>", "<b><table><tbody><tr><td><i>xy</i></td></tr></tbody></table>z</b>"},
+};
+
+static void Serialize(const GumboNode *node, Buffer *out) {
+    if (node->type == GUMBO_NODE_TEXT || node->type == GUMBO_NODE_WHITESPACE) {
+        AppendString(out, node->v.text.text);
+        return;
+    }
+    if (node->type != GUMBO_NODE_ELEMENT) {
+        return;
+    }
+    const GumboElement *element = &node->v.element;
+    const char *name = gumbo_normalized_tagname(element->tag);
+    AppendString(out, "<");
+    AppendString(out, name);
+    AppendString(out, ">");
+    for (unsigned i = 0; i != element->children.length; ++i) {
+        Serialize(element->children.data[i], out);
+    }
+    AppendString(out, "</");
+    AppendString(out, name);
+    AppendString(out, ">");
+}
+
+static bool Check(const char *name, const char *html, size_t length, const char *expected) {
+    GumboOutput *output = gumbo_parse_with_options(&kGumboDefaultOptions, html, length);
+    Buffer actual = {NULL, 0, 0};
+    AppendString(&actual, "");
+
+    const GumboVector *children = &output->root->v.element.children;
+    for (unsigned i = 0; i != children->length; ++i) {
+        const GumboNode *node = children->data[i];
+        if (node->type == GUMBO_NODE_ELEMENT && node->v.element.tag == GUMBO_TAG_BODY) {
+            for (unsigned j = 0; j != node->v.element.children.length; ++j) {
+                Serialize(node->v.element.children.data[j], &actual);
+            }
+        }
+    }
+
+    bool okay = strcmp(actual.data, expected) == 0;
+    if (!okay) {
+        fprintf(stderr, "%s:\n  expected: %.200s\n  actual:   %.200s\n", name, expected, actual.data);
+    }
+    free(actual.data);
+    gumbo_destroy_output(output);
+    return okay;
+}
+
+// The case repeated under nesting <div>s deep
+static bool CheckRepeated(const Case *test, unsigned nesting, unsigned repeats) {
+    Buffer html = {NULL, 0, 0}, expected = {NULL, 0, 0};
+    for (unsigned i = 0; i != nesting; ++i) {
+        AppendString(&html, "<div>");
+        AppendString(&expected, "<div>");
+    }
+    for (unsigned i = 0; i != repeats; ++i) {
+        AppendString(&html, test->html);
+        AppendString(&expected, test->expected);
+    }
+    for (unsigned i = 0; i != nesting; ++i) {
+        AppendString(&expected, "</div>");
+    }
+
+    char name[256];
+    snprintf(name, sizeof(name), "%s x%u under %u", test->html, repeats, nesting);
+    bool okay = Check(name, html.data, html.length, expected.data);
+    free(html.data);
+    free(expected.data);
+    return okay;
+}
+
+int main(void) {
+    unsigned failed = 0, total = 0;
+
+    for (unsigned i = 0; i != sizeof(kCases) / sizeof(kCases[0]); ++i) {
+        const Case *test = &kCases[i];
+        failed += !Check(test->html, test->html, strlen(test->html), test->expected);
+        failed += !CheckRepeated(test, 1, 2000);
+        failed += !CheckRepeated(test, 1000, 2000);
+        total += 3;
+    }
+
+    printf("%u of %u misnested formatting checks failed\n", failed, total);
+    return failed == 0 ? 0 : 1;
+}
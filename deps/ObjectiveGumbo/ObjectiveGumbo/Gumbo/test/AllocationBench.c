@@ -0,0 +1,86 @@
+//
+//  AllocationBench.c
+//  libwidgetinfo
+//
+//  Calls to Gumbo's allocator per parse, the bytes they ask for, and the parse
+//  time, on widget and SVG pages: how much of parsing goes to allocating tag
+//  names, attribute names and values, text and the tree they end up in. Every
+//  block the parse allocates has to be freed again with its output.
+//
+//      allocation-bench [-n rounds] [--quick] [file...]
+//
+
+#include "Bench.h"
+
+static void CountNodes(const GumboNode *node, unsigned *elements, unsigned *attributes) {
+    if (node->type != GUMBO_NODE_ELEMENT && node->type != GUMBO_NODE_TEMPLATE) {
+        return;
+    }
+    ++*elements;
+    *attributes += node->v.element.attributes.length;
+    const GumboVector *children = &node->v.element.children;
+    for (unsigned i = 0; i != children->length; ++i) {
+        CountNodes(children->data[i], elements, attributes);
+    }
+}
+
+static bool Run(const char *name, const Buffer *page, unsigned rounds) {
+    double best = 0;
+    size_t allocations = 0, bytes = 0;
+    unsigned elements = 0, attributes = 0;
+
+    for (unsigned round = 0; round != rounds; ++round) {
+        long live = liveBlocks_;
+        allocations_ = 0;
+        allocatedBytes_ = 0;
+
+        double start = Now();
+        GumboOutput *output = gumbo_parse_with_options(&kGumboDefaultOptions, page->data, page->length);
+        double time = Now() - start;
+        best = round == 0 || time < best ? time : best;
+        allocations = allocations_;
+        bytes = allocatedBytes_;
+
+        elements = attributes = 0;
+        CountNodes(output->root, &elements, &attributes);
+        gumbo_destroy_output(output);
+
+        if (liveBlocks_ != live) {
+            fprintf(stderr, "%s: %ld blocks left after the output was destroyed\n", name, liveBlocks_ - live);
+            return false;
+        }
+    }
+
+    printf("%-20s %9zu %8u %8u %9zu %9.3f %9zu %9.2f\n", name, page->length, elements, attributes,
+        allocations, elements != 0 ? (double) allocations / elements : 0.0, bytes / 1024, best);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    Arguments arguments;
+    ParseArguments(argc, argv, 10, &arguments);
+    CountAllocations();
+
+    printf("%-20s %9s %8s %8s %9s %9s %9s %9s\n", "page", "bytes", "elements", "attrs",
+        "allocs", "per elem", "KB asked", "parse ms");
+
+    bool okay = true;
+    if (arguments.fileCount == 0) {
+        unsigned scale = arguments.quick ? 1 : 100;
+        Buffer widget = {NULL, 0, 0}, svg = {NULL, 0, 0};
+        WidgetPage(&widget, 50 * scale);
+        SvgPage(&svg, 200 * scale);
+        okay = Run("widget", &widget, arguments.rounds) && okay;
+        okay = Run("svg", &svg, arguments.rounds) && okay;
+        free(widget.data);
+        free(svg.data);
+    } else {
+        for (int i = 0; i != arguments.fileCount; ++i) {
+            Buffer page = {NULL, 0, 0};
+            okay = ReadFile(arguments.files[i], &page) && Run(arguments.files[i], &page, arguments.rounds) && okay;
+            free(page.data);
+        }
+    }
+
+    return okay ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+//
+//  AttributeBench.c
+//  libwidgetinfo
+//
+//  Attribute lookups on attribute-heavy pages: the parse, then a lookup of
+//  each of a handful of names on every element, done three ways. The
+//  strcasecmp scan is what gumbo_get_attribute did before names were
+//  interned; gumbo_get_attribute interns its argument and compares atoms;
+//  gumbo_get_attribute_by_atom starts from the atom. All three have to find
+//  the same attributes.
+//
+//      attribute-bench [-n rounds] [--quick] [file...]
+//
+
+#include <strings.h>
+
+#include "Bench.h"
+
+// What the parser and the preprocessors ask about, a few SVG names, and one
+// that's never there
+static const char *const kNames[] = {
+    "type", "src", "href", "id", "class", "fill", "stroke", "d", "viewbox",
+    "xlink:href", "data-missing",
+};
+
+#define kNameCount (sizeof(kNames) / sizeof(kNames[0]))
+
+typedef struct {
+    const GumboElement **elements;
+    unsigned length;
+} Elements;
+
+static void CollectElements(const GumboNode *node, Elements *elements, unsigned *capacity) {
+    if (node->type != GUMBO_NODE_ELEMENT && node->type != GUMBO_NODE_TEMPLATE) {
+        return;
+    }
+    if (elements->length == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 256;
+        elements->elements = realloc(elements->elements, *capacity * sizeof(*elements->elements));
+    }
+    elements->elements[elements->length++] = &node->v.element;
+    const GumboVector *children = &node->v.element.children;
+    for (unsigned i = 0; i != children->length; ++i) {
+        CollectElements(children->data[i], elements, capacity);
+    }
+}
+
+static const GumboAttribute *ScanAttributes(const GumboVector *attributes, const char *name) {
+    for (unsigned i = 0; i != attributes->length; ++i) {
+        const GumboAttribute *attribute = attributes->data[i];
+        if (strcasecmp(attribute->name, name) == 0) {
+            return attribute;
+        }
+    }
+    return NULL;
+}
+
+// Found attributes are summed as addresses, so that the lookups can't be
+// skipped and the three ways can be compared
+static uintptr_t LookUp(const Elements *elements, int way, const GumboAttributeName *atoms) {
+    uintptr_t sum = 0;
+    for (unsigned i = 0; i != elements->length; ++i) {
+        const GumboVector *attributes = &elements->elements[i]->attributes;
+        for (unsigned name = 0; name != kNameCount; ++name) {
+            const GumboAttribute *found;
+            if (way == 0) {
+                found = ScanAttributes(attributes, kNames[name]);
+            } else if (way == 1) {
+                found = gumbo_get_attribute(attributes, kNames[name]);
+            } else if (atoms[name] != GUMBO_ATTRIBUTE_UNKNOWN) {
+                found = gumbo_get_attribute_by_atom(attributes, atoms[name]);
+            } else {
+                found = gumbo_get_attribute(attributes, kNames[name]);
+            }
+            sum += (uintptr_t) found;
+        }
+    }
+    return sum;
+}
+
+static bool Run(const char *name, const Buffer *page, unsigned rounds) {
+    GumboAttributeName atoms[kNameCount];
+    for (unsigned i = 0; i != kNameCount; ++i) {
+        atoms[i] = gumbo_attribute_enum(kNames[i]);
+    }
+
+    double parse = 0, ways[3] = {0, 0, 0};
+    unsigned attributes = 0;
+    Elements elements = {NULL, 0};
+    bool okay = true;
+
+    for (unsigned round = 0; round != rounds && okay; ++round) {
+        double start = Now();
+        GumboOutput *output = gumbo_parse_with_options(&kGumboDefaultOptions, page->data, page->length);
+        double time = Now() - start;
+        parse = round == 0 || time < parse ? time : parse;
+
+        unsigned capacity = 0;
+        elements.length = 0;
+        free(elements.elements);
+        elements.elements = NULL;
+        CollectElements(output->root, &elements, &capacity);
+        attributes = 0;
+        for (unsigned i = 0; i != elements.length; ++i) {
+            attributes += elements.elements[i]->attributes.length;
+        }
+
+        uintptr_t sums[3];
+        for (int way = 0; way != 3; ++way) {
+            start = Now();
+            sums[way] = LookUp(&elements, way, atoms);
+            time = Now() - start;
+            ways[way] = round == 0 || time < ways[way] ? time : ways[way];
+        }
+        if (sums[1] != sums[0] || sums[2] != sums[0]) {
+            fprintf(stderr, "%s: the lookups found different attributes\n", name);
+            okay = false;
+        }
+
+        gumbo_destroy_output(output);
+    }
+
+    double lookups = (double) elements.length * kNameCount;
+    printf("%-20s %9zu %8u %9u %9.2f %9.1f %9.1f %9.1f\n", name, page->length, elements.length,
+        attributes, parse, ways[0] * 1e6 / lookups, ways[1] * 1e6 / lookups, ways[2] * 1e6 / lookups);
+    free(elements.elements);
+    return okay;
+}
+
+int main(int argc, char *argv[]) {
+    Arguments arguments;
+    ParseArguments(argc, argv, 10, &arguments);
+
+    printf("%-20s %9s %8s %9s %9s %9s %9s %9s\n", "page", "bytes", "elements", "attrs",
+        "parse ms", "scan ns", "get ns", "atom ns");
+
+    bool okay = true;
+    if (arguments.fileCount == 0) {
+        unsigned scale = arguments.quick ? 1 : 100;
+        Buffer svg = {NULL, 0, 0}, widget = {NULL, 0, 0};
+        SvgPage(&svg, 200 * scale);
+        WidgetPage(&widget, 50 * scale);
+        okay = Run("svg", &svg, arguments.rounds) && okay;
+        okay = Run("widget", &widget, arguments.rounds) && okay;
+        free(svg.data);
+        free(widget.data);
+    } else {
+        for (int i = 0; i != arguments.fileCount; ++i) {
+            Buffer page = {NULL, 0, 0};
+            okay = ReadFile(arguments.files[i], &page) && Run(arguments.files[i], &page, arguments.rounds) && okay;
+            free(page.data);
+        }
+    }
+
+    return okay ? 0 : 1;
+}
@@ -0,0 +1,193 @@
+//
+//  Bench.h
+//  libwidgetinfo
+//
+//  What the benchmarks in this directory share: a clock, an allocator that
+//  counts what Gumbo asks for, the pages they parse when they're given no
+//  files, and reading the ones they are given. Each of them takes
+//
+//      <bench> [-n rounds] [--quick] [file...]
+//
+//  and reports the best of its rounds. --quick is what ctest runs: one round
+//  on small pages, to make sure the benchmark still works and that what it
+//  checks along the way holds.
+//
+
+#ifndef GUMBO_TEST_BENCH_H
+#define GUMBO_TEST_BENCH_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gumbo.h"
+
+#include "Markup.h"
+
+typedef struct {
+    unsigned rounds;
+    bool quick;
+    char **files;
+    int fileCount;
+} Arguments;
+
+static inline void ParseArguments(int argc, char *argv[], unsigned rounds, Arguments *arguments) {
+    arguments->rounds = rounds;
+    arguments->quick = false;
+    arguments->files = argv + argc;
+    arguments->fileCount = 0;
+
+    for (int i = 1; i != argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 != argc) {
+            int value = atoi(argv[++i]);
+            arguments->rounds = value > 0 ? (unsigned) value : 1;
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            arguments->quick = true;
+        } else {
+            // Files come last
+            arguments->files = argv + i;
+            arguments->fileCount = argc - i;
+            break;
+        }
+    }
+
+    if (arguments->quick) {
+        arguments->rounds = 1;
+    }
+}
+
+// Milliseconds from an arbitrary start
+static inline double Now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e3 + now.tv_nsec / 1e6;
+}
+
+// Every call Gumbo makes to its allocator, frees aside, and the bytes those
+// calls asked for; and the blocks it holds, which is back to where it was
+// once an output is destroyed
+static size_t allocations_, allocatedBytes_;
+static long liveBlocks_;
+
+static inline void *CountingAllocator(void *pointer, size_t size) {
+    ++allocations_;
+    allocatedBytes_ += size;
+    liveBlocks_ += pointer == NULL;
+    return realloc(pointer, size);
+}
+
+static inline void CountingFree(void *pointer) {
+    liveBlocks_ -= pointer != NULL;
+    free(pointer);
+}
+
+static inline void CountAllocations(void) {
+    gumbo_memory_set_allocator(CountingAllocator);
+    gumbo_memory_set_free(CountingFree);
+}
+
+static inline bool ReadFile(const char *path, Buffer *document) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+
+    char chunk[65536];
+    for (size_t size; (size = fread(chunk, 1, sizeof(chunk), file)) != 0;) {
+        Append(document, chunk, size);
+    }
+    fclose(file);
+
+    if (document->data == NULL) {
+        AppendString(document, "");
+    }
+    return true;
+}
+
+// A widget as they're usually written: a head with a style and scripts, then
+// nested containers of text, images and small icons, with a reference here
+// and there
+static inline void WidgetPage(Buffer *page, unsigned count) {
+    AppendString(page,
+        "<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n"
+        "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\n"
+        "<title>Weather</title>\n"
+        "<style>body { margin: 0; font: 12px -apple-system; } .row > span { color: #fff; }</style>\n"
+        "<script src=\"js/api.js\"></script>\n"
+        "<script type=\"text/cycript\">var api = [IS2Weather currentTemperature];</script>\n"
+        "</head>\n<body class=\"widget dark\">\n");
+
+    char line[1024];
+    for (unsigned i = 0; i != count; ++i) {
+        snprintf(line, sizeof(line),
+            "<div class=\"row\" id=\"row%u\" data-index=\"%u\">\n"
+            "  <img src=\"icons/%u.png\" alt=\"\" width=\"24\" height=\"24\">\n"
+            "  <span class=\"label\">Day %u</span> <span class=\"value\">%u&deg;</span>\n"
+            "  <a href=\"weather.html?day=%u&amp;units=c\" onclick=\"return open(this)\">More &raquo;</a>\n"
+            "  <svg width=\"16\" height=\"16\" viewBox=\"0 0 16 16\"><path d=\"M%u 0L16 8L0 16Z\" fill=\"#fff\"/></svg>\n"
+            "  <ul><li>High <b>%u</b></li><li>Low <b>%u</b></li><li><i>Rain</i> %u%%</li></ul>\n"
+            "</div>\n", i, i, i % 40, i, i % 30, i, i % 16, i % 35, i % 20, i % 100);
+        AppendString(page, line);
+    }
+
+    AppendString(page, "<script>api.refresh();</script>\n</body>\n</html>\n");
+}
+
+// Inline SVG the way icon sets and charts export it: every element carries
+// many attributes, several of them with foreign-attribute or SVG case fixups
+static inline void SvgPage(Buffer *page, unsigned count) {
+    AppendString(page,
+        "<!DOCTYPE html>\n<html><body>\n"
+        "<svg xmlns=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" "
+        "viewBox=\"0 0 1000 1000\" preserveAspectRatio=\"xMidYMid meet\">\n"
+        "<defs><linearGradient id=\"g\" gradientUnits=\"userSpaceOnUse\" x1=\"0\" y1=\"0\" x2=\"0\" y2=\"1\">"
+        "<stop offset=\"0\" stop-color=\"#fff\"/><stop offset=\"1\" stop-color=\"#000\"/></linearGradient></defs>\n");
+
+    char line[1024];
+    for (unsigned i = 0; i != count; ++i) {
+        snprintf(line, sizeof(line),
+            "<g id=\"g%u\" class=\"series\" transform=\"translate(%u %u)\" clip-path=\"url(#c)\" opacity=\"0.9\">"
+            "<path id=\"p%u\" d=\"M%u %uL%u %uZ\" fill=\"url(#g)\" stroke=\"#%06x\" stroke-width=\"2\" "
+            "stroke-linecap=\"round\" stroke-linejoin=\"round\" fill-rule=\"evenodd\"/>"
+            "<rect x=\"%u\" y=\"%u\" width=\"10\" height=\"10\" rx=\"2\" ry=\"2\" fill=\"#%06x\" data-value=\"%u\"/>"
+            "<use xlink:href=\"#p%u\" x=\"1\" y=\"1\" fill-opacity=\"0.5\"/>"
+            "<text x=\"%u\" y=\"%u\" font-family=\"Helvetica\" font-size=\"9\" text-anchor=\"middle\">%u</text></g>\n",
+            i, i % 1000, i / 1000, i, i % 997, i % 991, i % 983, i % 977, (i * 2654435761u) & 0xffffff,
+            i % 990, i % 980, (i * 40503u) & 0xffffff, i, i, i % 990, i % 980, i);
+        AppendString(page, line);
+    }
+
+    AppendString(page, "</svg>\n</body></html>\n");
+}
+
+// Enough of a tree to tell two parses of the same page apart
+static inline void SerializeTree(const GumboNode *node, Buffer *out) {
+    if (node->type == GUMBO_NODE_TEXT || node->type == GUMBO_NODE_WHITESPACE ||
+        node->type == GUMBO_NODE_COMMENT || node->type == GUMBO_NODE_CDATA) {
+        AppendString(out, node->v.text.text);
+        return;
+    }
+    if (node->type != GUMBO_NODE_ELEMENT && node->type != GUMBO_NODE_TEMPLATE) {
+        return;
+    }
+    const GumboElement *element = &node->v.element;
+    AppendString(out, "<");
+    AppendString(out, gumbo_normalized_tagname(element->tag));
+    for (unsigned i = 0; i != element->attributes.length; ++i) {
+        const GumboAttribute *attribute = element->attributes.data[i];
+        AppendString(out, " ");
+        AppendString(out, attribute->name);
+        AppendString(out, "=");
+        AppendString(out, attribute->value);
+    }
+    AppendString(out, ">");
+    for (unsigned i = 0; i != element->children.length; ++i) {
+        SerializeTree(element->children.data[i], out);
+    }
+    AppendString(out, "</>");
+}
+
+#endif
@@ -0,0 +1,125 @@
+//
+//  CharRefBench.c
+//  libwidgetinfo
+//
+//  Character references on a page dense with them, in text and in href query
+//  strings, against the same page with every reference written out as the
+//  characters it stands for. The two have to parse to the same tree, so the
+//  difference in parse time is what matching the references costs. Both are
+//  parsed without keeping errors, which the plain page's bare '<' and the dense
+//  page's legacy name would otherwise add to the times.
+//
+//      char-ref-bench [-n rounds] [--quick] [file...]
+//
+//  Given files, it only times them.
+//
+
+#include "Bench.h"
+
+// Twenty references a unit: common names, a long one, a legacy name without its
+// semicolon, numerics, and query strings
+static const char kDense[] =
+    "<p>Caf&eacute; &amp; bar &lt; 3 &gt; 2 &quot;q&quot; &nbsp;&copy; 2024 &mdash; &hellip; &rarr; "
+    "&euro;5 &#8212; &#x2014; &CounterClockwiseContourIntegral; &copy x</p>\n"
+    "<a href=\"w.html?day=%u&amp;units=c&amp;lang=en\" title=\"&laquo;More&raquo;\">x</a>\n";
+static const char kPlain[] =
+    "<p>Caf\xC3\xA9 & bar < 3 > 2 \"q\" \xC2\xA0\xC2\xA9 2024 \xE2\x80\x94 \xE2\x80\xA6 \xE2\x86\x92 "
+    "\xE2\x82\xAC""5 \xE2\x80\x94 \xE2\x80\x94 \xE2\x88\xB3 \xC2\xA9 x</p>\n"
+    "<a href=\"w.html?day=%u&units=c&lang=en\" title=\"\xC2\xABMore\xC2\xBB\">x</a>\n";
+#define kReferencesPerUnit 20
+
+static void Build(const char *unit, unsigned count, Buffer *page) {
+    AppendString(page, "<!DOCTYPE html>\n<html><body>\n");
+    char line[512];
+    for (unsigned i = 0; i != count; ++i) {
+        snprintf(line, sizeof(line), unit, i);
+        AppendString(page, line);
+    }
+    AppendString(page, "</body></html>\n");
+}
+
+// The text and attribute values of the tree, in order
+static void Flatten(const GumboNode *node, Buffer *out) {
+    if (node->type == GUMBO_NODE_TEXT || node->type == GUMBO_NODE_WHITESPACE) {
+        AppendString(out, node->v.text.text);
+        return;
+    }
+    if (node->type != GUMBO_NODE_ELEMENT) {
+        return;
+    }
+    const GumboVector *attributes = &node->v.element.attributes;
+    for (unsigned i = 0; i != attributes->length; ++i) {
+        const GumboAttribute *attribute = attributes->data[i];
+        AppendString(out, "\x01");
+        AppendString(out, attribute->value);
+    }
+    const GumboVector *children = &node->v.element.children;
+    for (unsigned i = 0; i != children->length; ++i) {
+        Flatten(children->data[i], out);
+    }
+}
+
+static double Time(const Buffer *page, unsigned rounds, Buffer *flat) {
+    GumboOptions options = kGumboDefaultOptions;
+    options.error_mode = GUMBO_ERRORS_NONE;
+
+    double best = 0;
+    for (unsigned round = 0; round != rounds; ++round) {
+        double start = Now();
+        GumboOutput *output = gumbo_parse_with_options(&options, page->data, page->length);
+        double time = Now() - start;
+        best = round == 0 || time < best ? time : best;
+        if (flat != NULL && round == 0) {
+            Flatten(output->root, flat);
+        }
+        gumbo_destroy_output(output);
+    }
+    return best;
+}
+
+int main(int argc, char *argv[]) {
+    Arguments arguments;
+    ParseArguments(argc, argv, 10, &arguments);
+
+    bool okay = true;
+    if (arguments.fileCount == 0) {
+        unsigned count = arguments.quick ? 200 : 100000;
+        Buffer dense = {NULL, 0, 0}, plain = {NULL, 0, 0};
+        Build(kDense, count, &dense);
+        Build(kPlain, count, &plain);
+
+        Buffer denseFlat = {NULL, 0, 0}, plainFlat = {NULL, 0, 0};
+        AppendString(&denseFlat, "");
+        AppendString(&plainFlat, "");
+        double denseTime = Time(&dense, arguments.rounds, &denseFlat);
+        double plainTime = Time(&plain, arguments.rounds, &plainFlat);
+        if (strcmp(denseFlat.data, plainFlat.data) != 0) {
+            fprintf(stderr, "the references don't decode to the plain page's text\n");
+            okay = false;
+        }
+
+        unsigned references = count * kReferencesPerUnit;
+        printf("%-8s %9s %9s %9s\n", "page", "bytes", "refs", "parse ms");
+        printf("%-8s %9zu %9u %9.2f\n", "dense", dense.length, references, denseTime);
+        printf("%-8s %9zu %9u %9.2f\n", "plain", plain.length, 0, plainTime);
+        printf("%.1f ns per reference over the plain page\n", (denseTime - plainTime) * 1e6 / references);
+
+        free(dense.data);
+        free(plain.data);
+        free(denseFlat.data);
+        free(plainFlat.data);
+    } else {
+        printf("%-20s %9s %9s\n", "page", "bytes", "parse ms");
+        for (int i = 0; i != arguments.fileCount; ++i) {
+            Buffer page = {NULL, 0, 0};
+            if (ReadFile(arguments.files[i], &page)) {
+                printf("%-20s %9zu %9.2f\n", arguments.files[i], page.length, Time(&page, arguments.rounds, NULL));
+            } else {
+                okay = false;
+            }
+            free(page.data);
+        }
+    }
+
+    return okay ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+//
+//  CharRefs.c
+//  libwidgetinfo
+//
+//  Every named character reference in char_ref.in, decoded in text and in
+//  attribute values, and then the cases where decoding depends on what comes
+//  around the reference: legacy names without their semicolon, which match as
+//  a prefix in text but are left alone in attributes when a letter, digit or
+//  '=' follows, and numeric references out of range or in the C1 controls.
+//
+//      char-refs [char_ref.in]
+//
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gumbo.h"
+
+#include "Markup.h"
+
+typedef struct {
+    const char *html;
+    // The text of the <p>, or the value of its title when html has one
+    const char *expected;
+} Case;
+
+static const Case kCases[] = {
+    // A legacy name is the longest match in text, semicolon or not
+    {"<p>&notit;", "\xC2\xACit;"},
+    {"<p>&notin;", "\xE2\x88\x89"},
+    {"<p>&notin", "\xC2\xACin"},
+    {"<p>&ampx", "&x"},
+    {"<p>&amp;x", "&x"},
+    {"<p>&AMP", "&"},
+    // Names that aren't legacy need their semicolon
+    {"<p>&hellip", "&hellip"},
+    {"<p>&zzz;", "&zzz;"},
+    {"<p>&;", "&;"},
+    {"<p>& x", "& x"},
+    {"<p>&", "&"},
+    // In attributes, a legacy name followed by an alphanumeric or '=' is text
+    {"<p title=\"&notit\">", "&notit"},
+    {"<p title=\"&notit;\">", "&notit;"},
+    {"<p title=\"&amp=\">", "&amp="},
+    {"<p title=\"?a=1&copy=2\">", "?a=1&copy=2"},
+    {"<p title=\"&amp;=\">", "&="},
+    {"<p title=\"&amp \">", "& "},
+    {"<p title=\"&amp\">", "&"},
+    {"<p title=&not>", "\xC2\xAC"},
+    {"<p title=\"&hellip\">", "&hellip"},
+    // Numeric references
+    {"<p>&#65;", "A"},
+    {"<p>&#x41;", "A"},
+    {"<p>&#X41", "A"},
+    {"<p>&#65x", "Ax"},
+    {"<p>&#0;", "\xEF\xBF\xBD"},
+    {"<p>&#x80;", "\xE2\x82\xAC"},
+    {"<p>&#x9F;", "\xC5\xB8"},
+    {"<p>&#xD800;", "\xEF\xBF\xBD"},
+    {"<p>&#xDFFF;", "\xEF\xBF\xBD"},
+    {"<p>&#x10FFFF;", "\xF4\x8F\xBF\xBF"},
+    {"<p>&#x110000;", "\xEF\xBF\xBD"},
+    {"<p>&#99999999999;", "\xEF\xBF\xBD"},
+    {"<p>&#;", "&#;"},
+    {"<p>&#x;", "&#x;"},
+    {"<p>&#xg;", "&#xg;"},
+    {"<p title=\"&#x80;\">", "\xE2\x82\xAC"},
+    {"<p title=\"&#38;amp;\">", "&amp;"},
+};
+
+static void AppendCodepoint(Buffer *buffer, unsigned long c) {
+    char bytes[4];
+    size_t length;
+    if (c < 0x80) {
+        bytes[0] = (char) c;
+        length = 1;
+    } else if (c < 0x800) {
+        bytes[0] = (char) (0xC0 | c >> 6);
+        bytes[1] = (char) (0x80 | (c & 0x3F));
+        length = 2;
+    } else if (c < 0x10000) {
+        bytes[0] = (char) (0xE0 | c >> 12);
+        bytes[1] = (char) (0x80 | (c >> 6 & 0x3F));
+        bytes[2] = (char) (0x80 | (c & 0x3F));
+        length = 3;
+    } else {
+        bytes[0] = (char) (0xF0 | c >> 18);
+        bytes[1] = (char) (0x80 | (c >> 12 & 0x3F));
+        bytes[2] = (char) (0x80 | (c >> 6 & 0x3F));
+        bytes[3] = (char) (0x80 | (c & 0x3F));
+        length = 4;
+    }
+    Append(buffer, bytes, length);
+}
+
+static const GumboNode *FindP(const GumboNode *node) {
+    if (node->type != GUMBO_NODE_ELEMENT) {
+        return NULL;
+    }
+    if (node->v.element.tag == GUMBO_TAG_P) {
+        return node;
+    }
+    const GumboVector *children = &node->v.element.children;
+    for (unsigned i = 0; i != children->length; ++i) {
+        const GumboNode *p = FindP(children->data[i]);
+        if (p != NULL) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+static bool Check(const char *html, const char *expected) {
+    GumboOutput *output = gumbo_parse(html);
+    const GumboNode *p = FindP(output->root);
+
+    Buffer actual = {NULL, 0, 0};
+    AppendString(&actual, "");
+    if (p != NULL && strstr(html, "title=") != NULL) {
+        const GumboAttribute *title = gumbo_get_attribute(&p->v.element.attributes, "title");
+        if (title != NULL) {
+            AppendString(&actual, title->value);
+        }
+    } else if (p != NULL) {
+        const GumboVector *children = &p->v.element.children;
+        for (unsigned i = 0; i != children->length; ++i) {
+            const GumboNode *child = children->data[i];
+            if (child->type == GUMBO_NODE_TEXT || child->type == GUMBO_NODE_WHITESPACE) {
+                AppendString(&actual, child->v.text.text);
+            }
+        }
+    }
+
+    bool okay = strcmp(actual.data, expected) == 0;
+    if (!okay) {
+        fprintf(stderr, "%s\n  expected: ", html);
+        for (const char *c = expected; *c != '\0'; ++c) {
+            fprintf(stderr, (unsigned char) *c < 0x80 ? "%c" : "\\x%02X", (unsigned char) *c);
+        }
+        fprintf(stderr, "\n  actual:   ");
+        for (const char *c = actual.data; *c != '\0'; ++c) {
+            fprintf(stderr, (unsigned char) *c < 0x80 ? "%c" : "\\x%02X", (unsigned char) *c);
+        }
+        fprintf(stderr, "\n");
+    }
+    free(actual.data);
+    gumbo_destroy_output(output);
+    return okay;
+}
+
+// Each reference in text followed by a space, and as a whole attribute value
+static void CheckList(const char *path, unsigned *failed, unsigned *total) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        ++*failed;
+        return;
+    }
+
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char name[128];
+        unsigned long first, second;
+        int fields = sscanf(line, "%127s %lx %lx", name, &first, &second);
+        if (fields < 2) {
+            continue;
+        }
+
+        Buffer decoded = {NULL, 0, 0};
+        AppendCodepoint(&decoded, first);
+        if (fields == 3) {
+            AppendCodepoint(&decoded, second);
+        }
+
+        char html[256];
+        Buffer expected = {NULL, 0, 0};
+        snprintf(html, sizeof(html), "<p>&%s x", name);
+        AppendString(&expected, decoded.data);
+        AppendString(&expected, " x");
+        *failed += !Check(html, expected.data);
+
+        snprintf(html, sizeof(html), "<p title=\"&%s\">", name);
+        *failed += !Check(html, decoded.data);
+
+        *total += 2;
+        free(decoded.data);
+        free(expected.data);
+    }
+    fclose(file);
+}
+
+int main(int argc, char *argv[]) {
+    unsigned failed = 0, total = 0;
+
+    CheckList(argc > 1 ? argv[1] : "char_ref.in", &failed, &total);
+    for (unsigned i = 0; i != sizeof(kCases) / sizeof(kCases[0]); ++i) {
+        failed += !Check(kCases[i].html, kCases[i].expected);
+        ++total;
+    }
+
+    printf("%u of %u character reference checks failed\n", failed, total);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+//
+//  DuplicateAttributes.c
+//  libwidgetinfo
+//
+//  A repeated attribute is dropped with its value, and the name after it is
+//  read as it's written, whether or not the duplicate's parse error is kept:
+//  under every error mode, and once max_errors has been reached.
+//
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gumbo.h"
+
+typedef struct {
+    const char *html;
+    // The attributes of the first element in the body, as name=value pairs
+    const char *expected;
+} Case;
+
+static const Case kCases[] = {
+    {"<p a=1 a=2 b=3>", "a=1 b=3"},
+    {"<p data-x data-x src=y>", "data-x= src=y"},
+    {"<p id=a ID=b class=c>", "id=a class=c"},
+    {"<p x x x y>", "x= y="},
+    {"<p foo=1 foo bar=2 foo=3 baz>", "foo=1 bar=2 baz="},
+    {"<p a=1 a=2>", "a=1"},
+};
+
+static const GumboNode *FirstInBody(const GumboOutput *output) {
+    const GumboVector *html = &output->root->v.element.children;
+    for (unsigned i = 0; i != html->length; ++i) {
+        const GumboNode *node = html->data[i];
+        if (node->type == GUMBO_NODE_ELEMENT && node->v.element.tag == GUMBO_TAG_BODY) {
+            return node->v.element.children.length != 0 ? node->v.element.children.data[0] : NULL;
+        }
+    }
+    return NULL;
+}
+
+static bool Check(const Case *test, const GumboOptions *options, const char *mode) {
+    GumboOutput *output = gumbo_parse_with_options(options, test->html, strlen(test->html));
+    const GumboNode *node = FirstInBody(output);
+
+    char actual[256] = "";
+    if (node != NULL && node->type == GUMBO_NODE_ELEMENT) {
+        const GumboVector *attributes = &node->v.element.attributes;
+        for (unsigned i = 0; i != attributes->length; ++i) {
+            const GumboAttribute *attribute = attributes->data[i];
+            size_t length = strlen(actual);
+            snprintf(actual + length, sizeof(actual) - length, "%s%s=%s",
+                i == 0 ? "" : " ", attribute->name, attribute->value);
+        }
+    }
+
+    gumbo_destroy_output(output);
+    if (strcmp(actual, test->expected) != 0) {
+        fprintf(stderr, "%s (%s): %s, not %s\n", test->html, mode, actual, test->expected);
+        return false;
+    }
+    return true;
+}
+
+int main(void) {
+    unsigned failed = 0;
+
+    for (unsigned i = 0; i != sizeof(kCases) / sizeof(kCases[0]); ++i) {
+        GumboOptions options = kGumboDefaultOptions;
+        failed += !Check(&kCases[i], &options, "all errors");
+        options.max_errors = 0;
+        failed += !Check(&kCases[i], &options, "no errors kept");
+        options.max_errors = -1;
+        options.error_mode = GUMBO_ERRORS_COUNT;
+        failed += !Check(&kCases[i], &options, "errors counted");
+        options.error_mode = GUMBO_ERRORS_NONE;
+        failed += !Check(&kCases[i], &options, "errors ignored");
+    }
+
+    printf("%u duplicate attribute checks failed\n", failed);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,172 @@
+//
+//  ErrorBench.c
+//  libwidgetinfo
+//
+//  Parse and destroy times, and allocator calls, in each error mode on markup
+//  that is mostly errors: generated tag soup, a run of tokenizer errors, and a
+//  widget page with a few for comparison. Every mode has to build the same
+//  tree; COUNT has to count what FULL does, FULL with max_errors has to keep
+//  that many of them, and NONE has to leave both at nothing.
+//
+//      error-bench [-n rounds] [--quick] [file...]
+//
+
+#include "Bench.h"
+
+typedef struct {
+    const char *name;
+    GumboErrorMode mode;
+    int maxErrors;
+} Mode;
+
+static const Mode kModes[] = {
+    {"full", GUMBO_ERRORS_FULL, -1},
+    {"full/50", GUMBO_ERRORS_FULL, 50},
+    {"count", GUMBO_ERRORS_COUNT, -1},
+    {"none", GUMBO_ERRORS_NONE, -1},
+};
+
+#define kModeCount (sizeof(kModes) / sizeof(kModes[0]))
+
+// Duplicate and stray attributes, bad character references, a NUL, bogus end
+// tags and comments, a doctype out of place and invalid UTF-8
+static const char kTokenizerUnit[] =
+    "<p a a=1 a=2 b=\"x\"c>&#0;&bogus; &#x110000 \0 x</p x=1></ p><//x><a =x>"
+    "<!--a--!><!-- -- --><!DOCTYPE><?pi?>\xFF\xC3(<br/ ></a>\n";
+
+// What one document parses to in one mode: its tree, its counted errors and
+// its recorded ones
+static bool Check(const char *name, const Mode *mode, const GumboOutput *output, const char *tree,
+    unsigned errors) {
+    const char *problem = NULL;
+    if (mode->mode == GUMBO_ERRORS_NONE) {
+        problem = output->error_count != 0 || output->errors.length != 0 ? "kept errors" : NULL;
+    } else if (output->error_count != errors) {
+        problem = "counted different errors";
+    } else if (mode->mode == GUMBO_ERRORS_COUNT && output->errors.length != 0) {
+        problem = "recorded errors";
+    } else if (mode->mode == GUMBO_ERRORS_FULL) {
+        unsigned kept = mode->maxErrors >= 0 && errors > (unsigned) mode->maxErrors ? (unsigned) mode->maxErrors : errors;
+        problem = output->errors.length != kept ? "recorded the wrong number of errors" : NULL;
+    }
+
+    if (problem == NULL) {
+        Buffer actual = {NULL, 0, 0};
+        AppendString(&actual, "");
+        SerializeTree(output->root, &actual);
+        problem = strcmp(actual.data, tree) != 0 ? "built a different tree" : NULL;
+        free(actual.data);
+    }
+
+    if (problem != NULL) {
+        fprintf(stderr, "%s: %s %s\n", name, mode->name, problem);
+        return false;
+    }
+    return true;
+}
+
+// The documents are parsed one after the other, and timed together
+static bool Run(const char *name, const Buffer *documents, unsigned count, unsigned rounds) {
+    // What FULL without a limit finds, which the other modes are checked against
+    char **trees = calloc(count, sizeof(*trees));
+    unsigned *errors = calloc(count, sizeof(*errors));
+    size_t bytes = 0;
+    unsigned total = 0;
+    for (unsigned i = 0; i != count; ++i) {
+        GumboOptions options = kGumboDefaultOptions;
+        options.max_errors = -1;
+        GumboOutput *output = gumbo_parse_with_options(&options, documents[i].data, documents[i].length);
+        Buffer tree = {NULL, 0, 0};
+        AppendString(&tree, "");
+        SerializeTree(output->root, &tree);
+        trees[i] = tree.data;
+        errors[i] = output->error_count;
+        bytes += documents[i].length;
+        total += output->error_count;
+        gumbo_destroy_output(output);
+    }
+
+    bool okay = true;
+    for (unsigned m = 0; m != kModeCount && okay; ++m) {
+        GumboOptions options = kGumboDefaultOptions;
+        options.error_mode = kModes[m].mode;
+        options.max_errors = kModes[m].maxErrors;
+
+        double best = 0;
+        size_t allocations = 0;
+        for (unsigned round = 0; round != rounds && okay; ++round) {
+            allocations_ = 0;
+            double time = 0;
+            for (unsigned i = 0; i != count && okay; ++i) {
+                double start = Now();
+                GumboOutput *output = gumbo_parse_with_options(&options, documents[i].data, documents[i].length);
+                double parsed = Now();
+                if (round == 0) {
+                    okay = Check(name, &kModes[m], output, trees[i], errors[i]);
+                }
+                double checked = Now();
+                gumbo_destroy_output(output);
+                time += parsed - start + Now() - checked;
+            }
+            allocations = allocations_;
+            best = round == 0 || time < best ? time : best;
+        }
+
+        printf("%-20s %-8s %9zu %9u %9zu %9.2f\n", name, kModes[m].name, bytes, total, allocations, best);
+    }
+
+    for (unsigned i = 0; i != count; ++i) {
+        free(trees[i]);
+    }
+    free(trees);
+    free(errors);
+    return okay;
+}
+
+int main(int argc, char *argv[]) {
+    Arguments arguments;
+    ParseArguments(argc, argv, 10, &arguments);
+    CountAllocations();
+
+    printf("%-20s %-8s %9s %9s %9s %9s\n", "page", "mode", "bytes", "errors", "allocs", "parse ms");
+
+    bool okay = true;
+    if (arguments.fileCount == 0) {
+        unsigned scale = arguments.quick ? 1 : 40;
+
+        // Separate documents, since one <plaintext> would turn the rest of a
+        // single one into text
+        unsigned soups = 50 * scale;
+        Buffer *soup = calloc(soups, sizeof(*soup));
+        for (unsigned i = 0; i != soups; ++i) {
+            SeedRandom(i);
+            AppendString(&soup[i], "");
+            while (soup[i].length < 500) {
+                Generate(&soup[i], 0);
+            }
+        }
+        okay = Run("soup", soup, soups, arguments.rounds) && okay;
+        for (unsigned i = 0; i != soups; ++i) {
+            free(soup[i].data);
+        }
+        free(soup);
+
+        Buffer tokenizer = {NULL, 0, 0}, widget = {NULL, 0, 0};
+        for (unsigned i = 0; i != 200 * scale; ++i) {
+            Append(&tokenizer, kTokenizerUnit, sizeof(kTokenizerUnit) - 1);
+        }
+        WidgetPage(&widget, 10 * scale);
+        okay = Run("tokenizer", &tokenizer, 1, arguments.rounds) && okay;
+        okay = Run("widget", &widget, 1, arguments.rounds) && okay;
+        free(tokenizer.data);
+        free(widget.data);
+    } else {
+        for (int i = 0; i != arguments.fileCount; ++i) {
+            Buffer page = {NULL, 0, 0};
+            okay = ReadFile(arguments.files[i], &page) && Run(arguments.files[i], &page, 1, arguments.rounds) && okay;
+            free(page.data);
+        }
+    }
+
+    return okay ? 0 : 1;
+}
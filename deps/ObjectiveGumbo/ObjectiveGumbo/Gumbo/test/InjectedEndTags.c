@@ -0,0 +1,79 @@
+//
+//  InjectedEndTags.c
+//  libwidgetinfo
+//
+//  Under XHTML rules a self-closing <table/> is followed by an injected
+//  </table>, and a table body or row reprocesses that in table mode. The start
+//  tag has been handled, and ignored, by then: handling it again frees its
+//  attributes twice, and the pool hands them out twice after that.
+//
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gumbo.h"
+
+static const char *const kCases[] = {
+    "<template><tbody><table a=1 b /></template>",
+    "<template><tr><table a=1 b /></template>",
+    "<template><thead><tr><table a=1 b /></template>",
+    "<template><tbody>x<table a=1 b /></template>",
+    "<template><tbody><table a=1 b /><table c=2 d /></template>",
+};
+
+// Attributes allocated after the free are the ones that would be handed out
+// twice
+static const char kAfter[] = "<p x=1 y=2 z=3 w=4>";
+static const char kExpected[] = "x=1 y=2 z=3 w=4";
+
+static const GumboNode *LastInBody(const GumboOutput *output) {
+    const GumboVector *html = &output->root->v.element.children;
+    for (unsigned i = 0; i != html->length; ++i) {
+        const GumboNode *node = html->data[i];
+        if (node->type == GUMBO_NODE_ELEMENT && node->v.element.tag == GUMBO_TAG_BODY) {
+            const GumboVector *children = &node->v.element.children;
+            return children->length != 0 ? children->data[children->length - 1] : NULL;
+        }
+    }
+    return NULL;
+}
+
+static bool Check(const char *html) {
+    char document[256];
+    snprintf(document, sizeof(document), "%s%s", html, kAfter);
+
+    GumboOptions options = kGumboDefaultOptions;
+    options.use_xhtml_rules = true;
+    GumboOutput *output = gumbo_parse_with_options(&options, document, strlen(document));
+    const GumboNode *node = LastInBody(output);
+
+    char actual[256] = "";
+    if (node != NULL && node->type == GUMBO_NODE_ELEMENT) {
+        const GumboVector *attributes = &node->v.element.attributes;
+        for (unsigned i = 0; i != attributes->length; ++i) {
+            const GumboAttribute *attribute = attributes->data[i];
+            size_t length = strlen(actual);
+            snprintf(actual + length, sizeof(actual) - length, "%s%s=%s",
+                i == 0 ? "" : " ", attribute->name, attribute->value);
+        }
+    }
+
+    gumbo_destroy_output(output);
+    if (strcmp(actual, kExpected) != 0) {
+        fprintf(stderr, "%s: %s, not %s\n", document, actual, kExpected);
+        return false;
+    }
+    return true;
+}
+
+int main(void) {
+    unsigned failed = 0;
+
+    for (unsigned i = 0; i != sizeof(kCases) / sizeof(kCases[0]); ++i) {
+        failed += !Check(kCases[i]);
+    }
+
+    printf("%u injected end tag checks failed\n", failed);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+//
+//  Markup.h
+//  libwidgetinfo
+//
+//  Seeded random markup for the differential tests: nested tags from a list
+//  that leans on everything the tree builder treats specially, with raw text,
+//  references and broken syntax in between. The same seed always gives the
+//  same document.
+//
+
+#ifndef GUMBO_TEST_MARKUP_H
+#define GUMBO_TEST_MARKUP_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Documents are built in a growable buffer
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+} Buffer;
+
+static inline void Append(Buffer *buffer, const char *data, size_t length) {
+    if (buffer->length + length + 1 > buffer->capacity) {
+        buffer->capacity = (buffer->length + length + 1) * 2;
+        buffer->data = realloc(buffer->data, buffer->capacity);
+    }
+    memcpy(buffer->data + buffer->length, data, length);
+    buffer->length += length;
+    buffer->data[buffer->length] = '\0';
+}
+
+static inline void AppendString(Buffer *buffer, const char *string) {
+    Append(buffer, string, strlen(string));
+}
+
+static uint64_t random_;
+
+static inline void SeedRandom(unsigned seed) {
+    random_ = 0x9e3779b97f4a7c15ull * (seed + 1);
+}
+
+static inline uint32_t Random(uint32_t bound) {
+    random_ ^= random_ << 13;
+    random_ ^= random_ >> 7;
+    random_ ^= random_ << 17;
+    return (uint32_t) (random_ % bound);
+}
+
+#define Choose(array) (array[Random(sizeof(array) / sizeof(array[0]))])
+
+static const char *const kTags[] = {
+    "div", "span", "p", "a", "b", "i", "s", "table", "tr", "td", "th",
+    "tbody", "thead", "caption", "colgroup", "ul", "li", "svg", "path", "g",
+    "math", "mi", "script", "style", "textarea", "title", "select", "option",
+    "form", "input", "img", "br", "hr", "template", "font", "nobr", "button",
+    "pre", "iframe", "noscript", "xmp", "head", "body", "html", "col",
+    "foreignObject", "desc", "marquee", "object", "applet", "dd", "noembed",
+    "noframes", "image", "listing", "annotation-xml", "mtext", "plaintext",
+    "frameset", "frame", "keygen",
+};
+
+static const char *const kAttributes[] = {
+    "id", "class", "type", "src", "href", "viewBox", "xlink:href", "xmlns",
+    "data-x", "color", "definitionURL", "onclick", "TYPE", "value", "encoding",
+};
+
+static const char *const kValues[] = {
+    "=\"v>&amp;'\"", "=v'&lt", "=hidden", "=\"text/html\"",
+};
+
+static const char *const kTexts[] = {
+    "hello", "  ", "\n", "x<y", "a > b", "if (a<b && c) {}", "</scr",
+    "<!-- c -->", "\xc3\xa9\xe4\xb8\xad", "\r\n", "</script>", "<!",
+    "<?php ?>", "<![CDATA[x]]>", "</", "-->", "&amp;", "&lt;", "&notin;",
+    "&not", "&#x41;", "&#0;", "&#x110000;", "&bogus;", "&", "&#", "\t",
+    "&CounterClockwiseContourIntegral;", "\xff", "\xe4\xb8",
+};
+
+static inline void Generate(Buffer *buffer, unsigned depth) {
+    for (unsigned count = 1 + Random(6); count != 0; --count) {
+        uint32_t choice = Random(100);
+        if (choice < 30 || depth > 6) {
+            AppendString(buffer, Choose(kTexts));
+        } else if (choice < 40) {
+            AppendString(buffer, "</");
+            AppendString(buffer, Choose(kTags));
+            AppendString(buffer, ">");
+        } else if (choice < 45) {
+            AppendString(buffer, "<!--x-->");
+        } else {
+            const char *tag = Choose(kTags);
+            AppendString(buffer, "<");
+            AppendString(buffer, tag);
+            for (unsigned attributes = Random(4); attributes != 0; --attributes) {
+                AppendString(buffer, " ");
+                AppendString(buffer, Choose(kAttributes));
+                if (Random(5) != 0) {
+                    AppendString(buffer, Choose(kValues));
+                }
+            }
+            AppendString(buffer, Random(10) == 0 ? "/>" : ">");
+            Generate(buffer, depth + 1);
+            if (Random(10) < 7) {
+                AppendString(buffer, "</");
+                AppendString(buffer, tag);
+                AppendString(buffer, ">");
+            }
+        }
+    }
+}
+
+#endif
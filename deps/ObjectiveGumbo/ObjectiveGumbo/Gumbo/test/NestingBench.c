@@ -0,0 +1,83 @@
+//
+//  NestingBench.c
+//  libwidgetinfo
+//
+//  Parse times on the markup that makes the tree builder search its stack of
+//  open elements and its list of active formatting elements: misnested
+//  formatting under a deep chain of <div>s, anchors closed from deep inside
+//  blocks, formatting reopened over and over, and plain deep nesting. While
+//  those searches were linear, the first three went quadratic in the depth.
+//
+//      nesting-bench [-n rounds] [--quick] [file...]
+//
+
+#include "Bench.h"
+
+typedef struct {
+    const char *name;
+    // Opened once, then the unit repeated
+    const char *prefix;
+    unsigned prefixCount;
+    const char *unit;
+} Shape;
+
+static const Shape kShapes[] = {
+    {"misnested", "<div>", 1000, "<b><i><u>x</b>y</i>z</u>"},
+    {"anchors", "<div>", 1000, "<a href=x><div><div><div><p>x</a>y</p></div></div></div>"},
+    {"reopened", "<div>", 1000, "<b><i><s><u>x</p>y"},
+    {"deep", "", 0, "<div><span>x"},
+};
+
+static void Build(const Shape *shape, unsigned repeats, Buffer *page) {
+    for (unsigned i = 0; i != shape->prefixCount; ++i) {
+        AppendString(page, shape->prefix);
+    }
+    for (unsigned i = 0; i != repeats; ++i) {
+        AppendString(page, shape->unit);
+    }
+}
+
+static bool Run(const char *name, const Buffer *page, unsigned repeats, unsigned rounds) {
+    double best = 0;
+    for (unsigned round = 0; round != rounds; ++round) {
+        double start = Now();
+        GumboOutput *output = gumbo_parse_with_options(&kGumboDefaultOptions, page->data, page->length);
+        double time = Now() - start;
+        best = round == 0 || time < best ? time : best;
+        if (output->root == NULL) {
+            fprintf(stderr, "%s: no tree\n", name);
+            return false;
+        }
+        gumbo_destroy_output(output);
+    }
+
+    printf("%-20s %9zu %8u %9.2f %9.3f\n", name, page->length, repeats, best,
+        repeats != 0 ? best * 1e3 / repeats : 0.0);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    Arguments arguments;
+    ParseArguments(argc, argv, 5, &arguments);
+
+    printf("%-20s %9s %8s %9s %9s\n", "page", "bytes", "repeats", "parse ms", "us/repeat");
+
+    bool okay = true;
+    if (arguments.fileCount == 0) {
+        unsigned repeats = arguments.quick ? 500 : 20000;
+        for (unsigned i = 0; i != sizeof(kShapes) / sizeof(kShapes[0]); ++i) {
+            Buffer page = {NULL, 0, 0};
+            Build(&kShapes[i], repeats, &page);
+            okay = Run(kShapes[i].name, &page, repeats, arguments.rounds) && okay;
+            free(page.data);
+        }
+    } else {
+        for (int i = 0; i != arguments.fileCount; ++i) {
+            Buffer page = {NULL, 0, 0};
+            okay = ReadFile(arguments.files[i], &page) && Run(arguments.files[i], &page, 0, arguments.rounds) && okay;
+            free(page.data);
+        }
+    }
+
+    return okay ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+//
+//  ParseLoopBench.c
+//  libwidgetinfo
+//
+//  The same page parsed over and over, the way the preprocessors go through a
+//  widget's files: once with a new output each time, timing the parse and the
+//  destroy apart, and once into the same output with gumbo_parse_into. Both
+//  loops report allocator calls per parse after the first, and the trees they
+//  build have to match.
+//
+//      parse-loop-bench [-n rounds] [--quick] [file...]
+//
+//  A round is a loop of parses; the best round is reported.
+//
+
+#include "Bench.h"
+
+static bool Run(const char *name, const Buffer *page, unsigned loops, unsigned rounds) {
+    Buffer first = {NULL, 0, 0}, tree = {NULL, 0, 0};
+    double parse = 0, destroy = 0, into = 0;
+    size_t allocations = 0, intoAllocations = 0;
+    long live = liveBlocks_;
+    bool okay = true;
+
+    for (unsigned round = 0; round != rounds && okay; ++round) {
+        // New outputs
+        double parseTime = 0, destroyTime = 0;
+        for (unsigned loop = 0; loop != loops; ++loop) {
+            if (loop == 1) {
+                allocations_ = 0;
+            }
+            double start = Now();
+            GumboOutput *output = gumbo_parse_with_options(&kGumboDefaultOptions, page->data, page->length);
+            double middle = Now();
+            if (round == 0 && loop == 0) {
+                AppendString(&first, "");
+                SerializeTree(output->root, &first);
+            }
+            double end = Now();
+            gumbo_destroy_output(output);
+            parseTime += middle - start;
+            destroyTime += Now() - end;
+        }
+        allocations = allocations_;
+
+        // One output
+        GumboOutput *output = NULL;
+        double start = Now();
+        for (unsigned loop = 0; loop != loops; ++loop) {
+            if (loop == 1) {
+                allocations_ = 0;
+            }
+            output = output == NULL ?
+                gumbo_parse_with_options(&kGumboDefaultOptions, page->data, page->length) :
+                gumbo_parse_into(output, &kGumboDefaultOptions, page->data, page->length);
+        }
+        double intoTime = Now() - start;
+        intoAllocations = allocations_;
+
+        if (round == 0) {
+            tree.length = 0;
+            AppendString(&tree, "");
+            SerializeTree(output->root, &tree);
+            if (strcmp(tree.data, first.data) != 0) {
+                fprintf(stderr, "%s: gumbo_parse_into built a different tree\n", name);
+                okay = false;
+            }
+        }
+        gumbo_destroy_output(output);
+
+        if (round == 0 || parseTime + destroyTime < parse + destroy) {
+            parse = parseTime;
+            destroy = destroyTime;
+        }
+        into = round == 0 || intoTime < into ? intoTime : into;
+    }
+
+    if (liveBlocks_ != live) {
+        fprintf(stderr, "%s: %ld blocks left after the outputs were destroyed\n", name, liveBlocks_ - live);
+        okay = false;
+    }
+
+    double later = loops > 1 ? loops - 1 : 1;
+    printf("%-20s %9zu %9.3f %9.3f %9.1f %9.3f %9.1f\n", name, page->length, parse / loops,
+        destroy / loops, allocations / later, into / loops, intoAllocations / later);
+    free(first.data);
+    free(tree.data);
+    return okay;
+}
+
+int main(int argc, char *argv[]) {
+    Arguments arguments;
+    ParseArguments(argc, argv, 5, &arguments);
+    CountAllocations();
+
+    unsigned loops = arguments.quick ? 5 : 200;
+    printf("%-20s %9s %9s %9s %9s %9s %9s\n", "page", "bytes", "parse ms", "free ms", "allocs",
+        "into ms", "allocs");
+
+    bool okay = true;
+    if (arguments.fileCount == 0) {
+        unsigned scale = arguments.quick ? 1 : 4;
+        Buffer small = {NULL, 0, 0}, widget = {NULL, 0, 0}, svg = {NULL, 0, 0};
+        WidgetPage(&small, 5);
+        WidgetPage(&widget, 50 * scale);
+        SvgPage(&svg, 200 * scale);
+        okay = Run("small widget", &small, loops * 10, arguments.rounds) && okay;
+        okay = Run("widget", &widget, loops, arguments.rounds) && okay;
+        okay = Run("svg", &svg, loops, arguments.rounds) && okay;
+        free(small.data);
+        free(widget.data);
+        free(svg.data);
+    } else {
+        for (int i = 0; i != arguments.fileCount; ++i) {
+            Buffer page = {NULL, 0, 0};
+            okay = ReadFile(arguments.files[i], &page) && Run(arguments.files[i], &page, loops, arguments.rounds) && okay;
+            free(page.data);
+        }
+    }
+
+    return okay ? 0 : 1;
+}
@@ -0,0 +1,263 @@
+//
+//  ScriptLocator.c
+//  libwidgetinfo
+//
+//  gumbo_locate_scripts against gumbo_parse: every HTML script element in the
+//  tree has to be located, and nothing else, with the same start tag,
+//  attributes, text and end tag. The documents are the cases that have gone
+//  wrong before, then thousands of random ones, each with and without XHTML
+//  rules. The random ones lean on misnested markup far more than real pages
+//  do, so a good share of them are parsed in full; the count is reported.
+//
+//      script-locator              all of it
+//      script-locator <file>...    only those files, reporting each script
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gumbo.h"
+
+#include "Markup.h"
+
+static const unsigned kRandomDocuments = 5000;
+
+static const char *const kCases[] = {
+    // A frameset replaces a body that only formatting elements have started,
+    // taking the body's scripts with it
+    "<s><frameset><script>x</script>",
+    "<b><script>x</script><frameset><script>y</script>",
+    "<body><script>x</script><frameset>",
+    "<p>x<frameset><script>y</script>",
+    "<head><script>x</script></head><frameset><noframes><script>y</script></noframes>",
+    "<frameset></frameset><script>x</script>",
+    "<frameset></frameset></html><noframes><script>x</script>",
+    "<div><frameset><script>x</script>",
+    "<input type=hidden><frameset><script>x</script>",
+    "<input><frameset><script>x</script>",
+    "<template><script>x</script></template><frameset><script>y</script>",
+    // A table start tag in a table closes it, which changes what a select
+    // after it is in
+    "<table><table/><select><td><noembed><script>x</script>",
+    "<table><table><select><td><noembed><script>x</script>",
+    "<table><tr><table><select><td><script>x</script>",
+    "<table><td><table><select><td><noembed><script>x</script>",
+    "<table><caption><table><select><td><noembed><script>x</script>",
+    "<table><select><td><noembed><script>x</script></noembed>",
+    "<table><td><select><td><noembed><script>x</script></noembed>",
+    "<table></table><select><td><noembed><script>x</script>",
+    // Scripts left open at the end, and closed by themselves
+    "<script>x",
+    "<script>x</scr",
+    "<script/>x",
+    "<select><script/>x</select>",
+    "<svg><script>x</script></svg><script>y</script>",
+    "<math><mi><script>x</script></mi></math>",
+    "<svg><foreignObject><script>x</script></foreignObject></svg>",
+    "<textarea><script>x</script></textarea><script>y</script>",
+    // Misnested formatting elements are reopened and moved by the adoption
+    // agency, and a cell or caption closes the ones opened in it, once
+    "<b><p><i></b><svg></i><script>x</script>",
+    "<a><svg><a></svg><script>x</script>",
+    "<table><applet><i><tr><svg encoding=\"text\"></i><script>x</script>",
+    "<table><td><applet><i></td><svg></i><script>x</script>",
+    // A foreign end tag only closes an element of the name it's written with
+    "<y><math><y></scr<script>x</script>",
+    "<svg><g></g x><script>x</script>",
+};
+
+static const char *document_;
+static unsigned parsedInFull_;
+
+typedef struct {
+    const GumboElement **elements;
+    unsigned length;
+    unsigned capacity;
+} Elements;
+
+// The tree's HTML scripts; misnested markup nests deep, so the walk keeps its
+// own stack
+static void FindScripts(const GumboNode *root, Elements *scripts) {
+    unsigned depth = 0, capacity = 64;
+    const GumboNode **stack = malloc(capacity * sizeof(*stack));
+    stack[depth++] = root;
+
+    while (depth != 0) {
+        const GumboNode *node = stack[--depth];
+        const GumboVector *children;
+        if (node->type == GUMBO_NODE_DOCUMENT) {
+            children = &node->v.document.children;
+        } else if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE) {
+            const GumboElement *element = &node->v.element;
+            if (element->tag == GUMBO_TAG_SCRIPT && element->tag_namespace == GUMBO_NAMESPACE_HTML) {
+                if (scripts->length == scripts->capacity) {
+                    scripts->capacity = scripts->capacity ? scripts->capacity * 2 : 16;
+                    scripts->elements = realloc(scripts->elements, scripts->capacity * sizeof(*scripts->elements));
+                }
+                scripts->elements[scripts->length++] = element;
+            }
+            children = &element->children;
+        } else {
+            continue;
+        }
+
+        if (depth + children->length > capacity) {
+            capacity = (depth + children->length) * 2;
+            stack = realloc(stack, capacity * sizeof(*stack));
+        }
+        for (unsigned i = children->length; i != 0; --i) {
+            stack[depth++] = children->data[i - 1];
+        }
+    }
+
+    free(stack);
+}
+
+// Foster parenting can put a script ahead of ones whose start tags came first
+static int CompareStarts(const void *left, const void *right) {
+    const char *a = (*(const GumboElement *const *) left)->original_tag.data;
+    const char *b = (*(const GumboElement *const *) right)->original_tag.data;
+    return a < b ? -1 : a > b;
+}
+
+static long Offset(const char *data) {
+    return data != NULL ? (long) (data - document_) : -1L;
+}
+
+// A script as a line: its pieces as offsets, and its attributes
+static void Describe(char *line, size_t size, GumboStringPiece start_tag,
+    const GumboVector *attributes, GumboStringPiece body, GumboStringPiece end_tag) {
+    int length = snprintf(line, size, "<%ld+%zu> %ld+%zu </%ld+%zu>",
+        Offset(start_tag.data), start_tag.length, Offset(body.data), body.length,
+        Offset(end_tag.data), end_tag.length);
+    for (unsigned i = 0; i != attributes->length && length > 0 && (size_t) length < size; ++i) {
+        const GumboAttribute *attribute = attributes->data[i];
+        length += snprintf(line + length, size - length, " %s=\"%s\"@%ld",
+            attribute->name, attribute->value, Offset(attribute->original_name.data));
+    }
+}
+
+static void DescribeElement(char *line, size_t size, const GumboElement *element) {
+    // The text runs from the start tag to the end tag, or to the end of the
+    // script's text when it's left open. The text node itself can start later:
+    // the tree builder drops a newline after <pre>, say, and points a CRLF's
+    // text at the LF. A <script/> left open in a select can even hold elements
+    const char *start = element->original_tag.data + element->original_tag.length, *end = start;
+    const GumboNode *child = element->children.length != 0 ? element->children.data[0] : NULL;
+    if (element->original_end_tag.data != NULL && element->original_end_tag.data != element->original_tag.data) {
+        end = element->original_end_tag.data;
+    } else if (child != NULL && child->type != GUMBO_NODE_ELEMENT && child->type != GUMBO_NODE_TEMPLATE) {
+        end = child->v.text.original_text.data + child->v.text.original_text.length;
+    }
+
+    GumboStringPiece body = {start, (size_t) (end - start)};
+    Describe(line, size, element->original_tag, &element->attributes, body, element->original_end_tag);
+}
+
+static void DescribeScript(char *line, size_t size, const GumboScript *script) {
+    Describe(line, size, script->start_tag, &script->attributes, script->body, script->end_tag);
+}
+
+static bool Compare(const char *name, const char *html, size_t length, const GumboOptions *options, bool verbose) {
+    document_ = html;
+    GumboOutput *output = gumbo_parse_with_options(options, html, length);
+    Elements elements = {NULL, 0, 0};
+    FindScripts(output->document, &elements);
+    if (elements.length > 1) {
+        qsort(elements.elements, elements.length, sizeof(*elements.elements), CompareStarts);
+    }
+
+    GumboScriptList *scripts = gumbo_locate_scripts(options, html, length);
+    parsedInFull_ += scripts->parsed_in_full;
+    if (verbose && scripts->parsed_in_full) {
+        printf("%s: parsed in full\n", name);
+    }
+
+    bool okay = true;
+    unsigned count = elements.length > scripts->scripts.length ? elements.length : scripts->scripts.length;
+    for (unsigned i = 0; i != count; ++i) {
+        char parsed[1024] = "(none)", located[1024] = "(none)";
+        if (i < elements.length) {
+            DescribeElement(parsed, sizeof(parsed), elements.elements[i]);
+        }
+        if (i < scripts->scripts.length) {
+            DescribeScript(located, sizeof(located), scripts->scripts.data[i]);
+        }
+
+        if (strcmp(parsed, located) != 0) {
+            fprintf(stderr, "%s (%s XHTML rules), script %u:\n  parsed:  %s\n  located: %s\n",
+                name, options->use_xhtml_rules ? "with" : "without", i, parsed, located);
+            okay = false;
+            break;
+        } else if (verbose) {
+            printf("%s: %s\n", name, parsed);
+        }
+    }
+
+    gumbo_destroy_script_list(scripts);
+    free(elements.elements);
+    gumbo_destroy_output(output);
+    return okay;
+}
+
+static bool CompareRules(const char *name, const char *html, size_t length, bool verbose) {
+    GumboOptions options = kGumboDefaultOptions;
+    bool okay = Compare(name, html, length, &options, verbose);
+    options.use_xhtml_rules = !options.use_xhtml_rules;
+    return Compare(name, html, length, &options, verbose) && okay;
+}
+
+static bool CompareFile(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+
+    Buffer document = {NULL, 0, 0};
+    char chunk[65536];
+    for (size_t size; (size = fread(chunk, 1, sizeof(chunk), file)) != 0;) {
+        Append(&document, chunk, size);
+    }
+    fclose(file);
+
+    bool okay = CompareRules(path, document.data != NULL ? document.data : "", document.length, true);
+    free(document.data);
+    return okay;
+}
+
+int main(int argc, char *argv[]) {
+    unsigned failed = 0, total = 0;
+
+    if (argc > 1) {
+        for (int i = 1; i != argc; ++i) {
+            failed += !CompareFile(argv[i]);
+        }
+        return failed == 0 ? 0 : 1;
+    }
+
+    for (unsigned i = 0; i != sizeof(kCases) / sizeof(kCases[0]); ++i) {
+        failed += !CompareRules(kCases[i], kCases[i], strlen(kCases[i]), false);
+        ++total;
+    }
+
+    for (unsigned seed = 0; seed != kRandomDocuments; ++seed) {
+        Buffer document = {NULL, 0, 0};
+        SeedRandom(seed);
+        AppendString(&document, seed % 2 ? "<!DOCTYPE html>" : "");
+        Generate(&document, 0);
+
+        char name[32];
+        snprintf(name, sizeof(name), "random %u", seed);
+        failed += !CompareRules(name, document.data, document.length, false);
+        ++total;
+        free(document.data);
+    }
+
+    printf("%u of %u documents have scripts located differently from a parse, %u of %u runs parsed in full\n",
+        failed, total, parsedInFull_, total * 2);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,288 @@
+//
+//  Speculation.c
+//  libwidgetinfo
+//
+//  Parses documents big enough to be split between tokenizer threads, once on
+//  the caller's thread alone and once with several, and requires the two to
+//  agree on everything: the tree, every source position and piece of original
+//  text, and the errors with their messages. Half the documents are random
+//  markup; the rest put raw text, foreign content, comments and the like
+//  across the points where the workers start, which is where a worker guesses
+//  its state wrong and the parser has to take over from it.
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gumbo.h"
+#include "error.h"
+#include "string_buffer.h"
+
+#include "Markup.h"
+
+// Each worker needs at least 64 KB, so 8 of them need half a megabyte
+static const size_t kDocumentLength = 520 * 1024;
+static const int kThreads[] = {2, 3, 8};
+static const unsigned kRandomDocuments = 8;
+
+static void RandomDocument(Buffer *buffer, unsigned seed) {
+    SeedRandom(seed);
+    AppendString(buffer, seed % 2 ? "<!DOCTYPE html>" : "");
+    while (buffer->length < kDocumentLength) {
+        Generate(buffer, 0);
+    }
+}
+
+// Repeats a unit up to the document length, with a prefix that never repeats,
+// so the units straddle every part boundary at some offset
+static void RepeatedDocument(
+    Buffer *buffer, const char *prefix, const char *unit, const char *suffix) {
+    AppendString(buffer, prefix);
+    while (buffer->length < kDocumentLength) {
+        AppendString(buffer, unit);
+    }
+    AppendString(buffer, suffix);
+}
+
+typedef struct {
+    const char *name;
+    const char *prefix;
+    const char *unit;
+    const char *suffix;
+} Adversary;
+
+static const Adversary kAdversaries[] = {
+    // Markup inside raw text, which a worker starting in DATA takes for tags
+    {"script", "<body><script>", "if (a<b) document.write('<div id=x>');\n", "</script>"},
+    {"textarea", "<textarea>", "<script>x</script> <b>&amp;</b>\n", "</textarea>"},
+    {"style", "<style>", "a > b { content: '<p>' }\n", "</style>"},
+    {"title", "<title>", "<i>x</i> &lt; >\n", "</title><p>"},
+    {"xmp", "<xmp>", "<b>x</b>\n", "</xmp>"},
+    {"noscript", "<noscript>", "<p>x</p>", "</noscript>"},
+    // Raw text closed and reopened, so the first end tag in a part misleads
+    {"reopened", "", "<script>x</script><p>y<textarea>z</textarea>", ""},
+    {"unclosed", "<p>", "<script>a</scr ipt>b</style>", ""},
+    // Foreign content, where only CDATA sections are sections
+    {"cdata", "<svg>", "<![CDATA[<p>]]><g x='>'/>", "</svg>"},
+    {"math", "<math><mi>", "<![CDATA[x]]><mtext>y</mtext>", "</math>"},
+    // Text that looks like the ends of things without being them
+    {"comment", "<!--", "<p>--!>- -", "-->"},
+    {"unterminated", "<p>x<!--", "<b>y</b>", ""},
+    {"plaintext", "<p>x<plaintext>", "</plaintext><b>", ""},
+    {"attributes", "", "<a title='>' href=\"x>y\" b=c>z</a>", ""},
+    {"references", "", "&notin&amp;&#x1F600;&#0;&CounterClockwiseContourIntegral", ""},
+    {"bytes", "", "\xc3\xa9\xe4\xb8\xad\r\n\t\xff\xe4\xb8<b>", ""},
+    {"text", "", "x", ""},
+};
+
+// Everything a caller could look at, with pointers into the document made
+// into offsets
+static const char *document_;
+
+static void DumpPosition(FILE *file, GumboSourcePosition position) {
+    fprintf(file, " @%u:%u:%u", position.line, position.column, position.offset);
+}
+
+static void DumpPiece(FILE *file, GumboStringPiece piece) {
+    fprintf(file, " [%ld+%zu]",
+        piece.data != NULL ? (long) (piece.data - document_) : -1L, piece.length);
+}
+
+static const GumboVector *Children(const GumboNode *node) {
+    switch (node->type) {
+        case GUMBO_NODE_DOCUMENT:
+            return &node->v.document.children;
+        case GUMBO_NODE_ELEMENT:
+        case GUMBO_NODE_TEMPLATE:
+            return &node->v.element.children;
+        default:
+            return NULL;
+    }
+}
+
+static void DumpNode(FILE *file, const GumboNode *node, unsigned depth) {
+    fprintf(file, "%u %d %u %x", depth, node->type, node->index_within_parent, node->parse_flags);
+    switch (node->type) {
+        case GUMBO_NODE_DOCUMENT: {
+            const GumboDocument *document = &node->v.document;
+            fprintf(file, " %d %s %s %s %d\n", document->has_doctype, document->name,
+                document->public_identifier, document->system_identifier,
+                document->doc_type_quirks_mode);
+        } break;
+
+        case GUMBO_NODE_ELEMENT:
+        case GUMBO_NODE_TEMPLATE: {
+            const GumboElement *element = &node->v.element;
+            fprintf(file, " <%s %d>", gumbo_normalized_tagname(element->tag), element->tag_namespace);
+            DumpPiece(file, element->original_tag);
+            DumpPiece(file, element->original_end_tag);
+            DumpPosition(file, element->start_pos);
+            DumpPosition(file, element->end_pos);
+            fputc('\n', file);
+            for (unsigned i = 0; i != element->attributes.length; ++i) {
+                const GumboAttribute *attribute = element->attributes.data[i];
+                fprintf(file, "  %d %s=\"%s\"", attribute->attr_namespace,
+                    attribute->name, attribute->value);
+                DumpPiece(file, attribute->original_name);
+                DumpPiece(file, attribute->original_value);
+                DumpPosition(file, attribute->name_start);
+                DumpPosition(file, attribute->name_end);
+                DumpPosition(file, attribute->value_start);
+                // A valueless attribute never has its value end set
+                if (attribute->original_value.length != 0) {
+                    DumpPosition(file, attribute->value_end);
+                }
+                fputc('\n', file);
+            }
+        } break;
+
+        default: {
+            const GumboText *text = &node->v.text;
+            fprintf(file, " \"%s\"", text->text);
+            DumpPiece(file, text->original_text);
+            DumpPosition(file, text->start_pos);
+            fputc('\n', file);
+        } break;
+    }
+}
+
+// Misnested markup nests tens of thousands deep, so the walk keeps its own
+// stack of the next child to visit at each level
+static void DumpTree(FILE *file, const GumboNode *root) {
+    size_t depth = 0, capacity = 64;
+    const GumboNode **nodes = malloc(capacity * sizeof(*nodes));
+    unsigned *next = malloc(capacity * sizeof(*next));
+
+    DumpNode(file, root, 0);
+    nodes[0] = root;
+    next[0] = 0;
+
+    for (;;) {
+        const GumboVector *children = Children(nodes[depth]);
+        if (children == NULL || next[depth] == children->length) {
+            if (depth == 0) {
+                break;
+            }
+            --depth;
+            continue;
+        }
+
+        const GumboNode *child = children->data[next[depth]++];
+        DumpNode(file, child, (unsigned) depth + 1);
+        if (++depth == capacity) {
+            capacity *= 2;
+            nodes = realloc(nodes, capacity * sizeof(*nodes));
+            next = realloc(next, capacity * sizeof(*next));
+        }
+        nodes[depth] = child;
+        next[depth] = 0;
+    }
+
+    free(nodes);
+    free(next);
+}
+
+static char *Parse(const Buffer *document, GumboOptions options, size_t *size) {
+    char *dump;
+    FILE *file = open_memstream(&dump, size);
+
+    document_ = document->data;
+    GumboOutput *output = gumbo_parse_with_options(&options, document->data, document->length);
+    DumpTree(file, output->document);
+
+    fprintf(file, "%u errors, %u recorded\n", output->error_count, output->errors.length);
+    for (unsigned i = 0; i != output->errors.length; ++i) {
+        const GumboError *error = output->errors.data[i];
+        GumboStringBuffer message;
+        gumbo_string_buffer_init(&message);
+        gumbo_error_to_string(error, &message);
+        fprintf(file, "%d", error->type);
+        DumpPosition(file, error->position);
+        fprintf(file, " %ld %.*s\n", (long) (error->original_text - document_),
+            (int) message.length, message.data);
+        gumbo_string_buffer_destroy(&message);
+    }
+
+    gumbo_destroy_output(output);
+    fclose(file);
+    return dump;
+}
+
+// Where two dumps first differ, as the line in each
+static void ReportDifference(const char *serial, const char *parallel) {
+    size_t offset = 0;
+    while (serial[offset] == parallel[offset]) {
+        ++offset;
+    }
+    while (offset != 0 && serial[offset - 1] != '\n') {
+        --offset;
+    }
+    fprintf(stderr, "  serial:   %.*s\n", (int) strcspn(serial + offset, "\n"), serial + offset);
+    fprintf(stderr, "  parallel: %.*s\n", (int) strcspn(parallel + offset, "\n"), parallel + offset);
+}
+
+static bool Compare(const char *name, const Buffer *document, GumboOptions options) {
+    bool okay = true;
+    size_t serial_size;
+    char *serial = Parse(document, options, &serial_size);
+
+    for (unsigned i = 0; i != sizeof(kThreads) / sizeof(kThreads[0]); ++i) {
+        options.tokenizer_threads = kThreads[i];
+        size_t size;
+        char *parallel = Parse(document, options, &size);
+        if (size != serial_size || memcmp(serial, parallel, size) != 0) {
+            fprintf(stderr, "%s: %d threads disagree with one (errors %d, max %d)\n",
+                name, kThreads[i], options.error_mode, options.max_errors);
+            ReportDifference(serial, parallel);
+            okay = false;
+        }
+        free(parallel);
+    }
+
+    free(serial);
+    return okay;
+}
+
+// Every error mode, and a cap on recorded errors that the parts have to agree
+// on between them
+static bool CompareModes(const char *name, const Buffer *document) {
+    GumboOptions options = kGumboDefaultOptions;
+    bool okay = Compare(name, document, options);
+    options.max_errors = 100;
+    okay = Compare(name, document, options) && okay;
+    options.max_errors = -1;
+    options.error_mode = GUMBO_ERRORS_COUNT;
+    okay = Compare(name, document, options) && okay;
+    options.error_mode = GUMBO_ERRORS_NONE;
+    okay = Compare(name, document, options) && okay;
+    return okay;
+}
+
+int main(void) {
+    unsigned failed = 0, total = 0;
+
+    for (unsigned seed = 0; seed != kRandomDocuments; ++seed) {
+        Buffer document = {NULL, 0, 0};
+        RandomDocument(&document, seed);
+        char name[32];
+        snprintf(name, sizeof(name), "random %u", seed);
+        failed += !CompareModes(name, &document);
+        ++total;
+        free(document.data);
+    }
+
+    for (unsigned i = 0; i != sizeof(kAdversaries) / sizeof(kAdversaries[0]); ++i) {
+        const Adversary *adversary = &kAdversaries[i];
+        Buffer document = {NULL, 0, 0};
+        RepeatedDocument(&document, adversary->prefix, adversary->unit, adversary->suffix);
+        failed += !CompareModes(adversary->name, &document);
+        ++total;
+        free(document.data);
+    }
+
+    printf("%u of %u documents differ between one and several threads\n", failed, total);
+    return failed == 0 ? 0 : 1;
+}
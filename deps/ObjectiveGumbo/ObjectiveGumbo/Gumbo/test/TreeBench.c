@@ -0,0 +1,148 @@
+//
+//  TreeBench.c
+//  libwidgetinfo
+//
+//  What a parsed widget's tree is made of, and how fast it can be walked while
+//  many of them are alive, as the preprocessors do when they hold on to every
+//  page of a widget. For each page it counts the elements whose children and
+//  attributes still fit in the storage inside the element, and the bytes of
+//  the arrays for those that don't; the bytes asked of the allocator for the
+//  whole parse; and the time per tree to walk every node and attribute of a
+//  set of live trees.
+//
+//      tree-bench [-n rounds] [--quick] [file...]
+//
+
+#include "Bench.h"
+
+typedef struct {
+    unsigned elements;
+    unsigned texts;
+    unsigned inlineChildren;
+    unsigned inlineAttributes;
+    size_t arrayBytes;
+} Shape;
+
+static bool Measure(const GumboNode *node, Shape *shape) {
+    if (node->type != GUMBO_NODE_ELEMENT && node->type != GUMBO_NODE_TEMPLATE) {
+        ++shape->texts;
+        return true;
+    }
+
+    const GumboElement *element = &node->v.element;
+    ++shape->elements;
+    if (element->children.data == (void **) element->inline_children) {
+        ++shape->inlineChildren;
+    } else {
+        shape->arrayBytes += element->children.capacity * sizeof(void *);
+    }
+    if (element->attributes.data == (void **) element->inline_attributes) {
+        ++shape->inlineAttributes;
+    } else {
+        shape->arrayBytes += element->attributes.capacity * sizeof(void *);
+    }
+
+    // Inline storage holds no more than it has room for
+    if ((element->children.data == (void **) element->inline_children &&
+            element->children.length > GUMBO_ELEMENT_INLINE_CHILDREN) ||
+        (element->attributes.data == (void **) element->inline_attributes &&
+            element->attributes.length > GUMBO_ELEMENT_INLINE_ATTRIBUTES)) {
+        fprintf(stderr, "<%s> holds more than fits inline\n", gumbo_normalized_tagname(element->tag));
+        return false;
+    }
+
+    for (unsigned i = 0; i != element->children.length; ++i) {
+        if (!Measure(element->children.data[i], shape)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// What a preprocessor's walk touches: every node, its attributes' values and
+// its text
+static size_t Walk(const GumboNode *node) {
+    if (node->type != GUMBO_NODE_ELEMENT && node->type != GUMBO_NODE_TEMPLATE) {
+        return node->v.text.text[0];
+    }
+    const GumboElement *element = &node->v.element;
+    size_t sum = element->tag;
+    for (unsigned i = 0; i != element->attributes.length; ++i) {
+        const GumboAttribute *attribute = element->attributes.data[i];
+        sum += attribute->value[0];
+    }
+    for (unsigned i = 0; i != element->children.length; ++i) {
+        sum += Walk(element->children.data[i]);
+    }
+    return sum;
+}
+
+static bool Run(const char *name, const Buffer *page, unsigned trees, unsigned rounds) {
+    GumboOutput **outputs = calloc(trees, sizeof(*outputs));
+
+    allocations_ = 0;
+    allocatedBytes_ = 0;
+    outputs[0] = gumbo_parse_with_options(&kGumboDefaultOptions, page->data, page->length);
+    size_t allocations = allocations_, bytes = allocatedBytes_;
+    for (unsigned i = 1; i != trees; ++i) {
+        outputs[i] = gumbo_parse_with_options(&kGumboDefaultOptions, page->data, page->length);
+    }
+
+    Shape shape = {0, 0, 0, 0, 0};
+    bool okay = Measure(outputs[0]->root, &shape);
+
+    double best = 0;
+    size_t expected = Walk(outputs[0]->root);
+    for (unsigned round = 0; round != rounds && okay; ++round) {
+        double start = Now();
+        for (unsigned i = 0; i != trees; ++i) {
+            if (Walk(outputs[i]->root) != expected) {
+                fprintf(stderr, "%s: tree %u walks differently\n", name, i);
+                okay = false;
+            }
+        }
+        double time = Now() - start;
+        best = round == 0 || time < best ? time : best;
+    }
+
+    for (unsigned i = 0; i != trees; ++i) {
+        gumbo_destroy_output(outputs[i]);
+    }
+    free(outputs);
+
+    unsigned elements = shape.elements != 0 ? shape.elements : 1;
+    printf("%-20s %9zu %8u %8u %7.1f%% %7.1f%% %9zu %7zu %9zu %9.1f\n", name, page->length,
+        shape.elements, shape.texts, shape.inlineChildren * 100.0 / elements,
+        shape.inlineAttributes * 100.0 / elements, shape.arrayBytes, allocations, bytes / 1024,
+        best * 1e3 / trees);
+    return okay;
+}
+
+int main(int argc, char *argv[]) {
+    Arguments arguments;
+    ParseArguments(argc, argv, 20, &arguments);
+    CountAllocations();
+
+    unsigned trees = arguments.quick ? 4 : 64;
+    printf("%-20s %9s %8s %8s %8s %8s %9s %7s %9s %9s\n", "page", "bytes", "elements", "texts",
+        "children", "attrs", "array B", "allocs", "KB asked", "walk us");
+
+    bool okay = true;
+    if (arguments.fileCount == 0) {
+        Buffer widget = {NULL, 0, 0}, svg = {NULL, 0, 0};
+        WidgetPage(&widget, 50);
+        SvgPage(&svg, 200);
+        okay = Run("widget", &widget, trees, arguments.rounds) && okay;
+        okay = Run("svg", &svg, trees, arguments.rounds) && okay;
+        free(widget.data);
+        free(svg.data);
+    } else {
+        for (int i = 0; i != arguments.fileCount; ++i) {
+            Buffer page = {NULL, 0, 0};
+            okay = ReadFile(arguments.files[i], &page) && Run(arguments.files[i], &page, trees, arguments.rounds) && okay;
+            free(page.data);
+        }
+    }
+
+    return okay ? 0 : 1;
+}
@@ -53,6 +53,7 @@
 #include "error.h"
 #include "gumbo.h"
 #include "parser.h"
+#include "pool.h"
 #include "string_buffer.h"
 #include "string_piece.h"
 #include "token_type.h"
@@ -411,10 +412,12 @@ static void reset_tag_buffer_start_point(GumboParser* parser) {
 }
 
 // Moves the temporary buffer contents over to the specified output string,
-// and clears the temporary buffer.
+// and clears the temporary buffer.  The string is carved from the output's
+// pool, like every string that ends up in the tree.
 static void finish_temporary_buffer(GumboParser* parser, const char** output) {
   GumboTokenizerState* tokenizer = parser->_tokenizer_state;
-  *output = gumbo_string_buffer_to_string(&tokenizer->_temporary_buffer);
+  *output = gumbo_pool_strndup(parser->_output->pool,
+      tokenizer->_temporary_buffer.data, tokenizer->_temporary_buffer.length);
   clear_temporary_buffer(parser);
 }
 
@@ -453,7 +456,6 @@ static void finish_token(GumboParser* parser, GumboToken* token) {
 static void finish_doctype_public_id(GumboParser* parser) {
   GumboTokenDocType* doc_type_state =
       &parser->_tokenizer_state->_doc_type_state;
-  gumbo_free((void*) doc_type_state->public_identifier);
   finish_temporary_buffer(parser, &doc_type_state->public_identifier);
   doc_type_state->has_public_identifier = true;
 }
@@ -463,7 +465,6 @@ static void finish_doctype_public_id(GumboParser* parser) {
 static void finish_doctype_system_id(GumboParser* parser) {
   GumboTokenDocType* doc_type_state =
       &parser->_tokenizer_state->_doc_type_state;
-  gumbo_free((void*) doc_type_state->system_identifier);
   finish_temporary_buffer(parser, &doc_type_state->system_identifier);
   doc_type_state->has_system_identifier = true;
 }
@@ -540,12 +541,11 @@ static StateResult emit_current_tag(GumboParser* parser, GumboToken* output) {
     for (unsigned int i = 0; i < tag_state->_attributes.length; ++i) {
       gumbo_destroy_attribute(tag_state->_attributes.data[i]);
     }
-    gumbo_free(tag_state->_attributes.data);
+    gumbo_pool_vector_destroy(parser->_output->pool, &tag_state->_attributes);
     mark_tag_state_as_empty(tag_state);
     gumbo_debug(
         "Emitted end tag %s.\n", gumbo_normalized_tagname(tag_state->_tag));
   }
-  gumbo_string_buffer_destroy(&tag_state->_buffer);
   finish_token(parser, output);
   gumbo_debug("Original text = %.*s.\n", output->original_text.length,
       output->original_text.data);
@@ -564,9 +564,8 @@ static void abandon_current_tag(GumboParser* parser) {
   for (unsigned int i = 0; i < tag_state->_attributes.length; ++i) {
     gumbo_destroy_attribute(tag_state->_attributes.data[i]);
   }
-  gumbo_free(tag_state->_attributes.data);
+  gumbo_pool_vector_destroy(parser->_output->pool, &tag_state->_attributes);
   mark_tag_state_as_empty(tag_state);
-  gumbo_string_buffer_destroy(&tag_state->_buffer);
   gumbo_debug("Abandoning current tag.\n");
 }
 
@@ -661,12 +660,14 @@ static void append_char_to_tag_buffer(
 }
 
 // (Re-)initialize the tag buffer.  This also resets the original_text pointer
-// and _start_pos field to point to the current position.
+// and _start_pos field to point to the current position.  The buffer itself
+// lives as long as the tokenizer and is only emptied here, so tag names,
+// attribute names and values stop allocating once it has grown to fit them.
 static void initialize_tag_buffer(GumboParser* parser) {
   GumboTokenizerState* tokenizer = parser->_tokenizer_state;
   GumboTagState* tag_state = &tokenizer->_tag_state;
 
-  gumbo_string_buffer_init(&tag_state->_buffer);
+  tag_state->_buffer.length = 0;
   reset_tag_buffer_start_point(parser);
 }
 
@@ -689,18 +690,20 @@ static void start_new_tag(GumboParser* parser, bool is_start_tag) {
   // 99.5% of elements have 0 attributes, 93% of the remainder have 1.  These
   // numbers are a bit higher for more modern websites (eg. ~45% = 0, ~40% = 1
   // for the HTML5 Spec), but still have basically 99% of nodes with <= 2 attrs.
-  gumbo_vector_init(2, &tag_state->_attributes);
+  gumbo_pool_vector_init(parser->_output->pool, 2, &tag_state->_attributes);
   tag_state->_drop_next_attr_value = false;
   tag_state->_is_start_tag = is_start_tag;
   tag_state->_is_self_closing = false;
   gumbo_debug("Starting new tag.\n");
 }
 
-// Fills in the specified char* with the contents of the tag buffer.
+// Fills in the specified char* with the contents of the tag buffer, carved
+// from the output's pool.
 static void copy_over_tag_buffer(GumboParser* parser, const char** output) {
   GumboTokenizerState* tokenizer = parser->_tokenizer_state;
   GumboTagState* tag_state = &tokenizer->_tag_state;
-  *output = gumbo_string_buffer_to_string(&tag_state->_buffer);
+  *output = gumbo_pool_strndup(
+      parser->_output->pool, tag_state->_buffer.data, tag_state->_buffer.length);
 }
 
 // Fills in:
@@ -729,9 +732,8 @@ static void copy_over_original_tag_text(GumboParser* parser,
   utf8iterator_get_position(&tokenizer->_input, end_pos);
 }
 
-// Releases and then re-initializes the tag buffer.
+// Empties the tag buffer and resets its start point.
 static void reinitialize_tag_buffer(GumboParser* parser) {
-  gumbo_free(parser->_tokenizer_state->_tag_state._buffer.data);
   initialize_tag_buffer(parser);
 }
 
@@ -759,8 +761,9 @@ static void add_duplicate_attr_error(
   error->original_text = tag_state->_original_text;
   error->v.duplicate_attr.original_index = original_index;
   error->v.duplicate_attr.new_index = new_index;
-  copy_over_tag_buffer(parser, &error->v.duplicate_attr.name);
-  reinitialize_tag_buffer(parser);
+  // Errors are freed one by one, so this can't come from the pool.
+  error->v.duplicate_attr.name =
+      gumbo_string_buffer_to_string(&tag_state->_buffer);
 }
 
 // Creates a new attribute in the current tag, copying the current tag buffer to
@@ -777,28 +780,50 @@ static bool finish_attribute_name(GumboParser* parser) {
   assert(tag_state->_attributes.data);
   assert(tag_state->_attributes.capacity);
 
+  // The buffer is already lowercased, so interning it here lets every later
+  // lookup of this attribute compare atoms instead of strings.
+  GumboAttributeName atom = gumbo_attributen_enum(
+      tag_state->_buffer.data, tag_state->_buffer.length);
+
   GumboVector* /* GumboAttribute* */ attributes = &tag_state->_attributes;
   for (unsigned int i = 0; i < attributes->length; ++i) {
     GumboAttribute* attr = attributes->data[i];
-    if (strlen(attr->name) == tag_state->_buffer.length &&
-        memcmp(attr->name, tag_state->_buffer.data,
-            tag_state->_buffer.length) == 0) {
-      // Identical attribute; bail.
+    if (attr->name_atom != atom) {
+      continue;
+    }
+    if (atom != GUMBO_ATTRIBUTE_UNKNOWN ||
+        (strlen(attr->name) == tag_state->_buffer.length &&
+            memcmp(attr->name, tag_state->_buffer.data,
+                tag_state->_buffer.length) == 0)) {
+      // Identical attribute; bail.  The buffer is reset whether or not the
+      // error was recorded, or the next name would start with this one.
       add_duplicate_attr_error(parser, i, attributes->length);
+      reinitialize_tag_buffer(parser);
       tag_state->_drop_next_attr_value = true;
       return false;
     }
   }
 
-  GumboAttribute* attr = gumbo_malloc(sizeof(GumboAttribute));
+  GumboAttribute* attr = gumbo_pool_alloc_attribute(parser->_output->pool);
   attr->attr_namespace = GUMBO_ATTR_NAMESPACE_NONE;
-  copy_over_tag_buffer(parser, &attr->name);
+  attr->name_atom = atom;
+  // A known name is exactly its atom's (lowercase) string, so that is shared
+  // instead of copied; so is the empty value until one is parsed.
+  if (atom != GUMBO_ATTRIBUTE_UNKNOWN) {
+    attr->name = gumbo_normalized_attribute_name(atom);
+  } else {
+    copy_over_tag_buffer(parser, &attr->name);
+  }
   copy_over_original_tag_text(
       parser, &attr->original_name, &attr->name_start, &attr->name_end);
-  attr->value = gumbo_strdup("");
+  attr->value = kGumboEmptyAttributeValue;
   copy_over_original_tag_text(
       parser, &attr->original_value, &attr->name_start, &attr->name_end);
-  gumbo_vector_add(attr, attributes);
+  // Pooled attributes are reused, so a value that's never parsed mustn't leave
+  // the last one's positions behind.
+  attr->value_start = attr->name_end;
+  attr->value_end = attr->name_end;
+  gumbo_pool_vector_add(parser->_output->pool, attr, attributes);
   reinitialize_tag_buffer(parser);
   return true;
 }
@@ -817,7 +842,7 @@ static void finish_attribute_value(GumboParser* parser) {
 
   GumboAttribute* attr =
       tag_state->_attributes.data[tag_state->_attributes.length - 1];
-  gumbo_free((void*) attr->value);
+  assert(attr->value == kGumboEmptyAttributeValue);
   copy_over_tag_buffer(parser, &attr->value);
   copy_over_original_tag_text(
       parser, &attr->original_value, &attr->value_start, &attr->value_end);
@@ -848,6 +873,7 @@ void gumbo_tokenizer_state_init(
   tokenizer->_temporary_buffer_emit = NULL;
 
   mark_tag_state_as_empty(&tokenizer->_tag_state);
+  gumbo_string_buffer_init(&tokenizer->_tag_state._buffer);
 
   gumbo_string_buffer_init(&tokenizer->_script_data_buffer);
   tokenizer->_token_start = text;
@@ -856,6 +882,24 @@ void gumbo_tokenizer_state_init(
   doc_type_state_init(parser);
 }
 
+void gumbo_tokenizer_state_init_at(GumboParser* parser, const char* text,
+    size_t text_length, const GumboSourcePosition* start,
+    GumboTokenizerEnum state, GumboTag last_start_tag) {
+  gumbo_tokenizer_state_init(
+      parser, text + start->offset, text_length - start->offset);
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  tokenizer->_state = state;
+  tokenizer->_tag_state._last_start_tag = last_start_tag;
+
+  // The offset may already be one past a carriage return the iterator skipped.
+  Utf8Iterator* input = &tokenizer->_input;
+  input->_pos.line = start->line;
+  input->_pos.column = start->column;
+  input->_pos.offset += start->offset;
+  utf8iterator_mark(input);
+  reset_token_start_point(tokenizer);
+}
+
 void gumbo_tokenizer_state_destroy(GumboParser* parser) {
   GumboTokenizerState* tokenizer = parser->_tokenizer_state;
   assert(tokenizer->_doc_type_state.name == NULL);
@@ -863,6 +907,7 @@ void gumbo_tokenizer_state_destroy(GumboParser* parser) {
   assert(tokenizer->_doc_type_state.system_identifier == NULL);
   gumbo_string_buffer_destroy(&tokenizer->_temporary_buffer);
   gumbo_string_buffer_destroy(&tokenizer->_script_data_buffer);
+  gumbo_string_buffer_destroy(&tokenizer->_tag_state._buffer);
   gumbo_free(tokenizer);
 }
 
@@ -879,6 +924,59 @@ void gumbo_tokenizer_set_is_current_node_foreign(
   parser->_tokenizer_state->_is_current_node_foreign = is_foreign;
 }
 
+GumboTokenizerEnum gumbo_tokenizer_get_state(GumboParser* parser) {
+  return parser->_tokenizer_state->_state;
+}
+
+bool gumbo_tokenizer_get_is_current_node_foreign(GumboParser* parser) {
+  return parser->_tokenizer_state->_is_current_node_foreign;
+}
+
+bool gumbo_tokenizer_get_checkpoint(
+    GumboParser* parser, GumboTokenizerCheckpoint* checkpoint) {
+  const GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  const Utf8Iterator* input = &tokenizer->_input;
+  checkpoint->state = tokenizer->_state;
+  checkpoint->last_start_tag = tokenizer->_tag_state._last_start_tag;
+  checkpoint->input = input->_start;
+  checkpoint->current = input->_current;
+  checkpoint->width = input->_width;
+  checkpoint->position = input->_pos;
+
+  switch (tokenizer->_state) {
+    case GUMBO_LEX_DATA:
+    case GUMBO_LEX_RCDATA:
+    case GUMBO_LEX_RAWTEXT:
+    case GUMBO_LEX_SCRIPT:
+    case GUMBO_LEX_PLAINTEXT:
+      break;
+    default:
+      return false;
+  }
+  return tokenizer->_buffered_emit_char == kGumboNoChar &&
+         !tokenizer->_temporary_buffer_emit && !tokenizer->_is_in_cdata;
+}
+
+void gumbo_tokenizer_resume(
+    GumboParser* parser, const GumboTokenizerCheckpoint* checkpoint) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  tokenizer->_reconsume_current_input = false;
+  tokenizer->_is_in_cdata = false;
+  tokenizer->_buffered_emit_char = kGumboNoChar;
+  tokenizer->_temporary_buffer_emit = NULL;
+  gumbo_string_buffer_clear(&tokenizer->_temporary_buffer);
+  gumbo_string_buffer_clear(&tokenizer->_script_data_buffer);
+  tokenizer->_tag_state._last_start_tag = checkpoint->last_start_tag;
+
+  Utf8Iterator* input = &tokenizer->_input;
+  input->_start = checkpoint->input;
+  input->_current = checkpoint->current;
+  input->_width = checkpoint->width;
+  input->_pos = checkpoint->position;
+  utf8iterator_mark(input);
+  reset_token_start_point(tokenizer);
+}
+
 // http://www.whatwg.org/specs/web-apps/current-work/complete5/tokenization.html#data-state
 static StateResult handle_data_state(GumboParser* parser,
     GumboTokenizerState* tokenizer, int c, GumboToken* output) {
@@ -1582,8 +1680,7 @@ static StateResult handle_script_double_escaped_lt_state(GumboParser* parser,
     GumboTokenizerState* tokenizer, int c, GumboToken* output) {
   if (c == '/') {
     gumbo_tokenizer_set_state(parser, GUMBO_LEX_SCRIPT_DOUBLE_ESCAPED_END);
-    gumbo_string_buffer_destroy(&tokenizer->_script_data_buffer);
-    gumbo_string_buffer_init(&tokenizer->_script_data_buffer);
+    gumbo_string_buffer_clear(&tokenizer->_script_data_buffer);
     return emit_current_char(parser, output);
   } else {
     gumbo_tokenizer_set_state(parser, GUMBO_LEX_SCRIPT_DOUBLE_ESCAPED);
@@ -2021,11 +2118,11 @@ static StateResult handle_markup_declaration_state(GumboParser* parser,
     tokenizer->_reconsume_current_input = true;
     // If we get here, we know we'll eventually emit a doctype token, so now is
     // the time to initialize the doctype strings.  (Not in doctype_state_init,
-    // since then they'll leak if ownership never gets transferred to the
-    // doctype token.
-    tokenizer->_doc_type_state.name = gumbo_strdup("");
-    tokenizer->_doc_type_state.public_identifier = gumbo_strdup("");
-    tokenizer->_doc_type_state.system_identifier = gumbo_strdup("");
+    // since then they'd be carved from the pool for every document.)
+    GumboPool* pool = parser->_output->pool;
+    tokenizer->_doc_type_state.name = gumbo_pool_strdup(pool, "");
+    tokenizer->_doc_type_state.public_identifier = gumbo_pool_strdup(pool, "");
+    tokenizer->_doc_type_state.system_identifier = gumbo_pool_strdup(pool, "");
   } else if (tokenizer->_is_current_node_foreign &&
              utf8iterator_maybe_consume_match(
                  &tokenizer->_input, "[CDATA[", sizeof("[CDATA[") - 1, true)) {
@@ -2301,12 +2398,10 @@ static StateResult handle_doctype_name_state(GumboParser* parser,
     case '\f':
     case ' ':
       gumbo_tokenizer_set_state(parser, GUMBO_LEX_AFTER_DOCTYPE_NAME);
-      gumbo_free((void*) tokenizer->_doc_type_state.name);
       finish_temporary_buffer(parser, &tokenizer->_doc_type_state.name);
       return NEXT_CHAR;
     case '>':
       gumbo_tokenizer_set_state(parser, GUMBO_LEX_DATA);
-      gumbo_free((void*) tokenizer->_doc_type_state.name);
       finish_temporary_buffer(parser, &tokenizer->_doc_type_state.name);
       emit_doctype(parser, output);
       return RETURN_SUCCESS;
@@ -2318,7 +2413,6 @@ static StateResult handle_doctype_name_state(GumboParser* parser,
       tokenizer_add_parse_error(parser, GUMBO_ERR_DOCTYPE_EOF);
       gumbo_tokenizer_set_state(parser, GUMBO_LEX_DATA);
       tokenizer->_doc_type_state.force_quirks = true;
-      gumbo_free((void*) tokenizer->_doc_type_state.name);
       finish_temporary_buffer(parser, &tokenizer->_doc_type_state.name);
       emit_doctype(parser, output);
       return RETURN_ERROR;
@@ -2904,15 +2998,12 @@ bool gumbo_lex(GumboParser* parser, GumboToken* output) {
   }
 }
 
-void gumbo_token_destroy(GumboToken* token) {
+// Token strings are carved from the output's pool, so only the attributes and
+// their vector are given back.
+void gumbo_token_destroy(GumboParser* parser, GumboToken* token) {
   if (!token) return;
 
   switch (token->type) {
-    case GUMBO_TOKEN_DOCTYPE:
-      gumbo_free((void*) token->v.doc_type.name);
-      gumbo_free((void*) token->v.doc_type.public_identifier);
-      gumbo_free((void*) token->v.doc_type.system_identifier);
-      return;
     case GUMBO_TOKEN_START_TAG:
       for (unsigned int i = 0; i < token->v.start_tag.attributes.length; ++i) {
         GumboAttribute* attr = token->v.start_tag.attributes.data[i];
@@ -2921,10 +3012,8 @@ void gumbo_token_destroy(GumboToken* token) {
           gumbo_destroy_attribute(attr);
         }
       }
-      gumbo_free((void*) token->v.start_tag.attributes.data);
-      return;
-    case GUMBO_TOKEN_COMMENT:
-      gumbo_free((void*) token->v.text);
+      gumbo_pool_vector_destroy(
+          parser->_output->pool, &token->v.start_tag.attributes);
       return;
     default:
       return;
@@ -92,6 +92,54 @@ void gumbo_tokenizer_set_state(
 void gumbo_tokenizer_set_is_current_node_foreign(
     struct GumboInternalParser* parser, bool is_foreign);
 
+// Returns the tokenizer state, as left by the last token lexed or by
+// gumbo_tokenizer_set_state.
+GumboTokenizerEnum gumbo_tokenizer_get_state(struct GumboInternalParser* parser);
+
+bool gumbo_tokenizer_get_is_current_node_foreign(
+    struct GumboInternalParser* parser);
+
+// Where the tokenizer is between two tokens, which is all it needs to carry on
+// from there when it's in one of the text states (data, RCDATA, RAWTEXT, script
+// data or PLAINTEXT) with nothing buffered to emit.  See speculation.h.
+typedef struct GumboInternalTokenizerCheckpoint {
+  GumboTokenizerEnum state;
+
+  // The last start tag lexed, which decides the end tag of RCDATA, RAWTEXT and
+  // script data.
+  GumboTag last_start_tag;
+
+  // The code point under the cursor, as the UTF-8 iterator read it, and where
+  // it is.
+  const char* input;
+  int current;
+  int width;
+  GumboSourcePosition position;
+} GumboTokenizerCheckpoint;
+
+// Fills in a checkpoint for where the tokenizer is.  Returns false if it's in
+// the middle of something a checkpoint doesn't capture (characters buffered by
+// a character reference or a rejected end tag, a CDATA section, or a state
+// other than the text states), in which case only the input fields and state
+// mean anything.
+bool gumbo_tokenizer_get_checkpoint(
+    struct GumboInternalParser* parser, GumboTokenizerCheckpoint* checkpoint);
+
+// Carries on lexing from a checkpoint taken by a tokenizer over the same
+// buffer.  The tokenizer state and the foreign content flag are left alone,
+// since the tree builder may have set them since the checkpoint was taken.
+void gumbo_tokenizer_resume(struct GumboInternalParser* parser,
+    const GumboTokenizerCheckpoint* checkpoint);
+
+// Like gumbo_tokenizer_state_init, but starts lexing part way into text, at
+// start->offset, which must be where the UTF-8 iterator would read a character
+// from if it began at the start of text; start is that character's position.
+// An error in the first character is recorded with its offset counted from
+// there.
+void gumbo_tokenizer_state_init_at(struct GumboInternalParser* parser,
+    const char* text, size_t text_length, const GumboSourcePosition* start,
+    GumboTokenizerEnum state, GumboTag last_start_tag);
+
 // Lexes a single token from the specified buffer, filling the output with the
 // parsed GumboToken data structure.  Returns true for a successful
 // tokenization, false if a parse error occurs.
@@ -114,8 +162,11 @@ bool gumbo_lex(struct GumboInternalParser* parser, GumboToken* output);
 //
 // Note that if you are handing over ownership of the internal strings to some
 // other data structure - for example, a parse tree - these do not need to be
-// freed.
-void gumbo_token_destroy(GumboToken* token);
+// freed.  Everything in a token is carved from the pool of the parser's output;
+// its attributes are given back to the pool, its strings stay until the pool
+// is reset.
+void gumbo_token_destroy(
+    struct GumboInternalParser* parser, GumboToken* token);
 
 #ifdef __cplusplus
 }
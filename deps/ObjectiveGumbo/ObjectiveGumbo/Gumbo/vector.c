@@ -34,7 +34,51 @@ void gumbo_vector_init(size_t initial_capacity, GumboVector* vector) {
     vector->data = gumbo_malloc(sizeof(void*) * initial_capacity);
 }
 
-void gumbo_vector_destroy(GumboVector* vector) { gumbo_free(vector->data); }
+void gumbo_vector_init_inline(size_t inline_capacity, GumboVector* vector) {
+  vector->data = (void**) (vector + 1);
+  vector->length = 0;
+  vector->capacity = inline_capacity;
+}
+
+bool gumbo_vector_has_inline_data(const GumboVector* vector) {
+  return vector->data == (void**) (vector + 1);
+}
+
+void gumbo_vector_swap(GumboVector* a, GumboVector* b) {
+  void** a_storage = (void**) (a + 1);
+  void** b_storage = (void**) (b + 1);
+  GumboVector temp = *a;
+  *a = *b;
+  *b = temp;
+  // Each vector now points at the other's inline storage if the other used it,
+  // so move those contents over to its own.
+  bool a_moved = a->data == b_storage;
+  bool b_moved = b->data == a_storage;
+  if (a_moved && b_moved) {
+    unsigned int length = a->length > b->length ? a->length : b->length;
+    for (unsigned int i = 0; i < length; ++i) {
+      void* item = a_storage[i];
+      a_storage[i] = b_storage[i];
+      b_storage[i] = item;
+    }
+  } else if (a_moved) {
+    memcpy(a_storage, b_storage, sizeof(void*) * a->length);
+  } else if (b_moved) {
+    memcpy(b_storage, a_storage, sizeof(void*) * b->length);
+  }
+  if (a_moved) {
+    a->data = a_storage;
+  }
+  if (b_moved) {
+    b->data = b_storage;
+  }
+}
+
+void gumbo_vector_destroy(GumboVector* vector) {
+  if (!gumbo_vector_has_inline_data(vector)) {
+    gumbo_free(vector->data);
+  }
+}
 
 static void enlarge_vector_if_full(GumboVector* vector, int space) {
   unsigned int new_length = vector->length + space;
@@ -44,11 +88,17 @@ static void enlarge_vector_if_full(GumboVector* vector, int space) {
 
   while (new_capacity < new_length) new_capacity *= 2;
 
-  if (new_capacity != vector->capacity) {
-    vector->capacity = new_capacity;
-    vector->data =
-        gumbo_realloc(vector->data, sizeof(void*) * vector->capacity);
+  if (new_capacity == vector->capacity) {
+    return;
+  }
+  if (gumbo_vector_has_inline_data(vector)) {
+    void** data = gumbo_malloc(sizeof(void*) * new_capacity);
+    memcpy(data, vector->data, sizeof(void*) * vector->length);
+    vector->data = data;
+  } else {
+    vector->data = gumbo_realloc(vector->data, sizeof(void*) * new_capacity);
   }
+  vector->capacity = new_capacity;
 }
 
 void gumbo_vector_add(void* element, GumboVector* vector) {
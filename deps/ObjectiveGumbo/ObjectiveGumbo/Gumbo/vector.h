@@ -17,6 +17,8 @@
 #ifndef GUMBO_VECTOR_H_
 #define GUMBO_VECTOR_H_
 
+#include <stdbool.h>
+
 #include "gumbo.h"
 
 #ifdef __cplusplus
@@ -26,6 +28,18 @@ extern "C" {
 // Initializes a new GumboVector with the specified initial capacity.
 void gumbo_vector_init(size_t initial_capacity, GumboVector* vector);
 
+// Initializes a GumboVector to use the inline storage that follows it in a
+// GumboElement, which holds inline_capacity elements.
+void gumbo_vector_init_inline(size_t inline_capacity, GumboVector* vector);
+
+// Whether the vector's data is the inline storage following it.  Such data is
+// never freed; growing the vector moves its contents to an allocated array.
+bool gumbo_vector_has_inline_data(const GumboVector* vector);
+
+// Exchanges the contents of two vectors.  Inline storage stays where it is, so
+// both vectors must have the same inline capacity if either uses it.
+void gumbo_vector_swap(GumboVector* a, GumboVector* b);
+
 // Frees the memory used by an GumboVector.  Does not free the contained
 // pointers.
 void gumbo_vector_destroy(GumboVector* vector);
@@ -7,6 +7,8 @@
 
 #import "ObjectiveGumbo.h"
 
+static const NSUInteger kTokenizerThreads = 2;
+
 @implementation ObjectiveGumbo
 
 +(OGNode*)parseNodeWithUrl:(NSURL *)url encoding:(NSStringEncoding)enc
@@ -67,7 +69,16 @@
 
 +(GumboOutput*)outputFromString:(NSString*)string
 {
-    GumboOutput * output = gumbo_parse(string.UTF8String);
+    // Large documents are tokenized on this thread and one more; small ones on
+    // this thread alone.  More threads would parse faster still, but widgets
+    // are parsed while SpringBoard and the web content process want the other
+    // cores.
+    GumboOptions options = kGumboDefaultOptions;
+    options.tokenizer_threads = (int)MIN([NSProcessInfo processInfo].activeProcessorCount, kTokenizerThreads);
+    // Nothing here reads the parse errors, so don't build them.
+    options.error_mode = GUMBO_ERRORS_NONE;
+    const char * buffer = string.UTF8String;
+    GumboOutput * output = gumbo_parse_with_options(&options, buffer, strlen(buffer));
     return output;
 }
 
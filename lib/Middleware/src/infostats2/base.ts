@@ -15,6 +15,13 @@ export default class IS2Base {
         });
     }
 
+    /**
+     * Selector to function map, for callers that resolve the selector ahead of time
+     */
+    public get dispatchTable(): any {
+        return this._lookupMap;
+    }
+
     public callFn(identifier: string, args: any[]) {
         const fn = this._lookupMap[identifier];
         if (fn) {
@@ -28,6 +28,15 @@ export class Type {
 export default class IS2Middleware implements XenHTMLMiddleware {
     private compatProviders: any = {};
 
+    /**
+     * Lookup maps of each compat provider, keyed by class name. Cylang compiles
+     * sends to these classes into direct calls on this table, falling back to
+     * `missing` for selectors a provider does not implement.
+     */
+    public objc_msgSend_dispatch: any = {
+        missing: () => { return undefined; }
+    };
+
     constructor() {
         // Setup compat providers - they observe providers themselves
         this.compatProviders['IS2Weather']          = new IS2Weather();
@@ -39,6 +48,10 @@ export default class IS2Middleware implements XenHTMLMiddleware {
         this.compatProviders['IS2System']           = new IS2System();
         this.compatProviders['IS2Telephony']        = new IS2Telephony();
 
+        Object.keys(this.compatProviders).forEach((key: string) => {
+            this.objc_msgSend_dispatch[key] = this.compatProviders[key].dispatchTable;
+        });
+
         // Add Type class to global namespace so that IS2 blocks work
         (window as any).Type = Type;
     }
@@ -11,36 +11,255 @@
 #include "Driver.hpp"
 #include "Syntax.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <sstream>
 
-const std::string Compile(const std::string &code, bool strict, bool pretty) {
+typedef std::chrono::steady_clock CYClock;
+
+static uint64_t CYNanosecondsSince(CYClock::time_point &start) {
+    CYClock::time_point now(CYClock::now());
+    uint64_t nanoseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count());
+    start = now;
+    return nanoseconds;
+}
+
+// Bump this with every change that alters what Compile() produces for the same
+// input; stored output is keyed on CompileVersion(), which includes it
+static const uint32_t CYCompilerVersion = 7;
+
+// Compile() and Validate() have to agree on this, so both take it from here
+static void CYCompileOptions(CYOptions &options, CompileTarget target) {
+    // Widgets loop over arrays every update; don't send them through for-in
+    options.forOf_ = CYForOfLoweringIndexed;
+    // Each script block is compiled alone, so even at ES2015 a top-level let,
+    // const or class still becomes a var, or two blocks declaring the same
+    // name would throw
+    options.level_ = target == CompileTargetES2015 ? CYLevelES2015 : CYLevelES5;
+}
+
+// Parse() only records warnings in strict mode, and there they are as fatal as
+// errors; a parse can also fail without saying why
+static bool CYParseFailed(const CYDriver &driver, bool failed) {
+    return failed || !driver.errors_.empty();
+}
+
+static void CYPrintErrors(const CYDriver &driver) {
+    for (CYDriver::Errors::const_iterator error(driver.errors_.begin()); error != driver.errors_.end(); ++error) {
+        printf("%s: %s (at line %d column %d)\n", error->warning_ ? "Warning" : "Error", error->message_.c_str(), error->location_.end.line, error->location_.end.column);
+    }
+}
+
+// Measures only when given stats, so the plain Compile() pays for none of it
+static const std::string CYCompile(const std::string &code, bool strict, bool pretty, CompileTarget target, CompileStats *stats) {
     CYPool pool;
-    std::istream *stream = new std::istringstream(code);
-    
-    CYDriver driver(pool, *stream->rdbuf());
+    std::istringstream stream(code);
+
+    CYClock::time_point start;
+    if (stats != NULL)
+        start = CYClock::now();
+
+    CYDriver driver(pool, *stream.rdbuf());
     driver.strict_ = strict;
     driver.debug_ = 0;
+
+    CYScanStatistics scan;
+    if (stats != NULL)
+        driver.scan_ = &scan;
+
+    bool failed(driver.Parse());
+
+    if (stats != NULL) {
+        stats->scanTime = scan.nanoseconds_;
+        stats->parseTime = CYNanosecondsSince(start) - scan.nanoseconds_;
+        stats->tokens = scan.tokens_;
+        stats->nodes = pool.objects_;
+        stats->poolBytes = pool.Used();
+        stats->poolBlocks = pool.Blocks();
+    }
     
-    if (driver.Parse() || !driver.errors_.empty()) {
-        for (CYDriver::Errors::const_iterator error(driver.errors_.begin()); error != driver.errors_.end(); ++error) {
-            printf("%s: %s (at line %d column %d)\n", error->warning_ ? "Warning" : "Error", error->message_.c_str(), error->location_.end.line, error->location_.end.column);
-        }
-        
+    if (CYParseFailed(driver, failed)) {
+        CYPrintErrors(driver);
         return "";
     }
     
-    if (driver.script_ == NULL)
+    if (driver.script_ == NULL) {
+        if (stats != NULL)
+            stats->compiled = true;
         return "";
+    }
     
     std::stringbuf str;
     CYOptions options;
+    CYCompileOptions(options, target);
     CYOutput out(str, options);
     out.pretty_ = pretty;
-    driver.Replace(options);
-    out << *driver.script_;
     
-    // Cleanup
-    delete stream;
+    // Redeclared let, const and class bindings are only caught here; anything
+    // else Replace throws is one of the compiler's own assertions failing
+    try {
+        if (!driver.Replace(options)) {
+            CYPrintErrors(driver);
+            return "";
+        }
+    } catch (const CYException &error) {
+        printf("Error: %s\n", error.PoolCString(pool));
+        return "";
+    }
+
+    if (stats != NULL)
+        stats->replaceTime = CYNanosecondsSince(start);
+    
+    out << *driver.script_;
+
+    std::string output(str.str());
+
+    if (stats != NULL) {
+        stats->outputTime = CYNanosecondsSince(start);
+        stats->poolBytes = pool.Used();
+        stats->poolBlocks = pool.Blocks();
+        stats->outputSize = output.size();
+        stats->compiled = true;
+    }
+
+    return output;
+}
+
+struct CYHistogram {
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> buckets[65];
+
+    void Add(uint64_t value) {
+        unsigned bucket(0);
+        for (uint64_t rest(value); rest != 0; rest >>= 1)
+            ++bucket;
+        count.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(value, std::memory_order_relaxed);
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+static std::atomic<bool> histograms_;
+static CYHistogram histogram_[CompileMetricCount];
+
+static void CYRecord(const CompileStats &stats) {
+    histogram_[CompileMetricScanTime].Add(stats.scanTime);
+    histogram_[CompileMetricParseTime].Add(stats.parseTime);
+    histogram_[CompileMetricReplaceTime].Add(stats.replaceTime);
+    histogram_[CompileMetricOutputTime].Add(stats.outputTime);
+    histogram_[CompileMetricTokens].Add(stats.tokens);
+    histogram_[CompileMetricNodes].Add(stats.nodes);
+    histogram_[CompileMetricPoolBytes].Add(stats.poolBytes);
+    histogram_[CompileMetricOutputSize].Add(stats.outputSize);
+}
+
+const std::string Compile(const std::string &code, bool strict, bool pretty, CompileTarget target) {
+    if (!histograms_.load(std::memory_order_relaxed))
+        return CYCompile(code, strict, pretty, target, NULL);
+
+    CompileStats stats;
+    return Compile(code, strict, pretty, stats, target);
+}
+
+const std::string Compile(const std::string &code, bool strict, bool pretty, CompileStats &stats, CompileTarget target) {
+    stats = CompileStats();
+    std::string output(CYCompile(code, strict, pretty, target, &stats));
+    if (histograms_.load(std::memory_order_relaxed))
+        CYRecord(stats);
+    return output;
+}
+
+void CompileHistogramsEnable(bool enabled) {
+    histograms_.store(enabled, std::memory_order_relaxed);
+}
+
+void CompileHistogramsReset() {
+    for (CYHistogram &histogram : histogram_) {
+        histogram.count.store(0, std::memory_order_relaxed);
+        histogram.sum.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64_t> &bucket : histogram.buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+// Each counter is read on its own, so a Compile() finishing meanwhile may be
+// only partly included
+void CompileHistogramsSnapshot(CompileHistogram (&histograms)[CompileMetricCount]) {
+    for (unsigned metric(0); metric != CompileMetricCount; ++metric) {
+        const CYHistogram &from(histogram_[metric]);
+        CompileHistogram &to(histograms[metric]);
+        to.count = from.count.load(std::memory_order_relaxed);
+        to.sum = from.sum.load(std::memory_order_relaxed);
+        for (unsigned bucket(0); bucket != 65; ++bucket)
+            to.buckets[bucket] = from.buckets[bucket].load(std::memory_order_relaxed);
+    }
+}
+
+const char *CompileMetricName(CompileMetric metric) {
+    switch (metric) {
+        case CompileMetricScanTime: return "scanTime";
+        case CompileMetricParseTime: return "parseTime";
+        case CompileMetricReplaceTime: return "replaceTime";
+        case CompileMetricOutputTime: return "outputTime";
+        case CompileMetricTokens: return "tokens";
+        case CompileMetricNodes: return "nodes";
+        case CompileMetricPoolBytes: return "poolBytes";
+        case CompileMetricOutputSize: return "outputSize";
+        case CompileMetricCount: break;
+    }
+    return NULL;
+}
+
+uint32_t CompileVersion() {
+    CYOptions options;
+    CYCompileOptions(options, CompileTargetES5);
+    return CYCompilerVersion << 16 | options.forOf_;
+}
+
+bool Validate(const std::string &code, bool strict, std::vector<CompileError> &errors, CompileTarget target) {
+    // Nothing parsed here outlives this call, so size the scratch pool up front
+    // to avoid growing it block by block on large scripts
+    CYPool pool(std::max<size_t>(code.size() * 2, 4096));
+    std::istringstream stream(code);
+
+    CYDriver driver(pool, *stream.rdbuf());
+    driver.strict_ = strict;
+    driver.debug_ = 0;
+
+    bool failed(driver.Parse());
+    bool valid(!CYParseFailed(driver, failed));
+
+    if (valid && driver.script_ != NULL) {
+        CYOptions options;
+        CYCompileOptions(options, target);
+
+        // Redeclared let, const and class bindings are only caught here
+        try {
+            valid = driver.Replace(options);
+        } catch (const CYException &error) {
+            CompileError result;
+            result.warning = false;
+            result.line = 0;
+            result.column = 0;
+            result.endLine = 0;
+            result.endColumn = 0;
+            result.message = error.PoolCString(pool);
+            errors.push_back(result);
+            valid = false;
+        }
+    }
+
+    for (CYDriver::Errors::const_iterator error(driver.errors_.begin()); error != driver.errors_.end(); ++error) {
+        CompileError result;
+        result.warning = error->warning_;
+        result.line = error->location_.begin.line;
+        result.column = error->location_.begin.column;
+        result.endLine = error->location_.end.line;
+        result.endColumn = error->location_.end.column;
+        result.message = error->message_;
+        errors.push_back(result);
+    }
 
-    return str.str();
+    return valid;
 }
@@ -9,9 +9,92 @@
 #ifndef Compile_hpp
 #define Compile_hpp
 
+#include <stdint.h>
 #include <stdio.h>
 #include <string>
+#include <vector>
 
-extern const std::string Compile(const std::string &code, bool strict, bool pretty);
+struct CompileError {
+    bool warning;
+    unsigned int line;
+    unsigned int column;
+    unsigned int endLine;
+    unsigned int endColumn;
+    std::string message;
+};
+
+// What one Compile() did. Times are from the monotonic clock, in nanoseconds;
+// scanning happens during parsing, and parseTime doesn't include it
+struct CompileStats {
+    uint64_t scanTime;
+    uint64_t parseTime;
+    uint64_t replaceTime;
+    uint64_t outputTime;
+
+    size_t tokens;
+    // objects the parser allocated, which is nearly all AST nodes
+    size_t nodes;
+
+    // CYPool bytes handed out, and the blocks that took from malloc
+    size_t poolBytes;
+    size_t poolBlocks;
+
+    size_t outputSize;
+
+    // Whether it got all the way through; an empty script also has empty output
+    bool compiled;
+};
+
+// The oldest JavaScript the output has to run on. ES5 lowers everything, as
+// Cylang always has. ES2015 leaves classes, let and const, arrow functions,
+// templates and for-of for WebKit to run itself; only Cycript's own syntax is
+// still lowered
+enum CompileTarget {
+    CompileTargetES5,
+    CompileTargetES2015,
+};
+
+extern const std::string Compile(const std::string &code, bool strict, bool pretty, CompileTarget target = CompileTargetES5);
+// Same, filling in stats; the plain overload measures nothing unless the
+// histograms below are on
+extern const std::string Compile(const std::string &code, bool strict, bool pretty, CompileStats &stats, CompileTarget target = CompileTargetES5);
+
+// Changes whenever Compile() could give different output for the same input
+// and target: with the compiler itself, and with the options it compiles at.
+// Anything that keeps compiled output around has to key it on this, and on
+// the target
+extern uint32_t CompileVersion();
+
+// Process-wide histograms of CompileStats, off until the host enables them;
+// from then on every Compile() adds its numbers in
+enum CompileMetric {
+    CompileMetricScanTime,
+    CompileMetricParseTime,
+    CompileMetricReplaceTime,
+    CompileMetricOutputTime,
+    CompileMetricTokens,
+    CompileMetricNodes,
+    CompileMetricPoolBytes,
+    CompileMetricOutputSize,
+    CompileMetricCount,
+};
+
+// buckets[0] counts zeros, buckets[i] values in [2^(i-1), 2^i)
+struct CompileHistogram {
+    uint64_t count;
+    uint64_t sum;
+    uint64_t buckets[65];
+};
+
+extern void CompileHistogramsEnable(bool enabled);
+extern void CompileHistogramsReset();
+extern void CompileHistogramsSnapshot(CompileHistogram (&histograms)[CompileMetricCount]);
+extern const char *CompileMetricName(CompileMetric metric);
+
+// Compiles as far as Replace, skipping Output, and fails exactly when Compile()
+// would: on any error, or in strict mode on any warning. Errors from Replace,
+// such as a redeclared let binding, are at the name at fault; only a failure
+// inside the compiler itself comes back with a line and column of 0
+extern bool Validate(const std::string &code, bool strict, std::vector<CompileError> &errors, CompileTarget target = CompileTargetES5);
 
 #endif /* Compile_hpp */
@@ -0,0 +1,470 @@
+//
+//  CompileCache.cpp
+//  libwidgetinfo
+//
+
+#include "CompileCache.hpp"
+#include "Compile.hpp"
+
+#include <errno.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+const uint32_t kHeaderMagic = 0x43594343; // CYCC
+const uint32_t kRecordMagic = 0x43594352; // CYCR
+
+// Only the layout of the file; which compiler wrote an entry is part of its
+// key, so processes from before and after an update can share one store
+const uint32_t kFormatVersion = 2;
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;
+    // Committed end of the record area; a record only exists once this has
+    // been advanced past it
+    uint64_t end;
+    // Set once a replacement has been renamed over this file
+    uint32_t retired;
+    uint32_t reserved[9];
+};
+
+struct Record {
+    uint32_t magic;
+    uint32_t size;
+    uint64_t hash;
+    uint32_t length;
+    uint32_t flags;
+    uint32_t compiler;
+    uint32_t checksum;
+    // size bytes of output follow, then a NUL, then the length bytes of source
+    // it was compiled from, padded out to 8 bytes
+};
+
+const uint64_t kRecordsStart = sizeof(Header);
+
+uint64_t Hash(const void *data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL) {
+    const uint8_t *bytes(static_cast<const uint8_t *>(data));
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint32_t Checksum(const void *output, size_t size, const void *code, size_t length) {
+    uint64_t hash(Hash(code, length, Hash(output, size)));
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+
+uint64_t RecordSize(uint64_t size, uint64_t length) {
+    return (sizeof(Record) + size + 1 + length + 7) & ~static_cast<uint64_t>(7);
+}
+
+const char *RecordOutput(const Record *record) {
+    return reinterpret_cast<const char *>(record + 1);
+}
+
+const char *RecordCode(const Record *record) {
+    return RecordOutput(record) + record->size + 1;
+}
+
+bool WriteFully(int fd, const void *data, size_t size, off_t offset) {
+    const uint8_t *bytes(static_cast<const uint8_t *>(data));
+    while (size != 0) {
+        ssize_t writ(pwrite(fd, bytes, size, offset));
+        if (writ < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        bytes += writ;
+        size -= writ;
+        offset += writ;
+    }
+    return true;
+}
+
+bool WriteRecord(int fd, uint64_t offset, uint64_t hash, uint32_t flags, uint32_t compiler, const std::string &code, const std::string &output) {
+    std::string buffer(RecordSize(output.size(), code.size()), '\0');
+
+    Record *record(reinterpret_cast<Record *>(&buffer[0]));
+    record->magic = kRecordMagic;
+    record->size = static_cast<uint32_t>(output.size());
+    record->hash = hash;
+    record->length = static_cast<uint32_t>(code.size());
+    record->flags = flags;
+    record->compiler = compiler;
+    record->checksum = Checksum(output.data(), output.size(), code.data(), code.size());
+    memcpy(&buffer[sizeof(Record)], output.data(), output.size());
+    memcpy(&buffer[sizeof(Record) + output.size() + 1], code.data(), code.size());
+
+    return WriteFully(fd, buffer.data(), buffer.size(), offset);
+}
+
+bool WriteHeader(int fd, uint64_t capacity, uint64_t end) {
+    Header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = kHeaderMagic;
+    header.version = kFormatVersion;
+    header.capacity = capacity;
+    header.end = end;
+    return WriteFully(fd, &header, sizeof(header), 0);
+}
+
+class FileLock {
+  private:
+    int fd_;
+    bool locked_;
+
+  public:
+    FileLock(int fd) :
+        fd_(fd),
+        locked_(false)
+    {
+        if (fd_ < 0)
+            return;
+        int result;
+        do result = flock(fd_, LOCK_EX);
+        while (result != 0 && errno == EINTR);
+        locked_ = result == 0;
+    }
+
+    ~FileLock() {
+        if (locked_)
+            flock(fd_, LOCK_UN);
+    }
+
+    operator bool() const {
+        return locked_;
+    }
+};
+
+}
+
+CompileCache::CompileCache(const std::string &path, size_t capacity) :
+    path_(path),
+    capacity_(std::max<size_t>(capacity, 64 * 1024)),
+    compiler_(CompileVersion()),
+    lock_fd_(-1),
+    fd_(-1),
+    base_(NULL),
+    scanned_(kRecordsStart)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+
+    lock_fd_ = open((path_ + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+    FileLock lock(lock_fd_);
+    if (lock)
+        Attach();
+}
+
+CompileCache::~CompileCache() {
+    Close();
+    if (lock_fd_ >= 0)
+        close(lock_fd_);
+}
+
+CompileCache::Key CompileCache::KeyFor(const std::string &code, uint32_t flags) const {
+    Key key;
+    key.hash = Hash(code.data(), code.size());
+    key.length = static_cast<uint32_t>(code.size());
+    key.flags = flags;
+    key.compiler = compiler_;
+    return key;
+}
+
+bool CompileCache::Attach() {
+    // Nothing renames over path_ while the lock is held, so a second look is
+    // only needed after replacing the file here
+    for (unsigned attempt = 0; attempt != 2; ++attempt) {
+        int fd(open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666));
+        if (fd < 0)
+            return false;
+
+        uint64_t capacity(capacity_);
+
+        Header header;
+        ssize_t read(pread(fd, &header, sizeof(header), 0));
+
+        if (read != sizeof(header) || header.magic != kHeaderMagic) {
+            // Fresh, or left half-created by a process that died; nobody can
+            // have mapped it without a valid header
+            if (ftruncate(fd, 0) != 0 || !WriteHeader(fd, capacity, kRecordsStart)) {
+                close(fd);
+                return false;
+            }
+        } else if (header.version != kFormatVersion) {
+            // A layout this build doesn't read; start over in a new file rather
+            // than truncating one that may still be mapped
+            std::string temporary(path_ + ".tmp");
+            int replacement(open(temporary.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666));
+            bool written(replacement >= 0 && WriteHeader(replacement, capacity, kRecordsStart) && fsync(replacement) == 0);
+            if (replacement >= 0)
+                close(replacement);
+
+            bool superseded(written && Supersede(fd, temporary));
+            close(fd);
+            if (!superseded)
+                return false;
+            continue;
+        } else if (header.retired != 0) {
+            // Only a damaged file can still be at path_ once retired; look
+            // again, and give up if it is still there
+            close(fd);
+            continue;
+        } else
+            capacity = header.capacity;
+
+        // Every offset below capacity has to be backed by the file, or a
+        // header that got ahead of the data would fault on the mapping;
+        // growing it is sparse, and safe for anyone who has it mapped already
+        struct stat info;
+        if (fstat(fd, &info) != 0 || (static_cast<uint64_t>(info.st_size) < capacity && ftruncate(fd, capacity) != 0)) {
+            close(fd);
+            return false;
+        }
+
+        void *base(mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+        if (base == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+
+        fd_ = fd;
+        base_ = static_cast<uint8_t *>(base);
+        capacity_ = capacity;
+        scanned_ = kRecordsStart;
+        index_.clear();
+        return true;
+    }
+
+    return false;
+}
+
+bool CompileCache::Reattach() {
+    Close();
+    return Attach();
+}
+
+bool CompileCache::Current() const {
+    struct stat opened, named;
+    if (fstat(fd_, &opened) != 0 || stat(path_.c_str(), &named) != 0)
+        return false;
+    return opened.st_dev == named.st_dev && opened.st_ino == named.st_ino;
+}
+
+bool CompileCache::Supersede(int fd, const std::string &temporary) {
+    if (rename(temporary.c_str(), path_.c_str()) != 0) {
+        unlink(temporary.c_str());
+        return false;
+    }
+
+    // Anyone still looking at the old file will move over on their next access
+    uint32_t retired(1);
+    return WriteFully(fd, &retired, sizeof(retired), offsetof(Header, retired));
+}
+
+void CompileCache::Close() {
+    if (base_ != NULL)
+        munmap(base_, capacity_);
+    if (fd_ >= 0)
+        close(fd_);
+
+    base_ = NULL;
+    fd_ = -1;
+}
+
+void CompileCache::Refresh() {
+    const Header *header(reinterpret_cast<const Header *>(base_));
+    uint64_t end(__atomic_load_n(&header->end, __ATOMIC_ACQUIRE));
+    if (end > capacity_)
+        end = capacity_;
+
+    while (scanned_ + sizeof(Record) <= end) {
+        const Record *record(reinterpret_cast<const Record *>(base_ + scanned_));
+        uint64_t size(RecordSize(record->size, record->length));
+
+        // Everything below end was committed, so this only trips on a damaged
+        // file; stop indexing rather than trust anything after it
+        if (record->magic != kRecordMagic || scanned_ + size > end)
+            break;
+        if (Checksum(RecordOutput(record), record->size, RecordCode(record), record->length) != record->checksum)
+            break;
+
+        Key key;
+        key.hash = record->hash;
+        key.length = record->length;
+        key.flags = record->flags;
+        key.compiler = record->compiler;
+        index_[key] = scanned_;
+
+        scanned_ += size;
+    }
+}
+
+bool CompileCache::Matches(uint64_t offset, const std::string &code) const {
+    const Record *record(reinterpret_cast<const Record *>(base_ + offset));
+    return record->length == code.size() && memcmp(RecordCode(record), code.data(), code.size()) == 0;
+}
+
+bool CompileCache::Find(const std::string &code, uint32_t flags, std::string &output) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (base_ == NULL)
+        return false;
+
+    const Header *header(reinterpret_cast<const Header *>(base_));
+    if (__atomic_load_n(&header->retired, __ATOMIC_ACQUIRE) != 0) {
+        FileLock lock(lock_fd_);
+        if (!lock || !Reattach())
+            return false;
+    }
+
+    Refresh();
+
+    std::unordered_map<Key, uint64_t, KeyHash>::const_iterator entry(index_.find(KeyFor(code, flags)));
+    if (entry == index_.end() || !Matches(entry->second, code))
+        return false;
+
+    // Copied out, so no mapping has to outlive the file it was of
+    const Record *record(reinterpret_cast<const Record *>(base_ + entry->second));
+    output.assign(RecordOutput(record), record->size);
+    return true;
+}
+
+void CompileCache::Append(const Key &key, const std::string &code, const std::string &output) {
+    Header *header(reinterpret_cast<Header *>(base_));
+    uint64_t offset(header->end);
+
+    if (!WriteRecord(fd_, offset, key.hash, key.flags, key.compiler, code, output))
+        return;
+    // The record has to be durable before the header says it exists
+    if (fsync(fd_) != 0)
+        return;
+
+    __atomic_store_n(&header->end, offset + RecordSize(output.size(), code.size()), __ATOMIC_RELEASE);
+    Refresh();
+}
+
+bool CompileCache::Rewrite(size_t budget) {
+    // Newest entries first, until the budget runs out
+    std::vector<uint64_t> offsets;
+    offsets.reserve(index_.size());
+    for (std::unordered_map<Key, uint64_t, KeyHash>::const_iterator entry(index_.begin()); entry != index_.end(); ++entry)
+        offsets.push_back(entry->second);
+    std::sort(offsets.begin(), offsets.end());
+
+    size_t used(0), first(offsets.size());
+    while (first != 0) {
+        const Record *record(reinterpret_cast<const Record *>(base_ + offsets[first - 1]));
+        size_t size(RecordSize(record->size, record->length));
+        if (used + size > budget)
+            break;
+        used += size;
+        --first;
+    }
+
+    std::string temporary(path_ + ".tmp");
+    int fd(open(temporary.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666));
+    if (fd < 0)
+        return false;
+
+    bool written(true);
+    uint64_t end(kRecordsStart);
+    for (size_t i = first; written && i != offsets.size(); ++i) {
+        const Record *record(reinterpret_cast<const Record *>(base_ + offsets[i]));
+        size_t size(RecordSize(record->size, record->length));
+        written = WriteFully(fd, record, size, end);
+        end += size;
+    }
+
+    written = written && WriteHeader(fd, capacity_, end) && fsync(fd) == 0;
+    close(fd);
+
+    if (!written) {
+        unlink(temporary.c_str());
+        return false;
+    }
+
+    return Supersede(fd_, temporary);
+}
+
+void CompileCache::Insert(const std::string &code, uint32_t flags, const std::string &output) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (base_ == NULL)
+        return;
+
+    FileLock lock(lock_fd_);
+    if (!lock)
+        return;
+
+    // Another process may have compacted or replaced the store since this one
+    // opened it, and anything appended to the old file would be lost
+    if (!Current() && !Reattach())
+        return;
+
+    Key key(KeyFor(code, flags));
+    uint64_t size(RecordSize(output.size(), code.size()));
+    if (size > capacity_ / 2)
+        return;
+
+    Refresh();
+
+    // Another process may have got here first
+    std::unordered_map<Key, uint64_t, KeyHash>::const_iterator entry(index_.find(key));
+    if (entry != index_.end() && Matches(entry->second, code))
+        return;
+
+    const Header *header(reinterpret_cast<const Header *>(base_));
+    if (header->end + size > capacity_) {
+        if (!Rewrite(capacity_ / 2 - size) || !Reattach())
+            return;
+        Refresh();
+    }
+
+    Append(key, code, output);
+}
+
+void CompileCache::Compact() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (base_ == NULL)
+        return;
+
+    FileLock lock(lock_fd_);
+    if (!lock)
+        return;
+
+    if (!Current() && !Reattach())
+        return;
+
+    Refresh();
+    if (Rewrite(capacity_ / 2))
+        Reattach();
+}
+
+const std::string CompileCached(CompileCache &cache, const std::string &code, bool strict, bool pretty, CompileTarget target) {
+    uint32_t flags((strict ? 1 : 0) | (pretty ? 2 : 0) | target << 2);
+
+    std::string output;
+    if (cache.Find(code, flags, output))
+        return output;
+
+    output = Compile(code, strict, pretty, target);
+
+    // Failures print their errors as part of compiling, so only successful
+    // output is worth keeping
+    if (!output.empty())
+        cache.Insert(code, flags, output);
+
+    return output;
+}
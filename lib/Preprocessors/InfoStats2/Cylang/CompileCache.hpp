@@ -0,0 +1,97 @@
+//
+//  CompileCache.hpp
+//  libwidgetinfo
+//
+//  Persistent store of compiled Cylang output, shared between every process
+//  that loads widgets. The backing file is append-only and content-addressed:
+//  readers map it and look entries up without taking any lock, writers append
+//  and publish a record by advancing the committed end offset in the header.
+//  Anything past that offset is a torn write from a writer that died, and is
+//  simply overwritten by the next one.
+//
+//  Appending, compaction and replacing the file all happen under flock() on a
+//  separate lock file next to it, which unlike the store itself is never
+//  renamed; a writer that finds the store it has open is no longer the one at
+//  the path moves over to the new one before touching anything.
+//
+
+#ifndef CompileCache_hpp
+#define CompileCache_hpp
+
+#include "Compile.hpp"
+
+#include <stdint.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+class CompileCache {
+  public:
+    // capacity is the most the file may grow to; once an append would pass it,
+    // the store is compacted down to its newest entries
+    CompileCache(const std::string &path, size_t capacity = 8 * 1024 * 1024);
+    ~CompileCache();
+
+    // Entries keep their source and only match it byte for byte, so a hash
+    // collision is a miss rather than another script's output
+    bool Find(const std::string &code, uint32_t flags, std::string &output);
+    void Insert(const std::string &code, uint32_t flags, const std::string &output);
+
+    // Rewrites the store keeping at most half its capacity of the newest entries
+    void Compact();
+
+    bool IsOpen() const { return base_ != NULL; }
+
+  private:
+    struct Key {
+        uint64_t hash;
+        uint32_t length;
+        uint32_t flags;
+        // CompileVersion() of the compiler that produced the entry
+        uint32_t compiler;
+
+        bool operator ==(const Key &rhs) const {
+            return hash == rhs.hash && length == rhs.length && flags == rhs.flags && compiler == rhs.compiler;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator ()(const Key &key) const {
+            return static_cast<size_t>(key.hash ^ key.flags ^ static_cast<uint64_t>(key.compiler) << 32);
+        }
+    };
+
+    std::string path_;
+    size_t capacity_;
+    uint32_t compiler_;
+
+    int lock_fd_;
+    int fd_;
+    uint8_t *base_;
+
+    // Offset up to which index_ has been built from the mapping
+    uint64_t scanned_;
+    std::unordered_map<Key, uint64_t, KeyHash> index_;
+    std::mutex lock_;
+
+    // These all need the lock file held
+    bool Attach();
+    bool Reattach();
+    bool Current() const;
+    bool Supersede(int fd, const std::string &temporary);
+
+    void Close();
+    void Refresh();
+    bool Matches(uint64_t offset, const std::string &code) const;
+
+    void Append(const Key &key, const std::string &code, const std::string &output);
+    bool Rewrite(size_t budget);
+
+    Key KeyFor(const std::string &code, uint32_t flags) const;
+};
+
+// Compile() through the cache: a hit skips the compiler entirely, a miss
+// compiles and publishes the result for other processes
+extern const std::string CompileCached(CompileCache &cache, const std::string &code, bool strict, bool pretty, CompileTarget target = CompileTargetES5);
+
+#endif /* CompileCache_hpp */
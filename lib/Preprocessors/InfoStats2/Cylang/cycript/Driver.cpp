@@ -20,6 +20,7 @@
 /* }}} */
 
 #include "Driver.hpp"
+#include "Error.hpp"
 #include "Syntax.hpp"
 
 bool CYParser(CYPool &pool, bool debug);
@@ -32,6 +33,7 @@ CYDriver::CYDriver(CYPool &pool, std::streambuf &data, const std::string &filena
     debug_(0),
     strict_(false),
     highlight_(false),
+    scan_(NULL),
     filename_(filename),
     script_(NULL),
     auto_(false),
@@ -51,8 +53,38 @@ CYDriver::~CYDriver() {
     ScannerDestroy();
 }
 
-void CYDriver::Replace(CYOptions &options) {
+// fails, adding to errors_, on mistakes that only show once the script is
+// put together, such as a let declared twice in the same block
+bool CYDriver::Replace(CYOptions &options) {
     CYLocal<CYPool> local(&pool_);
     CYContext context(options);
-    script_->Replace(context);
+
+    try {
+        script_->Replace(context);
+    } catch (const CYLocatedError &error) {
+        Error failure;
+        failure.warning_ = false;
+        if (error.extent_ != 0)
+            failure.location_ = Location(error.extent_);
+        else {
+            // line zero is nowhere, rather than the start of the script
+            failure.location_.begin.line = 0;
+            failure.location_.end.line = 0;
+        }
+        failure.message_ = error.message_;
+        errors_.push_back(failure);
+        return false;
+    }
+
+    return true;
+}
+
+unsigned CYDriver::Locate(const CYLocation &location) {
+    extents_.push_back(CYExtent(location));
+    return extents_.size();
+}
+
+CYLocation CYDriver::Location(unsigned extent) {
+    _assert(extent != 0 && extent <= extents_.size());
+    return extents_[extent - 1].Location(&filename_);
 }
@@ -38,6 +38,18 @@ struct CYExpression;
 struct CYScript;
 struct CYWord;
 
+// what the scanner did during a Parse(), if the driver was given one of these
+struct CYScanStatistics {
+    size_t tokens_;
+    uint64_t nanoseconds_;
+
+    CYScanStatistics() :
+        tokens_(0),
+        nanoseconds_(0)
+    {
+    }
+};
+
 enum CYMark {
     CYMarkScript,
     CYMarkModule,
@@ -70,6 +82,7 @@ class _visible CYDriver {
     int debug_;
     bool strict_;
     bool highlight_;
+    CYScanStatistics *scan_;
 
     enum Condition {
         XMLContentCondition,
@@ -89,6 +102,11 @@ class _visible CYDriver {
     CYScript *script_;
     Errors errors_;
 
+    // where the identifiers and literals the scanner made came from: they
+    // only keep an index into this, counting from one so that zero can mean
+    // a node that was made up later
+    std::vector<CYExtent> extents_;
+
     bool auto_;
 
     struct Context {
@@ -128,7 +146,7 @@ class _visible CYDriver {
     ~CYDriver();
 
     bool Parse(CYMark mark = CYMarkModule);
-    void Replace(CYOptions &options);
+    bool Replace(CYOptions &options);
 
     void SetRegEx(bool equal);
     void SetCondition(Condition condition);
@@ -137,6 +155,9 @@ class _visible CYDriver {
     void PopCondition();
 
     void Warning(const CYLocation &location, const char *message);
+
+    unsigned Locate(const CYLocation &location);
+    CYLocation Location(unsigned extent);
 };
 
 #endif/*CYCRIPT_DRIVER_HPP*/
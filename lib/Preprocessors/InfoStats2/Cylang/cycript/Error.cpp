@@ -54,3 +54,15 @@ _visible void CYThrow(const char *format, ...) {
     // XXX: does this matter? :(
     va_end(args);
 }
+
+CYLocatedError::CYLocatedError(unsigned extent, const char *format, va_list args) :
+    CYPoolError(format, args),
+    extent_(extent)
+{
+}
+
+_visible void CYThrowAt(unsigned extent, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    throw CYLocatedError(extent, format, args);
+}
@@ -40,4 +40,14 @@ struct _visible CYPoolError :
     virtual const char *PoolCString(CYPool &pool) const;
 };
 
+// thrown by CYThrowAt: extent_ is an index into CYDriver::extents_, or zero
+// if the node at fault was made up after parsing
+struct _visible CYLocatedError :
+    CYPoolError
+{
+    unsigned extent_;
+
+    CYLocatedError(unsigned extent, const char *format, va_list args);
+};
+
 #endif/*CYCRIPT_ERROR_HPP*/
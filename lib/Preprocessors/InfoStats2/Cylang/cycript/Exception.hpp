@@ -46,6 +46,8 @@ struct _visible CYException {
 };
 
 void CYThrow(const char *format, ...) _noreturn;
+// the same, for a mistake in the script at the node whose extent this is
+void CYThrowAt(unsigned extent, const char *format, ...) _noreturn;
 
 #ifdef CY_EXECUTE
 void CYThrow(JSContextRef context, JSValueRef value);
@@ -0,0 +1,199 @@
+/* Cycript - The Truly Universal Scripting Language
+ * Copyright (C) 2009-2016  Jay Freeman (saurik)
+*/
+
+/* GNU Affero General Public License, Version 3 {{{ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+/* }}} */
+
+#ifndef CYCRIPT_KEYWORD_HPP
+#define CYCRIPT_KEYWORD_HPP
+
+#include <stdint.h>
+#include <string.h>
+
+#include "Highlight.hpp"
+#include "Parser.tab.hpp"
+#include "Standard.hpp"
+
+struct CYKeyword {
+    const char *name_;
+    size_t size_;
+    cy::parser::token::yytokentype token_;
+    hi::Value highlight_;
+};
+
+#define CYKeywordEntry(name, value, highlight) \
+    {name, sizeof(name) - 1, cy::parser::token::value, hi::highlight}
+
+// reserved words are lexed by the scanner's identifier rule and classified
+// here, which keeps them out of the DFA and means they never touch the pool
+static constexpr CYKeyword CYKeywords[] = {
+    CYKeywordEntry("undefined",    _undefined_,    Operator),
+    CYKeywordEntry("bool",         _bool_,         Type),
+    CYKeywordEntry("BOOL",         _BOOL_,         Type),
+    CYKeywordEntry("id",           _id_,           Type),
+    CYKeywordEntry("nil",          _nil_,          Constant),
+    CYKeywordEntry("NULL",         _NULL_,         Constant),
+    CYKeywordEntry("SEL",          _SEL_,          Type),
+    CYKeywordEntry("abstract",     _abstract_,     Meta),               /*FII*/
+    CYKeywordEntry("as",           _as_,           Meta),               /*III*/
+    CYKeywordEntry("await",        _await_,        Meta),               /*II?*/
+    CYKeywordEntry("boolean",      _boolean_,      Type),               /*FII*/
+    CYKeywordEntry("break",        _break_,        Control),            /*KKK*/
+    CYKeywordEntry("byte",         _byte_,         Type),               /*FII*/
+    CYKeywordEntry("case",         _case_,         Control),            /*KKK*/
+    CYKeywordEntry("catch",        _catch_,        Control),            /*KKK*/
+    CYKeywordEntry("char",         _char_,         Type),               /*FII*/
+    CYKeywordEntry("class",        _class_,        Meta),               /*FFK*/
+    CYKeywordEntry("const",        _const_,        Meta),               /*FFK*/
+    CYKeywordEntry("constructor",  _constructor_,  Special),            /*III*/
+    CYKeywordEntry("continue",     _continue_,     Control),            /*KKK*/
+    CYKeywordEntry("debugger",     _debugger_,     Meta),               /*FKK*/
+    CYKeywordEntry("default",      _default_,      Control),            /*KKK*/
+    CYKeywordEntry("delete",       _delete_,       Operator),           /*KKK*/
+    CYKeywordEntry("do",           _do_,           Control),            /*KKK*/
+    CYKeywordEntry("double",       _double_,       Type),               /*FII*/
+    CYKeywordEntry("else",         _else_,         Control),            /*KKK*/
+    CYKeywordEntry("enum",         _enum_,         Meta),               /*FFF*/
+    CYKeywordEntry("export",       _export_,       Meta),               /*FFK*/
+    CYKeywordEntry("extends",      _extends_,      Meta),               /*FFK*/
+    CYKeywordEntry("eval",         _eval_,         Special),            /*III*/
+    CYKeywordEntry("false",        _false_,        Constant),           /*LLL*/
+    CYKeywordEntry("final",        _final_,        Meta),               /*FII*/
+    CYKeywordEntry("finally",      _finally_,      Control),            /*KKK*/
+    CYKeywordEntry("float",        _float_,        Type),               /*FII*/
+    CYKeywordEntry("for",          _for_,          Control),            /*KKK*/
+    CYKeywordEntry("from",         _from_,         Meta),               /*III*/
+    CYKeywordEntry("function",     _function_,     Meta),               /*KKK*/
+    CYKeywordEntry("goto",         _goto_,         Control),            /*FII*/
+    CYKeywordEntry("get",          _get_,          Meta),               /*III*/
+    CYKeywordEntry("if",           _if_,           Control),            /*KKK*/
+    CYKeywordEntry("implements",   _implements_,   Meta),               /*FSS*/
+    CYKeywordEntry("import",       _import_,       Meta),               /*FFK*/
+    CYKeywordEntry("in",           _in_,           Operator),           /*KKK*/
+    CYKeywordEntry("Infinity",     _Infinity_,     Constant),           /*III*/
+    CYKeywordEntry("instanceof",   _instanceof_,   Operator),           /*KKK*/
+    CYKeywordEntry("int",          _int_,          Type),               /*FII*/
+    CYKeywordEntry("__int128",     ___int128_,     Type),               /*III*/
+    CYKeywordEntry("interface",    _interface_,    Meta),               /*FSS*/
+    CYKeywordEntry("let",          _let_,          Meta),               /*IS?*/
+    CYKeywordEntry("long",         _long_,         Type),               /*FII*/
+    CYKeywordEntry("native",       _native_,       Meta),               /*FII*/
+    CYKeywordEntry("new",          _new_,          Operator),           /*KKK*/
+    CYKeywordEntry("null",         _null_,         Constant),           /*LLL*/
+    CYKeywordEntry("package",      _package_,      Meta),               /*FSS*/
+    CYKeywordEntry("private",      _private_,      Meta),               /*FSS*/
+    CYKeywordEntry("protected",    _protected_,    Meta),               /*FSS*/
+    CYKeywordEntry("__proto__",    ___proto___,    Special),            /*III*/
+    CYKeywordEntry("prototype",    _prototype_,    Special),            /*III*/
+    CYKeywordEntry("public",       _public_,       Meta),               /*FSS*/
+    CYKeywordEntry("return",       _return_,       Control),            /*KKK*/
+    CYKeywordEntry("set",          _set_,          Meta),               /*III*/
+    CYKeywordEntry("short",        _short_,        Type),               /*FII*/
+    CYKeywordEntry("static",       _static_,       Meta),               /*FS?*/
+    CYKeywordEntry("super",        _super_,        Constant),           /*FFK*/
+    CYKeywordEntry("switch",       _switch_,       Control),            /*KKK*/
+    CYKeywordEntry("synchronized", _synchronized_, Meta),               /*FII*/
+    CYKeywordEntry("target",       _target_,       Identifier),         /*III*/
+    CYKeywordEntry("this",         _this_,         Constant),           /*KKK*/
+    CYKeywordEntry("throw",        _throw_,        Control),            /*KKK*/
+    CYKeywordEntry("throws",       _throws_,       Meta),               /*FII*/
+    CYKeywordEntry("transient",    _transient_,    Meta),               /*FII*/
+    CYKeywordEntry("true",         _true_,         Constant),           /*LLL*/
+    CYKeywordEntry("try",          _try_,          Control),            /*KKK*/
+    CYKeywordEntry("typeid",       _typeid_,       Operator),           /*III*/
+    CYKeywordEntry("typeof",       _typeof_,       Operator),           /*KKK*/
+    CYKeywordEntry("var",          _var_,          Meta),               /*KKK*/
+    CYKeywordEntry("void",         _void_,         Operator),           /*KKK*/
+    CYKeywordEntry("volatile",     _volatile_,     Meta),               /*FII*/
+    CYKeywordEntry("while",        _while_,        Control),            /*KKK*/
+    CYKeywordEntry("with",         _with_,         Control),            /*KKK*/
+    CYKeywordEntry("yield",        _yield_,        Control),            /*IS?*/
+    CYKeywordEntry("each",         _each_,         Control),
+    CYKeywordEntry("of",           _of_,           Operator),
+    CYKeywordEntry("extern",       _extern_,       Type),
+    CYKeywordEntry("signed",       _signed_,       Type),
+    CYKeywordEntry("struct",       _struct_,       Meta),
+    CYKeywordEntry("typedef",      _typedef_,      Meta),
+    CYKeywordEntry("unsigned",     _unsigned_,     Type),
+    CYKeywordEntry("NO",           _NO_,           Constant),
+    CYKeywordEntry("YES",          _YES_,          Constant)
+};
+
+#undef CYKeywordEntry
+
+static constexpr size_t CYKeywordCount(sizeof(CYKeywords) / sizeof(CYKeywords[0]));
+static constexpr unsigned CYKeywordBits(9);
+
+// multiplier found by search; the static_assert below rejects any edit to the
+// table that makes it collide, at which point a new one has to be found
+static constexpr uint32_t CYKeywordHash(const char *data, size_t size) {
+    return uint32_t((
+        uint32_t(uint8_t(data[0])) |
+        uint32_t(uint8_t(data[1])) << 8 |
+        uint32_t(uint8_t(data[size - 1])) << 16 |
+        uint32_t(size) << 24
+    ) * 0xd697fe01u) >> (32 - CYKeywordBits);
+}
+
+struct CYKeywordIndex {
+    // offset into CYKeywords plus one, so that zero is an empty slot
+    uint8_t slots_[1 << CYKeywordBits];
+    size_t shortest_;
+    size_t longest_;
+    bool perfect_;
+};
+
+static constexpr CYKeywordIndex CYKeywordIndexMake() {
+    CYKeywordIndex index{};
+    index.shortest_ = SIZE_MAX;
+    index.perfect_ = true;
+
+    for (size_t i(0); i != CYKeywordCount; ++i) {
+        const CYKeyword &keyword(CYKeywords[i]);
+        if (keyword.size_ < index.shortest_)
+            index.shortest_ = keyword.size_;
+        if (keyword.size_ > index.longest_)
+            index.longest_ = keyword.size_;
+
+        uint8_t &slot(index.slots_[CYKeywordHash(keyword.name_, keyword.size_)]);
+        if (slot != 0)
+            index.perfect_ = false;
+        slot = i + 1;
+    }
+
+    return index;
+}
+
+static constexpr CYKeywordIndex CYKeywordSlots(CYKeywordIndexMake());
+static_assert(CYKeywordSlots.perfect_, "keyword hash has collisions");
+static_assert(CYKeywordSlots.shortest_ >= 2, "keyword hash reads two characters");
+static_assert(CYKeywordCount < 256, "keyword slots are a byte wide");
+
+static _finline const CYKeyword *CYKeywordFind(const char *data, size_t size) {
+    if (size < CYKeywordSlots.shortest_ || size > CYKeywordSlots.longest_)
+        return NULL;
+    uint8_t slot(CYKeywordSlots.slots_[CYKeywordHash(data, size)]);
+    if (slot == 0)
+        return NULL;
+    const CYKeyword &keyword(CYKeywords[slot - 1]);
+    if (keyword.size_ != size || memcmp(keyword.name_, data, size) != 0)
+        return NULL;
+    return &keyword;
+}
+
+#endif/*CYCRIPT_KEYWORD_HPP*/
@@ -68,7 +68,8 @@ Type_ *&CYGetLast(Type_ *&list) {
 template <typename Type_>
 struct CYList {
     Type_ *first_;
-    Type_ *last_;
+    // typed as Type_ links: a list of values can end in another kind of element
+    decltype(Type_::next_) last_;
 
     CYList() :
         first_(NULL),
@@ -98,14 +99,18 @@ struct CYList {
 
     CYList &operator ->*(Type_ *next) {
         if (next != NULL) {
-            if (first_ == NULL) {
+            if (first_ == NULL)
                 first_ = next;
-                last_ = next;
-            } else {
+            else {
                 _assert(last_->next_ == NULL);
                 last_->next_ = next;
-                last_ = next;
             }
+
+            // next can be a list itself, and last_ has to be its end for the
+            // next append to be constant time
+            last_ = next;
+            while (last_->next_ != NULL)
+                last_ = last_->next_;
         }
         return *this;
     }
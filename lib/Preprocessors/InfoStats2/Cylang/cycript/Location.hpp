@@ -64,6 +64,34 @@ class CYLocation {
     }
 };
 
+// a CYLocation without its filenames, which are the same for a whole script
+class CYExtent {
+  public:
+    unsigned int line;
+    unsigned int column;
+    unsigned int end_line;
+    unsigned int end_column;
+
+    CYExtent(const CYLocation &location) :
+        line(location.begin.line),
+        column(location.begin.column),
+        end_line(location.end.line),
+        end_column(location.end.column)
+    {
+    }
+
+    CYLocation Location(std::string *filename) const {
+        CYLocation location;
+        location.begin.filename = filename;
+        location.begin.line = line;
+        location.begin.column = column;
+        location.end.filename = filename;
+        location.end.line = end_line;
+        location.end.column = end_column;
+        return location;
+    }
+};
+
 inline std::ostream &operator <<(std::ostream &out, const CYLocation &location) {
     const CYPosition &begin(location.begin);
     const CYPosition &end(location.end);
@@ -19,8 +19,6 @@
 **/
 /* }}} */
 
-#include <sstream>
-
 #include "Replace.hpp"
 
 #include "Syntax.hpp"
@@ -171,32 +169,134 @@ CYTarget *CYSelector::Replace(CYContext &context) {
     return $C1($V("sel_registerName"), parts_->Replace(context));
 }
 
-CYString *CYSelectorPart::Replace(CYContext &context) {
-    std::ostringstream str;
-    CYForEach (part, this) {
-        if (part->name_ != NULL)
-            str << part->name_->Word();
-        if (part->value_)
-            str << ':';
+// Selector strings are interned per compilation. A site hashes its parts in
+// place and only when the selector is new is the string built, once, straight
+// into the pool; the parts come either from a CYSelectorPart chain or from the
+// named arguments of a send.
+
+_finline bool CYSelectorIncludes(const CYSelectorPart *part) {
+    return true;
+}
+
+_finline const char *CYSelectorName(const CYSelectorPart *part) {
+    return part->name_ == NULL ? NULL : part->name_->Word();
+}
+
+_finline bool CYSelectorColon(const CYSelectorPart *part) {
+    return part->value_;
+}
+
+_finline bool CYSelectorIncludes(const CYArgument *argument) {
+    return argument->name_ != NULL;
+}
+
+_finline const char *CYSelectorName(const CYArgument *argument) {
+    return argument->name_->Word();
+}
+
+_finline bool CYSelectorColon(const CYArgument *argument) {
+    return argument->value_ != NULL;
+}
+
+template <typename Part_>
+static bool CYSelectorEquals(const Part_ *parts, const CYUTF8String &selector) {
+    const char *data(selector.data), *end(data + selector.size);
+    CYForEach (part, parts) {
+        if (!CYSelectorIncludes(part))
+            continue;
+        if (const char *name = CYSelectorName(part))
+            for (; *name != '\0'; ++name, ++data)
+                if (data == end || *data != *name)
+                    return false;
+        if (CYSelectorColon(part) && (data == end || *data++ != ':'))
+            return false;
     }
-    return $S($pool.strdup(str.str().c_str()));
+    return data == end;
+}
+
+template <typename Part_>
+static CYString *CYSelectorIntern(CYContext &context, const Part_ *parts) {
+    size_t hash(2166136261u), size(0);
+    CYForEach (part, parts) {
+        if (!CYSelectorIncludes(part))
+            continue;
+        if (const char *name = CYSelectorName(part))
+            for (; *name != '\0'; ++name, ++size)
+                hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+        if (CYSelectorColon(part)) {
+            hash = (hash ^ ':') * 16777619u;
+            ++size;
+        }
+    }
+
+    auto range(context.selectors_.equal_range(hash));
+    for (auto entry(range.first); entry != range.second; ++entry)
+        if (entry->second.size == size && CYSelectorEquals(parts, entry->second))
+            return $ CYString(entry->second.data, size);
+
+    char *data($pool.malloc<char>(size + 1, 1)), *end(data);
+    CYForEach (part, parts) {
+        if (!CYSelectorIncludes(part))
+            continue;
+        if (const char *name = CYSelectorName(part)) {
+            size_t length(strlen(name));
+            memcpy(end, name, length);
+            end += length;
+        }
+        if (CYSelectorColon(part))
+            *end++ = ':';
+    }
+    *end = '\0';
+
+    context.selectors_.insert(std::make_pair(hash, CYUTF8String(data, size)));
+    return $ CYString(data, size);
+}
+
+CYString *CYSelectorPart::Replace(CYContext &context) {
+    return CYSelectorIntern(context, this);
+}
+
+// Receivers the IS2 middleware can answer without going through
+// objc_msgSend; must match compatProviders in lib/Middleware/src/infostats2
+static const char *const CYDispatchReceivers[] = {
+    "IS2Calendar",
+    "IS2Location",
+    "IS2Media",
+    "IS2Notifications",
+    "IS2Pedometer",
+    "IS2System",
+    "IS2Telephony",
+    "IS2Weather",
+};
+
+// only the global of that name is the class: a parameter or local spelled the
+// same holds whatever it was given, and objc_msgSend has to look at it
+static bool CYDispatchReceiver(CYContext &context, CYExpression *self) {
+    CYVariable *variable(dynamic_cast<CYVariable *>(self));
+    if (variable == NULL)
+        return false;
+
+    const char *name(variable->name_->Word());
+    bool known(false);
+    for (size_t i(0); i != sizeof(CYDispatchReceivers) / sizeof(CYDispatchReceivers[0]); ++i)
+        if (strcmp(name, CYDispatchReceivers[i]) == 0)
+            known = true;
+    if (!known)
+        return false;
+
+    for (CYScope *scope(context.scope_); scope != NULL; scope = scope->parent_)
+        if (CYIdentifierFlags *flags = scope->Lookup(context, name))
+            if (flags->kind_ != CYIdentifierGlobal && flags->kind_ != CYIdentifierMagic)
+                return false;
+    return true;
 }
 
 CYTarget *CYSendDirect::Replace(CYContext &context) {
-    std::ostringstream name;
+    CYString *selector(CYSelectorIntern(context, arguments_));
     CYArgument **argument(&arguments_);
-    CYSelectorPart *selector(NULL), *current(NULL);
 
     while (*argument != NULL) {
-        if ((*argument)->name_ != NULL) {
-            CYSelectorPart *part($ CYSelectorPart((*argument)->name_, (*argument)->value_ != NULL));
-            if (selector == NULL)
-                selector = part;
-            if (current != NULL)
-                current->SetNext(part);
-            current = part;
-            (*argument)->name_ = NULL;
-        }
+        (*argument)->name_ = NULL;
 
         if ((*argument)->value_ == NULL)
             *argument = (*argument)->next_;
@@ -204,7 +304,23 @@ CYTarget *CYSendDirect::Replace(CYContext &context) {
             argument = &(*argument)->next_;
     }
 
-    return $C2($V("objc_msgSend"), self_, selector->Replace(context), arguments_);
+    // The selector is always a constant here, so a send to a known receiver is
+    // lowered to a call straight through the middleware's dispatch table:
+    // ((objc_msgSend_dispatch[receiver] || {}).selector || objc_msgSend_dispatch.missing)([arguments])
+    // a var or function hoisted from later in the scope can still rebind the
+    // receiver, hence the {} for one that isn't a provider
+    if (CYDispatchReceiver(context, self_)) {
+        CYList<CYElement> elements;
+        CYForEach (argument, arguments_)
+            elements->*$ CYElementValue(argument->value_);
+
+        CYExpression *table($ CYLogicalOr($M($V("objc_msgSend_dispatch"), self_), $ CYObject()));
+        CYExpression *method($M(table, selector));
+        CYExpression *missing($M($V("objc_msgSend_dispatch"), $S("missing")));
+        return $C1($ CYLogicalOr(method, missing), $ CYArray(elements));
+    }
+
+    return $C2($V("objc_msgSend"), self_, selector, arguments_);
 }
 
 CYTarget *CYSendSuper::Replace(CYContext &context) {
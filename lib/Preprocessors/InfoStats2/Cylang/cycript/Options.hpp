@@ -22,11 +22,35 @@
 #ifndef CYCRIPT_OPTIONS_HPP
 #define CYCRIPT_OPTIONS_HPP
 
+// the oldest JavaScript the output has to run on: syntax that level has is
+// left as it is, and everything else, Cycript's own included, is lowered
+enum CYLevel {
+    // lexical bindings, arrow functions, classes, templates, for-of and object
+    // literal methods and computed names are all rewritten, as cycript always has
+    CYLevelES5,
+    // those are kept, and let and const stay block scoped
+    CYLevelES2015,
+};
+
+// how for-of is lowered
+enum CYForOfLowering {
+    // for (item in list) plus a member read, as cycript always has, or left
+    // as it is where the level has for-of
+    CYForOfLoweringEnumerate,
+    // an indexed loop over list, or over a copy of it if it isn't an array,
+    // at every level
+    CYForOfLoweringIndexed,
+};
+
 struct CYOptions {
     bool verbose_;
+    CYLevel level_;
+    CYForOfLowering forOf_;
 
     CYOptions() :
-        verbose_(false)
+        verbose_(false),
+        level_(CYLevelES5),
+        forOf_(CYForOfLoweringEnumerate)
     {
     }
 };
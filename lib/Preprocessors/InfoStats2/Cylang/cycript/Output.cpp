@@ -20,7 +20,8 @@
 /* }}} */
 
 #include <cmath>
-#include <iomanip>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 
 #include "Syntax.hpp"
@@ -31,147 +32,240 @@ enum CYStringType {
     CYStringTypeTemplate,
 };
 
-void CYStringify(std::ostringstream &str, const char *data, size_t size, CYStringifyMode mode) {
-    if (size == 0) {
-        str << "\"\"";
-        return;
-    }
+// CYStringify works through literals eight bytes at a time: these find, in
+// each byte of a word, the ones that are zero or that have the high bit set,
+// exactly (without the carries of the cheaper tricks), so that they can be
+// counted as well as tested for.
+static const uint64_t CYStringifyOnes_(0x0101010101010101ull);
+static const uint64_t CYStringifyLows_(0x7f7f7f7f7f7f7f7full);
 
-    unsigned quot(0), apos(0), tick(0), line(0);
-    for (const char *value(data), *end(data + size); value != end; ++value)
-        switch (*value) {
-            case '"': ++quot; break;
-            case '\'': ++apos; break;
-            case '`': ++tick; break;
-            case '$': ++tick; break;
-            case '\n': ++line; break;
-        }
+static _finline uint64_t CYStringifyZeros(uint64_t word) {
+    return ~(((word & CYStringifyLows_) + CYStringifyLows_) | word | CYStringifyLows_);
+}
 
-    bool split;
-    if (mode != CYStringifyModeCycript)
-        split = false;
-    else {
-        double ratio(double(line) / size);
-        split = size > 10 && line > 2 && ratio > 0.005 && ratio < 0.10;
-    }
+static _finline uint64_t CYStringifyMatches(uint64_t word, uint8_t value) {
+    return CYStringifyZeros(word ^ CYStringifyOnes_ * value);
+}
 
-    CYStringType type;
-    if (mode == CYStringifyModeNative)
-        type = CYStringTypeDouble;
-    else if (split)
-        type = CYStringTypeTemplate;
-    else if (quot > apos)
-        type = CYStringTypeSingle;
-    else
-        type = CYStringTypeDouble;
+static _finline uint64_t CYStringifyLoad(const char *data) {
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+    return word;
+}
 
-    bool parens(split && mode != CYStringifyModeNative && type != CYStringTypeTemplate);
-    if (parens)
-        str << '(';
+// bytes that are copied through as they are: everything else (controls, DEL,
+// non-ASCII, the backslash and whatever closes or interpolates into this type
+// of literal) goes through the switch in CYStringify
+static _finline bool CYStringifyPlain(uint8_t next, CYStringType type) {
+    switch (next) {
+        case '\\': return false;
+        case '\'': return type != CYStringTypeSingle;
+        case '"': return type != CYStringTypeDouble;
+        case '`': case '$': return type != CYStringTypeTemplate;
+        default: return next >= 0x20 && next < 0x7f;
+    }
+}
 
-    char border;
+// sets the high bit of each byte of word that isn't plain in this type
+static _finline uint64_t CYStringifySpecials(uint64_t word, CYStringType type) {
+    uint64_t specials(word | CYStringifyMatches(word, 0x7f) | CYStringifyMatches(word, '\\'));
+    // bytes below 0x20 are the ones whose top three bits are clear
+    specials |= CYStringifyZeros(word & CYStringifyOnes_ * 0xe0);
     switch (type) {
-        case CYStringTypeSingle: border = '\''; break;
-        case CYStringTypeDouble: border = '"'; break;
-        case CYStringTypeTemplate: border = '`'; break;
+        case CYStringTypeSingle: specials |= CYStringifyMatches(word, '\''); break;
+        case CYStringTypeDouble: specials |= CYStringifyMatches(word, '"'); break;
+        case CYStringTypeTemplate: specials |= CYStringifyMatches(word, '`') | CYStringifyMatches(word, '$'); break;
     }
+    return specials & CYStringifyOnes_ * 0x80;
+}
+
+static void CYStringifyHex(std::string &str, const char *prefix, unsigned value, unsigned digits) {
+    static const char hex[] = "0123456789abcdef";
+    str += prefix;
+    while (digits < 8 && value >> digits * 4 != 0)
+        ++digits;
+    while (digits != 0)
+        str += hex[value >> --digits * 4 & 0xf];
+}
 
-    str << border;
+// the characters of a literal of this type, escaped, between its borders
+static void CYStringifyBody(std::string &str, const char *data, size_t size, CYStringType type, CYStringifyMode mode, bool split, char border) {
+    const char *end(data + size);
+    str.reserve(str.size() + size + 4);
 
     bool space(false);
 
-    for (const char *value(data), *end(data + size); value != end; ++value)
-        if (*value == ' ') {
-            space = true;
-            str << ' ';
-        } else { switch (uint8_t next = *value) {
-            case '\\': str << "\\\\"; break;
-            case '\b': str << "\\b"; break;
-            case '\f': str << "\\f"; break;
-            case '\r': str << "\\r"; break;
-            case '\t': str << "\\t"; break;
-            case '\v': str << "\\v"; break;
+    for (const char *value(data); value != end; ++value) {
+        // copy the run of bytes that need no escape in one go, skipping whole
+        // words of it and finishing off within the word that ends it
+        const char *run(value);
+        while (end - value >= 8 && CYStringifySpecials(CYStringifyLoad(value), type) == 0)
+            value += 8;
+        while (value != end && CYStringifyPlain(*value, type))
+            ++value;
+
+        if (value != run) {
+            str.append(run, value - run);
+            space = value[-1] == ' ';
+            if (value == end)
+                break;
+        }
+
+        switch (uint8_t next = *value) {
+            case '\\': str += "\\\\"; break;
+            case '\b': str += "\\b"; break;
+            case '\f': str += "\\f"; break;
+            case '\r': str += "\\r"; break;
+            case '\t': str += "\\t"; break;
+            case '\v': str += "\\v"; break;
 
             case '\a':
                 if (mode == CYStringifyModeNative)
-                    str << "\\a";
+                    str += "\\a";
                 else goto simple;
             break;
 
             case '\n':
                 if (!split)
-                    str << "\\n";
+                    str += "\\n";
                 /*else if (mode == CYStringifyModeNative)
                     str << border << "\\\n" << border;*/
-                else if (type != CYStringTypeTemplate)
-                    str << border << '+' << border;
-                else if (!space)
-                    str << '\n';
+                else if (type != CYStringTypeTemplate) {
+                    str += border;
+                    str += '+';
+                    str += border;
+                } else if (!space)
+                    str += '\n';
                 else
-                    str << "\\n\\\n";
+                    str += "\\n\\\n";
             break;
 
             case '$':
                 if (type == CYStringTypeTemplate)
-                    str << "\\$";
+                    str += "\\$";
                 else goto simple;
             break;
 
             case '`':
                 if (type == CYStringTypeTemplate)
-                    str << "\\`";
+                    str += "\\`";
                 else goto simple;
             break;
 
             case '"':
                 if (type == CYStringTypeDouble)
-                    str << "\\\"";
+                    str += "\\\"";
                 else goto simple;
             break;
 
             case '\'':
                 if (type == CYStringTypeSingle)
-                    str << "\\'";
+                    str += "\\'";
                 else goto simple;
             break;
 
             case '\0':
-                if (mode != CYStringifyModeNative && value[1] >= '0' && value[1] <= '9')
-                    str << "\\x00";
+                if (mode != CYStringifyModeNative && value + 1 != end && value[1] >= '0' && value[1] <= '9')
+                    str += "\\x00";
                 else
-                    str << "\\0";
+                    str += "\\0";
             break;
 
             default:
                 if (next >= 0x20 && next < 0x7f) simple:
-                    str << *value;
+                    str += *value;
                 else if (mode == CYStringifyModeNative)
-                    str << "\\x" << std::setbase(16) << std::setw(2) << std::setfill('0') << unsigned(*value & 0xff);
+                    CYStringifyHex(str, "\\x", next, 2);
                 else {
                     unsigned levels(1);
                     if ((next & 0x80) != 0)
                         while ((next & 0x80 >> ++levels) != 0);
 
+                    // a sequence cut off by the end of the literal is read as
+                    // if it were padded out with zeros
                     unsigned point(next & 0xff >> levels);
                     while (--levels != 0)
-                        point = point << 6 | uint8_t(*++value) & 0x3f;
+                        point = point << 6 | (value + 1 != end ? uint8_t(*++value) & 0x3f : 0);
 
                     if (point < 0x100)
-                        str << "\\x" << std::setbase(16) << std::setw(2) << std::setfill('0') << point;
+                        CYStringifyHex(str, "\\x", point, 2);
                     else if (point < 0x10000)
-                        str << "\\u" << std::setbase(16) << std::setw(4) << std::setfill('0') << point;
+                        CYStringifyHex(str, "\\u", point, 4);
                     else {
                         point -= 0x10000;
-                        str << "\\u" << std::setbase(16) << std::setw(4) << std::setfill('0') << (0xd800 | point >> 0x0a);
-                        str << "\\u" << std::setbase(16) << std::setw(4) << std::setfill('0') << (0xdc00 | point & 0x3ff);
+                        CYStringifyHex(str, "\\u", 0xd800 | point >> 0x0a, 4);
+                        CYStringifyHex(str, "\\u", 0xdc00 | (point & 0x3ff), 4);
                     }
                 }
-        } space = false; }
+        }
+
+        space = false;
+    }
+}
+
+void CYStringify(std::string &str, const char *data, size_t size, CYStringifyMode mode) {
+    if (size == 0) {
+        str += "\"\"";
+        return;
+    }
+
+    const char *end(data + size);
+
+    // only the quotes and, in Cycript mode, the newlines decide anything
+    unsigned quot(0), apos(0), line(0);
+    if (mode != CYStringifyModeNative) {
+        const char *value(data);
+        for (; end - value >= 8; value += 8) {
+            uint64_t word(CYStringifyLoad(value));
+            quot += __builtin_popcountll(CYStringifyMatches(word, '"'));
+            apos += __builtin_popcountll(CYStringifyMatches(word, '\''));
+            if (mode == CYStringifyModeCycript)
+                line += __builtin_popcountll(CYStringifyMatches(word, '\n'));
+        }
+
+        for (; value != end; ++value)
+            switch (*value) {
+                case '"': ++quot; break;
+                case '\'': ++apos; break;
+                case '\n': ++line; break;
+            }
+    }
+
+    bool split;
+    if (mode != CYStringifyModeCycript)
+        split = false;
+    else {
+        double ratio(double(line) / size);
+        split = size > 10 && line > 2 && ratio > 0.005 && ratio < 0.10;
+    }
+
+    CYStringType type;
+    if (mode == CYStringifyModeNative)
+        type = CYStringTypeDouble;
+    else if (split)
+        type = CYStringTypeTemplate;
+    else if (quot > apos)
+        type = CYStringTypeSingle;
+    else
+        type = CYStringTypeDouble;
+
+    bool parens(split && mode != CYStringifyModeNative && type != CYStringTypeTemplate);
+    if (parens)
+        str += '(';
 
-    str << border;
+    char border;
+    switch (type) {
+        case CYStringTypeSingle: border = '\''; break;
+        case CYStringTypeDouble: border = '"'; break;
+        case CYStringTypeTemplate: border = '`'; break;
+    }
+
+    str += border;
+    CYStringifyBody(str, data, size, type, mode, split, border);
+    str += border;
 
     if (parens)
-        str << ')';
+        str += ')';
 }
 
 void CYNumerify(std::ostringstream &str, double value) {
@@ -274,6 +368,24 @@ CYOutput &CYOutput::operator <<(const char *rhs) {
     return *this;
 }
 
+static void CYOutputWord(CYOutput &out, const CYWord *word, const char *name) {
+    out << name;
+    if (out.options_.verbose_) {
+        out('@');
+        char number[32];
+        sprintf(number, "%p", word);
+        out(number);
+    }
+}
+
+// two digits per division when spelling out a number
+static const char CYDigitPairs_[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
 void CYArgument::Output(CYOutput &out) const {
     if (name_ != NULL) {
         out << *name_;
@@ -386,18 +498,45 @@ void CYClassTail::Output(CYOutput &out) const {
     out << '{' << '\n';
     ++out.indent_;
 
+    if (constructor_ != NULL) {
+        out << '\t' << "constructor";
+        constructor_->CYFunction::Output(out);
+        out << '\n';
+    }
+
+    CYForEach (member, instance_) {
+        out << '\t';
+        member->Definition(out);
+        out << '\n';
+    }
+
+    CYForEach (member, static_) {
+        out << '\t' << "static" << ' ';
+        member->Definition(out);
+        out << '\n';
+    }
+
     --out.indent_;
-    out << '}';
+    out << '\t' << '}';
 }
 
 void CYCompound::Output(CYOutput &out, CYFlags flags) const {
-    if (next_ == NULL)
-        expression_->Output(out, flags);
-    else {
-        expression_->Output(out, CYLeft(flags));
+    const CYCompound *compound(this);
+    while (compound->next_ != NULL) {
+        compound->expression_->Output(out, CYLeft(flags));
         out << ',' << ' ';
-        next_->Output(out, CYRight(flags));
+        flags = CYRight(flags);
+
+        // following the chain here keeps long ones off the stack
+        const CYCompound *next(dynamic_cast<const CYCompound *>(compound->next_));
+        if (next == NULL) {
+            compound->next_->Output(out, flags);
+            return;
+        }
+        compound = next;
     }
+
+    compound->expression_->Output(out, flags);
 }
 
 void CYComputed::PropertyName(CYOutput &out) const {
@@ -443,7 +582,6 @@ void CYDebugger::Output(CYOutput &out, CYFlags flags) const {
 
 void CYBinding::Output(CYOutput &out, CYFlags flags) const {
     out << *identifier_;
-    //out.out_ << ':' << identifier_->usage_ << '#' << identifier_->offset_;
     if (initializer_ != NULL) {
         out << ' ' << '=' << ' ';
         initializer_->Output(out, CYAssign::Precedence_, CYRight(flags));
@@ -554,7 +692,11 @@ void CYExternalExpression::Output(CYOutput &out, CYFlags flags) const {
 }
 
 void CYFatArrow::Output(CYOutput &out, CYFlags flags) const {
-    out << '(' << parameters_ << ')' << ' ' << "=>" << ' ' << '{' << code_ << '}';
+    out << '(' << parameters_ << ')' << ' ' << "=>" << ' ' << '{' << '\n';
+    ++out.indent_;
+    out << code_;
+    --out.indent_;
+    out << '\t' << '}';
 }
 
 void CYFinally::Output(CYOutput &out) const {
@@ -752,7 +894,20 @@ void CYStatement::Output(CYOutput &out) const {
 }
 
 void CYTemplate::Output(CYOutput &out, CYFlags flags) const {
-    _assert(false);
+    std::string str("`");
+    CYStringifyBody(str, string_->value_, string_->size_, CYStringTypeTemplate, CYStringifyModeLegacy, false, '`');
+
+    CYForEach (span, spans_) {
+        str += "${";
+        out << str.c_str();
+        span->expression_->Output(out, CYNoFlags);
+
+        str = "}";
+        CYStringifyBody(str, span->string_->value_, span->string_->size_, CYStringTypeTemplate, CYStringifyModeLegacy, false, '`');
+    }
+
+    str += '`';
+    out << str.c_str();
 }
 
 void CYTypeArrayOf::Output(CYOutput &out, CYPropertyName *name) const {
@@ -861,7 +1016,7 @@ void CYTypeExpression::Output(CYOutput &out, CYFlags flags) const {
 }
 
 void CYLexical::Output(CYOutput &out, CYFlags flags) const {
-    out << "let" << ' ';
+    out << (constant_ ? "const" : "let") << ' ';
     bindings_->Output(out, flags); // XXX: flags
     out << ';';
 }
@@ -934,37 +1089,34 @@ void CYScript::Output(CYOutput &out) const {
 }
 
 void CYProperty::Output(CYOutput &out) const {
+    Definition(out);
     if (next_ != NULL || out.pretty_)
         out << ',';
     out << '\n' <<  next_;
 }
 
-void CYPropertyGetter::Output(CYOutput &out) const {
+void CYPropertyGetter::Definition(CYOutput &out) const {
     out << "get" << ' ';
     name_->PropertyName(out);
     CYFunction::Output(out);
-    CYProperty::Output(out);
 }
 
-void CYPropertyMethod::Output(CYOutput &out) const {
+void CYPropertyMethod::Definition(CYOutput &out) const {
     name_->PropertyName(out);
     CYFunction::Output(out);
-    CYProperty::Output(out);
 }
 
-void CYPropertySetter::Output(CYOutput &out) const {
+void CYPropertySetter::Definition(CYOutput &out) const {
     out << "set" << ' ';
     name_->PropertyName(out);
     CYFunction::Output(out);
-    CYProperty::Output(out);
 }
 
-void CYPropertyValue::Output(CYOutput &out) const {
+void CYPropertyValue::Definition(CYOutput &out) const {
     out << '\t';
     name_->PropertyName(out);
     out << ':' << ' ';
     value_->Output(out, CYAssign::Precedence_, CYNoFlags);
-    CYProperty::Output(out);
 }
 
 void CYRegEx::Output(CYOutput &out, CYFlags flags) const {
@@ -1049,9 +1201,9 @@ void CYStatement::Single(CYOutput &out, CYFlags flags, CYCompactType request) co
 #endif
 
 void CYString::Output(CYOutput &out, CYFlags flags) const {
-    std::ostringstream str;
+    std::string str;
     CYStringify(str, value_, size_, CYStringifyModeLegacy);
-    out << str.str().c_str();
+    out << str.c_str();
 }
 
 void CYString::PropertyName(CYOutput &out) const {
@@ -1268,6 +1420,43 @@ void CYTypeVoid::Output(CYOutput &out) const {
     out << "void";
 }
 
+char *CYUnique::Spell(char *end) const {
+    *--end = '\0';
+    unsigned value(index_);
+    for (; value >= 100; value /= 100) {
+        const char *pair(CYDigitPairs_ + value % 100 * 2);
+        *--end = pair[1];
+        *--end = pair[0];
+    }
+    if (value >= 10) {
+        const char *pair(CYDigitPairs_ + value * 2);
+        *--end = pair[1];
+        *--end = pair[0];
+    } else
+        *--end = '0' + value;
+    end -= 3;
+    memcpy(end, "$cy", 3);
+    return end;
+}
+
+const char *CYUnique::Word() const {
+    if (next_ != NULL && next_ != this)
+        return next_->Word();
+    if (name_[0] == '\0') {
+        char *end(name_ + sizeof(name_));
+        char *begin(Spell(end));
+        memmove(name_, begin, end - begin);
+    }
+    return name_;
+}
+
+void CYUnique::Output(CYOutput &out) const {
+    if (next_ != NULL && next_ != this)
+        return CYWord::Output(out);
+    char name[16];
+    CYOutputWord(out, this, Spell(name + sizeof(name)));
+}
+
 void CYVar::Output(CYOutput &out, CYFlags flags) const {
     out << "var" << ' ';
     bindings_->Output(out, flags); // XXX: flags
@@ -1289,13 +1478,7 @@ void CYWith::Output(CYOutput &out, CYFlags flags) const {
 }
 
 void CYWord::Output(CYOutput &out) const {
-    out << Word();
-    if (out.options_.verbose_) {
-        out('@');
-        char number[32];
-        sprintf(number, "%p", this);
-        out(number);
-    }
+    CYOutputWord(out, this, Word());
 }
 
 void CYWord::PropertyName(CYOutput &out) const {
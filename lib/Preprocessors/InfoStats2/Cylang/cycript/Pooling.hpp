@@ -53,6 +53,12 @@ class CYPool {
     size_t size_;
     size_t next_;
 
+    // only kept up to date when a block runs out, so they cost nothing on
+    // the way through malloc; see Used()
+    size_t blocks_;
+    size_t total_;
+    size_t waste_;
+
     struct Cleaner {
         Cleaner *next_;
         void (*code_)(void *);
@@ -74,11 +80,17 @@ class CYPool {
     CYPool(const CYPool &);
 
   public:
+    size_t objects_;
+
     CYPool(size_t next = 64) :
         data_(NULL),
         size_(0),
         next_(next),
-        cleaner_(NULL)
+        blocks_(0),
+        total_(0),
+        waste_(0),
+        cleaner_(NULL),
+        objects_(0)
     {
     }
 
@@ -100,8 +112,11 @@ class CYPool {
             size_t need(sizeof(Cleaner));
             CYAlign(need, alignment);
             need += size;
+            waste_ += size_;
             size_ = std::max<size_t>(next_, need);
             next_ *= 2;
+            ++blocks_;
+            total_ += size_;
             data_ = reinterpret_cast<uint8_t *>(::malloc(size_));
             atexit(free, data_);
             _assert(size <= size_);
@@ -208,6 +223,16 @@ class CYPool {
         return strmemdup(buffer, writ);
     }
 
+    // bytes handed out so far, alignment included, and the blocks they were
+    // carved from; objects_ counts what was made with new(pool)
+    size_t Used() const {
+        return total_ - waste_ - size_;
+    }
+
+    size_t Blocks() const {
+        return blocks_;
+    }
+
     void atexit(void (*code)(void *), void *data = NULL);
 
     template <typename Type_>
@@ -219,6 +244,7 @@ class CYPool {
 };
 
 _finline void *operator new(size_t size, CYPool &pool) {
+    ++pool.objects_;
     return pool.malloc<void>(size);
 }
 
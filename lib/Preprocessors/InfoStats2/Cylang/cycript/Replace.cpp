@@ -19,8 +19,10 @@
 **/
 /* }}} */
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
-#include <map>
+#include <utility>
 
 #include "Replace.hpp"
 #include "Syntax.hpp"
@@ -89,17 +91,23 @@ CYTarget *CYApply::AddArgument(CYContext &context, CYExpression *value) {
     return this;
 }
 
-CYArgument *CYArgument::Replace(CYContext &context) { $T(NULL)
-    context.Replace(value_);
-    next_ = next_->Replace(context);
-
-    if (value_ == NULL) {
-        if (next_ == NULL)
-            return NULL;
-        else
-            value_ = $U;
+CYArgument *CYArgument::Replace(CYContext &context) {
+    // arguments that replace to nothing are dropped from the end of the
+    // list and become undefined anywhere else
+    CYArgument *last(NULL);
+    CYForEach (argument, this) {
+        context.Replace(argument->value_);
+        if (argument->value_ != NULL)
+            last = argument;
     }
 
+    if (last == NULL)
+        return NULL;
+    last->next_ = NULL;
+
+    CYForEach (argument, this)
+        if (argument->value_ == NULL)
+            argument->value_ = $U;
     return this;
 }
 
@@ -185,6 +193,15 @@ void Catch::Replace(CYContext &context) { $T()
 } }
 
 CYTarget *CYClassExpression::Replace(CYContext &context) {
+    if (context.options_.level_ >= CYLevelES2015) {
+        CYScope scope(false, context);
+        if (name_ != NULL)
+            name_ = name_->Replace(context, CYIdentifierOther);
+        tail_->Replace(context);
+        scope.Close(context);
+        return this;
+    }
+
     CYBuilder builder;
 
     CYIdentifier *super(context.Unique());
@@ -220,10 +237,33 @@ CYTarget *CYClassExpression::Replace(CYContext &context) {
     ), tail_->extends_ ? tail_->extends_ : $V($I("Object")));
 }
 
+// each script on a page is compiled on its own but shares the page's global
+// scope, where two scripts both declaring a let or a class would collide, so
+// those are only kept below the top level
+static bool CYKeepLexical(CYContext &context) {
+    return context.options_.level_ >= CYLevelES2015 && context.scope_->parent_ != NULL;
+}
+
 CYStatement *CYClassStatement::Replace(CYContext &context) {
+    if (CYKeepLexical(context)) {
+        name_ = name_->Replace(context, CYIdentifierLexical);
+        tail_->Replace(context);
+        return this;
+    }
+
     return $ CYVar($B1($B(name_, $ CYClassExpression(name_, tail_))));
 }
 
+void CYClassTail::Replace(CYContext &context) {
+    context.Replace(extends_);
+    if (constructor_ != NULL)
+        constructor_->CYFunction::Replace(context);
+    CYForEach (member, instance_)
+        member->Replace(context);
+    CYForEach (member, static_)
+        member->Replace(context);
+}
+
 void CYClause::Replace(CYContext &context) { $T()
     context.Replace(value_);
     context.ReplaceAll(code_);
@@ -231,17 +271,34 @@ void CYClause::Replace(CYContext &context) { $T()
 }
 
 CYExpression *CYCompound::Replace(CYContext &context) {
-    context.Replace(expression_);
-    context.Replace(next_);
+    // a long var or comma expression is a long chain of these, so this walks
+    // it rather than recursing; each is only ever rearranged with its own
+    for (CYCompound *compound(this);;) {
+        // the parser nests a comma expression to the left, which the walk
+        // would recurse down, so it is turned to nest to the right first
+        while (CYCompound *left = dynamic_cast<CYCompound *>(compound->expression_)) {
+            compound->expression_ = left->expression_;
+            left->expression_ = left->next_;
+            left->next_ = compound->next_;
+            compound->next_ = left;
+        }
 
-    if (CYCompound *compound = dynamic_cast<CYCompound *>(expression_)) {
-        expression_ = compound->expression_;
-        compound->expression_ = compound->next_;
-        compound->next_ = next_;
-        next_ = compound;
-    }
+        context.Replace(compound->expression_);
+        CYCompound *next(dynamic_cast<CYCompound *>(compound->next_));
+        if (next == NULL)
+            context.Replace(compound->next_);
 
-    return this;
+        if (CYCompound *left = dynamic_cast<CYCompound *>(compound->expression_)) {
+            compound->expression_ = left->expression_;
+            left->expression_ = left->next_;
+            left->next_ = compound->next_;
+            compound->next_ = left;
+        }
+
+        if (next == NULL)
+            return this;
+        compound = next;
+    }
 }
 
 CYFunctionParameter *CYCompound::Parameter() const {
@@ -274,6 +331,13 @@ CYExpression *CYComputed::PropertyName(CYContext &context) {
     return expression_;
 }
 
+// properties that are kept as they were have their computed names replaced
+// along with them, rather than by way of a CYBuilder
+static void CYReplaceName(CYContext &context, CYPropertyName *name) {
+    if (CYComputed *computed = dynamic_cast<CYComputed *>(name))
+        context.Replace(computed->expression_);
+}
+
 CYExpression *CYCondition::Replace(CYContext &context) {
     context.Replace(test_);
     context.Replace(true_);
@@ -307,7 +371,7 @@ void CYContext::NonLocal(CYStatement *&statements) {
 }
 
 CYIdentifier *CYContext::Unique() {
-    return $ CYIdentifier($pool.strcat("$cy", $pool.itoa(unique_++), NULL));
+    return $ CYUnique(unique_++);
 }
 
 CYStatement *CYContinue::Replace(CYContext &context) {
@@ -333,16 +397,22 @@ CYAssignment *CYBinding::Replace(CYContext &context, CYIdentifierKind kind) {
     return value;
 }
 
-CYExpression *CYBindings::Replace(CYContext &context, CYIdentifierKind kind) { $T(NULL)
-    CYAssignment *assignment(binding_->Replace(context, kind));
-    CYExpression *compound(next_->Replace(context, kind));
+CYExpression *CYBindings::Replace(CYContext &context, CYIdentifierKind kind) {
+    // a, (b, c), built from the front so a long var doesn't recurse
+    CYExpression *compound(NULL);
+    CYExpression **last(&compound);
+
+    CYForEach (bindings, this)
+        if (CYAssignment *assignment = bindings->binding_->Replace(context, kind)) {
+            if (*last == NULL)
+                *last = assignment;
+            else {
+                CYCompound *next($ CYCompound(*last, assignment));
+                *last = next;
+                last = &next->next_;
+            }
+        }
 
-    if (assignment != NULL) {
-        if (compound == NULL)
-            compound = assignment;
-        else
-            compound = $ CYCompound(assignment, compound);
-    }
     return compound;
 }
 
@@ -430,6 +500,14 @@ CYString *CYFalse::String(CYContext &context) {
 }
 
 CYExpression *CYFatArrow::Replace(CYContext &context) {
+    if (context.options_.level_ >= CYLevelES2015) {
+        // this and arguments are the enclosing function's already
+        CYScope scope(false, context);
+        CYFunction::Replace(context);
+        scope.Close(context);
+        return this;
+    }
+
     CYFunctionExpression *function($ CYFunctionExpression(NULL, parameters_, code_));
     function->this_.SetNext(context.this_);
     return function;
@@ -469,8 +547,10 @@ CYStatement *CYForLexical::Initialize(CYContext &context, CYExpression *value) {
     return $ CYLexical(constant_, $B1($ CYBinding(binding_->identifier_, value)));
 }
 
-CYTarget *CYForLexical::Replace(CYContext &context) {
+CYForInInitializer *CYForLexical::Replace(CYContext &context) {
     _assert(binding_->Replace(context, CYIdentifierLexical) == NULL);
+    if (context.options_.level_ >= CYLevelES2015)
+        return this;
     return binding_->Target(context);
 }
 
@@ -498,7 +578,56 @@ CYStatement *CYForInComprehension::Replace(CYContext &context, CYStatement *stat
     return $ CYForIn(binding_->Target(context), iterable_, CYComprehension::Replace(context, statement));
 }
 
+// for-in enumerates an array's keys as strings, inherited enumerable ones
+// included, through JavaScriptCore's slow property enumeration; this instead
+// counts through list[index] up to a length read once, after one check that
+// sends anything else to be copied into an array first: through the iterator
+// protocol (by way of Array.from) if it has one, and otherwise by collecting
+// what the for-in lowering would have walked, so that plain objects and null
+// behave as they always have
+static CYStatement *CYForOfIndexed(CYContext &context, CYIdentifier *list, CYIdentifier *index, CYExpression *iterable, CYStatement *code) {
+    CYIdentifier *length(context.Unique()), *items(context.Unique()), *key(context.Unique());
+
+    CYExpression *iterator($ CYLogicalAnd($ CYLogicalAnd(
+        $ CYEqual($ CYTypeOf($V("Symbol")), $S("function")),
+        $ CYNotEqual($V(list), $ CYNull())),
+        $ CYEqual($ CYTypeOf($M($V(list), $M($V("Symbol"), $S("iterator")))), $S("function"))));
+
+    return $ CYBlock($$
+        ->* $ CYLexical(false, $B3($B(list, iterable), $B(items), $B(key)))
+        ->* $ CYIf($ CYLogicalNot($C1($M($V("Array"), $S("isArray")), $V(list))),
+            $ CYIf(iterator,
+                $E($ CYAssign($V(list), $C1($M($V("Array"), $S("from")), $V(list)))),
+                $ CYBlock($$
+                    ->* $E($ CYAssign($V(items), $ CYArray()))
+                    ->* $ CYForIn($V(key), $V(list), $E($C1($M($V(items), $S("push")), $M($V(list), $V(key)))))
+                    ->* $E($ CYAssign($V(list), $V(items))))))
+        ->* $ CYFor($ CYLexical(false, $B2($B(index, $D(0)), $B(length, $M($V(list), $S("length"))))),
+            $ CYLess($V(index), $V(length)), $ CYPreIncrement($V(index)), code));
+}
+
 CYStatement *CYForOf::Replace(CYContext &context) {
+    // an indexed loop was asked for, so it is used whatever the level
+    if (context.options_.forOf_ == CYForOfLoweringIndexed) {
+        CYIdentifier *list(context.Unique()), *index(context.Unique());
+
+        return $ CYBlock($$
+            ->* initializer_->Initialize(context, NULL)
+            ->* CYForOfIndexed(context, list, index, iterable_, $ CYBlock($$
+                ->* initializer_->Initialize(context, $M($V(list), $V(index)))
+                ->* code_
+        )));
+    }
+
+    if (context.options_.level_ >= CYLevelES2015) {
+        CYScope scope(true, context);
+        context.Replace(initializer_);
+        context.Replace(iterable_);
+        context.ReplaceAll(code_);
+        scope.Close(context);
+        return this;
+    }
+
     CYIdentifier *item(context.Unique()), *list(context.Unique());
 
     return $ CYBlock($$
@@ -515,6 +644,15 @@ CYFunctionParameter *CYForOfComprehension::Parameter(CYContext &context) const {
 }
 
 CYStatement *CYForOfComprehension::Replace(CYContext &context, CYStatement *statement) const {
+    if (context.options_.forOf_ == CYForOfLoweringIndexed) {
+        CYIdentifier *list(context.Unique()), *index(context.Unique());
+
+        return CYForOfIndexed(context, list, index, iterable_, $ CYBlock($$
+            ->* $E($ CYAssign(binding_->Target(context), $M($V(list), $V(index))))
+            ->* CYComprehension::Replace(context, statement)
+        ));
+    }
+
     CYIdentifier *cys(context.Unique());
 
     return $ CYBlock($$
@@ -535,7 +673,7 @@ CYStatement *CYForVariable::Initialize(CYContext &context, CYExpression *value)
     return $ CYVar($B1($ CYBinding(binding_->identifier_, value)));
 }
 
-CYTarget *CYForVariable::Replace(CYContext &context) {
+CYForInInitializer *CYForVariable::Replace(CYContext &context) {
     _assert(binding_->Replace(context, CYIdentifierVariable) == NULL);
     return binding_->Target(context);
 }
@@ -544,6 +682,22 @@ CYTarget *CYForVariable::Replace(CYContext &context) {
 #define MappingSet "0etnirsoalfucdphmgyvbxTwSNECAFjDLkMOIBPqzRH$_WXUVGYKQJZ"
 //#define MappingSet "0abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ$_"
 
+// the short names are counted out of MappingSet, which spells these on the
+// way; they have to be skipped, as they can't name a variable (sorted)
+static const char *const CYReservedWords_[] = {
+    "arguments", "await", "break", "case", "catch", "class", "const",
+    "continue", "debugger", "default", "delete", "do", "else", "enum", "eval",
+    "export", "extends", "false", "finally", "for", "function", "if",
+    "implements", "import", "in", "instanceof", "interface", "let", "new",
+    "null", "package", "private", "protected", "public", "return", "static",
+    "super", "switch", "this", "throw", "true", "try", "typeof", "var", "void",
+    "while", "with", "yield",
+};
+
+static bool CYReserved(const char *word) {
+    return std::binary_search(CYReservedWords_, CYReservedWords_ + sizeof(CYReservedWords_) / sizeof(CYReservedWords_[0]), word, CYCStringLess());
+}
+
 void CYFunction::Replace(CYContext &context) {
     CYThisScope *_this(context.this_);
     context.this_ = &this_;
@@ -670,7 +824,8 @@ CYStatement *CYImportDeclaration::Replace(CYContext &context) {
 }
 
 CYStatement *CYImportSpecifier::Replace(CYContext &context, CYIdentifier *module) {
-    binding_ = binding_->Replace(context, CYIdentifierLexical);
+    // these are assigned, not declared, so where let is kept they need a var
+    binding_ = binding_->Replace(context, context.options_.level_ >= CYLevelES2015 ? CYIdentifierVariable : CYIdentifierLexical);
 
     CYExpression *import($V(module));
     if (name_ != NULL)
@@ -702,6 +857,15 @@ CYTarget *CYLambda::Replace(CYContext &context) {
 }
 
 CYForInitializer *CYLexical::Replace(CYContext &context) {
+    if (CYKeepLexical(context)) {
+        CYForEach (bindings, bindings_) {
+            CYBinding *binding(bindings->binding_);
+            binding->identifier_ = binding->identifier_->Replace(context, CYIdentifierLexical);
+            context.Replace(binding->initializer_);
+        }
+        return this;
+    }
+
     if (CYExpression *expression = bindings_->Replace(context, CYIdentifierLexical))
         return $E(expression);
     return $ CYEmpty();
@@ -712,6 +876,7 @@ CYFunctionExpression *CYMethod::Constructor() {
 }
 
 void CYMethod::Replace(CYContext &context) {
+    CYReplaceName(context, name_);
     CYFunction::Replace(context);
 }
 
@@ -760,8 +925,61 @@ CYNumber *CYNumber::Number(CYContext &context) {
 }
 
 CYString *CYNumber::String(CYContext &context) {
-    // XXX: there is a precise algorithm for this
-    return $S($pool.sprintf(24, "%.17g", Value()));
+    // Number.prototype.toString: the fewest digits that read back as the same
+    // double, spelled out in full from 1e-6 up to 1e21 and in e notation beyond
+    double value(Value());
+    if (std::isnan(value))
+        return $S("NaN");
+    if (std::isinf(value))
+        return $S(value < 0 ? "-Infinity" : "Infinity");
+    if (value == 0)
+        return $S("0");
+
+    char scientific[32];
+    for (int precision(1); ; ++precision) {
+        sprintf(scientific, "%.*e", precision - 1, value);
+        if (precision == 17 || strtod(scientific, NULL) == value)
+            break;
+    }
+
+    char digits[20];
+    size_t count(0);
+    const char *mark(scientific);
+    bool negative(*mark == '-');
+    if (negative)
+        ++mark;
+    for (; *mark != 'e'; ++mark)
+        if (*mark != '.')
+            digits[count++] = *mark;
+    int point(atoi(mark + 1) + 1);
+    while (count > 1 && digits[count - 1] == '0')
+        --count;
+
+    std::string string;
+    if (negative)
+        string += '-';
+    if (point >= int(count) && point <= 21) {
+        string.append(digits, count);
+        string.append(point - count, '0');
+    } else if (point > 0 && point <= 21) {
+        string.append(digits, point);
+        string += '.';
+        string.append(digits + point, count - point);
+    } else if (point > -6 && point <= 0) {
+        string += "0.";
+        string.append(-point, '0');
+        string.append(digits, count);
+    } else {
+        string += digits[0];
+        if (count > 1) {
+            string += '.';
+            string.append(digits + 1, count - 1);
+        }
+        string += point > 0 ? "e+" : "e-";
+        string += std::to_string(point > 0 ? point - 1 : 1 - point);
+    }
+
+    return $S($pool.strmemdup(string.data(), string.size()), string.size());
 }
 
 CYExpression *CYNumber::PropertyName(CYContext &context) {
@@ -770,7 +988,8 @@ CYExpression *CYNumber::PropertyName(CYContext &context) {
 
 CYTarget *CYObject::Replace(CYContext &context, CYTarget *seed) {
     CYBuilder builder;
-    if (properties_ != NULL)
+    // ES2015 has methods and computed names of its own
+    if (properties_ != NULL && (seed != this || context.options_.level_ < CYLevelES2015))
         properties_ = properties_->ReplaceAll(context, builder, $ CYThis(), seed != this);
 
     if (builder) {
@@ -806,12 +1025,22 @@ CYExpression *CYPrefix::Replace(CYContext &context) {
 }
 
 CYProperty *CYProperty::ReplaceAll(CYContext &context, CYBuilder &builder, CYExpression *self, bool update) {
-    update |= Update();
-    if (update)
-        Replace(context, builder, self, false);
-    if (next_ != NULL)
-        next_ = next_->ReplaceAll(context, builder, self, update);
-    return update ? next_ : this;
+    // once one property has to be set on the object, all that follow it are
+    // too, so the literal keeps only those that come before
+    CYProperty *first(this);
+    CYProperty **link(&first);
+
+    for (CYProperty *property(this); property != NULL; property = property->next_) {
+        update |= property->Update();
+        if (!update)
+            link = &property->next_;
+        else {
+            property->Replace(context, builder, self, false);
+            *link = NULL;
+        }
+    }
+
+    return first;
 }
 
 void CYProperty::Replace(CYContext &context, CYBuilder &builder, CYExpression *self, bool protect) {
@@ -873,6 +1102,7 @@ void CYPropertyValue::Replace(CYContext &context, CYBuilder &builder, CYExpressi
 }
 
 void CYPropertyValue::Replace(CYContext &context) {
+    CYReplaceName(context, name_);
     context.Replace(value_);
 }
 
@@ -905,9 +1135,8 @@ void CYScript::Replace(CYContext &context) {
                 id[--position] = MappingSet[index];
             } while (local != 0);
 
-            if (scope.Lookup(context, id + position) != NULL)
+            if (CYReserved(id + position) || scope.Lookup(context, id + position) != NULL)
                 goto id;
-            // XXX: at some point, this could become a keyword
 
             name = $pool.strmemdup(id + position, 7 - position);
         }
@@ -954,7 +1183,9 @@ CYScope::CYScope(bool transparent, CYContext &context) :
     parent_(context.scope_),
     damaged_(false),
     shadow_(NULL),
-    internal_(NULL)
+    internal_(NULL),
+    size_(0),
+    index_(NULL)
 {
     _assert(!transparent_ || parent_ != NULL);
     context.scope_ = this;
@@ -966,23 +1197,105 @@ void CYScope::Damage() {
         parent_->Damage();
 }
 
+CYScope::~CYScope() {
+    delete index_;
+}
+
+static size_t CYScopeHash(const char *word) {
+    size_t hash(2166136261u);
+    for (; *word != '\0'; ++word)
+        hash = (hash ^ static_cast<uint8_t>(*word)) * 16777619u;
+    return hash;
+}
+
+// temporaries are spelled out on the stack to be compared or hashed, so that
+// only the ones that make it into the output ever keep a name; once renamed,
+// they are compared by the name they were given instead
+static CYUnique *CYScopeUnique(CYIdentifier *identifier) {
+    CYUnique *unique(identifier->Unique());
+    if (unique == NULL || (unique->next_ != NULL && unique->next_ != unique))
+        return NULL;
+    return unique;
+}
+
+static bool CYScopeSame(CYIdentifier *identifier, const char *word) {
+    CYUnique *unique(CYScopeUnique(identifier));
+    if (unique == NULL)
+        return strcmp(identifier->Word(), word) == 0;
+    if (word[0] != '$')
+        return false;
+    char name[16];
+    return strcmp(unique->Spell(name + sizeof(name)), word) == 0;
+}
+
+static size_t CYScopeHash(CYIdentifier *identifier) {
+    CYUnique *unique(CYScopeUnique(identifier));
+    if (unique == NULL)
+        return CYScopeHash(identifier->Word());
+    char name[16];
+    return CYScopeHash(unique->Spell(name + sizeof(name)));
+}
+
 CYIdentifierFlags *CYScope::Lookup(CYContext &context, const char *word) {
+    if (index_ != NULL) {
+        auto range(index_->equal_range(CYScopeHash(word)));
+        for (auto i(range.first); i != range.second; ++i)
+            if (CYScopeSame(i->second->identifier_, word))
+                return i->second;
+        return NULL;
+    }
+
     CYForEach (i, internal_)
-        if (strcmp(i->identifier_->Word(), word) == 0)
+        if (CYScopeSame(i->identifier_, word))
             return i;
     return NULL;
 }
 
 CYIdentifierFlags *CYScope::Lookup(CYContext &context, CYIdentifier *identifier) {
-    return Lookup(context, identifier->Word());
+    CYUnique *unique(CYScopeUnique(identifier));
+    if (unique == NULL)
+        return Lookup(context, identifier->Word());
+
+    // no two temporaries share a number, so this one can only be found as
+    // itself or as something else that happens to be spelled the same
+    char name[16];
+    const char *word(unique->Spell(name + sizeof(name)));
+
+    if (index_ != NULL) {
+        auto range(index_->equal_range(CYScopeHash(word)));
+        for (auto i(range.first); i != range.second; ++i) {
+            CYIdentifier *other(i->second->identifier_);
+            if (other == identifier || (CYScopeUnique(other) == NULL && strcmp(other->Word(), word) == 0))
+                return i->second;
+        }
+        return NULL;
+    }
+
+    CYForEach (i, internal_) {
+        CYIdentifier *other(i->identifier_);
+        if (other == identifier || (CYScopeUnique(other) == NULL && strcmp(other->Word(), word) == 0))
+            return i;
+    }
+    return NULL;
 }
 
 CYIdentifierFlags *CYScope::Declare(CYContext &context, CYIdentifier *identifier, CYIdentifierKind kind) {
     _assert(identifier->next_ == NULL || identifier->next_ == identifier);
 
     CYIdentifierFlags *existing(Lookup(context, identifier));
-    if (existing == NULL)
+    if (existing == NULL) {
         internal_ = $ CYIdentifierFlags(identifier, kind, internal_);
+
+        // a script of nothing but declarations would otherwise search the
+        // whole scope for every one of them
+        if (index_ != NULL)
+            index_->insert(std::make_pair(CYScopeHash(identifier), internal_));
+        else if (++size_ == 32) {
+            index_ = new std::unordered_multimap<size_t, CYIdentifierFlags *>();
+            CYForEach (i, internal_)
+                index_->insert(std::make_pair(CYScopeHash(i->identifier_), i));
+        }
+    }
     ++internal_->count_;
     if (existing == NULL)
         return internal_;
@@ -990,11 +1303,13 @@ CYIdentifierFlags *CYScope::Declare(CYContext &context, CYIdentifier *identifier
     if (kind == CYIdentifierGlobal);
     else if (existing->kind_ == CYIdentifierGlobal || existing->kind_ == CYIdentifierMagic)
         existing->kind_ = kind;
+    else if (existing->kind_ == CYIdentifierScoped && kind == CYIdentifierVariable)
+        // a var of the same name still has to be declared
+        existing->kind_ = kind;
     else if (existing->kind_ == CYIdentifierLexical || kind == CYIdentifierLexical)
-        _assert(false);
+        CYThrowAt(identifier->extent_, "duplicate declaration of %s", identifier->Word());
     else if (transparent_ && existing->kind_ == CYIdentifierArgument && kind == CYIdentifierVariable)
-        _assert(false);
-    // XXX: throw new SyntaxError() instead of these asserts
+        CYThrowAt(identifier->extent_, "duplicate declaration of %s", identifier->Word());
 
     return existing;
 }
@@ -1040,12 +1355,13 @@ void CYScope::Close(CYContext &context) {
                 i->identifier_ = replace;
             }
 
-            if (!transparent_)
-                i->kind_ = CYIdentifierVariable;
-            else
-                parent_->Declare(context, i->identifier_, CYIdentifierVariable);
-        } break;
+            // from here on it is named as a variable of the function would
+            // be, which it becomes unless let and const are being kept (see
+            // CYKeepLexical)
+            i->kind_ = context.options_.level_ >= CYLevelES2015 && parent_ != NULL ? CYIdentifierScoped : CYIdentifierVariable;
+        } // fall through
 
+        case CYIdentifierScoped:
         case CYIdentifierVariable: {
             if (transparent_) {
                 parent_->Declare(context, i->identifier_, i->kind_);
@@ -1057,24 +1373,49 @@ void CYScope::Close(CYContext &context) {
     if (damaged_)
         return;
 
-    typedef std::multimap<unsigned, CYIdentifier *> CYIdentifierOffsetMap;
-    CYIdentifierOffsetMap offsets;
+    std::vector<CYIdentifierFlags *> &offsets(context.offsets_);
+    offsets.clear();
+    unsigned high(0);
 
     CYForEach (i, internal_) {
         _assert(i->identifier_->next_ == i->identifier_);
     switch (i->kind_) {
         case CYIdentifierArgument:
+        case CYIdentifierScoped:
         case CYIdentifierVariable:
-            offsets.insert(CYIdentifierOffsetMap::value_type(i->offset_, i->identifier_));
+            offsets.push_back(i);
+            high |= i->offset_;
         break;
     default:; } }
 
+    size_t count(offsets.size());
+    CYIdentifierFlags **sorted(offsets.data());
+
+    // a stable radix sort by offset, a byte at a time and only through the
+    // bytes some offset uses; most scopes have every offset at zero
+    if (high != 0) {
+        offsets.resize(count * 2);
+        sorted = offsets.data();
+        CYIdentifierFlags **other(sorted + count);
+
+        for (unsigned shift(0); shift != 32 && (high >> shift) != 0; shift += 8) {
+            size_t starts[257] = {0};
+            for (size_t i(0); i != count; ++i)
+                ++starts[(sorted[i]->offset_ >> shift & 0xff) + 1];
+            for (unsigned digit(0); digit != 256; ++digit)
+                starts[digit + 1] += starts[digit];
+            for (size_t i(0); i != count; ++i)
+                other[starts[sorted[i]->offset_ >> shift & 0xff]++] = sorted[i];
+            std::swap(sorted, other);
+        }
+    }
+
     unsigned offset(0);
 
-    for (CYIdentifierOffsetMap::const_iterator i(offsets.begin()); i != offsets.end(); ++i) {
-        if (offset < i->first)
-            offset = i->first;
-        CYIdentifier *identifier(i->second);
+    for (size_t i(0); i != count; ++i) {
+        if (offset < sorted[i]->offset_)
+            offset = sorted[i]->offset_;
+        CYIdentifier *identifier(sorted[i]->identifier_);
 
         if (offset >= context.replace_.size())
             context.replace_.resize(offset + 1, NULL);
@@ -1105,10 +1446,6 @@ CYTarget *CYSubscriptMember::Replace(CYContext &context) {
     return $C1($M(object_, $S("$cyg")), property_);
 }
 
-CYElementValue *CYSpan::Replace(CYContext &context) { $T(NULL)
-    return $ CYElementValue(expression_, $ CYElementValue(string_, next_->Replace(context)));
-}
-
 CYStatement *CYStatement::Return() {
     return this;
 }
@@ -1167,10 +1504,20 @@ CYTarget *CYStructTail::Replace(CYContext &context) {
 }
 
 CYTarget *CYSuperAccess::Replace(CYContext &context) {
+    if (context.options_.level_ >= CYLevelES2015) {
+        context.Replace(property_);
+        return this;
+    }
+
     return $C1($M($M($M($V(context.super_), $S("prototype")), property_), $S("bind")), $ CYThis());
 }
 
 CYTarget *CYSuperCall::Replace(CYContext &context) {
+    if (context.options_.level_ >= CYLevelES2015) {
+        arguments_->Replace(context);
+        return this;
+    }
+
     return $C($C1($M($V(context.super_), $S("bind")), $ CYThis()), arguments_);
 }
 
@@ -1190,19 +1537,138 @@ CYStatement *CYTarget::Initialize(CYContext &context, CYExpression *value) {
     return $E($ CYAssign(this, value));
 }
 
+// whether + on a string turns value into what String() would, as it does any
+// primitive: objects go through valueOf rather than toString
+static bool CYIsPrimitive(CYExpression *value) {
+    if (dynamic_cast<CYPostfix *>(value) != NULL)
+        return true;
+    if (CYPrefix *prefix = dynamic_cast<CYPrefix *>(value))
+        return dynamic_cast<CYAddressOf *>(prefix) == NULL;
+    if (CYInfix *infix = dynamic_cast<CYInfix *>(value)) {
+        const char *op(infix->Operator());
+        return strcmp(op, "+") != 0 && strcmp(op, "&&") != 0 && strcmp(op, "||") != 0;
+    }
+    return false;
+}
+
+// the literal that Replace would fold value to, worked out without replacing
+// it: the + chain built from a substitution is replaced again as a whole, and
+// replacing a function or a class twice declares its names twice
+static CYExpression *CYFolded(CYContext &context, CYExpression *value) {
+    if (CYParenthetical *parenthetical = dynamic_cast<CYParenthetical *>(value))
+        return CYFolded(context, parenthetical->expression_);
+
+    if (CYNegate *negate = dynamic_cast<CYNegate *>(value)) {
+        CYExpression *rhs(CYFolded(context, negate->rhs_));
+        if (rhs != NULL)
+            if (CYNumber *number = rhs->Number(context))
+                return $D(-number->Value());
+        return NULL;
+    }
+
+    if (CYInfix *infix = dynamic_cast<CYInfix *>(value)) {
+        bool add(dynamic_cast<CYAdd *>(infix) != NULL);
+        if (!add && dynamic_cast<CYMultiply *>(infix) == NULL)
+            return NULL;
+
+        CYExpression *lhs(CYFolded(context, infix->lhs_));
+        CYExpression *rhs(lhs == NULL ? NULL : CYFolded(context, infix->rhs_));
+        if (rhs == NULL)
+            return NULL;
+
+        // as CYAdd::Replace and CYMultiply::Replace
+        if (add && (dynamic_cast<CYString *>(lhs) != NULL || dynamic_cast<CYString *>(rhs) != NULL))
+            return lhs->String(context)->Concat(context, rhs->String(context));
+        if (CYNumber *lhn = lhs->Number(context))
+            if (CYNumber *rhn = rhs->Number(context))
+                return $D(add ? lhn->Value() + rhn->Value() : lhn->Value() * rhn->Value());
+        return NULL;
+    }
+
+    // a constant template is only ever a string
+    if (dynamic_cast<CYTemplate *>(value) != NULL)
+        return value->String(context);
+    return value->String(context) == NULL ? NULL : value;
+}
+
 CYTarget *CYTemplate::Replace(CYContext &context) {
-    return $C2($M($M($M($V("String"), $S("prototype")), $S("concat")), $S("apply")), $S(""), $ CYArray($ CYElementValue(string_, spans_->Replace(context))));
+    if (context.options_.level_ >= CYLevelES2015) {
+        CYForEach (span, spans_)
+            context.Replace(span->expression_);
+        return this;
+    }
+
+    // constant substitutions are folded into the strings around them, and the
+    // rest is joined up with +, which needs no array or call to concat.apply
+    CYString *string(string_);
+    CYExpression *value(NULL);
+    bool typed(false);
+
+    for (CYSpan *span(spans_); span != NULL; span = span->next_) {
+        CYExpression *folded(CYFolded(context, span->expression_));
+        if (folded != NULL) {
+            string = string->Concat(context, folded->String(context))->Concat(context, span->string_);
+            continue;
+        }
+
+        if (string->size_ == 0);
+        else if (value == NULL) {
+            value = string;
+            typed = true;
+        } else {
+            value = $ CYAdd(value, string);
+            typed = true;
+        }
+
+        CYExpression *substitution(span->expression_);
+        bool stringy(dynamic_cast<CYTemplate *>(substitution) != NULL || dynamic_cast<CYTypeOf *>(substitution) != NULL);
+        if (!stringy && !CYIsPrimitive(substitution)) {
+            substitution = $C1($V("String"), substitution);
+            stringy = true;
+        }
+
+        if (value == NULL) {
+            value = substitution;
+            typed = stringy;
+        } else {
+            // two numbers in a row would otherwise be added
+            if (!typed)
+                value = $C1($V("String"), value);
+            value = $ CYAdd(value, substitution);
+            typed = true;
+        }
+
+        string = span->string_;
+    }
+
+    if (value == NULL)
+        return string;
+
+    if (string->size_ != 0)
+        value = $ CYAdd(value, string);
+    else if (!typed)
+        value = $C1($V("String"), value);
+
+    if (CYTarget *target = dynamic_cast<CYTarget *>(value))
+        return target;
+    return $ CYParenthetical(value);
 }
 
 CYString *CYTemplate::String(CYContext &context) {
-    // XXX: implement this over local concat
-    if (spans_ != NULL)
-        return NULL;
-    return string_;
+    CYString *string(string_);
+    for (CYSpan *span(spans_); span != NULL; span = span->next_) {
+        CYExpression *folded(CYFolded(context, span->expression_));
+        if (folded == NULL)
+            return NULL;
+        string = string->Concat(context, folded->String(context))->Concat(context, span->string_);
+    }
+    return string;
 }
 
 CYTarget *CYThis::Replace(CYContext &context) {
-    if (context.this_ != NULL)
+    // arrow functions see the this around them themselves, and a derived
+    // constructor can't read this before it has called super()
+    if (context.this_ != NULL && context.options_.level_ < CYLevelES2015)
         return $V(context.this_->Identifier(context));
     return this;
 }
@@ -27,6 +27,7 @@
 
 #include <streambuf>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "List.hpp"
@@ -53,7 +54,7 @@ enum CYStringifyMode {
     CYStringifyModeNative,
 };
 
-void CYStringify(std::ostringstream &str, const char *data, size_t size, CYStringifyMode mode);
+void CYStringify(std::string &str, const char *data, size_t size, CYStringifyMode mode);
 
 // XXX: this really should not be here ... :/
 void *CYPoolFile(CYPool &pool, const char *path, size_t *psize);
@@ -276,6 +277,9 @@ enum CYIdentifierKind {
     CYIdentifierLexical,
     CYIdentifierMagic,
     CYIdentifierOther,
+    // a lexical binding left as let or const: named like a variable, but
+    // declared where it is rather than by a var at the top of the function
+    CYIdentifierScoped,
     CYIdentifierVariable,
 };
 
@@ -283,14 +287,12 @@ struct CYIdentifier :
     CYNext<CYIdentifier>,
     CYWord
 {
-    CYLocation location_;
-    size_t offset_;
-    size_t usage_;
+    // in CYDriver::extents_
+    unsigned extent_;
 
     CYIdentifier(const char *word) :
         CYWord(word),
-        offset_(0),
-        usage_(0)
+        extent_(0)
     {
     }
 
@@ -300,8 +302,40 @@ struct CYIdentifier :
 
     virtual const char *Word() const;
     CYIdentifier *Replace(CYContext &context, CYIdentifierKind);
+
+    _finline struct CYUnique *Unique();
+};
+
+// a temporary from CYContext::Unique(), kept as its number: the "$cy" name
+// is only spelled out if it survives to be printed or someone asks for it
+struct CYUnique :
+    CYIdentifier
+{
+    unsigned index_;
+    mutable char name_[16];
+
+    CYUnique(unsigned index) :
+        CYIdentifier(NULL),
+        index_(index)
+    {
+        name_[0] = '\0';
+    }
+
+    // writes the name, terminated, so that it ends just before end
+    char *Spell(char *end) const;
+
+    virtual bool Constructor() const {
+        return false;
+    }
+
+    virtual const char *Word() const;
+    virtual void Output(CYOutput &out) const;
 };
 
+CYUnique *CYIdentifier::Unique() {
+    return word_ == NULL ? static_cast<CYUnique *>(this) : NULL;
+}
+
 struct CYLabel :
     CYStatement
 {
@@ -361,8 +395,12 @@ struct CYScope {
     CYIdentifierFlags *shadow_;
 
     CYIdentifierFlags *internal_;
+    // internal_ by hash of its names, once there are enough to want it
+    unsigned size_;
+    std::unordered_multimap<size_t, CYIdentifierFlags *> *index_;
 
     CYScope(bool transparent, CYContext &context);
+    ~CYScope();
 
     CYIdentifierFlags *Lookup(CYContext &context, const char *word);
     CYIdentifierFlags *Lookup(CYContext &context, CYIdentifier *identifier);
@@ -404,6 +442,13 @@ struct CYContext {
     unsigned unique_;
 
     std::vector<CYIdentifier *> replace_;
+    // scratch space for CYScope::Close to order a scope's names by offset in,
+    // kept here so closing a scope doesn't allocate
+    std::vector<CYIdentifierFlags *> offsets_;
+
+    // Selector strings already built for this compilation, by hash of their
+    // parts (see ObjectiveC/Replace.cpp)
+    std::unordered_multimap<size_t, CYUTF8String> selectors_;
 
     CYContext(CYOptions &options) :
         options_(options),
@@ -416,18 +461,20 @@ struct CYContext {
     {
     }
 
+    // a loop rather than recursion: a long script would run out of stack
     void ReplaceAll(CYStatement *&statement) {
-        if (statement == NULL)
-            return;
-        CYStatement *next(statement->next_);
-
-        Replace(statement);
-        ReplaceAll(next);
-
-        if (statement == NULL)
-            statement = next;
-        else
-            statement->SetNext(next);
+        CYStatement **link(&statement);
+        while (*link != NULL) {
+            CYStatement *next((*link)->next_);
+            Replace(*link);
+
+            if (*link == NULL)
+                *link = next;
+            else {
+                (*link)->SetNext(next);
+                link = &(*link)->next_;
+            }
+        }
     }
 
     template <typename Type_>
@@ -505,7 +552,7 @@ struct CYVar;
 struct CYForInInitializer {
     virtual CYStatement *Initialize(CYContext &context, CYExpression *value) = 0;
 
-    virtual CYTarget *Replace(CYContext &context) = 0;
+    virtual CYForInInitializer *Replace(CYContext &context) = 0;
     virtual void Output(CYOutput &out, CYFlags flags) const = 0;
 };
 
@@ -727,7 +774,13 @@ struct CYArrayComprehension :
 struct CYLiteral :
     CYTarget
 {
-    CYLocation location_;
+    // in CYDriver::extents_
+    unsigned extent_;
+
+    CYLiteral() :
+        extent_(0)
+    {
+    }
 
     CYPrecedence(0)
 
@@ -820,8 +873,6 @@ struct CYString :
     virtual void PropertyName(CYOutput &out) const;
 };
 
-struct CYElementValue;
-
 struct CYSpan :
     CYNext<CYSpan>
 {
@@ -834,8 +885,6 @@ struct CYSpan :
         string_(string)
     {
     }
-
-    CYElementValue *Replace(CYContext &context);
 };
 
 struct CYTemplate :
@@ -1235,7 +1284,7 @@ struct CYForLexical :
 
     virtual CYStatement *Initialize(CYContext &context, CYExpression *value);
 
-    virtual CYTarget *Replace(CYContext &context);
+    virtual CYForInInitializer *Replace(CYContext &context);
     virtual void Output(CYOutput &out, CYFlags flags) const;
 };
 
@@ -1251,7 +1300,7 @@ struct CYForVariable :
 
     virtual CYStatement *Initialize(CYContext &context, CYExpression *value);
 
-    virtual CYTarget *Replace(CYContext &context);
+    virtual CYForInInitializer *Replace(CYContext &context);
     virtual void Output(CYOutput &out, CYFlags flags) const;
 };
 
@@ -1340,6 +1389,8 @@ struct CYProperty :
 
     virtual void Replace(CYContext &context) = 0;
     virtual void Output(CYOutput &out) const;
+    // the property without the comma that separates it from the next one
+    virtual void Definition(CYOutput &out) const = 0;
 };
 
 struct CYPropertyValue :
@@ -1355,7 +1406,7 @@ struct CYPropertyValue :
 
     virtual void Replace(CYContext &context, CYBuilder &builder, CYExpression *self, CYExpression *name, bool protect);
     virtual void Replace(CYContext &context);
-    virtual void Output(CYOutput &out) const;
+    virtual void Definition(CYOutput &out) const;
 };
 
 struct CYFor :
@@ -1774,7 +1825,7 @@ struct CYFatArrow :
     {
     }
 
-    CYPrecedence(0)
+    CYPrecedence(16)
 
     CYExpression *Replace(CYContext &context) override;
     virtual void Output(CYOutput &out, CYFlags flags) const;
@@ -1840,7 +1891,7 @@ struct CYPropertyGetter :
     }
 
     virtual void Replace(CYContext &context, CYBuilder &builder, CYExpression *self, CYExpression *name, bool protect);
-    virtual void Output(CYOutput &out) const;
+    virtual void Definition(CYOutput &out) const;
 };
 
 struct CYPropertySetter :
@@ -1852,7 +1903,7 @@ struct CYPropertySetter :
     }
 
     virtual void Replace(CYContext &context, CYBuilder &builder, CYExpression *self, CYExpression *name, bool protect);
-    virtual void Output(CYOutput &out) const;
+    virtual void Definition(CYOutput &out) const;
 };
 
 struct CYPropertyMethod :
@@ -1868,7 +1919,7 @@ struct CYPropertyMethod :
     virtual CYFunctionExpression *Constructor();
 
     virtual void Replace(CYContext &context, CYBuilder &builder, CYExpression *self, CYExpression *name, bool protect);
-    virtual void Output(CYOutput &out) const;
+    virtual void Definition(CYOutput &out) const;
 };
 
 struct CYClassTail :
@@ -1886,6 +1937,7 @@ struct CYClassTail :
     {
     }
 
+    void Replace(CYContext &context);
     void Output(CYOutput &out) const;
 };
 
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# Cycript - The Truly Universal Scripting Language
+# Copyright (C) 2009-2016  Jay Freeman (saurik)
+
+# GNU Affero General Public License, Version 3 {{{
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Affero General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Affero General Public License for more details.
+#
+# You should have received a copy of the GNU Affero General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+# }}}
+
+# generates IdentifierStart.h and IdentifierContinue.h from the Unicode
+# character database:
+#
+#   ./unicode.py DerivedCoreProperties.txt ID_Start IsIdentifierStart 0024 005F 200C..200D >IdentifierStart.h
+#   ./unicode.py DerivedCoreProperties.txt ID_Continue IsIdentifierContinue 0024 200C..200D >IdentifierContinue.h
+#
+# the trailing arguments are code points JavaScript adds to the property
+#
+# the lookup is a two-level table: the top bits of a code point pick one of
+# the distinct 256-bit blocks, which the low eight bits index; ASCII doesn't
+# touch the tables at all, and everything past the last block is false
+
+import re
+import sys
+
+Block = 256
+Word = 64
+
+def parse(text):
+    if '..' in text:
+        begin, end = text.split('..')
+    else:
+        begin = end = text
+    return int(begin, 16), int(end, 16)
+
+def main(argv):
+    path, property, function = argv[1:4]
+
+    points = set()
+    def add(text):
+        begin, end = parse(text)
+        points.update(range(begin, end + 1))
+
+    pattern = re.compile(r'^([0-9A-F.]+)\s*;\s*(\w+)')
+    with open(path) as data:
+        for line in data:
+            match = pattern.match(line)
+            if match != None and match.group(2) == property:
+                add(match.group(1))
+
+    for text in argv[4:]:
+        add(text)
+
+    limit = (max(points) // Block + 1) * Block
+
+    blocks = []
+    indices = {}
+    stage1 = []
+    for base in range(0, limit, Block):
+        words = []
+        for word in range(base, base + Block, Word):
+            bits = 0
+            for bit in range(Word):
+                if word + bit in points:
+                    bits |= 1 << bit
+            words.append(bits)
+        words = tuple(words)
+        if words not in indices:
+            indices[words] = len(blocks)
+            blocks.append(words)
+        stage1.append(indices[words])
+
+    index = 'uint8_t' if len(blocks) <= 0x100 else 'uint16_t'
+    ascii = blocks[stage1[0]][:2]
+    name = function[2:]
+
+    out = sys.stdout
+    out.write('/* generated by unicode.py from %s (%s); do not edit */\n\n' % (path.split('/')[-1], property))
+    out.write('#include <stdint.h>\n\n')
+
+    out.write('static const %s %sIndex_[0x%X] = {' % (index, name, len(stage1)))
+    for i, value in enumerate(stage1):
+        out.write(('\n    ' if i % 16 == 0 else ' ') + '%d,' % value)
+    out.write('\n};\n\n')
+
+    out.write('static const uint64_t %sBlocks_[%d][%d] = {\n' % (name, len(blocks), Block // Word))
+    for words in blocks:
+        out.write('    {%s},\n' % ', '.join('0x%016XULL' % word for word in words))
+    out.write('};\n\n')
+
+    out.write('bool %s(unsigned v) {\n' % function)
+    out.write('    if (v < 0x80)\n')
+    out.write('        return ((v < 0x40 ? 0x%016XULL : 0x%016XULL) >> (v & 0x3f)) & 1;\n' % ascii)
+    out.write('    if (v >= 0x%X)\n' % limit)
+    out.write('        return false;\n')
+    out.write('    const uint64_t *block(%sBlocks_[%sIndex_[v >> 8]]);\n' % (name, name))
+    out.write('    return (block[(v >> 6) & 3] >> (v & 0x3f)) & 1;\n')
+    out.write('}\n')
+
+if __name__ == '__main__':
+    main(sys.argv)
@@ -0,0 +1,532 @@
+//
+//  cylangc.cpp
+//  libwidgetinfo
+//
+//  Command line driver for the Cylang compiler, built by CMakeLists.txt so
+//  the compiler can be run and profiled away from the device. It compiles
+//  files, or every matching file under a directory, through Compile(); each
+//  one can be compiled repeatedly to time it, inputs are spread over several
+//  threads, and the results come out as compiled code, a text report or JSON.
+//  With --check it runs Validate() instead, as a linter.
+//
+
+#include "Compile.hpp"
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+enum Phase {
+    kPhaseScan,
+    kPhaseParse,
+    kPhaseReplace,
+    kPhaseOutput,
+    // Wall time around the whole Compile() call
+    kPhaseTotal,
+    kPhaseCount,
+};
+
+const char *const kPhaseNames[kPhaseCount] = {"scan", "parse", "replace", "output", "total"};
+
+struct Options {
+    unsigned iterations;
+    unsigned threads;
+    std::vector<std::string> extensions;
+    bool json;
+    bool histograms;
+    bool pretty;
+    bool strict;
+    bool quiet;
+    bool check;
+    CompileTarget target;
+};
+
+// One phase over every iteration of a file, in nanoseconds
+struct Summary {
+    uint64_t min;
+    uint64_t median;
+    uint64_t mean;
+    uint64_t max;
+};
+
+struct Result {
+    std::string path;
+    bool read;
+    size_t size;
+
+    // Or, with --check, validated
+    bool compiled;
+    std::string output;
+    // From Validate(), for the scripts that fail
+    std::vector<CompileError> errors;
+
+    // From the last iteration; everything but the times is the same each time
+    CompileStats stats;
+    unsigned iterations;
+    Summary times[kPhaseCount];
+};
+
+void Usage(FILE *file) {
+    fprintf(file,
+        "usage: cylangc [options] <file|directory>...\n"
+        "\n"
+        "  -n <count>     compile each input <count> times and report timings\n"
+        "  -j <threads>   compile inputs on this many threads (default: one per\n"
+        "                 core; use -j 1 for steadier timings)\n"
+        "  -x <ext>       pick up files with this extension in directories\n"
+        "                 (default: cy; may be repeated)\n"
+        "  --json         print a JSON report instead of compiled code\n"
+        "  --histograms   add the process-wide Compile() histograms to the JSON\n"
+        "  --pretty       pretty-print compiled code\n"
+        "  --strict       parse in strict mode\n"
+        "  --target <es>  the JavaScript to compile down to: es5 (default) or\n"
+        "                 es2015\n"
+        "  -q             compile without printing the result\n"
+        "  --check        only validate inputs, as Validate() does, and report\n"
+        "                 how many files a second that got through\n"
+        "\n"
+        "With a single compile per input the compiled code is printed; with -n it\n"
+        "is replaced by a table of median times, in milliseconds.\n");
+}
+
+bool ParseCount(const char *text, unsigned &value) {
+    char *end;
+    unsigned long parsed(strtoul(text, &end, 10));
+    if (*text == '\0' || *end != '\0' || parsed == 0 || parsed > 1000000)
+        return false;
+    value = static_cast<unsigned>(parsed);
+    return true;
+}
+
+bool HasExtension(const std::string &name, const std::vector<std::string> &extensions) {
+    size_t dot(name.rfind('.'));
+    if (dot == std::string::npos)
+        return false;
+    return std::find(extensions.begin(), extensions.end(), name.substr(dot + 1)) != extensions.end();
+}
+
+// Files named on the command line are always compiled; inside directories
+// only those with a matching extension are, in name order so that reports
+// line up between runs
+bool Collect(const std::string &path, const Options &options, std::vector<std::string> &files, bool named) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+        fprintf(stderr, "cylangc: %s: %s\n", path.c_str(), strerror(errno));
+        return false;
+    }
+
+    if (!S_ISDIR(info.st_mode)) {
+        if (named || (S_ISREG(info.st_mode) && HasExtension(path, options.extensions)))
+            files.push_back(path);
+        return true;
+    }
+
+    DIR *directory(opendir(path.c_str()));
+    if (directory == NULL) {
+        fprintf(stderr, "cylangc: %s: %s\n", path.c_str(), strerror(errno));
+        return false;
+    }
+
+    std::vector<std::string> names;
+    while (struct dirent *entry = readdir(directory))
+        if (entry->d_name[0] != '.')
+            names.push_back(entry->d_name);
+    closedir(directory);
+
+    std::sort(names.begin(), names.end());
+
+    bool okay(true);
+    std::string prefix(path[path.size() - 1] == '/' ? path : path + "/");
+    for (const std::string &name : names)
+        okay = Collect(prefix + name, options, files, false) && okay;
+    return okay;
+}
+
+uint64_t Nanoseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+Summary Summarize(std::vector<uint64_t> &values) {
+    Summary summary;
+    if (values.empty()) {
+        memset(&summary, 0, sizeof(summary));
+        return summary;
+    }
+
+    std::sort(values.begin(), values.end());
+
+    size_t count(values.size());
+    summary.min = values[0];
+    summary.max = values[count - 1];
+    summary.median = count % 2 != 0 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2;
+
+    uint64_t sum(0);
+    for (uint64_t value : values)
+        sum += value;
+    summary.mean = sum / count;
+    return summary;
+}
+
+void Run(Result &result, const Options &options) {
+    std::ifstream file(result.path.c_str(), std::ios::in | std::ios::binary);
+    std::stringstream data;
+    data << file.rdbuf();
+    result.read = !file.fail() || file.eof();
+    if (!result.read)
+        return;
+
+    std::string code(data.str());
+    result.size = code.size();
+
+    std::vector<uint64_t> times[kPhaseCount];
+
+    if (options.check) {
+        for (result.iterations = 0; result.iterations != options.iterations; ++result.iterations) {
+            result.errors.clear();
+
+            std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+            result.compiled = Validate(code, options.strict, result.errors, options.target);
+            times[kPhaseTotal].push_back(Nanoseconds(std::chrono::steady_clock::now() - start));
+
+            if (!result.compiled)
+                break;
+        }
+
+        for (unsigned phase(0); phase != kPhaseCount; ++phase)
+            result.times[phase] = Summarize(times[phase]);
+        return;
+    }
+
+    for (result.iterations = 0; result.iterations != options.iterations; ++result.iterations) {
+        std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+        std::string output(Compile(code, options.strict, options.pretty, result.stats, options.target));
+        uint64_t total(Nanoseconds(std::chrono::steady_clock::now() - start));
+
+        if (!result.stats.compiled)
+            break;
+
+        times[kPhaseScan].push_back(result.stats.scanTime);
+        times[kPhaseParse].push_back(result.stats.parseTime);
+        times[kPhaseReplace].push_back(result.stats.replaceTime);
+        times[kPhaseOutput].push_back(result.stats.outputTime);
+        times[kPhaseTotal].push_back(total);
+
+        result.output.swap(output);
+    }
+
+    result.compiled = result.stats.compiled;
+    if (!result.compiled) {
+        result.output.clear();
+        Validate(code, options.strict, result.errors, options.target);
+        return;
+    }
+
+    for (unsigned phase(0); phase != kPhaseCount; ++phase)
+        result.times[phase] = Summarize(times[phase]);
+}
+
+double FilesPerSecond(size_t files, const Options &options, uint64_t wall) {
+    return wall == 0 ? 0 : files * double(options.iterations) / (wall / 1e9);
+}
+
+void JSONString(FILE *out, const std::string &value) {
+    fputc('"', out);
+    for (unsigned char character : value)
+        switch (character) {
+            case '"': fputs("\\\"", out); break;
+            case '\\': fputs("\\\\", out); break;
+            case '\n': fputs("\\n", out); break;
+            case '\r': fputs("\\r", out); break;
+            case '\t': fputs("\\t", out); break;
+            default:
+                if (character < 0x20)
+                    fprintf(out, "\\u%04x", character);
+                else
+                    fputc(character, out);
+        }
+    fputc('"', out);
+}
+
+void ReportJSON(FILE *out, const std::vector<Result> &results, const Options &options, uint64_t wall) {
+    size_t failed(0), bytes(0);
+
+    fprintf(out, "{\n  \"files\": [");
+    for (size_t i(0); i != results.size(); ++i) {
+        const Result &result(results[i]);
+        fprintf(out, "%s\n    {\"path\": ", i == 0 ? "" : ",");
+        JSONString(out, result.path);
+
+        if (!result.read) {
+            ++failed;
+            fprintf(out, ", \"read\": false, \"compiled\": false}");
+            continue;
+        }
+
+        bytes += result.size;
+        const CompileStats &stats(result.stats);
+        fprintf(out, ", \"bytes\": %zu, \"%s\": %s", result.size, options.check ? "valid" : "compiled", result.compiled ? "true" : "false");
+        if (!options.check)
+            fprintf(out, ", \"tokens\": %zu, \"nodes\": %zu, \"poolBytes\": %zu, \"poolBlocks\": %zu", stats.tokens, stats.nodes, stats.poolBytes, stats.poolBlocks);
+
+        if (!result.compiled) {
+            ++failed;
+            fprintf(out, ", \"errors\": [");
+            for (size_t j(0); j != result.errors.size(); ++j) {
+                const CompileError &error(result.errors[j]);
+                fprintf(out, "%s{\"warning\": %s, \"line\": %u, \"column\": %u, \"endLine\": %u, \"endColumn\": %u, \"message\": ", j == 0 ? "" : ", ", error.warning ? "true" : "false", error.line, error.column, error.endLine, error.endColumn);
+                JSONString(out, error.message);
+                fputc('}', out);
+            }
+            fprintf(out, "]}");
+            continue;
+        }
+
+        if (!options.check)
+            fprintf(out, ", \"outputSize\": %zu", stats.outputSize);
+        fprintf(out, ", \"iterations\": %u, \"timesNs\": {", result.iterations);
+        // Validate() isn't broken down into phases
+        for (unsigned phase(options.check ? kPhaseTotal : 0); phase != kPhaseCount; ++phase) {
+            const Summary &summary(result.times[phase]);
+            fprintf(out, "%s\"%s\": {\"min\": %llu, \"median\": %llu, \"mean\": %llu, \"max\": %llu}", phase == 0 || options.check ? "" : ", ", kPhaseNames[phase],
+                (unsigned long long) summary.min, (unsigned long long) summary.median, (unsigned long long) summary.mean, (unsigned long long) summary.max);
+        }
+        fprintf(out, "}}");
+    }
+    fprintf(out, "\n  ],\n");
+
+    fprintf(out, "  \"summary\": {\"mode\": \"%s\", \"target\": \"%s\", \"files\": %zu, \"failed\": %zu, \"bytes\": %zu, \"iterations\": %u, \"threads\": %u, \"wallNs\": %llu, \"filesPerSecond\": %.1f}",
+        options.check ? "check" : "compile", options.target == CompileTargetES2015 ? "es2015" : "es5", results.size(), failed, bytes, options.iterations, options.threads, (unsigned long long) wall, FilesPerSecond(results.size(), options, wall));
+
+    if (options.histograms) {
+        CompileHistogram histograms[CompileMetricCount];
+        CompileHistogramsSnapshot(histograms);
+
+        // Each bucket is given by the least value it counts
+        fprintf(out, ",\n  \"histograms\": {");
+        for (unsigned metric(0); metric != CompileMetricCount; ++metric) {
+            const CompileHistogram &histogram(histograms[metric]);
+            fprintf(out, "%s\n    \"%s\": {\"count\": %llu, \"sum\": %llu, \"buckets\": [", metric == 0 ? "" : ",", CompileMetricName(CompileMetric(metric)),
+                (unsigned long long) histogram.count, (unsigned long long) histogram.sum);
+            bool first(true);
+            for (unsigned bucket(0); bucket != 65; ++bucket)
+                if (histogram.buckets[bucket] != 0) {
+                    fprintf(out, "%s[%llu, %llu]", first ? "" : ", ", bucket == 0 ? 0ULL : 1ULL << (bucket - 1), (unsigned long long) histogram.buckets[bucket]);
+                    first = false;
+                }
+            fprintf(out, "]}");
+        }
+        fprintf(out, "\n  }");
+    }
+
+    fprintf(out, "\n}\n");
+}
+
+void ReportSummary(FILE *out, const std::vector<Result> &results, const Options &options, uint64_t wall) {
+    size_t failed(0), bytes(0);
+    for (const Result &result : results) {
+        bytes += result.size;
+        if (!result.read || !result.compiled)
+            ++failed;
+    }
+
+    double seconds(wall / 1e9);
+    fprintf(out, "%zu files, %zu failed, %zu bytes x %u %s in %.3f s on %u threads (%.1f files/s, %.2f MB/s)\n",
+        results.size(), failed, bytes, options.iterations, options.check ? "checked" : "compiled", seconds, options.threads,
+        FilesPerSecond(results.size(), options, wall), seconds == 0 ? 0 : bytes * double(options.iterations) / seconds / 1e6);
+}
+
+void ReportText(FILE *out, const std::vector<Result> &results, const Options &options, uint64_t wall) {
+    fprintf(out, "%-40s %9s %8s %8s", "file", "bytes", "tokens", "nodes");
+    for (unsigned phase(0); phase != kPhaseCount; ++phase)
+        fprintf(out, " %9s", kPhaseNames[phase]);
+    fprintf(out, "\n");
+
+    for (const Result &result : results) {
+        if (!result.read || !result.compiled) {
+            fprintf(out, "%-40s %s\n", result.path.c_str(), result.read ? "failed" : "unreadable");
+            continue;
+        }
+
+        fprintf(out, "%-40s %9zu %8zu %8zu", result.path.c_str(), result.size, result.stats.tokens, result.stats.nodes);
+        for (unsigned phase(0); phase != kPhaseCount; ++phase)
+            fprintf(out, " %9.3f", result.times[phase].median / 1e6);
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "\n");
+    ReportSummary(out, results, options, wall);
+}
+
+void ReportErrors(const Result &result) {
+    if (!result.read) {
+        fprintf(stderr, "cylangc: %s: could not read\n", result.path.c_str());
+        return;
+    }
+
+    // Only the compiler's own failures have no location
+    for (const CompileError &error : result.errors)
+        if (error.line == 0)
+            fprintf(stderr, "%s: %s: %s\n", result.path.c_str(), error.warning ? "warning" : "error", error.message.c_str());
+        else
+            fprintf(stderr, "%s:%u:%u: %s: %s\n", result.path.c_str(), error.line, error.column, error.warning ? "warning" : "error", error.message.c_str());
+    if (result.errors.empty())
+        fprintf(stderr, "%s: failed to compile\n", result.path.c_str());
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    options.iterations = 1;
+    options.threads = std::max(1u, std::thread::hardware_concurrency());
+    options.json = false;
+    options.histograms = false;
+    options.pretty = false;
+    options.strict = false;
+    options.quiet = false;
+    options.check = false;
+    options.target = CompileTargetES5;
+
+    std::vector<std::string> inputs;
+
+    for (int i(1); i != argc; ++i) {
+        std::string argument(argv[i]);
+        bool valued(argument == "-n" || argument == "-j" || argument == "-x" || argument == "--target");
+        if (valued && i + 1 == argc) {
+            fprintf(stderr, "cylangc: %s needs a value\n", argument.c_str());
+            return 2;
+        }
+
+        if (argument == "-n") {
+            if (!ParseCount(argv[++i], options.iterations)) {
+                fprintf(stderr, "cylangc: bad iteration count %s\n", argv[i]);
+                return 2;
+            }
+        } else if (argument == "-j") {
+            if (!ParseCount(argv[++i], options.threads)) {
+                fprintf(stderr, "cylangc: bad thread count %s\n", argv[i]);
+                return 2;
+            }
+        } else if (argument == "-x") {
+            std::string extension(argv[++i]);
+            options.extensions.push_back(extension[0] == '.' ? extension.substr(1) : extension);
+        } else if (argument == "--target") {
+            std::string target(argv[++i]);
+            if (target == "es5")
+                options.target = CompileTargetES5;
+            else if (target == "es2015")
+                options.target = CompileTargetES2015;
+            else {
+                fprintf(stderr, "cylangc: unknown target %s\n", target.c_str());
+                return 2;
+            }
+        } else if (argument == "--json")
+            options.json = true;
+        else if (argument == "--histograms")
+            options.histograms = true;
+        else if (argument == "--pretty")
+            options.pretty = true;
+        else if (argument == "--strict")
+            options.strict = true;
+        else if (argument == "-q")
+            options.quiet = true;
+        else if (argument == "--check")
+            options.check = true;
+        else if (argument == "-h" || argument == "--help") {
+            Usage(stdout);
+            return 0;
+        } else if (argument.size() > 1 && argument[0] == '-') {
+            fprintf(stderr, "cylangc: unknown option %s\n", argument.c_str());
+            Usage(stderr);
+            return 2;
+        } else
+            inputs.push_back(argument);
+    }
+
+    if (inputs.empty()) {
+        Usage(stderr);
+        return 2;
+    }
+
+    if (options.extensions.empty())
+        options.extensions.push_back("cy");
+    if (options.histograms)
+        CompileHistogramsEnable(true);
+
+    std::vector<std::string> files;
+    bool okay(true);
+    for (const std::string &input : inputs)
+        okay = Collect(input, options, files, true) && okay;
+
+    std::vector<Result> results(files.size());
+    for (size_t i(0); i != files.size(); ++i) {
+        results[i].path = files[i];
+        results[i].read = false;
+        results[i].size = 0;
+        results[i].compiled = false;
+        results[i].stats = CompileStats();
+        results[i].iterations = 0;
+    }
+
+    // Compile() prints its diagnostics to stdout; send those to stderr so
+    // that stdout only carries what was asked for
+    fflush(stdout);
+    FILE *out(fdopen(dup(STDOUT_FILENO), "w"));
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    options.threads = std::min<size_t>(options.threads, std::max<size_t>(files.size(), 1));
+    std::atomic<size_t> next(0);
+    auto work([&]() {
+        for (size_t i; (i = next++) < results.size(); )
+            Run(results[i], options);
+    });
+
+    std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+    std::vector<std::thread> workers;
+    for (unsigned i(1); i < options.threads; ++i)
+        workers.emplace_back(work);
+    work();
+    for (std::thread &worker : workers)
+        worker.join();
+    uint64_t wall(Nanoseconds(std::chrono::steady_clock::now() - start));
+
+    for (const Result &result : results)
+        if (!result.read || !result.compiled) {
+            okay = false;
+            if (!options.json)
+                ReportErrors(result);
+        }
+
+    if (options.json)
+        ReportJSON(out, results, options, wall);
+    else if (options.check)
+        ReportSummary(out, results, options, wall);
+    else if (options.iterations != 1)
+        ReportText(out, results, options, wall);
+    else if (!options.quiet)
+        for (const Result &result : results)
+            if (result.compiled) {
+                if (results.size() != 1)
+                    fprintf(out, "// %s\n", result.path.c_str());
+                fprintf(out, "%s\n", result.output.c_str());
+            }
+
+    fclose(out);
+    return okay ? 0 : 1;
+}
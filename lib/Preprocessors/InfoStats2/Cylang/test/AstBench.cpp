@@ -0,0 +1,155 @@
+//
+//  AstBench.cpp
+//  libwidgetinfo
+//
+//  How big the tree is next to the source it came from, and how long Replace
+//  and Output take to walk it, at both levels. The tree is counted as the pool
+//  bytes Parse() handed out, and the locations as the part of
+//  CYDriver::extents_ in use; the script's own length is left out of both.
+//
+//      ast-bench [-n rounds] [--quick] [file...]
+//
+//  Without files it uses the generated scripts from Scripts.hpp. Every
+//  location has to fall inside the script, or it fails.
+//
+
+#include "Driver.hpp"
+#include "Syntax.hpp"
+
+#include "Scripts.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Measure {
+    size_t tree;
+    size_t extents;
+    bool located;
+    double replace;
+    double output;
+};
+
+double Milliseconds(std::chrono::steady_clock::time_point &start) {
+    std::chrono::steady_clock::time_point now(std::chrono::steady_clock::now());
+    double milliseconds(std::chrono::duration<double, std::milli>(now - start).count());
+    start = now;
+    return milliseconds;
+}
+
+bool Once(const std::string &code, CYLevel level, Measure &measure) {
+    CYPool pool;
+    std::istringstream stream(code);
+    CYDriver driver(pool, *stream.rdbuf());
+
+    if (driver.Parse() || !driver.errors_.empty() || driver.script_ == NULL)
+        return false;
+
+    measure.tree = pool.Used();
+    measure.extents = driver.extents_.size() * sizeof(CYExtent);
+
+    unsigned lines(std::count(code.begin(), code.end(), '\n') + 1);
+    measure.located = !driver.extents_.empty();
+    for (unsigned extent(1); extent <= driver.extents_.size(); ++extent) {
+        CYLocation location(driver.Location(extent));
+        if (location.begin.line > location.end.line || location.end.line > lines)
+            measure.located = false;
+    }
+
+    CYOptions options;
+    options.level_ = level;
+    std::stringbuf str;
+    CYOutput out(str, options);
+
+    std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+    if (!driver.Replace(options))
+        return false;
+    measure.replace = Milliseconds(start);
+    out << *driver.script_;
+    measure.output = Milliseconds(start);
+    return true;
+}
+
+// The sizes are the same every round; the times are the best of them
+bool Run(const char *name, const std::string &code, unsigned rounds) {
+    Measure best[2];
+    const CYLevel levels[2] = {CYLevelES5, CYLevelES2015};
+
+    for (unsigned level(0); level != 2; ++level)
+        for (unsigned round(0); round != rounds; ++round) {
+            Measure measure;
+            if (!Once(code, levels[level], measure)) {
+                fprintf(stderr, "%s: does not compile\n", name);
+                return false;
+            }
+            if (!measure.located) {
+                fprintf(stderr, "%s: a location is outside the script\n", name);
+                return false;
+            }
+            if (round == 0)
+                best[level] = measure;
+            else {
+                best[level].replace = std::min(best[level].replace, measure.replace);
+                best[level].output = std::min(best[level].output, measure.output);
+            }
+        }
+
+    double size(code.size());
+    printf("%-16s %9zu %8.2f %8.2f %9.2f %9.2f %9.2f %9.2f\n", name, code.size(),
+        best[0].tree / size, (best[0].tree + best[0].extents) / size,
+        best[0].replace, best[0].output, best[1].replace, best[1].output);
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    unsigned rounds(15);
+    bool quick(false);
+    std::vector<const char *> files;
+
+    for (int i(1); i != argc; ++i)
+        if (strcmp(argv[i], "-n") == 0 && i + 1 != argc)
+            rounds = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else
+            files.push_back(argv[i]);
+
+    if (quick)
+        rounds = 1;
+
+    printf("%-16s %9s %8s %8s %9s %9s %9s %9s\n", "script", "bytes", "tree/B", "+table/B", "ES5 repl", "ES5 out", "2015 repl", "2015 out");
+
+    bool okay(true);
+    if (files.empty()) {
+        unsigned scale(quick ? 1 : 20);
+        std::pair<const char *, std::string> scripts[] = {
+            {"widgets", WidgetScript(50 * scale)},
+            {"functions", FunctionScript(50 * scale)},
+            {"flat", FlatScript(500 * scale)},
+            {"vars", VarsScript(500 * scale)},
+        };
+        for (const auto &script : scripts)
+            okay = Run(script.first, script.second, rounds) && okay;
+    } else
+        for (const char *file : files) {
+            std::string code;
+            if (!ReadScript(file, code)) {
+                fprintf(stderr, "%s: could not read\n", file);
+                okay = false;
+            } else
+                okay = Run(file, code, rounds) && okay;
+        }
+
+    return okay ? 0 : 1;
+}
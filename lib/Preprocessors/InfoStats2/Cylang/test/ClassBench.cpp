@@ -0,0 +1,183 @@
+//
+//  ClassBench.cpp
+//  libwidgetinfo
+//
+//  Replace and Output times at both levels on widget classes, whose lowering
+//  (classes, super, for-of, arrows over this, comprehensions) takes the most
+//  compiler temporaries; with the pool bytes Replace hands out, and how often
+//  a temporary is still printed as "$cyN" in what comes out. Every round has
+//  to give the same output, and every temporary in it has to be spelled whole.
+//
+//      class-bench [-n rounds] [--quick] [file...]
+//
+//  Without files it uses WidgetScript from Scripts.hpp, and for-of and
+//  comprehensions at the top level, whose temporaries are printed.
+//
+
+#include "Driver.hpp"
+#include "Syntax.hpp"
+
+#include "Scripts.hpp"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Measure {
+    size_t pool;
+    double replace;
+    double output;
+    std::string code;
+};
+
+double Milliseconds(std::chrono::steady_clock::time_point &start) {
+    std::chrono::steady_clock::time_point now(std::chrono::steady_clock::now());
+    double milliseconds(std::chrono::duration<double, std::milli>(now - start).count());
+    start = now;
+    return milliseconds;
+}
+
+bool Once(const std::string &code, CYLevel level, Measure &measure) {
+    CYPool pool;
+    std::istringstream stream(code);
+    CYDriver driver(pool, *stream.rdbuf());
+
+    if (driver.Parse() || !driver.errors_.empty() || driver.script_ == NULL)
+        return false;
+
+    CYOptions options;
+    options.level_ = level;
+    std::stringbuf str;
+    CYOutput out(str, options);
+
+    size_t parsed(pool.Used());
+    std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+    if (!driver.Replace(options))
+        return false;
+    measure.replace = Milliseconds(start);
+    measure.pool = pool.Used() - parsed;
+    out << *driver.script_;
+    measure.output = Milliseconds(start);
+    measure.code = str.str();
+    return true;
+}
+
+// for-of and comprehensions at the top level, where the temporaries they take
+// are not renamed and are printed as they are
+std::string LoopScript(unsigned count) {
+    std::string script;
+    char line[256];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line),
+            "for (const item of items%u) total += item.value * %u;\n"
+            "names = [for (item of items%u) item.name];\n", i, i % 7 + 1, i);
+        script += line;
+    }
+    return script;
+}
+
+// how often a temporary is printed, or -1 if one is not "$cy" and digits
+ssize_t Temporaries(const std::string &code) {
+    ssize_t count(0);
+    for (size_t at(code.find("$cy")); at != std::string::npos; at = code.find("$cy", at + 3)) {
+        size_t end(at + 3);
+        while (end != code.size() && isdigit(code[end]))
+            ++end;
+        // $cyr, $cyv and $cyk are the runtime's own names, not temporaries
+        if (end != code.size() && strchr("rvk", code[end]) != NULL && end == at + 3)
+            continue;
+        if (end == at + 3 || end != code.size() && (isalnum(code[end]) || code[end] == '$' || code[end] == '_'))
+            return -1;
+        ++count;
+    }
+    return count;
+}
+
+bool Run(const char *name, const std::string &code, unsigned rounds) {
+    Measure best[2];
+    const CYLevel levels[2] = {CYLevelES5, CYLevelES2015};
+    ssize_t temporaries[2];
+
+    for (unsigned level(0); level != 2; ++level) {
+        for (unsigned round(0); round != rounds; ++round) {
+            Measure measure;
+            if (!Once(code, levels[level], measure)) {
+                fprintf(stderr, "%s: does not compile\n", name);
+                return false;
+            }
+            if (round == 0)
+                best[level] = measure;
+            else if (measure.code != best[level].code) {
+                fprintf(stderr, "%s: round %u gave different output\n", name, round);
+                return false;
+            } else {
+                best[level].replace = std::min(best[level].replace, measure.replace);
+                best[level].output = std::min(best[level].output, measure.output);
+            }
+        }
+
+        temporaries[level] = Temporaries(best[level].code);
+        if (temporaries[level] < 0) {
+            fprintf(stderr, "%s: a temporary is not spelled whole\n", name);
+            return false;
+        }
+    }
+
+    printf("%-16s %9zu %9.2f %9.2f %9zu %6zd %9.2f %9.2f %9zu %6zd\n", name, code.size(),
+        best[0].replace, best[0].output, best[0].pool / 1024, temporaries[0],
+        best[1].replace, best[1].output, best[1].pool / 1024, temporaries[1]);
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    unsigned rounds(20);
+    bool quick(false);
+    std::vector<const char *> files;
+
+    for (int i(1); i != argc; ++i)
+        if (strcmp(argv[i], "-n") == 0 && i + 1 != argc)
+            rounds = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else
+            files.push_back(argv[i]);
+
+    if (quick)
+        rounds = 1;
+
+    printf("%-16s %9s %9s %9s %9s %6s %9s %9s %9s %6s\n", "script", "bytes",
+        "ES5 repl", "ES5 out", "ES5 KB", "$cy", "2015 repl", "2015 out", "2015 KB", "$cy");
+
+    bool okay(true);
+    if (files.empty()) {
+        unsigned scale(quick ? 1 : 30);
+        std::pair<const char *, std::string> scripts[] = {
+            {"widgets", WidgetScript(20 * scale)},
+            {"loops", LoopScript(100 * scale)},
+        };
+        for (const auto &script : scripts)
+            okay = Run(script.first, script.second, rounds) && okay;
+    } else
+        for (const char *file : files) {
+            std::string code;
+            if (!ReadScript(file, code)) {
+                fprintf(stderr, "%s: could not read\n", file);
+                okay = false;
+            } else
+                okay = Run(file, code, rounds) && okay;
+        }
+
+    return okay ? 0 : 1;
+}
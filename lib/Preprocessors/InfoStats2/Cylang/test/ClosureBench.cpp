@@ -0,0 +1,161 @@
+//
+//  ClosureBench.cpp
+//  libwidgetinfo
+//
+//  Replace and Output times, and the heap allocations Replace makes, on
+//  scripts of closures nested deep, where every function closes a scope whose
+//  names have to be ordered and renamed. The tree comes from CYPool, so what
+//  the allocations count is the renaming's own bookkeeping; there have to be
+//  fewer of them than there are functions, and every round has to give the
+//  same output.
+//
+//      closure-bench [-n rounds] [--quick] [file...]
+//
+//  Without files it uses ClosureScript from Scripts.hpp.
+//
+
+#include "Driver.hpp"
+#include "Syntax.hpp"
+
+#include "Scripts.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+size_t allocations_;
+}
+
+void *operator new(size_t size) {
+    ++allocations_;
+    if (void *pointer = malloc(size == 0 ? 1 : size))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+    free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    free(pointer);
+}
+
+namespace {
+
+struct Measure {
+    size_t allocations;
+    double replace;
+    double output;
+    std::string code;
+};
+
+bool Once(const std::string &code, CYLevel level, Measure &measure) {
+    CYPool pool;
+    std::istringstream stream(code);
+    CYDriver driver(pool, *stream.rdbuf());
+
+    if (driver.Parse() || !driver.errors_.empty() || driver.script_ == NULL)
+        return false;
+
+    CYOptions options;
+    options.level_ = level;
+    std::stringbuf str;
+    CYOutput out(str, options);
+
+    std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+    size_t allocations(allocations_);
+    if (!driver.Replace(options))
+        return false;
+    measure.allocations = allocations_ - allocations;
+    std::chrono::steady_clock::time_point replaced(std::chrono::steady_clock::now());
+    out << *driver.script_;
+    std::chrono::steady_clock::time_point output(std::chrono::steady_clock::now());
+
+    measure.replace = std::chrono::duration<double, std::milli>(replaced - start).count();
+    measure.output = std::chrono::duration<double, std::milli>(output - replaced).count();
+    measure.code = str.str();
+    return true;
+}
+
+bool Run(const char *name, const std::string &code, unsigned rounds, size_t functions) {
+    Measure best[2];
+    const CYLevel levels[2] = {CYLevelES5, CYLevelES2015};
+
+    for (unsigned level(0); level != 2; ++level)
+        for (unsigned round(0); round != rounds; ++round) {
+            Measure measure;
+            if (!Once(code, levels[level], measure)) {
+                fprintf(stderr, "%s: does not compile\n", name);
+                return false;
+            }
+            if (round == 0)
+                best[level] = measure;
+            else if (measure.code != best[level].code) {
+                fprintf(stderr, "%s: round %u gave different output\n", name, round);
+                return false;
+            } else {
+                best[level].replace = std::min(best[level].replace, measure.replace);
+                best[level].output = std::min(best[level].output, measure.output);
+                best[level].allocations = std::min(best[level].allocations, measure.allocations);
+            }
+        }
+
+    for (unsigned level(0); level != 2; ++level)
+        if (functions != 0 && best[level].allocations >= functions) {
+            fprintf(stderr, "%s: %zu allocations replacing %zu functions\n", name, best[level].allocations, functions);
+            return false;
+        }
+
+    printf("%-16s %9zu %9zu %9.2f %9.2f %9zu %9.2f %9.2f\n", name, code.size(),
+        best[0].allocations, best[0].replace, best[0].output,
+        best[1].allocations, best[1].replace, best[1].output);
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    unsigned rounds(5);
+    bool quick(false);
+    std::vector<const char *> files;
+
+    for (int i(1); i != argc; ++i)
+        if (strcmp(argv[i], "-n") == 0 && i + 1 != argc)
+            rounds = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else
+            files.push_back(argv[i]);
+
+    if (quick)
+        rounds = 1;
+
+    printf("%-16s %9s %9s %9s %9s %9s %9s %9s\n", "script", "bytes", "ES5 new", "ES5 repl", "ES5 out",
+        "2015 new", "2015 repl", "2015 out");
+
+    bool okay(true);
+    if (files.empty()) {
+        unsigned count(quick ? 20 : 1000), depth(14);
+        okay = Run("closures", ClosureScript(count, depth), rounds, count * depth);
+    } else
+        for (const char *file : files) {
+            std::string code;
+            if (!ReadScript(file, code)) {
+                fprintf(stderr, "%s: could not read\n", file);
+                okay = false;
+            } else
+                okay = Run(file, code, rounds, 0) && okay;
+        }
+
+    return okay ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+//
+//  CompileCacheStress.cpp
+//  libwidgetinfo
+//
+//  Several processes share one CompileCache small enough that it compacts
+//  every few inserts, while they also keep opening it afresh; that is where a
+//  process could be left appending to a file nobody else will read again.
+//  Every hit has to be the output that was stored for exactly that source.
+//  Once they have all finished, each adds one last entry through the cache it
+//  has had open all along, and a newcomer has to find every one of them.
+//
+
+#include "CompileCache.hpp"
+
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+const unsigned kProcesses = 8;
+const unsigned kRounds = 10;
+const unsigned kIterations = 300;
+const size_t kCapacity = 64 * 1024;
+
+std::string Source(unsigned process, unsigned index) {
+    char prefix[64];
+    snprintf(prefix, sizeof(prefix), "var p%u = %u;", process, index);
+    // Varied sizes, so records land at every alignment
+    return prefix + std::string((process * 131 + index * 17) % 900, 'x');
+}
+
+std::string Output(const std::string &code) {
+    return "/*compiled*/" + code + ";";
+}
+
+std::string Last(unsigned process) {
+    char code[64];
+    snprintf(code, sizeof(code), "last(%u)", process);
+    return code;
+}
+
+// Exit status is the number of wrong hits, capped; ready is written to once
+// the churn is over, and go is closed once everyone's is
+int Child(const std::string &path, unsigned process, int ready, int go) {
+    srand(process * 7919 + getpid());
+    unsigned wrong(0);
+
+    CompileCache *cache(new CompileCache(path, kCapacity));
+    for (unsigned i = 0; i != kIterations; ++i) {
+        // Opening while others compact is the case that used to lose a store
+        if (rand() % 40 == 0) {
+            delete cache;
+            cache = new CompileCache(path, kCapacity);
+        }
+
+        std::string code(Source(process, i));
+        cache->Insert(code, 0, Output(code));
+
+        // Anyone's entry, including ones compaction may have dropped
+        std::string other(Source(rand() % kProcesses, rand() % (i + 1)));
+        std::string output;
+        if (cache->Find(other, 0, output) && output != Output(other))
+            ++wrong;
+        // Nor may a source that was never stored
+        std::string near(other);
+        near[near.size() - 1] = 'y';
+        if (cache->Find(near, 0, output))
+            ++wrong;
+
+        if (rand() % 25 == 0)
+            cache->Compact();
+    }
+
+    char byte(0);
+    if (write(ready, &byte, 1) != 1 || read(go, &byte, 1) != 0)
+        return 100;
+
+    std::string last(Last(process));
+    cache->Insert(last, 0, Output(last));
+    delete cache;
+
+    return wrong > 100 ? 100 : wrong;
+}
+
+bool Round(const std::string &directory, unsigned round) {
+    std::string path(directory + "/cache");
+
+    // Start every other round from a store some other layout left behind
+    if (round % 2 != 0) {
+        uint32_t stale[16] = {0x43594343, 1};
+        FILE *file(fopen(path.c_str(), "wb"));
+        if (file == NULL)
+            return false;
+        fwrite(stale, sizeof(stale), 1, file);
+        fclose(file);
+    }
+
+    int ready[2], go[2];
+    if (pipe(ready) != 0 || pipe(go) != 0)
+        return false;
+
+    std::vector<pid_t> children;
+    for (unsigned process = 0; process != kProcesses; ++process) {
+        pid_t child(fork());
+        if (child == 0) {
+            close(ready[0]);
+            close(go[1]);
+            _exit(Child(path, process, ready[1], go[0]));
+        }
+        children.push_back(child);
+    }
+
+    close(ready[1]);
+    close(go[0]);
+
+    // A child that died on the way will never turn up, so stop waiting once
+    // any has exited
+    for (unsigned arrived = 0; arrived != kProcesses; ) {
+        struct pollfd poller = {ready[0], POLLIN, 0};
+        char byte;
+        if (poll(&poller, 1, 100) > 0 && read(ready[0], &byte, 1) == 1) {
+            ++arrived;
+            continue;
+        }
+
+        siginfo_t info;
+        info.si_pid = 0;
+        if (waitid(P_ALL, 0, &info, WEXITED | WNOHANG | WNOWAIT) == 0 && info.si_pid != 0)
+            break;
+    }
+
+    close(ready[0]);
+    close(go[1]);
+
+    bool okay(true);
+    for (unsigned process = 0; process != children.size(); ++process) {
+        int status;
+        if (waitpid(children[process], &status, 0) != children[process])
+            okay = false;
+        else if (WIFSIGNALED(status)) {
+            fprintf(stderr, "round %u: process %u died of signal %d\n", round, process, WTERMSIG(status));
+            okay = false;
+        } else if (WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "round %u: process %u got %d wrong hits\n", round, process, WEXITSTATUS(status));
+            okay = false;
+        }
+    }
+
+    CompileCache cache(path, kCapacity);
+    for (unsigned process = 0; process != kProcesses; ++process) {
+        std::string last(Last(process)), output;
+        if (!cache.Find(last, 0, output) || output != Output(last)) {
+            fprintf(stderr, "round %u: process %u's last entry is gone\n", round, process);
+            okay = false;
+        }
+    }
+
+    unlink(path.c_str());
+    unlink((path + ".lock").c_str());
+    unlink((path + ".tmp").c_str());
+    return okay;
+}
+
+}
+
+int main() {
+    const char *base(getenv("TMPDIR"));
+    std::string directory(base != NULL && *base != '\0' ? base : "/tmp");
+    directory += "/compilecache.XXXXXX";
+    if (mkdtemp(&directory[0]) == NULL) {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    unsigned failed(0);
+    for (unsigned round = 0; round != kRounds; ++round)
+        if (!Round(directory, round))
+            ++failed;
+
+    rmdir(directory.c_str());
+
+    printf("%u of %u rounds failed\n", failed, kRounds);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+//
+//  DispatchBench.js
+//  libwidgetinfo
+//
+//  Compiles DispatchBench.cy with cylangc, rewrites the output the way
+//  IS2PreProcessor does, and runs it against a copy of IS2Middleware's two
+//  paths: the dispatch table the compiler calls for sends to IS2 classes, and
+//  objc_msgSend for every other send. Both functions have to compute the same
+//  as a send straight to the provider would.
+//
+//      node test/DispatchBench.js <cylangc>             best of 7, in ns per send
+//      node --jitless test/DispatchBench.js <cylangc>   the same without the JIT
+//      node test/DispatchBench.js <cylangc> --check     only that the paths agree
+//
+
+'use strict';
+
+const child = require('child_process');
+const path = require('path');
+const vm = require('vm');
+
+const cylangc = process.argv[2];
+const check = process.argv.includes('--check');
+if (cylangc === undefined) {
+    console.error('usage: node DispatchBench.js <cylangc> [--check]');
+    process.exit(2);
+}
+
+const compiled = child.spawnSync(cylangc, [path.join(__dirname, 'DispatchBench.cy')], {encoding: 'utf8'});
+if (compiled.status !== 0) {
+    console.error(compiled.stderr);
+    process.exit(1);
+}
+
+// IS2PreProcessor's rewrites
+let output = compiled.stdout.replace(/objc_msgSend/g, 'api._middleware.infostats2.objc_msgSend');
+for (const name of ['IS2System', 'IS2Weather'])
+    output = output.replace(new RegExp(name, 'g'), `"${name}"`);
+
+// IS2Base and IS2Middleware, as lib/Middleware/src/infostats2 has them
+class Provider {
+    constructor(lookupMap) { this._lookupMap = lookupMap; }
+    get dispatchTable() { return this._lookupMap; }
+    callFn(identifier, args) {
+        const fn = this._lookupMap[identifier];
+        return fn ? fn(args) : undefined;
+    }
+}
+
+class Middleware {
+    constructor() {
+        this.compatProviders = {
+            IS2Weather: new Provider({currentTemperature: () => 21}),
+            IS2System: new Provider({'ramFree:inUnits:': args => args[0] % 7 * args[1]}),
+        };
+        this.objc_msgSend_dispatch = {missing: () => undefined};
+        for (const key of Object.keys(this.compatProviders))
+            this.objc_msgSend_dispatch[key] = this.compatProviders[key].dispatchTable;
+    }
+
+    objc_msgSend(object, selector, ...args) {
+        const compatProvider = this.compatProviders[object];
+        return compatProvider ? compatProvider.callFn(selector, args) : null;
+    }
+}
+
+// api is a global on a widget's page, so the code runs in this context rather
+// than a new one, whose globals are much slower to reach
+globalThis.api = {_middleware: {infostats2: new Middleware()}};
+const paths = vm.runInThisContext(`(function () {\n${output}\nreturn {dispatched, sent};\n})()`);
+
+// Three sends an iteration
+function expected(n) {
+    let total = 0;
+    for (let i = 0; i < n; ++i)
+        total += 21 + i % 7 * 2 + 1;
+    return total;
+}
+
+let failed = 0;
+for (const [name, run] of Object.entries(paths))
+    if (run(100) !== expected(100)) {
+        console.error(`${name}: ${run(100)}, not ${expected(100)}`);
+        ++failed;
+    }
+
+if (!check) {
+    const n = 100000;
+    for (const [name, run] of Object.entries(paths)) {
+        let best = Infinity;
+        for (let round = 0; round !== 7; ++round) {
+            const start = process.hrtime.bigint();
+            run(n);
+            best = Math.min(best, Number(process.hrtime.bigint() - start));
+        }
+        console.log(`${name.padEnd(12)} ${(best / (n * 3)).toFixed(1).padStart(8)}`);
+    }
+}
+
+process.exitCode = failed === 0 ? 0 : 1;
@@ -0,0 +1,134 @@
+//
+//  ForOfBench.js
+//  libwidgetinfo
+//
+//  Times the loops Cylang can turn one for-of into, on the kinds of list a
+//  widget walks on every update. The shapes are the compiler's own output for
+//  ForOfBench.cy, from forof-shapes: enumerate is the for-in lowering, indexed
+//  is what Compile() emits, and native leaves the loop to the engine.
+//
+//      node test/ForOfBench.js <forof-shapes>             best of 7, in ns per call
+//      node --jitless test/ForOfBench.js <forof-shapes>   the same without the JIT
+//      node test/ForOfBench.js <forof-shapes> --check     only what each shape iterates
+//
+//  Each shape has to see what a for-of would: the items of anything iterable,
+//  loop and comprehension alike. The indexed shape also has to see what the
+//  for-in lowering always did for everything else, such as the values of a
+//  plain object, and nothing for null.
+//
+
+'use strict';
+
+const child = require('child_process');
+const path = require('path');
+const vm = require('vm');
+
+const forofShapes = process.argv[2];
+const check = process.argv.includes('--check');
+if (forofShapes === undefined) {
+    console.error('usage: node ForOfBench.js <forof-shapes> [--check]');
+    process.exit(2);
+}
+
+const compiled = child.spawnSync(forofShapes, [path.join(__dirname, 'ForOfBench.cy')], {encoding: 'utf8'});
+if (compiled.status !== 0) {
+    console.error(compiled.stderr);
+    process.exit(1);
+}
+
+const shapes = {};
+for (const [shape, code] of Object.entries(JSON.parse(compiled.stdout)))
+    shapes[shape] = vm.runInNewContext(code + '\n;({sum, items})');
+
+const notifications = Array.from({length: 50}, (_, i) => ({count: i % 3, title: 'n' + i}));
+
+const timed = {
+    forecast7: Array.from({length: 7}, (_, i) => ({high: 20 + i, low: 10 + i})),
+    notifications50: notifications,
+    numbers1000: Array.from({length: 1000}, (_, i) => i),
+    set50: new Set(notifications),
+};
+
+function Inherited() { this.own = 1; }
+Inherited.prototype.inherited = 2;
+
+const checked = Object.assign({
+    string: 'abc',
+    map: new Map([['a', 1], ['b', 2]]),
+    object: {a: 1, b: 2, c: 3},
+    inherited: new Inherited(),
+    empty: {},
+    nothing: null,
+    number: 5,
+}, timed);
+
+function iterable(list) {
+    return list != null && typeof list[Symbol.iterator] === 'function';
+}
+
+// What the for-in lowering walks
+function values(list) {
+    const result = [];
+    for (const key in list)
+        result.push(list[key]);
+    return result;
+}
+
+function same(actual, expected) {
+    return JSON.stringify(actual) === JSON.stringify(expected);
+}
+
+let failed = 0;
+for (const [name, list] of Object.entries(checked)) {
+    const items = iterable(list) ? Array.from(list) : values(list);
+    const sum = items.reduce((s, x) => s + (x.high !== undefined ? x.high : x.count !== undefined ? x.count : x), 0);
+
+    for (const [shape, {sum: sumShape, items: itemsShape}] of Object.entries(shapes)) {
+        // for-in never sees the items of an iterable that isn't an array,
+        // which is what the indexed lowering was added to fix; a native
+        // for-of throws on anything that isn't iterable; and comprehensions
+        // are lowered at every level
+        if (shape === 'enumerate' && iterable(list) && !Array.isArray(list) && typeof list !== 'string')
+            continue;
+        if (shape === 'native' && !iterable(list))
+            continue;
+
+        const actual = sumShape(list);
+        if (actual !== sum) {
+            console.error(`${shape} sum of ${name}: ${actual}, not ${sum}`);
+            ++failed;
+        }
+
+        if (shape !== 'native' && !same(itemsShape(list), items)) {
+            console.error(`${shape} items of ${name}: ${JSON.stringify(itemsShape(list))}, not ${JSON.stringify(items)}`);
+            ++failed;
+        }
+    }
+}
+
+if (!check)
+    for (const [name, list] of Object.entries(timed)) {
+        const expected = shapes.native.sum(list);
+        const size = Array.isArray(list) ? list.length : list.size;
+        const calls = Math.max(1, Math.floor(2e6 / size));
+
+        const line = [name.padEnd(16)];
+        for (const [shape, {sum}] of Object.entries(shapes)) {
+            const missed = sum(list) !== expected;
+            let best = Infinity, sink = 0;
+            for (let round = 0; round !== 7; ++round) {
+                const start = process.hrtime.bigint();
+                for (let call = 0; call !== calls; ++call)
+                    sink += sum(list);
+                best = Math.min(best, Number(process.hrtime.bigint() - start) / calls);
+            }
+
+            line.push(`${shape} ${best.toFixed(0).padStart(7)} ns${missed ? ' (no items)' : ''}`);
+            if (sink !== sum(list) * calls * 7)
+                ++failed;
+        }
+
+        console.log(line.join('  '));
+    }
+
+process.exitCode = failed === 0 ? 0 : 1;
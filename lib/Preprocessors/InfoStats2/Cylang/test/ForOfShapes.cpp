@@ -0,0 +1,91 @@
+//
+//  ForOfShapes.cpp
+//  libwidgetinfo
+//
+//  Compiles a script the three ways Cylang can emit a for-of and prints them
+//  as one JSON object, for test/ForOfBench.js to time and compare: enumerate
+//  is CYLevelES5 with CYForOfLoweringEnumerate, indexed is CYLevelES5 with
+//  CYForOfLoweringIndexed, as Compile() uses, and native is CYLevelES2015
+//  with CYForOfLoweringEnumerate, which leaves the loop alone.
+//
+//      forof-shapes <script>
+//
+
+#include "Driver.hpp"
+#include "Syntax.hpp"
+
+#include "Scripts.hpp"
+
+#include <stdio.h>
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+bool Shape(const std::string &code, CYLevel level, CYForOfLowering forOf, std::string &output) {
+    CYPool pool;
+    std::istringstream stream(code);
+    CYDriver driver(pool, *stream.rdbuf());
+
+    if (driver.Parse() || !driver.errors_.empty() || driver.script_ == NULL)
+        return false;
+
+    CYOptions options;
+    options.level_ = level;
+    options.forOf_ = forOf;
+    if (!driver.Replace(options))
+        return false;
+
+    std::stringbuf str;
+    CYOutput out(str, options);
+    out << *driver.script_;
+    output = str.str();
+    return true;
+}
+
+void JSONString(const std::string &value) {
+    putchar('"');
+    for (unsigned char character : value)
+        if (character == '"' || character == '\\')
+            printf("\\%c", character);
+        else if (character < 0x20)
+            printf("\\u%04x", character);
+        else
+            putchar(character);
+    putchar('"');
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    std::string code;
+    if (argc != 2 || !ReadScript(argv[1], code)) {
+        fprintf(stderr, "usage: forof-shapes <script>\n");
+        return 2;
+    }
+
+    struct {
+        const char *name;
+        CYLevel level;
+        CYForOfLowering forOf;
+    } shapes[] = {
+        {"enumerate", CYLevelES5, CYForOfLoweringEnumerate},
+        {"indexed", CYLevelES5, CYForOfLoweringIndexed},
+        {"native", CYLevelES2015, CYForOfLoweringEnumerate},
+    };
+
+    putchar('{');
+    for (unsigned i(0); i != sizeof(shapes) / sizeof(shapes[0]); ++i) {
+        std::string output;
+        if (!Shape(code, shapes[i].level, shapes[i].forOf, output)) {
+            fprintf(stderr, "%s: does not compile as %s\n", argv[1], shapes[i].name);
+            return 1;
+        }
+
+        printf("%s\"%s\": ", i == 0 ? "" : ", ", shapes[i].name);
+        JSONString(output);
+    }
+    printf("}\n");
+    return 0;
+}
@@ -0,0 +1,77 @@
+//
+//  KeywordTable.cpp
+//  libwidgetinfo
+//
+//  CYKeywordFind against a plain search of CYKeywords: it has to find every
+//  keyword with its own token, and nothing else, for the names that differ
+//  from one by a character and for every name of up to three characters.
+//  A keyword the hash sent to the wrong slot, or a slot that let a near miss
+//  through, would lex as the wrong token.
+//
+
+#include "Keyword.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+namespace {
+
+const char kCharacters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_$0123456789";
+
+const CYKeyword *Search(const std::string &name) {
+    for (const CYKeyword &keyword : CYKeywords)
+        if (keyword.size_ == name.size() && memcmp(keyword.name_, name.data(), name.size()) == 0)
+            return &keyword;
+    return NULL;
+}
+
+unsigned checked_;
+
+bool Check(const std::string &name) {
+    ++checked_;
+    const CYKeyword *found(CYKeywordFind(name.data(), name.size()));
+    const CYKeyword *expected(Search(name));
+    if (found == expected)
+        return true;
+    fprintf(stderr, "%s: found %s, not %s\n", name.c_str(),
+        found == NULL ? "nothing" : found->name_, expected == NULL ? "nothing" : expected->name_);
+    return false;
+}
+
+}
+
+int main() {
+    unsigned failed(0);
+
+    for (const CYKeyword &keyword : CYKeywords) {
+        std::string name(keyword.name_, keyword.size_);
+        failed += !Check(name);
+        failed += !Check(name + "x");
+        failed += !Check(name.substr(0, name.size() - 1));
+        failed += !Check(name.substr(1));
+
+        // each character replaced, which keeps the length the hash reads
+        for (size_t i(0); i != name.size(); ++i)
+            for (const char *character(kCharacters); *character != '\0'; ++character) {
+                std::string miss(name);
+                miss[i] = *character;
+                failed += !Check(miss);
+            }
+    }
+
+    std::string name;
+    for (const char *first(kCharacters); *first != '\0'; ++first) {
+        failed += !Check(name.assign(1, *first));
+        for (const char *second(kCharacters); *second != '\0'; ++second) {
+            name.assign(1, *first) += *second;
+            failed += !Check(name);
+            for (const char *third(kCharacters); *third != '\0'; ++third)
+                failed += !Check(name.substr(0, 2) + *third);
+        }
+    }
+
+    printf("%u of %u names classified differently from a search of the keywords\n", failed, checked_);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+//
+//  LevelBench.js
+//  libwidgetinfo
+//
+//  Compiles LevelBench.cy with cylangc at each --target, then reports, per
+//  target, how big the output is, how long cylangc takes to compile it, how
+//  long the engine takes to parse it, and how long it takes to run. Every
+//  target has to compute the same result as the others.
+//
+//      node test/LevelBench.js <cylangc>            best of 7, in ms
+//      node test/LevelBench.js <cylangc> --check    only that the targets agree
+//
+
+'use strict';
+
+const child = require('child_process');
+const path = require('path');
+const vm = require('vm');
+const zlib = require('zlib');
+
+const targets = ['es5', 'es2015'];
+const script = path.join(__dirname, 'LevelBench.cy');
+
+const cylangc = process.argv[2];
+const check = process.argv.includes('--check');
+if (cylangc === undefined) {
+    console.error('usage: node LevelBench.js <cylangc> [--check]');
+    process.exit(2);
+}
+
+function cylang(args) {
+    const result = child.spawnSync(cylangc, args, {encoding: 'utf8'});
+    if (result.status !== 0)
+        throw new Error(`cylangc ${args.join(' ')}: ${result.stderr}`);
+    return result.stdout;
+}
+
+function best(rounds, body) {
+    let best = Infinity;
+    for (let round = 0; round !== rounds; ++round) {
+        const start = process.hrtime.bigint();
+        body();
+        best = Math.min(best, Number(process.hrtime.bigint() - start) / 1e6);
+    }
+    return best;
+}
+
+let failed = 0, expected;
+if (!check)
+    console.log(`${'target'.padEnd(8)} ${'bytes'.padStart(7)} ${'gzip'.padStart(6)} ${'compile'.padStart(8)} ${'parse'.padStart(7)} ${'run'.padStart(8)}`);
+
+for (const target of targets) {
+    const output = cylang(['--target', target, script]);
+    const run = vm.runInNewContext(output + '\nrun');
+    const actual = run(check ? 10 : 1000);
+
+    if (expected === undefined)
+        expected = actual;
+    else if (actual !== expected) {
+        console.error(`${target}: ${actual}, not ${expected}`);
+        ++failed;
+    }
+
+    if (check)
+        continue;
+
+    const report = JSON.parse(cylang(['--target', target, '-n', '50', '-j', '1', '--json', script]));
+    const compile = report.files[0].timesNs.total.median / 1e6;
+    const parse = best(7, () => new vm.Script(output, {filename: `${target}-${Math.random()}.js`}));
+    const time = best(7, () => run(1000));
+
+    const size = Buffer.byteLength(output);
+    const gzip = zlib.gzipSync(output).length;
+    console.log(`${target.padEnd(8)} ${String(size).padStart(7)} ${String(gzip).padStart(6)} ${compile.toFixed(3).padStart(8)} ${parse.toFixed(3).padStart(7)} ${time.toFixed(1).padStart(8)}`);
+}
+
+process.exitCode = failed === 0 ? 0 : 1;
@@ -0,0 +1,176 @@
+//
+//  LongBench.cpp
+//  libwidgetinfo
+//
+//  Replace and Output times at both levels on scripts that are one long list:
+//  statements at the top level, the properties of an object literal, the
+//  arguments of a call, the parts of a comma expression and the bindings of
+//  one var or let. Each script is then compiled again, at both levels, on a
+//  thread with a 512 KB stack, the size of an iOS secondary thread's; a walk
+//  that recurses once per item crashes it there.
+//
+//      long-bench [-n rounds] [--quick] [file...]
+//
+//  Without files it uses 100,000-item scripts from Scripts.hpp.
+//
+
+#include "Driver.hpp"
+#include "Syntax.hpp"
+
+#include "Scripts.hpp"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const size_t StackSize_(512 * 1024);
+
+struct Measure {
+    double replace;
+    double output;
+    size_t size;
+};
+
+double Milliseconds(std::chrono::steady_clock::time_point &start) {
+    std::chrono::steady_clock::time_point now(std::chrono::steady_clock::now());
+    double milliseconds(std::chrono::duration<double, std::milli>(now - start).count());
+    start = now;
+    return milliseconds;
+}
+
+bool Once(const std::string &code, CYLevel level, Measure &measure) {
+    CYPool pool;
+    std::istringstream stream(code);
+    CYDriver driver(pool, *stream.rdbuf());
+
+    if (driver.Parse() || !driver.errors_.empty() || driver.script_ == NULL)
+        return false;
+
+    CYOptions options;
+    options.level_ = level;
+    std::stringbuf str;
+    CYOutput out(str, options);
+
+    std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+    if (!driver.Replace(options))
+        return false;
+    measure.replace = Milliseconds(start);
+    out << *driver.script_;
+    measure.output = Milliseconds(start);
+    measure.size = str.str().size();
+    return true;
+}
+
+struct Small {
+    const std::string *code;
+    bool okay;
+};
+
+void *CompileSmall(void *arg) {
+    Small &small(*reinterpret_cast<Small *>(arg));
+    Measure measure;
+    small.okay = Once(*small.code, CYLevelES5, measure) && Once(*small.code, CYLevelES2015, measure);
+    return NULL;
+}
+
+// compiles code on a thread with a small stack; if anything recurses per item
+// this is where it crashes
+bool OnSmallStack(const std::string &code) {
+    Small small = {&code, false};
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, StackSize_);
+    pthread_t thread;
+    bool started(pthread_create(&thread, &attr, &CompileSmall, &small) == 0);
+    pthread_attr_destroy(&attr);
+    if (!started)
+        return false;
+    pthread_join(thread, NULL);
+    return small.okay;
+}
+
+bool Run(const char *name, const std::string &code, unsigned rounds) {
+    Measure best[2];
+    const CYLevel levels[2] = {CYLevelES5, CYLevelES2015};
+
+    for (unsigned level(0); level != 2; ++level)
+        for (unsigned round(0); round != rounds; ++round) {
+            Measure measure;
+            if (!Once(code, levels[level], measure)) {
+                fprintf(stderr, "%s: does not compile\n", name);
+                return false;
+            }
+            if (round == 0)
+                best[level] = measure;
+            else {
+                best[level].replace = std::min(best[level].replace, measure.replace);
+                best[level].output = std::min(best[level].output, measure.output);
+            }
+        }
+
+    if (!OnSmallStack(code)) {
+        fprintf(stderr, "%s: does not compile on a %zu KB stack\n", name, StackSize_ / 1024);
+        return false;
+    }
+
+    printf("%-16s %9zu %9.2f %9.2f %9.2f %9.2f %9s\n", name, code.size(),
+        best[0].replace, best[0].output, best[1].replace, best[1].output, "ok");
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    unsigned rounds(5);
+    bool quick(false);
+    std::vector<const char *> files;
+
+    for (int i(1); i != argc; ++i)
+        if (strcmp(argv[i], "-n") == 0 && i + 1 != argc)
+            rounds = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else
+            files.push_back(argv[i]);
+
+    if (quick)
+        rounds = 1;
+
+    printf("%-16s %9s %9s %9s %9s %9s %9s\n", "script", "bytes", "ES5 repl", "ES5 out",
+        "2015 repl", "2015 out", "512 KB");
+
+    bool okay(true);
+    if (files.empty()) {
+        unsigned count(quick ? 20000 : 100000);
+        std::pair<const char *, std::string> scripts[] = {
+            {"statements", FlatScript(count)},
+            {"object", ObjectScript(count)},
+            {"arguments", ArgumentsScript(count)},
+            {"comma", CommaScript(count)},
+            {"var", VarsScript(count)},
+            {"let", VarsScript(count, "let")},
+        };
+        for (const auto &script : scripts)
+            okay = Run(script.first, script.second, rounds) && okay;
+    } else
+        for (const char *file : files) {
+            std::string code;
+            if (!ReadScript(file, code)) {
+                fprintf(stderr, "%s: could not read\n", file);
+                okay = false;
+            } else
+                okay = Run(file, code, rounds) && okay;
+        }
+
+    return okay ? 0 : 1;
+}
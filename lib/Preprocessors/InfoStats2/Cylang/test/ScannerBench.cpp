@@ -0,0 +1,114 @@
+//
+//  ScannerBench.cpp
+//  libwidgetinfo
+//
+//  Tokens per second through the scanner alone, as Compile() counts them in
+//  CompileStats: the time inside cylex, not the parser's. Comparing scanners
+//  means building this against each of them, at the commits to compare, and
+//  running it on the same scripts.
+//
+//      scanner-bench [-n rounds] [--quick] [file...]
+//
+//  Without files it uses the generated scripts from Scripts.hpp, and one that
+//  is nearly all keywords and identifiers, which is what the scanner's
+//  classification of words has to keep up with.
+//
+
+#include "Compile.hpp"
+
+#include "Scripts.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Keywords, the contextual words and identifiers close to both
+std::string WordScript(unsigned count) {
+    std::string script;
+    char line[512];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line),
+            "function get%u(of, from, target) {\n"
+            "    var self = this, let%u = typeof of, instance = of instanceof Object;\n"
+            "    if (from in target && !instance) return void 0; else if (let%u === \"undefined\") throw null;\n"
+            "    do { switch (from) { case true: continue; default: break; } } while (false);\n"
+            "    try { return new target(this, of, from); } catch (error) { return eval; } finally { delete self.from; }\n"
+            "}\n", i, i, i);
+        script += line;
+    }
+    return script;
+}
+
+bool Run(const char *name, const std::string &code, unsigned rounds) {
+    CompileStats best;
+    for (unsigned round(0); round != rounds; ++round) {
+        CompileStats stats;
+        Compile(code, false, false, stats);
+        if (!stats.compiled) {
+            fprintf(stderr, "%s: does not compile\n", name);
+            return false;
+        }
+        if (stats.tokens == 0) {
+            fprintf(stderr, "%s: no tokens counted\n", name);
+            return false;
+        }
+        if (round == 0 || stats.scanTime < best.scanTime)
+            best = stats;
+    }
+
+    double seconds(std::max<uint64_t>(best.scanTime, 1) / 1e9);
+    printf("%-16s %9zu %9zu %9.2f %12.0f %9.1f\n", name, code.size(), best.tokens,
+        seconds * 1e3, best.tokens / seconds, code.size() / seconds / 1e6);
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    unsigned rounds(15);
+    bool quick(false);
+    std::vector<const char *> files;
+
+    for (int i(1); i != argc; ++i)
+        if (strcmp(argv[i], "-n") == 0 && i + 1 != argc)
+            rounds = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else
+            files.push_back(argv[i]);
+
+    if (quick)
+        rounds = 1;
+
+    printf("%-16s %9s %9s %9s %12s %9s\n", "script", "bytes", "tokens", "scan ms", "tokens/s", "MB/s");
+
+    bool okay(true);
+    if (files.empty()) {
+        unsigned scale(quick ? 1 : 20);
+        std::pair<const char *, std::string> scripts[] = {
+            {"words", WordScript(50 * scale)},
+            {"widgets", WidgetScript(50 * scale)},
+            {"functions", FunctionScript(50 * scale)},
+            {"flat", FlatScript(500 * scale)},
+        };
+        for (const auto &script : scripts)
+            okay = Run(script.first, script.second, rounds) && okay;
+    } else
+        for (const char *file : files) {
+            std::string code;
+            if (!ReadScript(file, code)) {
+                fprintf(stderr, "%s: could not read\n", file);
+                okay = false;
+            } else
+                okay = Run(file, code, rounds) && okay;
+        }
+
+    return okay ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+//
+//  Scripts.hpp
+//  libwidgetinfo
+//
+//  Generated scripts for the benchmarks in this directory, so that they have
+//  large inputs without a corpus checked in beside them. Each is the same few
+//  lines over and over, with the numbers changed so no two are alike.
+//
+
+#ifndef CYLANG_TEST_SCRIPTS_HPP
+#define CYLANG_TEST_SCRIPTS_HPP
+
+#include <stdio.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Classes with accessors, templates, arrows, for-of and a comprehension: the
+// shape of a widget's own code
+inline std::string WidgetScript(unsigned count) {
+    std::string script;
+    char line[512];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line),
+            "class Widget%u extends %s {\n"
+            "    constructor(items, scale) { super(); this.items = items; this.scale = scale; this.handlers = []; }\n"
+            "    get count() { return this.items.length; }\n"
+            "    set count(n) { this.items.length = n; }\n", i, i == 0 ? "Object" : ("Widget" + std::to_string(i - 1)).c_str());
+        script += line;
+        snprintf(line, sizeof(line),
+            "    render() {\n"
+            "        let out = [];\n"
+            "        for (let item of this.items) out.push(`<li>${item.name}: ${item.value * this.scale}</li>`);\n"
+            "        return `<ul class=\"w%u\">${out.join(\"\")}</ul>`;\n"
+            "    }\n", i);
+        script += line;
+        snprintf(line, sizeof(line),
+            "    bind(el) { this.handlers.push(() => this.render(el)); el.onclick = e => this.click(e); }\n"
+            "    click(e) { for (const h of this.handlers) h.call(this, e); return super.toString(); }\n"
+            "    static make(n) { return new Widget%u([for (x of n) ({name: x, value: x})], %u); }\n"
+            "}\n", i, i % 7 + 1);
+        script += line;
+    }
+    return script;
+}
+
+// One statement after another at the top level
+inline std::string FlatScript(unsigned count) {
+    std::string script;
+    char line[64];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line), "t[%u] = %u;\n", i, i * 7);
+        script += line;
+    }
+    return script;
+}
+
+// One var (or let) with many names, each of which the scope has to keep apart
+inline std::string VarsScript(unsigned count, const char *keyword = "var") {
+    std::string script(std::string(keyword) + " ");
+    char line[64];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line), "%sv%u = %u", i == 0 ? "" : ",", i, i);
+        script += line;
+    }
+    return script + ";\n";
+}
+
+// One object literal with many properties, as a widget's data table
+inline std::string ObjectScript(unsigned count) {
+    std::string script("var table = {");
+    char line[64];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line), "%s\n    k%u: %u", i == 0 ? "" : ",", i, i * 7);
+        script += line;
+    }
+    return script + "\n};\n";
+}
+
+// One call with many arguments
+inline std::string ArgumentsScript(unsigned count) {
+    std::string script("push(");
+    char line[64];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line), "%s%u", i == 0 ? "" : ", ", i);
+        script += line;
+    }
+    return script + ");\n";
+}
+
+// One comma expression with many parts
+inline std::string CommaScript(unsigned count) {
+    std::string script("x = (");
+    char line[64];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line), "%st[%u] = %u", i == 0 ? "" : ", ", i, i);
+        script += line;
+    }
+    return script + ");\n";
+}
+
+// Plain ES5 functions with locals, loops and string building, as older
+// widgets are written
+inline std::string FunctionScript(unsigned count) {
+    std::string script;
+    char line[512];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line),
+            "function update%u(list, label) {\n"
+            "    var total = 0, names = [], index;\n"
+            "    for (index = 0; index < list.length; ++index) {\n"
+            "        total += list[index].value * %u;\n"
+            "        names.push(label + \": \" + list[index].name);\n"
+            "    }\n"
+            "    return {total: total, text: names.join(\", \"), id: \"w%u\"};\n"
+            "}\n", i, i % 9 + 1, i);
+        script += line;
+    }
+    return script;
+}
+
+// Closures nested depth deep, each level with its own vars, lets and loop
+// bindings over the names of the levels around it: the scopes that renaming
+// has to order and fill
+inline void ClosureLevel(std::string &script, unsigned index, unsigned level, unsigned depth) {
+    std::string indent(level * 4 + 4, ' ');
+    char line[512];
+    snprintf(line, sizeof(line),
+        "%svar total%u = %u, names%u = [];\n"
+        "%slet scale%u = total%u * 2;\n"
+        "%sfor (let i = 0; i < 3; ++i) names%u.push(i + scale%u);\n", indent.c_str(), level, index,
+        level, indent.c_str(), level, level, indent.c_str(), level, level);
+    script += line;
+    if (level + 1 != depth) {
+        snprintf(line, sizeof(line), "%sfunction inner%u(value%u) {\n", indent.c_str(), level, level);
+        script += line;
+        ClosureLevel(script, index, level + 1, depth);
+        snprintf(line, sizeof(line), "%s}\n%stotal%u += inner%u(names%u.length);\n", indent.c_str(),
+            indent.c_str(), level, level, level);
+        script += line;
+    }
+    std::string outer(level == 0 ? "" : " + value" + std::to_string(level - 1) + " + total" + std::to_string(level - 1));
+    snprintf(line, sizeof(line), "%sreturn total%u + names%u.length%s;\n", indent.c_str(), level, level, outer.c_str());
+    script += line;
+}
+
+inline std::string ClosureScript(unsigned count, unsigned depth) {
+    std::string script;
+    char line[64];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line), "function outer%u() {\n", i);
+        script += line;
+        ClosureLevel(script, i, 0, depth);
+        script += "}\n";
+    }
+    return script;
+}
+
+// Message sends over about fifty selectors, none of them to an IS2 class, so
+// that each one stays a call to objc_msgSend with its selector as a string
+inline std::string SendScript(unsigned count) {
+    static const char *const selectors[] = {
+        "count", "reload", "currentTemperature", "objectAtIndex:%u", "setHidden:%u",
+        "setText:\"t%u\" forKey:key", "valueForKey:\"k%u\"", "addObject:%u",
+        "setWeatherUpdateTimeInterval:%u forRequester:\"w\"", "ramFree:%u inUnits:2",
+        "stringWithFormat:\"%%d\" arguments:%u", "initWithFrame:%u style:1 animated:true",
+        "updateSlot%u:1",
+    };
+    static const unsigned sends(sizeof(selectors) / sizeof(selectors[0]));
+
+    std::string script;
+    char send[128], line[256];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line), "function poll%u(view, source, key) {\n", i);
+        script += line;
+        for (unsigned j(0); j != 8; ++j) {
+            snprintf(send, sizeof(send), selectors[(i * 5 + j) % sends], i % 40);
+            snprintf(line, sizeof(line), "    [%s %s];\n", j % 2 == 0 ? "view" : "source", send);
+            script += line;
+        }
+        script += "}\n";
+    }
+    return script;
+}
+
+inline bool ReadScript(const char *path, std::string &script) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    std::stringstream data;
+    data << file.rdbuf();
+    if (file.fail() && !file.eof())
+        return false;
+    script = data.str();
+    return true;
+}
+
+#endif/*CYLANG_TEST_SCRIPTS_HPP*/
@@ -0,0 +1,129 @@
+//
+//  SelectorBench.cpp
+//  libwidgetinfo
+//
+//  Replace and Output times on scripts made of message sends, where the
+//  ObjectiveC replacer builds a selector string for every send. Every send in
+//  the output has to be a call to objc_msgSend whose selector has as many
+//  parts as the call has arguments after it.
+//
+//      selector-bench [-n rounds] [--quick] [file...]
+//
+//  Without files it uses SendScript from Scripts.hpp. Given files, it only
+//  times them.
+//
+
+#include "Compile.hpp"
+
+#include "Scripts.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Counts the sends in compact output, and the distinct selectors they use;
+// false if a selector doesn't match its arguments
+bool CountSends(const std::string &output, size_t &sends, size_t &selectors) {
+    static const std::string call("objc_msgSend(");
+    std::set<std::string> distinct;
+    sends = 0;
+
+    for (size_t at(output.find(call)); at != std::string::npos; at = output.find(call, at + 1)) {
+        size_t quote(output.find(",\"", at));
+        if (quote == std::string::npos)
+            return false;
+        size_t end(output.find('"', quote + 2));
+        if (end == std::string::npos)
+            return false;
+        std::string selector(output.substr(quote + 2, end - quote - 2));
+
+        // The generated arguments hold no commas or parentheses of their own
+        size_t close(output.find(')', end));
+        if (close == std::string::npos)
+            return false;
+        size_t colons(std::count(selector.begin(), selector.end(), ':'));
+        size_t arguments(std::count(output.begin() + end, output.begin() + close, ','));
+        if (colons != arguments)
+            return false;
+
+        distinct.insert(selector);
+        ++sends;
+    }
+
+    selectors = distinct.size();
+    return true;
+}
+
+bool Run(const char *name, const std::string &code, unsigned rounds, size_t expected) {
+    CompileStats best;
+    std::string output;
+    for (unsigned round(0); round != rounds; ++round) {
+        CompileStats stats;
+        output = Compile(code, false, false, stats);
+        if (!stats.compiled) {
+            fprintf(stderr, "%s: does not compile\n", name);
+            return false;
+        }
+        if (round == 0 || stats.replaceTime + stats.outputTime < best.replaceTime + best.outputTime)
+            best = stats;
+    }
+
+    size_t sends, selectors;
+    if (!CountSends(output, sends, selectors)) {
+        fprintf(stderr, "%s: a selector doesn't match the arguments sent with it\n", name);
+        return false;
+    }
+    if (expected != 0 && sends != expected) {
+        fprintf(stderr, "%s: %zu sends, not %zu\n", name, sends, expected);
+        return false;
+    }
+
+    printf("%-16s %9zu %8zu %9zu %9.2f %9.2f %9.3f\n", name, code.size(), sends, selectors,
+        best.replaceTime / 1e6, best.outputTime / 1e6, sends != 0 ? best.replaceTime / 1e3 / sends : 0.0);
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    unsigned rounds(30);
+    bool quick(false);
+    std::vector<const char *> files;
+
+    for (int i(1); i != argc; ++i)
+        if (strcmp(argv[i], "-n") == 0 && i + 1 != argc)
+            rounds = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else
+            files.push_back(argv[i]);
+
+    if (quick)
+        rounds = 1;
+
+    printf("%-16s %9s %8s %9s %9s %9s %9s\n", "script", "bytes", "sends", "selectors", "repl ms", "out ms", "us/send");
+
+    bool okay(true);
+    if (files.empty()) {
+        unsigned functions(quick ? 100 : 2500);
+        okay = Run("sends", SendScript(functions), rounds, functions * 8);
+    } else
+        for (const char *file : files) {
+            std::string code;
+            if (!ReadScript(file, code)) {
+                fprintf(stderr, "%s: could not read\n", file);
+                okay = false;
+            } else
+                okay = Run(file, code, rounds, 0) && okay;
+        }
+
+    return okay ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+//
+//  StringifyDifferential.cpp
+//  libwidgetinfo
+//
+//  CYStringify against the byte-at-a-time version it replaced, kept here as it
+//  was, on random literals in all three modes. The inputs lean on whatever the
+//  word-at-a-time scan treats specially: quotes and backslashes, control bytes,
+//  NULs before digits, newlines enough to split a Cycript literal, and valid,
+//  overlong and truncated UTF-8, at lengths either side of a word.
+//
+
+#include "Syntax.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+const unsigned kIterations = 400000;
+
+// CYStringify as it was before it worked a word at a time
+enum CYStringType {
+    CYStringTypeSingle,
+    CYStringTypeDouble,
+    CYStringTypeTemplate,
+};
+
+void CYStringifyReference(std::ostringstream &str, const char *data, size_t size, CYStringifyMode mode) {
+    if (size == 0) {
+        str << "\"\"";
+        return;
+    }
+
+    unsigned quot(0), apos(0), tick(0), line(0);
+    for (const char *value(data), *end(data + size); value != end; ++value)
+        switch (*value) {
+            case '"': ++quot; break;
+            case '\'': ++apos; break;
+            case '`': ++tick; break;
+            case '$': ++tick; break;
+            case '\n': ++line; break;
+        }
+
+    bool split;
+    if (mode != CYStringifyModeCycript)
+        split = false;
+    else {
+        double ratio(double(line) / size);
+        split = size > 10 && line > 2 && ratio > 0.005 && ratio < 0.10;
+    }
+
+    CYStringType type;
+    if (mode == CYStringifyModeNative)
+        type = CYStringTypeDouble;
+    else if (split)
+        type = CYStringTypeTemplate;
+    else if (quot > apos)
+        type = CYStringTypeSingle;
+    else
+        type = CYStringTypeDouble;
+
+    bool parens(split && mode != CYStringifyModeNative && type != CYStringTypeTemplate);
+    if (parens)
+        str << '(';
+
+    char border;
+    switch (type) {
+        case CYStringTypeSingle: border = '\''; break;
+        case CYStringTypeDouble: border = '"'; break;
+        case CYStringTypeTemplate: border = '`'; break;
+    }
+
+    str << border;
+
+    bool space(false);
+
+    for (const char *value(data), *end(data + size); value != end; ++value)
+        if (*value == ' ') {
+            space = true;
+            str << ' ';
+        } else { switch (uint8_t next = *value) {
+            case '\\': str << "\\\\"; break;
+            case '\b': str << "\\b"; break;
+            case '\f': str << "\\f"; break;
+            case '\r': str << "\\r"; break;
+            case '\t': str << "\\t"; break;
+            case '\v': str << "\\v"; break;
+
+            case '\a':
+                if (mode == CYStringifyModeNative)
+                    str << "\\a";
+                else goto simple;
+            break;
+
+            case '\n':
+                if (!split)
+                    str << "\\n";
+                /*else if (mode == CYStringifyModeNative)
+                    str << border << "\\\n" << border;*/
+                else if (type != CYStringTypeTemplate)
+                    str << border << '+' << border;
+                else if (!space)
+                    str << '\n';
+                else
+                    str << "\\n\\\n";
+            break;
+
+            case '$':
+                if (type == CYStringTypeTemplate)
+                    str << "\\$";
+                else goto simple;
+            break;
+
+            case '`':
+                if (type == CYStringTypeTemplate)
+                    str << "\\`";
+                else goto simple;
+            break;
+
+            case '"':
+                if (type == CYStringTypeDouble)
+                    str << "\\\"";
+                else goto simple;
+            break;
+
+            case '\'':
+                if (type == CYStringTypeSingle)
+                    str << "\\'";
+                else goto simple;
+            break;
+
+            case '\0':
+                if (mode != CYStringifyModeNative && value[1] >= '0' && value[1] <= '9')
+                    str << "\\x00";
+                else
+                    str << "\\0";
+            break;
+
+            default:
+                if (next >= 0x20 && next < 0x7f) simple:
+                    str << *value;
+                else if (mode == CYStringifyModeNative)
+                    str << "\\x" << std::setbase(16) << std::setw(2) << std::setfill('0') << unsigned(*value & 0xff);
+                else {
+                    unsigned levels(1);
+                    if ((next & 0x80) != 0)
+                        while ((next & 0x80 >> ++levels) != 0);
+
+                    unsigned point(next & 0xff >> levels);
+                    while (--levels != 0)
+                        point = point << 6 | (uint8_t(*++value) & 0x3f);
+
+                    if (point < 0x100)
+                        str << "\\x" << std::setbase(16) << std::setw(2) << std::setfill('0') << point;
+                    else if (point < 0x10000)
+                        str << "\\u" << std::setbase(16) << std::setw(4) << std::setfill('0') << point;
+                    else {
+                        point -= 0x10000;
+                        str << "\\u" << std::setbase(16) << std::setw(4) << std::setfill('0') << (0xd800 | point >> 0x0a);
+                        str << "\\u" << std::setbase(16) << std::setw(4) << std::setfill('0') << (0xdc00 | (point & 0x3ff));
+                    }
+                }
+        } space = false; }
+
+    str << border;
+
+    if (parens)
+        str << ')';
+}
+
+// The old code decoded a truncated UTF-8 sequence at the end of a literal by
+// reading on past it, so there is nothing to compare against there
+bool Overruns(const std::string &data, CYStringifyMode mode) {
+    if (mode == CYStringifyModeNative)
+        return false;
+    for (size_t i = 0; i < data.size(); ++i) {
+        uint8_t next(data[i]);
+        if (next < 0x80)
+            continue;
+        unsigned levels(1);
+        while ((next & 0x80 >> ++levels) != 0);
+        if (i + levels - 1 >= data.size())
+            return true;
+        i += levels - 1;
+    }
+    return false;
+}
+
+const char kAlphabet[] = " \"'`$\\\n\r\t\b\f\v\a" "\0" "0123456789abcXYZ<>{}\x7f";
+const char *const kSequences[] = {"\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80", "\xff", "\xc0\x80", "\xe2\x82"};
+
+std::string Literal(std::mt19937_64 &random, unsigned iteration) {
+    // Mostly short, as most literals are, with some long enough to split
+    size_t size(random() % (iteration % 100 == 0 ? 300 : 40));
+    unsigned style(random() % 4);
+
+    std::string data;
+    while (data.size() < size) {
+        uint64_t choice(random());
+        if (style == 0)
+            data += char(choice);
+        else if (style == 1 || choice % 5 != 0)
+            data += kAlphabet[(choice >> 8) % (sizeof(kAlphabet) - 1)];
+        else
+            data += kSequences[(choice >> 8) % (sizeof(kSequences) / sizeof(kSequences[0]))];
+    }
+
+    data.resize(size);
+    return data;
+}
+
+}
+
+int main(int argc, const char *argv[]) {
+    std::mt19937_64 random(argc > 1 ? strtoull(argv[1], NULL, 0) : 1);
+
+    unsigned compared(0), wrong(0);
+    for (unsigned iteration = 0; iteration != kIterations; ++iteration) {
+        std::string data(Literal(random, iteration));
+        CYStringifyMode mode(CYStringifyMode(random() % 3));
+
+        // The new code still has to cope, and stay inside the literal
+        std::string output;
+        CYStringify(output, data.data(), data.size(), mode);
+        if (Overruns(data, mode))
+            continue;
+
+        // std::string's terminating NUL stands in for the one after a pooled
+        // string, which the old code looked at after a NUL of its own
+        std::ostringstream reference;
+        CYStringifyReference(reference, data.data(), data.size(), mode);
+        ++compared;
+
+        if (output != reference.str() && ++wrong <= 5)
+            fprintf(stderr, "mode %d, %zu bytes:\n  old %s\n  new %s\n", mode, data.size(), reference.str().c_str(), output.c_str());
+    }
+
+    printf("%u of %u literals differ\n", wrong, compared);
+    return wrong == 0 ? 0 : 1;
+}
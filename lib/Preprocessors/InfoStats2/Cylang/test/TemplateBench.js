@@ -0,0 +1,125 @@
+//
+//  TemplateBench.js
+//  libwidgetinfo
+//
+//  Compiles TemplateBench.cy with cylangc and times each template in three
+//  shapes: plus is the + chain the ES5 target lowers templates to, native is
+//  the template the ES2015 target leaves alone, and concat is the
+//  String.prototype.concat.apply("", [...]) that templates were lowered to
+//  before, rebuilt here from the native output. Every shape has to give what
+//  the template itself does, for numbers, -0, objects with their own valueOf
+//  and toString, null and undefined.
+//
+//      node test/TemplateBench.js <cylangc>             best of 7, in ns per evaluation
+//      node --jitless test/TemplateBench.js <cylangc>   the same without the JIT
+//      node test/TemplateBench.js <cylangc> --check     only that the shapes agree
+//
+
+'use strict';
+
+const child = require('child_process');
+const path = require('path');
+const vm = require('vm');
+
+const cylangc = process.argv[2];
+const check = process.argv.includes('--check');
+if (cylangc === undefined) {
+    console.error('usage: node TemplateBench.js <cylangc> [--check]');
+    process.exit(2);
+}
+
+const script = path.join(__dirname, 'TemplateBench.cy');
+const names = ['degrees', 'clock', 'weather', 'label'];
+
+function cylang(target) {
+    const result = child.spawnSync(cylangc, ['--target', target, script], {encoding: 'utf8'});
+    if (result.status !== 0)
+        throw new Error(`cylangc --target ${target}: ${result.stderr}`);
+    return result.stdout;
+}
+
+// Each template literal in the output as the concat.apply it used to be; the
+// substitutions here hold no templates or braces of their own, and the text
+// between them is escaped as a string literal would be, but for its quotes
+function concat(code) {
+    const text = raw => raw.length === 0 ? [] : [`"${raw.replace(/"/g, '\\"')}"`];
+    return code.replace(/`((?:[^`\\]|\\.)*)`/g, (_, body) => {
+        const parts = [];
+        let at = 0;
+        for (let start; (start = body.indexOf('${', at)) !== -1;) {
+            parts.push(...text(body.slice(at, start)));
+            const end = body.indexOf('}', start);
+            parts.push(body.slice(start + 2, end));
+            at = end + 1;
+        }
+        parts.push(...text(body.slice(at)));
+        return ` String.prototype.concat.apply("", [${parts.join(', ')}])`;
+    });
+}
+
+function load(code) {
+    return vm.runInThisContext(`(function () {\n${code}\nreturn {${names.join(', ')}};\n})()`);
+}
+
+const native = cylang('es2015');
+const shapes = {
+    plus: load(cylang('es5')),
+    native: load(native),
+    concat: load(concat(native)),
+};
+
+const both = {valueOf() { return 1; }, toString() { return 'string'; }};
+const checked = {
+    degrees: [[21], [-0], [0.1], [1e21], [both], [null], [undefined], ['x']],
+    clock: [[9, 5], [12, 30], [both, both]],
+    weather: [['Paris', 290.5, 'C'], [both, both, both]],
+    label: [[{kind: 'day', name: 'Mon', count: 3}], [{kind: both, name: null, count: both}]],
+};
+
+// What the templates give, written out
+const expected = {
+    degrees: temp => `${temp}\xb0`,
+    clock: (h, m) => `${h}:${m < 10 ? '0' : ''}${m}`,
+    weather: (city, temp, unit) => `${city}: ${temp - 273}\xb0${unit}`,
+    label: item => `<li class="${item.kind}">${item.name} ${item.count * 2}</li>`,
+};
+
+let failed = 0;
+for (const [shape, functions] of Object.entries(shapes))
+    for (const name of names)
+        for (const args of checked[name]) {
+            const actual = functions[name](...args), wanted = expected[name](...args);
+            if (actual !== wanted) {
+                console.error(`${shape} ${name}: ${JSON.stringify(actual)}, not ${JSON.stringify(wanted)}`);
+                ++failed;
+            }
+        }
+
+if (!check) {
+    const timed = {
+        degrees: [21],
+        clock: [9, 5],
+        weather: ['Paris', 290.5, 'C'],
+        label: [{kind: 'day', name: 'Mon', count: 3}],
+    };
+
+    const n = 1000000;
+    console.log(`${'template'.padEnd(10)} ${Object.keys(shapes).map(shape => shape.padStart(8)).join(' ')}`);
+    for (const name of names) {
+        const times = [];
+        for (const functions of Object.values(shapes)) {
+            const run = functions[name], args = timed[name];
+            let best = Infinity, length = 0;
+            for (let round = 0; round !== 7; ++round) {
+                const start = process.hrtime.bigint();
+                for (let i = 0; i !== n; ++i)
+                    length += run(...args).length;
+                best = Math.min(best, Number(process.hrtime.bigint() - start));
+            }
+            times.push((best / n).toFixed(1).padStart(8));
+        }
+        console.log(`${name.padEnd(10)} ${times.join(' ')}`);
+    }
+}
+
+process.exitCode = failed === 0 ? 0 : 1;
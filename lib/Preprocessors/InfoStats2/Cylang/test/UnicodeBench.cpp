@@ -0,0 +1,209 @@
+//
+//  UnicodeBench.cpp
+//  libwidgetinfo
+//
+//  The identifier classification the scanner does for \u escapes in names, on
+//  runs of code points that are mostly CJK and emoji and on plain ASCII; then
+//  tokens per second through the scanner on widget scripts whose comments,
+//  strings and names are CJK and emoji. Every ID_Start code point has to be
+//  ID_Continue as well, and a handful of known ones have to classify as they
+//  should.
+//
+//      unicode-bench [-n rounds] [--quick] [file...]
+//
+//  Given files, it only scans them.
+//
+
+#include "Compile.hpp"
+
+#include "Scripts.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Defined by the scanner, from IdentifierStart.h and IdentifierContinue.h
+bool IsIdentifierStart(unsigned v);
+bool IsIdentifierContinue(unsigned v);
+
+namespace {
+
+struct Known {
+    unsigned point;
+    bool start;
+    bool part;
+};
+
+const Known Knowns_[] = {
+    {'a', true, true}, {'Z', true, true}, {'$', true, true}, {'_', true, true},
+    {'0', false, true}, {'-', false, false}, {' ', false, false}, {0x7F, false, false},
+    {0xAA, true, true}, {0xB7, false, true}, {0xD7, false, false}, {0xE9, true, true},
+    {0x0301, false, true}, {0x200C, true, true}, {0x200D, true, true}, {0x2028, false, false},
+    {0x3042, true, true}, {0x4E00, true, true}, {0x5929, true, true}, {0x3000, false, false},
+    {0xAC00, true, true}, {0xFF10, false, true}, {0x1F600, false, false}, {0x1F324, false, false},
+    {0x20000, true, true}, {0x2FA1D, true, true}, {0x2FB00, false, false}, {0x10FFFF, false, false},
+};
+
+bool Check() {
+    bool okay(true);
+    for (const Known &known : Knowns_)
+        if (IsIdentifierStart(known.point) != known.start || IsIdentifierContinue(known.point) != known.part) {
+            fprintf(stderr, "U+%04X classifies as %d/%d, not %d/%d\n", known.point,
+                IsIdentifierStart(known.point), IsIdentifierContinue(known.point), known.start, known.part);
+            okay = false;
+        }
+
+    for (unsigned point(0); point != 0x110000; ++point)
+        if (IsIdentifierStart(point) && !IsIdentifierContinue(point)) {
+            fprintf(stderr, "U+%04X is ID_Start but not ID_Continue\n", point);
+            okay = false;
+        }
+    return okay;
+}
+
+uint32_t random_(2463534242u);
+
+unsigned Random(unsigned bound) {
+    random_ ^= random_ << 13;
+    random_ ^= random_ >> 17;
+    random_ ^= random_ << 5;
+    return random_ % bound;
+}
+
+// Kana, kanji, hangul, emoji and some Latin-1, as a widget's names and text
+std::vector<unsigned> MixedPoints(size_t count) {
+    static const unsigned ranges[][2] = {
+        {0x3040, 0x30FF}, {0x4E00, 0x9FFF}, {0xAC00, 0xD7A3}, {0x1F300, 0x1FAFF}, {0xC0, 0xFF}, {'a', 'z'},
+    };
+    std::vector<unsigned> points(count);
+    for (unsigned &point : points) {
+        const unsigned *range(ranges[Random(sizeof(ranges) / sizeof(ranges[0]))]);
+        point = range[0] + Random(range[1] - range[0] + 1);
+    }
+    return points;
+}
+
+std::vector<unsigned> AsciiPoints(size_t count) {
+    std::vector<unsigned> points(count);
+    for (unsigned &point : points)
+        point = 0x20 + Random(0x5F);
+    return points;
+}
+
+double Classify(const std::vector<unsigned> &points, unsigned rounds, size_t &found) {
+    double best(0);
+    for (unsigned round(0); round != rounds; ++round) {
+        std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+        size_t count(0);
+        for (unsigned point : points)
+            count += IsIdentifierStart(point) + IsIdentifierContinue(point);
+        double time(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        best = round == 0 || time < best ? time : best;
+        found = count;
+    }
+    return best;
+}
+
+// A widget written in Japanese: comments and strings throughout, names in
+// kanji, and the same names again spelled with \u escapes
+std::string UnicodeScript(unsigned count) {
+    std::string script;
+    char line[1024];
+    for (unsigned i(0); i != count; ++i) {
+        snprintf(line, sizeof(line),
+            "// 天気ウィジェット %u: 現在の気温と予報を表示します 🌤️☔️\n"
+            "function 天気%u(予報, 単位) {\n"
+            "    /* 最高気温と最低気温 📈📉 */\n"
+            "    var 合計 = 0, 名前 = [];\n"
+            "    for (var i = 0; i < 予報.length; ++i) {\n"
+            "        \\u5408\\u8a08 += 予報[i].気温; // 合計に足す ➕\n"
+            "        \\u540d\\u524d.push(\"日\" + i + \": \" + 予報[i].天気 + \" ☀️🌙\");\n"
+            "    }\n"
+            "    return {合計: 合計, 表示: 名前.join(\"、\") + 単位 + \"°\"};\n"
+            "}\n", i, i);
+        script += line;
+    }
+    return script;
+}
+
+bool Scan(const char *name, const std::string &code, unsigned rounds) {
+    CompileStats best;
+    for (unsigned round(0); round != rounds; ++round) {
+        CompileStats stats;
+        Compile(code, false, false, stats);
+        if (!stats.compiled) {
+            fprintf(stderr, "%s: does not compile\n", name);
+            return false;
+        }
+        if (round == 0 || stats.scanTime < best.scanTime)
+            best = stats;
+    }
+
+    double seconds(std::max<uint64_t>(best.scanTime, 1) / 1e9);
+    printf("%-16s %9zu %9zu %9.2f %12.0f %9.1f\n", name, code.size(), best.tokens,
+        seconds * 1e3, best.tokens / seconds, code.size() / seconds / 1e6);
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+    unsigned rounds(20);
+    bool quick(false);
+    std::vector<const char *> files;
+
+    for (int i(1); i != argc; ++i)
+        if (strcmp(argv[i], "-n") == 0 && i + 1 != argc)
+            rounds = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else
+            files.push_back(argv[i]);
+
+    if (quick)
+        rounds = 1;
+
+    bool okay(Check());
+
+    if (files.empty()) {
+        size_t count(quick ? 10000 : 1000000);
+        std::pair<const char *, std::vector<unsigned>> runs[] = {
+            {"cjk/emoji", MixedPoints(count)},
+            {"ascii", AsciiPoints(count)},
+        };
+        printf("%-16s %9s %9s %9s %9s\n", "code points", "count", "found", "ms", "ns/point");
+        for (const auto &run : runs) {
+            size_t found;
+            double time(Classify(run.second, rounds, found));
+            printf("%-16s %9zu %9zu %9.2f %9.2f\n", run.first, run.second.size(), found, time, time * 1e6 / run.second.size());
+        }
+        printf("\n");
+    }
+
+    printf("%-16s %9s %9s %9s %12s %9s\n", "script", "bytes", "tokens", "scan ms", "tokens/s", "MB/s");
+    if (files.empty()) {
+        unsigned scale(quick ? 1 : 20);
+        std::pair<const char *, std::string> scripts[] = {
+            {"japanese", UnicodeScript(50 * scale)},
+            {"functions", FunctionScript(50 * scale)},
+        };
+        for (const auto &script : scripts)
+            okay = Scan(script.first, script.second, rounds) && okay;
+    } else
+        for (const char *file : files) {
+            std::string code;
+            if (!ReadScript(file, code)) {
+                fprintf(stderr, "%s: could not read\n", file);
+                okay = false;
+            } else
+                okay = Scan(file, code, rounds) && okay;
+        }
+
+    return okay ? 0 : 1;
+}
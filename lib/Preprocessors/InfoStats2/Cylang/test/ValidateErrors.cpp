@@ -0,0 +1,88 @@
+//
+//  ValidateErrors.cpp
+//  libwidgetinfo
+//
+//  Validate() has to put each error where it is in the script, whether the
+//  parser found it or Replace did, and has to agree with Compile() on which
+//  scripts fail at all.
+//
+
+#include "Compile.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Case {
+    const char *code;
+    // Of the first error, counting columns from zero; zero lines for none
+    unsigned line;
+    unsigned column;
+    const char *message;
+};
+
+const Case kCases[] = {
+    {"var a = 1;\nfunction f() { return a; }\n", 0, 0, NULL},
+    {"function f(a) {\n  let b = 1;\n    let  b = 2;\n}\n", 3, 9, "duplicate declaration of b"},
+    {"{ const c = 1; class c {} }", 1, 21, "duplicate declaration of c"},
+    {"for (;;) {\n\n  let d; var d;\n}", 3, 13, "duplicate declaration of d"},
+    {"var e = ;", 1, 8, NULL},
+    {"if (x) {\n  y(\n}", 3, 0, NULL},
+};
+
+bool Check(const Case &test) {
+    std::vector<CompileError> errors;
+    bool valid(Validate(test.code, false, errors));
+    bool compiled(!Compile(test.code, false, false).empty());
+
+    if (valid != compiled) {
+        fprintf(stderr, "%s: Validate() says %d, Compile() says %d\n", test.code, valid, compiled);
+        return false;
+    }
+
+    if (test.line == 0) {
+        if (!valid || !errors.empty()) {
+            fprintf(stderr, "%s: should be valid\n", test.code);
+            return false;
+        }
+        return true;
+    }
+
+    if (valid || errors.empty()) {
+        fprintf(stderr, "%s: should have failed\n", test.code);
+        return false;
+    }
+
+    const CompileError &error(errors[0]);
+    if (error.line != test.line || error.column != test.column || error.endLine < error.line) {
+        fprintf(stderr, "%s: error at %u:%u-%u:%u, not %u:%u\n", test.code, error.line, error.column, error.endLine, error.endColumn, test.line, test.column);
+        return false;
+    }
+
+    if (test.message != NULL && error.message != test.message) {
+        fprintf(stderr, "%s: \"%s\", not \"%s\"\n", test.code, error.message.c_str(), test.message);
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+int main() {
+    // Compile() reports on stdout as it goes, which is noise here
+    if (freopen("/dev/null", "w", stdout) == NULL)
+        return 1;
+
+    unsigned failed(0);
+    for (const Case &test : kCases)
+        if (!Check(test))
+            ++failed;
+
+    fprintf(stderr, "%u of %zu cases failed\n", failed, sizeof(kCases) / sizeof(kCases[0]));
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+//
+//  WideScope.js
+//  libwidgetinfo
+//
+//  Compiles a function with more locals than there are one-letter short
+//  names, and enough that the two-letter ones run through in, if and do, at
+//  each --target. Every output has to get through node --check, and the
+//  function has to return the same sum when it runs.
+//
+//      node test/WideScope.js <cylangc>
+//
+
+'use strict';
+
+const child = require('child_process');
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const vm = require('vm');
+
+const cylangc = process.argv[2];
+if (cylangc === undefined) {
+    console.error('usage: node WideScope.js <cylangc>');
+    process.exit(2);
+}
+
+const count = 800;
+const names = Array.from({length: count}, (_, i) => `local${i}`);
+const script = [
+    'function wide(seed) {',
+    `    var ${names.map((name, i) => `${name} = seed + ${i}`).join(', ')};`,
+    `    return ${names.join(' + ')};`,
+    '}',
+    '',
+].join('\n');
+const expected = Array.from({length: count}, (_, i) => 1 + i).reduce((sum, value) => sum + value);
+
+const directory = fs.mkdtempSync(path.join(os.tmpdir(), 'wide-scope-'));
+let failed = 0;
+try {
+    const source = path.join(directory, 'wide.cy');
+    fs.writeFileSync(source, script);
+
+    for (const target of ['es5', 'es2015']) {
+        const compiled = child.spawnSync(cylangc, ['--target', target, source], {encoding: 'utf8'});
+        if (compiled.status !== 0) {
+            console.error(`cylangc --target ${target}: ${compiled.stderr}`);
+            ++failed;
+            continue;
+        }
+
+        const output = path.join(directory, `wide.${target}.js`);
+        fs.writeFileSync(output, compiled.stdout);
+        const checked = child.spawnSync(process.execPath, ['--check', output], {encoding: 'utf8'});
+        if (checked.status !== 0) {
+            const error = checked.stderr.split('\n').find(line => /Error/.test(line));
+            console.error(`${target}: node --check failed: ${error}`);
+            ++failed;
+            continue;
+        }
+
+        const sum = vm.runInThisContext(`(function () {\n${compiled.stdout}\nreturn wide;\n})()`)(1);
+        if (sum !== expected) {
+            console.error(`${target}: ${sum}, not ${expected}`);
+            ++failed;
+        }
+    }
+} finally {
+    fs.rmSync(directory, {recursive: true, force: true});
+}
+
+process.exitCode = failed === 0 ? 0 : 1;
@@ -14,15 +14,51 @@
 **/
 
 #import "IS2PreProcessor.h"
+#import <ObjectiveGumbo/ObjectiveGumbo.h>
 #include "Compile.hpp"
+#include "CompileCache.hpp"
+
+#define CACHE_DIRECTORY @"/var/mobile/Library/Caches/com.matchstic.xenhtml"
 
 @interface IS2PreProcessor ()
 @end
 
 @implementation IS2PreProcessor
 
++ (CompileCache*)compileCache {
+    static CompileCache *cache = NULL;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        [[NSFileManager defaultManager] createDirectoryAtPath:CACHE_DIRECTORY
+                                  withIntermediateDirectories:YES
+                                                   attributes:nil
+                                                        error:nil];
+        
+        NSString *path = [CACHE_DIRECTORY stringByAppendingPathComponent:@"cylang.cache"];
+        cache = new CompileCache([path cStringUsingEncoding:NSUTF8StringEncoding]);
+    });
+    
+    return cache;
+}
+
 - (BOOL)needsPreprocessing:(NSString*)html {
-    return [html rangeOfString:@"text/cycript"].location != NSNotFound;
+    // Most widgets never mention Cycript, so skip tokenizing those
+    if ([html rangeOfString:@"text/cycript"].location == NSNotFound)
+        return NO;
+    
+    // Otherwise only a script element of that type needs the full parse; the text can be anywhere else
+    NSData *data = [html dataUsingEncoding:NSUTF8StringEncoding];
+    GumboScriptList *list = gumbo_locate_scripts(&kGumboDefaultOptions, (const char*)data.bytes, data.length);
+    
+    BOOL hasCycript = NO;
+    for (unsigned int i = 0; i < list->scripts.length && !hasCycript; i++) {
+        GumboScript *script = (GumboScript*)list->scripts.data[i];
+        GumboAttribute *type = gumbo_get_attribute(&script->attributes, "type");
+        hasCycript = type != NULL && strcmp(type->value, "text/cycript") == 0;
+    }
+    
+    gumbo_destroy_script_list(list);
+    return hasCycript;
 }
 
 - (NSString*)parseScriptNodeContents:(NSString*)contents withAttributes:(NSDictionary*)attributes {
@@ -35,11 +71,15 @@
     
     if (!isCycriptType) return contents;
     
-    // Compile cycript to ES5
-    std::string result = Compile([contents cStringUsingEncoding:NSUTF8StringEncoding], false, false);
+    // Compile cycript to ES5, re-using output from any process that has already seen this script
+    std::string code = [contents cStringUsingEncoding:NSUTF8StringEncoding];
+    CompileCache *cache = [IS2PreProcessor compileCache];
+    
+    std::string result = cache->IsOpen() ? CompileCached(*cache, code, false, false) : Compile(code, false, false);
     NSString *output = [NSString stringWithUTF8String:result.c_str()];
     
-    // Sort out objc_msgSend
+    // Sort out objc_msgSend; this also routes objc_msgSend_dispatch, which the compiler emits for
+    // sends to IS2 classes, to the middleware's dispatch table
     output = [output stringByReplacingOccurrencesOfString:@"objc_msgSend" withString:@"api._middleware.infostats2.objc_msgSend"];
     // output = [self replacingString:output withPattern:@"new Type\\(\"[a-z]+\"\\).blockWith\\(\\)\\(([\\S\\s]+)\\)\\)" withTemplate:@"$1)" error:nil];
     